@@ -43,6 +43,8 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <string.h>
+
 #include <Plat4m_Core/AllocationMemory.h>
 #include <Plat4m_Core/Plat4m.h>
 
@@ -104,6 +106,17 @@ size_t AllocationMemory::getFreeMemorySize()
     return (myCurrentDriver->driverGetFreeMemorySize());
 }
 
+//------------------------------------------------------------------------------
+AllocationMemory::Stats AllocationMemory::getStats()
+{
+    Stats stats;
+    memset(&stats, 0, sizeof(stats));
+
+    myCurrentDriver->driverGetStats(stats);
+
+    return stats;
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
@@ -141,3 +154,14 @@ AllocationMemory::~AllocationMemory()
         myCurrentDriver = 0;
     }
 }
+
+//------------------------------------------------------------------------------
+// Private virtual methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void AllocationMemory::driverGetStats(Stats& stats)
+{
+    // Drivers that don't keep statistics only know how much memory is left
+    stats.freeMemorySize = driverGetFreeMemorySize();
+}
@@ -65,6 +65,21 @@ class AllocationMemory : public Module
 {
 public:
 
+    //--------------------------------------------------------------------------
+    // Public structures
+    //--------------------------------------------------------------------------
+
+    struct Stats
+    {
+        size_t totalMemorySize;
+        size_t usedMemorySize;
+        size_t freeMemorySize;
+        size_t highWaterMarkMemorySize;
+
+        /// Free memory that can only be reused for some allocation sizes
+        size_t fragmentedMemorySize;
+    };
+
     //--------------------------------------------------------------------------
     // Public static methods
     //--------------------------------------------------------------------------
@@ -79,6 +94,8 @@ public:
 
     static size_t getFreeMemorySize();
 
+    static Stats getStats();
+
 protected:
 
     //--------------------------------------------------------------------------
@@ -118,6 +135,12 @@ private:
     virtual void driverDeallocateArray(void* pointer) = 0;
 
     virtual size_t driverGetFreeMemorySize() = 0;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods
+    //--------------------------------------------------------------------------
+
+    virtual void driverGetStats(Stats& stats);
 };
 
 }; // namespace Plat4m
@@ -162,6 +162,17 @@ private:
     {
         return (N - myMemoryIndex);
     }
+
+    //--------------------------------------------------------------------------
+    virtual void driverGetStats(Stats& stats) override
+    {
+        // Nothing is ever freed, so usage only grows
+        stats.totalMemorySize         = N;
+        stats.usedMemorySize          = myMemoryIndex;
+        stats.freeMemorySize          = N - myMemoryIndex;
+        stats.highWaterMarkMemorySize = myMemoryIndex;
+        stats.fragmentedMemorySize    = 0;
+    }
 };
 
 }; // namespace Plat4m
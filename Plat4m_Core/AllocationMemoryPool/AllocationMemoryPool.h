@@ -0,0 +1,854 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file AllocationMemoryPool.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief AllocationMemoryPool class header file.
+///
+
+#ifndef PLAT4M_ALLOCATION_MEMORY_POOL_H
+#define PLAT4M_ALLOCATION_MEMORY_POOL_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/AllocationMemory.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+/// Per-thread free block caches, the shared free lists are then also guarded
+/// by a mutex. Without it the pool is no more thread safe than
+/// AllocationMemoryLite.
+#ifndef PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+#if defined(__linux__)
+#define PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED 1
+#else
+#define PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED 0
+#endif
+#endif
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+#include <atomic>
+#include <mutex>
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Allocation memory that hands out blocks from fixed size classes
+/// (16 to 512 bytes) and, unlike AllocationMemoryLite, reuses them once they
+/// are deallocated. Memory is split into pages of PageSize bytes that are
+/// claimed from the bottom of the arena by one size class at a time, so the
+/// class of any block is found from its address and both allocation and
+/// deallocation are O(1) pops/pushes on intrusive free lists. Blocks larger
+/// than the biggest class are bump allocated from the top of the arena like
+/// AllocationMemoryLite and are never reused.
+///
+template <unsigned int N, unsigned int PageSize = 1024>
+class AllocationMemoryPool : public AllocationMemory
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public structures
+    //--------------------------------------------------------------------------
+
+    struct ClassStats
+    {
+        size_t blockSize;
+        uint32_t nPages;
+        uint32_t nBlocks;
+        uint32_t nFreeBlocks;
+        uint32_t nUsedBlocks;
+        uint32_t nUsedBlocksHighWaterMark;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    AllocationMemoryPool() :
+        AllocationMemory(),
+        myNClaimedPages(0),
+        myLargeMemorySize(0),
+        myUsedMemorySize(0),
+        myHighWaterMarkMemorySize(0),
+        myIsLocked(false)
+    {
+        memset(myClasses, 0, sizeof(myClasses));
+        memset(myPageClassIndexes, 0, sizeof(myPageClassIndexes));
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+        myIsThreadCacheEnabled = true;
+        mySerial = createSerial();
+        registerPool(this, mySerial);
+
+#endif
+    }
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual ~AllocationMemoryPool()
+    {
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+        // Blocks still cached by threads are dropped along with the pool
+        registerPool(0, mySerial);
+
+#endif
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    void setLocked(const bool locked)
+    {
+        myIsLocked = locked;
+    }
+
+    //--------------------------------------------------------------------------
+    uint32_t getNClasses() const
+    {
+        return myNClasses;
+    }
+
+    //--------------------------------------------------------------------------
+    bool getClassStats(const uint32_t classIndex, ClassStats& classStats)
+    {
+        if (classIndex >= myNClasses)
+        {
+            return false;
+        }
+
+        Lock lock(*this);
+
+        const Class& sizeClass = myClasses[classIndex];
+        const uint32_t nBlocksPerPage = PageSize / getBlockSize(classIndex);
+
+        classStats.blockSize                = getBlockSize(classIndex);
+        classStats.nPages                   = sizeClass.nPages;
+        classStats.nBlocks                  = sizeClass.nPages * nBlocksPerPage;
+        classStats.nFreeBlocks              = sizeClass.nFreeBlocks;
+        classStats.nUsedBlocks              = sizeClass.nUsedBlocks;
+        classStats.nUsedBlocksHighWaterMark =
+                                           sizeClass.nUsedBlocksHighWaterMark;
+
+        return true;
+    }
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    //--------------------------------------------------------------------------
+    void setThreadCacheEnabled(const bool enabled)
+    {
+        myIsThreadCacheEnabled = enabled;
+    }
+
+#endif
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private constants
+    //--------------------------------------------------------------------------
+
+    static const uint32_t myNClasses = 6;
+
+    static const size_t myMinBlockSize = 16;
+
+    static const size_t myMaxBlockSize = myMinBlockSize << (myNClasses - 1);
+
+    static const uint32_t myNPages = N / PageSize;
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    static const uint32_t myMaxNRegistrations = 4;
+
+    static const uint32_t myMaxThreadCacheBatchSize = 16;
+
+#endif
+
+    static_assert((PageSize % myMaxBlockSize) == 0,
+                  "PageSize must be a multiple of the largest block size");
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct Class
+    {
+        FreeBlock* freeBlocks;
+        uint32_t nPages;
+        uint32_t nFreeBlocks;
+        uint32_t nUsedBlocks;
+        uint32_t nUsedBlocksHighWaterMark;
+    };
+
+    ///
+    /// @brief Holds the shared free list mutex (if any) for its scope.
+    ///
+    class Lock
+    {
+    public:
+
+        Lock(AllocationMemoryPool& pool) :
+            myPool(pool)
+        {
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+            myPool.myMutex.lock();
+#endif
+        }
+
+        ~Lock()
+        {
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+            myPool.myMutex.unlock();
+#endif
+        }
+
+    private:
+
+        AllocationMemoryPool& myPool;
+    };
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    ///
+    /// @brief Free blocks owned by one thread. Blocks move between the cache
+    /// and the shared free lists in batches, so most allocations and
+    /// deallocations don't take the mutex. Cached blocks count as used in the
+    /// statistics.
+    ///
+    struct ThreadCache
+    {
+        ThreadCache() :
+            pool(0),
+            poolSerial(0)
+        {
+            memset(freeBlocks, 0, sizeof(freeBlocks));
+            memset(nFreeBlocks, 0, sizeof(nFreeBlocks));
+        }
+
+        ~ThreadCache()
+        {
+            releaseThreadCache(*this);
+        }
+
+        AllocationMemoryPool* pool;
+        uint64_t poolSerial;
+        FreeBlock* freeBlocks[myNClasses];
+        uint32_t nFreeBlocks[myNClasses];
+    };
+
+    struct Registration
+    {
+        AllocationMemoryPool* pool;
+        uint64_t serial;
+    };
+
+#endif
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    alignas(myMinBlockSize) uint8_t myMemory[N];
+
+    Class myClasses[myNClasses];
+
+    uint8_t myPageClassIndexes[(myNPages == 0) ? 1 : myNPages];
+
+    uint32_t myNClaimedPages;
+
+    size_t myLargeMemorySize;
+
+    size_t myUsedMemorySize;
+
+    size_t myHighWaterMarkMemorySize;
+
+    bool myIsLocked;
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    std::mutex myMutex;
+
+    uint64_t mySerial;
+
+    bool myIsThreadCacheEnabled;
+
+#endif
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for AllocationMemory
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual void* driverAllocate(size_t count) override
+    {
+        if (myIsLocked)
+        {
+            return 0;
+        }
+
+        if (count > myMaxBlockSize)
+        {
+            Lock lock(*this);
+
+            return allocateLarge(count);
+        }
+
+        const uint32_t classIndex = getClassIndex(count);
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+        if (myIsThreadCacheEnabled)
+        {
+            ThreadCache& threadCache = getThreadCache();
+
+            // Blocks cached for another pool, or for a destroyed pool this
+            // one may be reusing the address of, must never be handed out
+            bindThreadCache(threadCache);
+
+            if (threadCache.nFreeBlocks[classIndex] == 0)
+            {
+                refillThreadCache(threadCache, classIndex);
+            }
+
+            FreeBlock* block = threadCache.freeBlocks[classIndex];
+
+            if (block != 0)
+            {
+                threadCache.freeBlocks[classIndex] = block->next;
+                threadCache.nFreeBlocks[classIndex]--;
+
+                return block;
+            }
+
+            // Pages ran out, fall through to the large block memory
+        }
+
+#endif
+
+        Lock lock(*this);
+
+        void* memory = allocateBlock(classIndex);
+
+        if (memory == 0)
+        {
+            memory = allocateLarge(count);
+        }
+
+        return memory;
+    }
+
+    //--------------------------------------------------------------------------
+    virtual void* driverAllocateArray(size_t count) override
+    {
+        return driverAllocate(count);
+    }
+
+    //--------------------------------------------------------------------------
+    virtual void driverDeallocate(void* pointer) override
+    {
+        const uintptr_t offset = reinterpret_cast<uintptr_t>(pointer) -
+                                 reinterpret_cast<uintptr_t>(myMemory);
+
+        // Large blocks (above the claimed pages) are never reused, pointers
+        // from another allocator (or null) are ignored
+        if (offset >= (myNClaimedPages * PageSize))
+        {
+            return;
+        }
+
+        const uint32_t classIndex = myPageClassIndexes[offset / PageSize];
+
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+        if (myIsThreadCacheEnabled)
+        {
+            ThreadCache& threadCache = getThreadCache();
+
+            bindThreadCache(threadCache);
+
+            block->next = threadCache.freeBlocks[classIndex];
+            threadCache.freeBlocks[classIndex] = block;
+            threadCache.nFreeBlocks[classIndex]++;
+
+            const uint32_t batchSize = getThreadCacheBatchSize(classIndex);
+
+            if (threadCache.nFreeBlocks[classIndex] > (2 * batchSize))
+            {
+                flushThreadCache(threadCache, classIndex, batchSize);
+            }
+
+            return;
+        }
+
+#endif
+
+        Lock lock(*this);
+
+        deallocateBlock(block, classIndex);
+    }
+
+    //--------------------------------------------------------------------------
+    virtual void driverDeallocateArray(void* pointer) override
+    {
+        driverDeallocate(pointer);
+    }
+
+    //--------------------------------------------------------------------------
+    virtual size_t driverGetFreeMemorySize() override
+    {
+        Lock lock(*this);
+
+        return (getUnclaimedMemorySize() + getFreeBlockMemorySize());
+    }
+
+    //--------------------------------------------------------------------------
+    virtual void driverGetStats(Stats& stats) override
+    {
+        Lock lock(*this);
+
+        size_t pageWasteSize = 0;
+
+        for (uint32_t i = 0; i < myNClasses; i++)
+        {
+            pageWasteSize += myClasses[i].nPages *
+                             (PageSize % getBlockSize(i));
+        }
+
+        stats.totalMemorySize         = N;
+        stats.usedMemorySize          = myUsedMemorySize;
+        stats.freeMemorySize          = getUnclaimedMemorySize() +
+                                        getFreeBlockMemorySize();
+        stats.highWaterMarkMemorySize = myHighWaterMarkMemorySize;
+        stats.fragmentedMemorySize    = getFreeBlockMemorySize() +
+                                        pageWasteSize;
+    }
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static uint32_t getClassIndex(const size_t count)
+    {
+        uint32_t classIndex = 0;
+        size_t blockSize = myMinBlockSize;
+
+        while (blockSize < count)
+        {
+            blockSize <<= 1;
+            classIndex++;
+        }
+
+        return classIndex;
+    }
+
+    //--------------------------------------------------------------------------
+    static size_t getBlockSize(const uint32_t classIndex)
+    {
+        return (myMinBlockSize << classIndex);
+    }
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Gets the number of blocks moved between a thread cache and the
+    /// pool at once. Capped at half a page so threads can't strand whole pages
+    /// of large blocks in their caches (a thread caches at most two batches).
+    ///
+    static uint32_t getThreadCacheBatchSize(const uint32_t classIndex)
+    {
+        const uint32_t batchSize = PageSize / getBlockSize(classIndex) / 2;
+
+        if (batchSize == 0)
+        {
+            return 1;
+        }
+
+        if (batchSize > myMaxThreadCacheBatchSize)
+        {
+            return myMaxThreadCacheBatchSize;
+        }
+
+        return batchSize;
+    }
+
+#endif
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    //--------------------------------------------------------------------------
+    static ThreadCache& getThreadCache()
+    {
+        static thread_local ThreadCache threadCache;
+
+        return threadCache;
+    }
+
+    //--------------------------------------------------------------------------
+    static std::mutex& getRegistrationMutex()
+    {
+        static std::mutex registrationMutex;
+
+        return registrationMutex;
+    }
+
+    //--------------------------------------------------------------------------
+    static Registration* getRegistrations()
+    {
+        static Registration registrations[myMaxNRegistrations];
+
+        return registrations;
+    }
+
+    //--------------------------------------------------------------------------
+    static uint64_t createSerial()
+    {
+        static std::atomic<uint64_t> lastSerial(0);
+
+        return (lastSerial.fetch_add(1) + 1);
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Keeps track of which pools are alive, so a thread cache can tell
+    /// whether its pool (which may have been destroyed, or replaced by another
+    /// pool at the same address) can still take its blocks back.
+    /// @param pool Pool to register, or 0 to unregister serial.
+    ///
+    static void registerPool(AllocationMemoryPool* pool, const uint64_t serial)
+    {
+        std::lock_guard<std::mutex> lock(getRegistrationMutex());
+
+        Registration* registrations = getRegistrations();
+
+        for (uint32_t i = 0; i < myMaxNRegistrations; i++)
+        {
+            if (isNullPointer(pool) && (registrations[i].serial == serial))
+            {
+                registrations[i].pool   = 0;
+                registrations[i].serial = 0;
+
+                return;
+            }
+
+            if (isValidPointer(pool) && (registrations[i].serial == 0))
+            {
+                registrations[i].pool   = pool;
+                registrations[i].serial = serial;
+
+                return;
+            }
+        }
+
+        // More pools than registrations, their thread caches are dropped
+        // instead of returned when threads exit
+    }
+
+    //--------------------------------------------------------------------------
+    static void releaseThreadCache(ThreadCache& threadCache)
+    {
+        if (isNullPointer(threadCache.pool))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(getRegistrationMutex());
+
+        Registration* registrations = getRegistrations();
+
+        for (uint32_t i = 0; i < myMaxNRegistrations; i++)
+        {
+            if ((registrations[i].pool == threadCache.pool) &&
+                (registrations[i].serial == threadCache.poolSerial))
+            {
+                for (uint32_t j = 0; j < myNClasses; j++)
+                {
+                    threadCache.pool->flushThreadCache(
+                                                   threadCache,
+                                                   j,
+                                                   threadCache.nFreeBlocks[j]);
+                }
+
+                break;
+            }
+        }
+
+        threadCache.pool       = 0;
+        threadCache.poolSerial = 0;
+        memset(threadCache.freeBlocks, 0, sizeof(threadCache.freeBlocks));
+        memset(threadCache.nFreeBlocks, 0, sizeof(threadCache.nFreeBlocks));
+    }
+
+#endif
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    size_t getUnclaimedMemorySize() const
+    {
+        return (N - (myNClaimedPages * PageSize) - myLargeMemorySize);
+    }
+
+    //--------------------------------------------------------------------------
+    size_t getFreeBlockMemorySize() const
+    {
+        size_t size = 0;
+
+        for (uint32_t i = 0; i < myNClasses; i++)
+        {
+            size += myClasses[i].nFreeBlocks * getBlockSize(i);
+        }
+
+        return size;
+    }
+
+    //--------------------------------------------------------------------------
+    void updateUsedMemorySize(const size_t size, const bool isAllocated)
+    {
+        if (isAllocated)
+        {
+            myUsedMemorySize += size;
+
+            if (myUsedMemorySize > myHighWaterMarkMemorySize)
+            {
+                myHighWaterMarkMemorySize = myUsedMemorySize;
+            }
+        }
+        else
+        {
+            myUsedMemorySize -= size;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void* allocateLarge(const size_t count)
+    {
+        // Same alignment as the blocks
+        const size_t size = ((count + myMinBlockSize - 1) / myMinBlockSize) *
+                            myMinBlockSize;
+
+        if (size > getUnclaimedMemorySize())
+        {
+            // Attempting to allocate more memory than available, lock up
+            while (true)
+            {
+            }
+        }
+
+        myLargeMemorySize += size;
+        updateUsedMemorySize(size, true);
+
+        return &(myMemory[N - myLargeMemorySize]);
+    }
+
+    //--------------------------------------------------------------------------
+    bool claimPage(const uint32_t classIndex)
+    {
+        if (getUnclaimedMemorySize() < PageSize)
+        {
+            return false;
+        }
+
+        const uint32_t pageIndex = myNClaimedPages;
+        const size_t blockSize = getBlockSize(classIndex);
+        const uint32_t nBlocks = PageSize / blockSize;
+        uint8_t* page = &(myMemory[pageIndex * PageSize]);
+
+        Class& sizeClass = myClasses[classIndex];
+
+        // Push in reverse so blocks are handed out in address order
+        for (uint32_t i = nBlocks; i > 0; i--)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(
+                                                page + ((i - 1) * blockSize));
+            block->next = sizeClass.freeBlocks;
+            sizeClass.freeBlocks = block;
+        }
+
+        sizeClass.nPages++;
+        sizeClass.nFreeBlocks += nBlocks;
+
+        myPageClassIndexes[pageIndex] = static_cast<uint8_t>(classIndex);
+        myNClaimedPages++;
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    void* allocateBlock(const uint32_t classIndex)
+    {
+        Class& sizeClass = myClasses[classIndex];
+
+        if (isNullPointer(sizeClass.freeBlocks) && !claimPage(classIndex))
+        {
+            return 0;
+        }
+
+        FreeBlock* block = sizeClass.freeBlocks;
+        sizeClass.freeBlocks = block->next;
+        sizeClass.nFreeBlocks--;
+        sizeClass.nUsedBlocks++;
+
+        if (sizeClass.nUsedBlocks > sizeClass.nUsedBlocksHighWaterMark)
+        {
+            sizeClass.nUsedBlocksHighWaterMark = sizeClass.nUsedBlocks;
+        }
+
+        updateUsedMemorySize(getBlockSize(classIndex), true);
+
+        return block;
+    }
+
+    //--------------------------------------------------------------------------
+    void deallocateBlock(FreeBlock* block, const uint32_t classIndex)
+    {
+        Class& sizeClass = myClasses[classIndex];
+
+        block->next = sizeClass.freeBlocks;
+        sizeClass.freeBlocks = block;
+        sizeClass.nFreeBlocks++;
+        sizeClass.nUsedBlocks--;
+
+        updateUsedMemorySize(getBlockSize(classIndex), false);
+    }
+
+#if PLAT4M_ALLOCATION_MEMORY_POOL_THREAD_CACHE_ENABLED
+
+    //--------------------------------------------------------------------------
+    void bindThreadCache(ThreadCache& threadCache)
+    {
+        if ((threadCache.pool != this) || (threadCache.poolSerial != mySerial))
+        {
+            // First use from this thread, or the thread moved on from another
+            // pool
+            releaseThreadCache(threadCache);
+
+            threadCache.pool       = this;
+            threadCache.poolSerial = mySerial;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void refillThreadCache(ThreadCache& threadCache, const uint32_t classIndex)
+    {
+        bindThreadCache(threadCache);
+
+        Lock lock(*this);
+
+        const uint32_t batchSize = getThreadCacheBatchSize(classIndex);
+
+        for (uint32_t i = 0; i < batchSize; i++)
+        {
+            FreeBlock* block =
+                        static_cast<FreeBlock*>(allocateBlock(classIndex));
+
+            if (isNullPointer(block))
+            {
+                break;
+            }
+
+            block->next = threadCache.freeBlocks[classIndex];
+            threadCache.freeBlocks[classIndex] = block;
+            threadCache.nFreeBlocks[classIndex]++;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void flushThreadCache(ThreadCache& threadCache,
+                          const uint32_t classIndex,
+                          const uint32_t nBlocks)
+    {
+        Lock lock(*this);
+
+        for (uint32_t i = 0; i < nBlocks; i++)
+        {
+            FreeBlock* block = threadCache.freeBlocks[classIndex];
+
+            if (isNullPointer(block))
+            {
+                break;
+            }
+
+            threadCache.freeBlocks[classIndex] = block->next;
+            threadCache.nFreeBlocks[classIndex]--;
+
+            deallocateBlock(block, classIndex);
+        }
+    }
+
+#endif
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_ALLOCATION_MEMORY_POOL_H
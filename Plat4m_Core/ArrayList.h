@@ -0,0 +1,518 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ArrayList.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ArrayList class header file.
+///
+
+#ifndef PLAT4M_ARRAY_LIST_H
+#define PLAT4M_ARRAY_LIST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief List with the same interface as List<T> that keeps its items in one
+/// contiguous array. The first N items are stored inline, so lists that stay
+/// within N never touch the allocator and iterating is a walk over adjacent
+/// memory. Past N the items move to an allocated array that doubles in size
+/// as needed. remove() shifts the following items down to keep them in
+/// insertion order.
+///
+/// One thread at a time may modify the list while other threads iterate it.
+/// Arrays outgrown by append() or prepend() are retired rather than freed
+/// (together less than the current array) and only freed when the list is
+/// destroyed, so an iterator on another thread never reads freed memory. An
+/// iterator on another thread may miss an item appended or removed while it
+/// runs.
+///
+template <typename T, std::uint32_t N>
+class ArrayList
+{
+public:
+
+    static_assert(N > 0, "ArrayList must have inline storage");
+
+    //--------------------------------------------------------------------------
+    // Public friend classes
+    //--------------------------------------------------------------------------
+
+    class Iterator
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        Iterator(ArrayList<T, N>& list) :
+            myList(list),
+            myIndex(0)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        bool hasCurrent()
+        {
+            return (myIndex < myList.mySize.load(std::memory_order_acquire));
+        }
+
+        //----------------------------------------------------------------------
+        bool next()
+        {
+            if (!hasCurrent())
+            {
+                return false;
+            }
+
+            myIndex++;
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        bool previous()
+        {
+            if (!hasCurrent())
+            {
+                return false;
+            }
+
+            // Wraps to an index past the end when moving before the first item
+            myIndex--;
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        void first()
+        {
+            myIndex = 0;
+        }
+
+        //----------------------------------------------------------------------
+        void last()
+        {
+            myIndex = myList.mySize.load(std::memory_order_acquire) - 1;
+        }
+
+        //----------------------------------------------------------------------
+        T& current()
+        {
+            return (myList.myItems.load(std::memory_order_acquire)[myIndex]);
+        }
+
+    private:
+
+        ArrayList<T, N>& myList;
+
+        std::uint32_t myIndex;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ArrayList() :
+        mySize(0),
+        myCapacity(N),
+        myItems(0),
+        myRetiredItems(0),
+        myInlineItems()
+    {
+        myItems.store(myInlineItems, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    ArrayList(const ArrayList<T, N>& list) :
+        mySize(0),
+        myCapacity(N),
+        myItems(0),
+        myRetiredItems(0),
+        myInlineItems()
+    {
+        myItems.store(myInlineItems, std::memory_order_relaxed);
+
+        copy(list);
+    }
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ~ArrayList()
+    {
+        freeItems();
+    }
+
+    //--------------------------------------------------------------------------
+    // Public operator overloads
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ArrayList<T, N>& operator=(const ArrayList<T, N>& list)
+    {
+        if (&list != this)
+        {
+            clear();
+            copy(list);
+        }
+
+        return (*this);
+    }
+
+    //--------------------------------------------------------------------------
+    T& operator[](const std::uint32_t index)
+    {
+        return (getItems()[index]);
+    }
+
+    //--------------------------------------------------------------------------
+    const T& operator[](const std::uint32_t index) const
+    {
+        return (getItems()[index]);
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    std::uint32_t size() const
+    {
+        return mySize.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t capacity() const
+    {
+        return myCapacity;
+    }
+
+    //--------------------------------------------------------------------------
+    bool isEmpty()
+    {
+        return (size() == 0);
+    }
+
+    //--------------------------------------------------------------------------
+    void append(const T& value)
+    {
+        const std::uint32_t size = this->size();
+
+        reserve(size + 1);
+
+        getItems()[size] = value;
+
+        // Iterators that see the new size also see the new item
+        mySize.store(size + 1, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------
+    void prepend(const T& value)
+    {
+        const std::uint32_t size = this->size();
+
+        reserve(size + 1);
+
+        T* items = getItems();
+
+        for (std::uint32_t i = size; i > 0; i--)
+        {
+            items[i] = items[i - 1];
+        }
+
+        items[0] = value;
+        mySize.store(size + 1, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------
+    bool first(T& value)
+    {
+        if (size() == 0)
+        {
+            return false;
+        }
+
+        value = getItems()[0];
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    bool last(T& value)
+    {
+        const std::uint32_t size = this->size();
+
+        if (size == 0)
+        {
+            return false;
+        }
+
+        value = getItems()[size - 1];
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    Iterator iterator()
+    {
+        return Iterator(*this);
+    }
+
+    //--------------------------------------------------------------------------
+    void remove(const T& value)
+    {
+        const std::uint32_t size = this->size();
+        T* items = getItems();
+
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            if (value == items[i])
+            {
+                mySize.store(size - 1, std::memory_order_release);
+
+                for (std::uint32_t j = i; j < (size - 1); j++)
+                {
+                    items[j] = items[j + 1];
+                }
+
+                items[size - 1] = T();
+
+                break;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void clear()
+    {
+        const std::uint32_t size = this->size();
+        T* items = getItems();
+
+        mySize.store(0, std::memory_order_release);
+
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            items[i] = T();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void reserve(const std::uint32_t capacity)
+    {
+        if (capacity <= myCapacity)
+        {
+            return;
+        }
+
+        std::uint32_t newCapacity = myCapacity;
+
+        while (newCapacity < capacity)
+        {
+            newCapacity *= 2;
+        }
+
+        void* memory = MemoryAllocator::allocateArray(
+                                  headerSize + (newCapacity * sizeof(T)));
+        T* newItems = reinterpret_cast<T*>(static_cast<std::uint8_t*>(memory) +
+                                           headerSize);
+
+        getHeader(newItems).retiredItems = 0;
+        getHeader(newItems).capacity = newCapacity;
+
+        for (std::uint32_t i = 0; i < newCapacity; i++)
+        {
+            new(&(newItems[i])) T();
+        }
+
+        const std::uint32_t size = this->size();
+        T* items = getItems();
+
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            newItems[i] = items[i];
+        }
+
+        // Iterators on other threads may still be walking the old array
+        if (items != myInlineItems)
+        {
+            getHeader(items).retiredItems = myRetiredItems;
+            myRetiredItems = items;
+        }
+
+        myCapacity = newCapacity;
+        myItems.store(newItems, std::memory_order_release);
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    // Stored in front of each allocated array
+    struct Header
+    {
+        T* retiredItems;
+
+        std::uint32_t capacity;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    // Rounded up so the items that follow the header stay aligned
+    static const std::uint32_t headerSize =
+                   ((sizeof(Header) + alignof(T) - 1) / alignof(T)) * alignof(T);
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::atomic<std::uint32_t> mySize;
+
+    std::uint32_t myCapacity;
+
+    std::atomic<T*> myItems;
+
+    T* myRetiredItems;
+
+    T myInlineItems[N];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static Header& getHeader(T* items)
+    {
+        return *reinterpret_cast<Header*>(
+                         reinterpret_cast<std::uint8_t*>(items) - headerSize);
+    }
+
+    //--------------------------------------------------------------------------
+    static void freeAllocatedItems(T* items)
+    {
+        const std::uint32_t capacity = getHeader(items).capacity;
+
+        for (std::uint32_t i = 0; i < capacity; i++)
+        {
+            items[i].~T();
+        }
+
+        MemoryAllocator::deallocateArray(&(getHeader(items)));
+    }
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    T* getItems() const
+    {
+        return myItems.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    void copy(const ArrayList<T, N>& list)
+    {
+        const std::uint32_t size = list.size();
+
+        reserve(size);
+
+        T* items = getItems();
+        const T* listItems = list.getItems();
+
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            items[i] = listItems[i];
+        }
+
+        mySize.store(size, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------
+    void freeItems()
+    {
+        T* items = getItems();
+
+        if (items != myInlineItems)
+        {
+            freeAllocatedItems(items);
+        }
+        else
+        {
+            clear();
+        }
+
+        while (isValidPointer(myRetiredItems))
+        {
+            T* retiredItems = myRetiredItems;
+            myRetiredItems = getHeader(retiredItems).retiredItems;
+
+            freeAllocatedItems(retiredItems);
+        }
+
+        mySize.store(0, std::memory_order_relaxed);
+        myCapacity = N;
+        myItems.store(myInlineItems, std::memory_order_relaxed);
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_ARRAY_LIST_H
@@ -277,6 +277,12 @@ public:
     	myWriteIndex = writeIndex;
     }
 
+    //--------------------------------------------------------------------------
+    void setReadIndex(const uint32_t readIndex)
+    {
+    	myReadIndex = readIndex;
+    }
+
 private:
     
     //--------------------------------------------------------------------------
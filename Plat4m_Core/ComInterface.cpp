@@ -48,6 +48,8 @@
 
 using Plat4m::ComInterface;
 using Plat4m::Buffer;
+using Plat4m::Array;
+using Plat4m::ByteArray;
 
 //------------------------------------------------------------------------------
 // Public virtual methods
@@ -65,6 +67,29 @@ void ComInterface::setReceiveBuffer(Buffer<uint8_t>& receiveBuffer)
     myReceiveBuffer = &receiveBuffer;
 }
 
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterface::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    const uint32_t nSegments = segments.getSize();
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        // Only the last segment needs waiting on, the others are queued ahead
+        // of it
+        Error error = transmitBytes(segments[i],
+                                    (waitUntilDone && (i == (nSegments - 1))));
+
+        if (error.getCode() != ERROR_CODE_NONE)
+        {
+            return error;
+        }
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
 //------------------------------------------------------------------------------
 // Public methods
 //------------------------------------------------------------------------------
@@ -76,6 +101,13 @@ void ComInterface::setByteReceivedCallback(
     myByteReceivedCallback = &byteReceivedCallback;
 }
 
+//------------------------------------------------------------------------------
+void ComInterface::setBytesReceivedCallback(
+                                     BytesReceivedCallback& bytesReceivedCallback)
+{
+    myBytesReceivedCallback = &bytesReceivedCallback;
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
@@ -85,7 +117,8 @@ ComInterface::ComInterface() :
     Module(),
     myTransmitBuffer(0),
     myReceiveBuffer(0),
-    myByteReceivedCallback(0)
+    myByteReceivedCallback(0),
+    myBytesReceivedCallback(0)
 {
 }
 
@@ -95,7 +128,8 @@ ComInterface::ComInterface(Buffer<uint8_t>& transmitBuffer,
     Module(),
     myTransmitBuffer(&transmitBuffer),
     myReceiveBuffer(&receiveBuffer),
-    myByteReceivedCallback(0)
+    myByteReceivedCallback(0),
+    myBytesReceivedCallback(0)
 {
 }
 
@@ -51,6 +51,7 @@
 #include <Plat4m_Core/ErrorTemplate.h>
 #include <Plat4m_Core/Callback.h>
 #include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/Array.h>
 #include <Plat4m_Core/Buffer.h>
 
 //------------------------------------------------------------------------------
@@ -90,6 +91,8 @@ public:
 
     typedef Callback<void, uint8_t> ByteReceivedCallback;
 
+    typedef Callback<void, const ByteArray&> BytesReceivedCallback;
+
     //--------------------------------------------------------------------------
     // Public pure virtual methods
     //--------------------------------------------------------------------------
@@ -110,12 +113,28 @@ public:
 
     virtual void setReceiveBuffer(Buffer<uint8_t>& receiveBuffer);
 
+    ///
+    /// @brief Transmits a gather list of segments as one contiguous run of
+    /// bytes. By default each segment goes through transmitBytes() in turn,
+    /// drivers that can hand the whole list to the hardware or OS at once
+    /// (writev() on Linux) should override this.
+    ///
+    virtual Error transmitSegments(const Array<ByteArray>& segments,
+                                   const bool waitUntilDone = true);
+
     //--------------------------------------------------------------------------
     // Public methods
     //--------------------------------------------------------------------------
 
     void setByteReceivedCallback(ByteReceivedCallback& byteReceivedCallback);
 
+    ///
+    /// @brief Sets a callback that takes received bytes a block at a time.
+    /// Drivers that receive in blocks call it once per block instead of
+    /// calling the byte received callback once per byte.
+    ///
+    void setBytesReceivedCallback(BytesReceivedCallback& bytesReceivedCallback);
+
 protected:
 
     //--------------------------------------------------------------------------
@@ -158,6 +177,24 @@ protected:
         }
     }
 
+    //--------------------------------------------------------------------------
+    inline void bytesReceived(const ByteArray& byteArray)
+    {
+        if (isValidPointer(myBytesReceivedCallback))
+        {
+            myBytesReceivedCallback->call(byteArray);
+
+            return;
+        }
+
+        const uint32_t size = byteArray.getSize();
+
+        for (uint32_t i = 0; i < size; i++)
+        {
+            byteReceived(byteArray[i]);
+        }
+    }
+
 private:
 
     //--------------------------------------------------------------------------
@@ -169,6 +206,8 @@ private:
     Buffer<uint8_t>* myReceiveBuffer;
 
     ByteReceivedCallback* myByteReceivedCallback;
+
+    BytesReceivedCallback* myBytesReceivedCallback;
 };
 
 }; // namespace Plat4m
@@ -107,6 +107,16 @@ ComInterfaceDevice::Error ComInterfaceDevice::transmitBytes(
     return error;
 }
 
+//------------------------------------------------------------------------------
+ComInterfaceDevice::Error ComInterfaceDevice::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    Error error = driverTransmitSegments(segments, waitUntilDone);
+
+    return error;
+}
+
 //------------------------------------------------------------------------------
 ComInterfaceDevice::Error ComInterfaceDevice::receiveBytes(
                                                          ByteArray& byteArray,
@@ -166,6 +176,16 @@ ComInterfaceDevice::Error ComInterfaceDevice::driverTransmitBytes(
     return Error(ERROR_CODE_NONE);
 }
 
+//------------------------------------------------------------------------------
+ComInterfaceDevice::Error ComInterfaceDevice::driverTransmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    myComInterface->transmitSegments(segments, waitUntilDone);
+
+    return Error(ERROR_CODE_NONE);
+}
+
 //------------------------------------------------------------------------------
 ComInterfaceDevice::Error ComInterfaceDevice::driverReceiveBytes(
                                                          ByteArray& byteArray,
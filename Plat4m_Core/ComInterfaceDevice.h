@@ -52,6 +52,7 @@
 #include <Plat4m_Core/ComInterface.h>
 #include <Plat4m_Core/Buffer.h>
 #include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/Array.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -111,6 +112,9 @@ public:
     Error transmitBytes(const ByteArray& byteArray,
                         const bool waitUntilDone = false);
 
+    Error transmitSegments(const Array<ByteArray>& segments,
+                           const bool waitUntilDone = false);
+
     Error receiveBytes(ByteArray& byteArray, const uint32_t timeoutMs = 100);
 
     uint32_t getReceivedBytesCount();
@@ -149,6 +153,9 @@ private:
     virtual Error driverTransmitBytes(const ByteArray& byteArray,
                                       const bool waitUntilDone);
 
+    virtual Error driverTransmitSegments(const Array<ByteArray>& segments,
+                                         const bool waitUntilDone);
+
     virtual Error driverReceiveBytes(ByteArray& byteArray,
                                      const TimeMs timeoutMs);
     
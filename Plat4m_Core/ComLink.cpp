@@ -44,6 +44,7 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <string.h>
 
 #include <Plat4m_Core/ComLink.h>
 #include <Plat4m_Core/ComProtocol.h>
@@ -61,7 +62,8 @@ using Plat4m::Thread;
 //------------------------------------------------------------------------------
 ComLink::ComLink(ByteArray& transmitByteArray,
                  ByteArray& receiveByteArray,
-                 ComInterfaceDevice& comInterfaceDevice) :
+                 ComInterfaceDevice& comInterfaceDevice,
+                 const uint32_t receiveByteQueueSize) :
     Module(),
     myTransmitByteArray(transmitByteArray),
     myReceiveByteArray(receiveByteArray),
@@ -74,7 +76,8 @@ ComLink::ComLink(ByteArray& transmitByteArray,
                                          &ComLink::dataParsingThreadCallback))),
     myWaitCondition(System::createWaitCondition(myDataParsingThread)),
     myMutex(System::createMutex(myDataParsingThread)),
-	myReceiveByteQueue(System::createQueue<uint8_t>(128, myDataParsingThread))
+	myReceiveByteQueue(System::createQueue<uint8_t>(receiveByteQueueSize,
+	                                                myDataParsingThread))
 {
     myDataParsingThread.setPriority(3);
 }
@@ -83,7 +86,8 @@ ComLink::ComLink(ByteArray& transmitByteArray,
 ComLink::ComLink(ByteArray& transmitByteArray,
                  ByteArray& receiveByteArray,
                  ComInterfaceDevice& comInterfaceDevice,
-                 ComInterface& comInterface) :
+                 ComInterface& comInterface,
+                 const uint32_t receiveByteQueueSize) :
     myTransmitByteArray(transmitByteArray),
     myReceiveByteArray(receiveByteArray),
     myComInterfaceDevice(comInterfaceDevice),
@@ -95,13 +99,17 @@ ComLink::ComLink(ByteArray& transmitByteArray,
                                          &ComLink::dataParsingThreadCallback))),
     myWaitCondition(System::createWaitCondition(myDataParsingThread)),
     myMutex(System::createMutex(myDataParsingThread)),
-	myReceiveByteQueue(System::createQueue<uint8_t>(128, myDataParsingThread))
+	myReceiveByteQueue(System::createQueue<uint8_t>(receiveByteQueueSize,
+	                                                myDataParsingThread))
 {
     myDataParsingThread.setPriority(3);
 
     comInterface.setByteReceivedCallback(
 							    createCallback(this,
 											   &ComLink::byteReceivedCallback));
+    comInterface.setBytesReceivedCallback(
+                                createCallback(this,
+                                               &ComLink::bytesReceivedCallback));
 }
 
 //------------------------------------------------------------------------------
@@ -148,6 +156,18 @@ ComLink::Error ComLink::transmitBytes(const ByteArray& byteArray,
     return Error(ERROR_CODE_NONE);
 }
 
+//------------------------------------------------------------------------------
+ComLink::Error ComLink::transmitSegments(const Array<ByteArray>& segments,
+                                         const bool waitUntilDone)
+{
+    // Held for the whole list so no other frame lands between its segments
+    MutexLock mutexLock(myMutex);
+
+    myComInterfaceDevice.transmitSegments(segments, waitUntilDone);
+
+    return Error(ERROR_CODE_NONE);
+}
+
 //------------------------------------------------------------------------------
 // Private methods implemented from Module
 //------------------------------------------------------------------------------
@@ -174,20 +194,49 @@ void ComLink::byteReceivedCallback(const uint8_t byte)
 	}
 }
 
+//------------------------------------------------------------------------------
+void ComLink::bytesReceivedCallback(const ByteArray& byteArray)
+{
+    if (myDataParsingThread.isEnabled())
+    {
+        // Bytes that don't fit are dropped, just as byteReceivedCallback()
+        // drops them one at a time
+        myReceiveByteQueue.enqueueBatch(byteArray.getItems(),
+                                        byteArray.getSize());
+    }
+}
+
 //------------------------------------------------------------------------------
 void ComLink::dataParsingThreadCallback()
 {
-	uint8_t byte;
-	myReceiveByteQueue.dequeue(byte);
-	myReceiveByteArray.append(byte);
+    // A frame that doesn't fit in the receive buffer can never complete
+    if (myReceiveByteArray.getSize() == myReceiveByteArray.getMaxSize())
+    {
+        myCurrentComProtocol = 0;
+        myReceiveByteArray.clear();
+        resetParsers();
+    }
 
-	uint32_t nBytes = myReceiveByteQueue.getSize();
+    uint8_t bytes[64];
+    uint32_t nBytes = 0;
 
-	for (uint32_t i = 0; i < nBytes; i++)
-	{
-		myReceiveByteQueue.dequeue(byte);
-		myReceiveByteArray.append(byte);
-	}
+    // Block for the first bytes, then take whatever else has arrived so a
+    // burst is parsed in one pass instead of one pass per byte
+    do
+    {
+        uint32_t nMaxBytes = myReceiveByteArray.getMaxSize() -
+                             myReceiveByteArray.getSize();
+
+        if (nMaxBytes > arraySize(bytes))
+        {
+            nMaxBytes = arraySize(bytes);
+        }
+
+        nBytes = myReceiveByteQueue.dequeueBatch(bytes, nMaxBytes);
+        myReceiveByteArray.append(&bytes[0], nBytes);
+    } while ((nBytes > 0) &&
+             (myReceiveByteArray.getSize() < myReceiveByteArray.getMaxSize()) &&
+             (myReceiveByteQueue.getSize() > 0));
 
     // Timeout
     if (isValidPointer(myCurrentComProtocol) &&
@@ -196,41 +245,63 @@ void ComLink::dataParsingThreadCallback()
         myCurrentComProtocol = 0;
         myReceiveByteQueue.clear();
         myReceiveByteArray.clear();
+        resetParsers();
     }
 
-    if (myReceiveByteArray.getSize() == 0)
-    {
-        return;
-    }
+    parseReceiveBytes();
+}
 
-    if (isValidPointer(myCurrentComProtocol))
-    {
-        tryProtocol(myCurrentComProtocol);
-    }
-    else
+//------------------------------------------------------------------------------
+void ComLink::parseReceiveBytes()
+{
+    // Several frames can arrive in one batch, keep going until the remaining
+    // bytes are mid frame or used up
+    while (myReceiveByteArray.getSize() > 0)
     {
-        List<ComProtocol*>::Iterator iterator = myComProtocolList.iterator();
+        bool isClaimed = false;
 
-        while (iterator.hasCurrent())
+        if (isValidPointer(myCurrentComProtocol))
+        {
+            isClaimed = tryProtocol(myCurrentComProtocol);
+        }
+        else
         {
-            ComProtocol* comProtocol = iterator.current();
-            tryProtocol(comProtocol);
+            ComProtocolList::Iterator iterator = myComProtocolList.iterator();
+
+            while (iterator.hasCurrent() && !isClaimed)
+            {
+                isClaimed = tryProtocol(iterator.current());
 
-            iterator.next();
+                iterator.next();
+            }
         }
 
+        if (!isClaimed)
+        {
+            // No protocol recognizes the first byte, drop it and resync on the
+            // next one
+            myCurrentComProtocol = 0;
+            consumeReceiveBytes(1);
+        }
+        else if (isValidPointer(myCurrentComProtocol))
+        {
+            // Mid frame, wait for more bytes
+            return;
+        }
     }
 }
 
 //------------------------------------------------------------------------------
-void ComLink::tryProtocol(ComProtocol* comProtocol)
+bool ComLink::tryProtocol(ComProtocol* comProtocol)
 {
     Callback<>* followUpCallback = 0;
+    uint32_t frameSize = 0;
 
     ComProtocol::ParseStatus parseStatus =
                                      comProtocol->parseData(myReceiveByteArray,
                                                             myTransmitByteArray,
-                                                            followUpCallback);
+                                                            followUpCallback,
+                                                            frameSize);
 
     switch (parseStatus)
     {
@@ -244,7 +315,7 @@ void ComLink::tryProtocol(ComProtocol* comProtocol)
                                       myCurrentComProtocol->getParseTimeoutMs();
             }
 
-            break;
+            return true;
         }
         case ComProtocol::PARSE_STATUS_FOUND_FRAME:
         {
@@ -263,16 +334,55 @@ void ComLink::tryProtocol(ComProtocol* comProtocol)
 
             myCurrentComProtocolTimeoutTimeMs = 0;
             myCurrentComProtocol = 0;
-            myReceiveByteArray.clear();
 
-            break;
+            // Frame size 0 means the protocol used up everything received
+            if (frameSize == 0)
+            {
+                frameSize = myReceiveByteArray.getSize();
+            }
+
+            consumeReceiveBytes(frameSize);
+
+            return true;
         }
         default:
         {
-            myCurrentComProtocol = 0;
-            myReceiveByteArray.clear();
-
             break;
         }
     }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void ComLink::consumeReceiveBytes(const uint32_t nBytes)
+{
+    uint32_t size = myReceiveByteArray.getSize();
+
+    if (nBytes >= size)
+    {
+        myReceiveByteArray.clear();
+    }
+    else
+    {
+        uint8_t* items = myReceiveByteArray.getItems();
+
+        memmove(items, items + nBytes, size - nBytes);
+        myReceiveByteArray.setSize(size - nBytes);
+    }
+
+    resetParsers();
+}
+
+//------------------------------------------------------------------------------
+void ComLink::resetParsers()
+{
+    ComProtocolList::Iterator iterator = myComProtocolList.iterator();
+
+    while (iterator.hasCurrent())
+    {
+        iterator.current()->resetParser();
+
+        iterator.next();
+    }
 }
@@ -50,7 +50,7 @@
 #include <Plat4m_Core/Module.h>
 #include <Plat4m_Core/ComInterfaceDevice.h>
 #include <Plat4m_Core/ErrorTemplate.h>
-#include <Plat4m_Core/List.h>
+#include <Plat4m_Core/ArrayList.h>
 #include <Plat4m_Core/ComInterface.h>
 #include <Plat4m_Core/Thread.h>
 #include <Plat4m_Core/CallbackMethod.h>
@@ -104,12 +104,14 @@ public:
 
     ComLink(ByteArray& transmitByteArray,
             ByteArray& receiveByteArray,
-            ComInterfaceDevice& comInterfaceDevice);
+            ComInterfaceDevice& comInterfaceDevice,
+            const uint32_t receiveByteQueueSize = 128);
 
     ComLink(ByteArray& transmitByteArray,
             ByteArray& receiveByteArray,
             ComInterfaceDevice& comInterfaceDevice,
-            ComInterface& comInterface);
+            ComInterface& comInterface,
+            const uint32_t receiveByteQueueSize = 128);
 
     //--------------------------------------------------------------------------
     // Public virtual destructors
@@ -130,8 +132,22 @@ public:
     Error transmitBytes(const ByteArray& byteArray,
                         const bool waitUntilDone = false);
 
+    ///
+    /// @brief Transmits a gather list of segments (see
+    /// Frame::toSegments()) without first copying them into one array.
+    ///
+    Error transmitSegments(const Array<ByteArray>& segments,
+                           const bool waitUntilDone = false);
+
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    // Links rarely have more than a few protocols, keep them inline
+    typedef ArrayList<ComProtocol*, 4> ComProtocolList;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
@@ -142,7 +158,7 @@ private:
 
     ComInterfaceDevice& myComInterfaceDevice;
 
-    List<ComProtocol*> myComProtocolList;
+    ComProtocolList myComProtocolList;
 
     ComProtocol* myCurrentComProtocol;
 
@@ -168,9 +184,17 @@ private:
 
     void byteReceivedCallback(const uint8_t byte);
 
+    void bytesReceivedCallback(const ByteArray& byteArray);
+
     void dataParsingThreadCallback();
 
-    void tryProtocol(ComProtocol* comProtocol);
+    void parseReceiveBytes();
+
+    bool tryProtocol(ComProtocol* comProtocol);
+
+    void consumeReceiveBytes(const uint32_t nBytes);
+
+    void resetParsers();
 };
 
 }; // namespace Plat4m
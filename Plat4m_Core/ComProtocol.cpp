@@ -63,13 +63,41 @@ uint32_t ComProtocol::getParseTimeoutMs()
 ComProtocol::ParseStatus ComProtocol::parseData(
                                               const ByteArray& receiveByteArray,
 								   	   	   	  ByteArray& transmitByteArray,
-						                      Callback<>*& followUpCallback)
+						                      Callback<>*& followUpCallback,
+						                      uint32_t& frameSize)
 {
-	return driverParseData(receiveByteArray,
+    frameSize = 0;
+
+    ParseStatus parseStatus = driverScanData(receiveByteArray, frameSize);
+
+    if (parseStatus != PARSE_STATUS_FOUND_FRAME)
+    {
+        return parseStatus;
+    }
+
+    if ((frameSize == 0) || (frameSize >= receiveByteArray.getSize()))
+    {
+        frameSize = 0;
+
+        return driverParseData(receiveByteArray,
+                               transmitByteArray,
+                               followUpCallback);
+    }
+
+    // Hand the protocol only its frame, bytes after it belong to the next one
+    ByteArray frameByteArray = receiveByteArray.subArray(0, frameSize);
+
+	return driverParseData(frameByteArray,
 	                       transmitByteArray,
 	                       followUpCallback);
 }
 
+//------------------------------------------------------------------------------
+void ComProtocol::resetParser()
+{
+    driverResetParser();
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
@@ -100,3 +128,21 @@ ComLink& ComProtocol::getComLink()
 {
     return myComLink;
 }
+
+//------------------------------------------------------------------------------
+// Private virtual methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComProtocol::driverScanData(
+                                              const ByteArray& receiveByteArray,
+                                              uint32_t& frameSize)
+{
+    return PARSE_STATUS_FOUND_FRAME;
+}
+
+//------------------------------------------------------------------------------
+void ComProtocol::driverResetParser()
+{
+    // Nothing to reset
+}
@@ -99,9 +99,25 @@ public:
     
     uint32_t getParseTimeoutMs();
     
+    ///
+    /// @brief Parses the bytes received so far. receiveByteArray only grows
+    /// between calls until resetParser() is called, so a protocol that
+    /// implements driverScanData() only scans the newly received bytes and
+    /// runs driverParseData() once per frame.
+    /// @param frameSize Set to the size of the frame found at the start of
+    /// receiveByteArray, or 0 if the protocol can't tell where the frame ends
+    /// (the frame is then assumed to span all of receiveByteArray).
+    ///
     ParseStatus parseData(const ByteArray& receiveByteArray,
                           ByteArray& transmitByteArray,
-                          Callback<>*& followUpCallback);
+                          Callback<>*& followUpCallback,
+                          uint32_t& frameSize);
+
+    ///
+    /// @brief Restarts parsing, called whenever the receive bytes passed to
+    /// parseData() are cleared or consumed.
+    ///
+    void resetParser();
     
 protected:
     
@@ -140,6 +156,25 @@ private:
     virtual ParseStatus driverParseData(const ByteArray& receiveByteArray,
     									ByteArray& transmitByteArray,
     									Callback<>*& followUpCallback) = 0;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Scans the bytes received since the last call, keeping its own
+    /// cursor, to find out whether a complete frame has arrived. The default
+    /// implementation always reports PARSE_STATUS_FOUND_FRAME so that
+    /// driverParseData() parses the whole receive buffer on every call.
+    /// @param frameSize Set to the frame size when it is known.
+    /// @return PARSE_STATUS_MID_FRAME while the frame is incomplete,
+    /// PARSE_STATUS_FOUND_FRAME once driverParseData() should run, or
+    /// PARSE_STATUS_NOT_A_FRAME if the bytes can't be for this protocol.
+    ///
+    virtual ParseStatus driverScanData(const ByteArray& receiveByteArray,
+                                       uint32_t& frameSize);
+
+    virtual void driverResetParser();
 };
 
 }; // namespace Plat4m
@@ -64,6 +64,22 @@ const char AsciiMessage::myCommandSeparatorCharacter   = '|';
 const char AsciiMessage::myAssignmentCharacter         = '=';
 const char AsciiMessage::myParameterSeparatorCharacter = ',';
 
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+char AsciiMessage::getStartCharacter()
+{
+    return myStartCharacter;
+}
+
+//------------------------------------------------------------------------------
+char AsciiMessage::getEndCharacter()
+{
+    return myEndCharacter;
+}
+
 //------------------------------------------------------------------------------
 // Public constructors
 //------------------------------------------------------------------------------
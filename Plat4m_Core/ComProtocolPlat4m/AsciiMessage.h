@@ -69,6 +69,14 @@ public:
     // Public structures
     //--------------------------------------------------------------------------
 
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static char getStartCharacter();
+
+    static char getEndCharacter();
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
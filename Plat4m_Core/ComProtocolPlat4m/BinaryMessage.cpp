@@ -152,6 +152,18 @@ bool BinaryMessage::frameParseByteArray(const ByteArray& byteArray)
             binaryMessageParseByteArray(byteArray.subArray(4)));
 }
 
+//------------------------------------------------------------------------------
+bool BinaryMessage::frameToSegments(ByteArray& headerByteArray,
+                                    Array<ByteArray>& segments) const
+{
+    const uint32_t headerIndex = headerByteArray.getSize();
+
+    return (headerByteArray.append(myGroupId,   ENDIAN_BIG)                &&
+            headerByteArray.append(myMessageId, ENDIAN_BIG)                &&
+            appendSegment(segments, headerByteArray.subArray(headerIndex)) &&
+            binaryMessageToSegments(headerByteArray, segments));
+}
+
 //------------------------------------------------------------------------------
 // Private virtual methods
 //------------------------------------------------------------------------------
@@ -171,3 +183,13 @@ bool BinaryMessage::binaryMessageParseByteArray(const ByteArray& byteArray)
 
     return true;
 }
+
+//------------------------------------------------------------------------------
+bool BinaryMessage::binaryMessageToSegments(ByteArray& headerByteArray,
+                                            Array<ByteArray>& segments) const
+{
+    const uint32_t index = headerByteArray.getSize();
+
+    return (binaryMessageToByteArray(headerByteArray) &&
+            appendSegment(segments, headerByteArray.subArray(index)));
+}
@@ -128,6 +128,9 @@ private:
 
     bool frameParseByteArray(const ByteArray& data);
 
+    bool frameToSegments(ByteArray& headerByteArray,
+                         Array<ByteArray>& segments) const;
+
     //--------------------------------------------------------------------------
     // Private virtual methods
     //-------------------------------------------------------------------------
@@ -135,6 +138,14 @@ private:
     virtual bool binaryMessageToByteArray(ByteArray& byteArray) const;
 
     virtual bool binaryMessageParseByteArray(const ByteArray& byteArray);
+
+    ///
+    /// @brief By default the message data is built in headerByteArray by
+    /// binaryMessageToByteArray(). Messages holding their data in a buffer of
+    /// their own can append it with appendSegment() instead.
+    ///
+    virtual bool binaryMessageToSegments(ByteArray& headerByteArray,
+                                         Array<ByteArray>& segments) const;
 };
 
 }; // namespace Plat4m
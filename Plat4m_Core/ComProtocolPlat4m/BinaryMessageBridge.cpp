@@ -0,0 +1,544 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridge.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridge class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageBridge.h>
+#include <Plat4m_Core/ComProtocolPlat4m/Packet.h>
+#include <Plat4m_Core/MutexLock.h>
+
+using Plat4m::BinaryMessageBridge;
+using Plat4m::ByteArray;
+using Plat4m::ComProtocol;
+using Plat4m::Module;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const std::uint32_t BinaryMessageBridge::myFrameHeaderSize;
+
+const std::uint32_t BinaryMessageBridge::myBatchHeaderSize;
+
+const std::uint32_t BinaryMessageBridge::myRecordHeaderSize;
+
+const std::uint32_t BinaryMessageBridge::myRequestHeaderSize;
+
+const std::uint32_t BinaryMessageBridge::myResponseHeaderSize;
+
+const std::uint16_t BinaryMessageBridge::myBatchMessageId = 0xFFFF;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::BinaryMessageBridge(
+                         const std::uint16_t groupId,
+                         ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                         BinaryMessageFrameHandler& binaryMessageFrameHandler,
+                         const TimeMs flushIntervalMs,
+                         const std::uint32_t nCredits,
+                         const TimeMs creditTimeoutMs) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    myComProtocolPlat4mBinary(comProtocolPlat4mBinary),
+    myGroupId(groupId),
+    myNMaxCredits(nCredits),
+    myCreditTimeoutMs(creditTimeoutMs),
+    myBatchMessageHandler(*this),
+    myEntries(),
+    myNEntries(0),
+    myFlushContext(*(MemoryAllocator::allocate<FlushContext>(*this))),
+    myFlushThread(System::createThread(
+                             createCallback(&myFlushContext,
+                                            &FlushContext::threadCallback),
+                     flushIntervalMs,
+                     0,
+                     false,
+                     "MessageBridge")),
+    myMutex(System::createMutex(myFlushThread)),
+    myQueueByteArray(),
+    myNQueuedSamples(0),
+    myBatchByteArray(),
+    myFrameByteArray(),
+    myNCredits(nCredits),
+    myNCreditsToGive(0),
+    myNoCreditsTimeMs(0),
+    myNFramesSent(0),
+    myNSamplesSent(0),
+    myNSamplesReceived(0),
+    myNDroppedSamples(0),
+    myNCreditTimeouts(0)
+{
+    addMessageHandler(myBatchMessageId, myBatchMessageHandler);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::~BinaryMessageBridge()
+{
+    disable();
+
+    // Like the thread, the context is never deallocated
+    myFlushContext.detach();
+
+    for (std::uint32_t i = 0; i < myNEntries; i++)
+    {
+        myEntries[i]->~Entry();
+        MemoryAllocator::deallocate(myEntries[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint16_t BinaryMessageBridge::getGroupId() const
+{
+    return myGroupId;
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNCredits() const
+{
+    return (myNCredits.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNFramesSent() const
+{
+    return (myNFramesSent.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNSamplesSent() const
+{
+    return (myNSamplesSent.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNSamplesReceived() const
+{
+    return (myNSamplesReceived.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNDroppedSamples() const
+{
+    return (myNDroppedSamples.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::getNCreditTimeouts() const
+{
+    return (myNCreditTimeouts.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods implemented from Module
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Module::Error BinaryMessageBridge::driverSetEnabled(const bool enabled)
+{
+    return (myFlushThread.setEnabled(enabled));
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::Error BinaryMessageBridge::addEntry(Entry* entry)
+{
+    Error error(ERROR_CODE_NONE);
+
+    if (entry->getMessageId() == myBatchMessageId)
+    {
+        error.setCode(ERROR_CODE_MESSAGE_ID_INVALID);
+    }
+    else if (myNEntries == PLAT4M_BINARY_MESSAGE_BRIDGE_MAX_N_ENTRIES)
+    {
+        error.setCode(ERROR_CODE_ENTRY_LIMIT_REACHED);
+    }
+
+    // Both directions may use the same message ID
+    for (std::uint32_t i = 0;
+         (i < myNEntries) && (error.getCode() == ERROR_CODE_NONE);
+         i++)
+    {
+        if ((myEntries[i]->getType() == entry->getType()) &&
+            (myEntries[i]->getMessageId() == entry->getMessageId()))
+        {
+            error.setCode(ERROR_CODE_MESSAGE_ID_IN_USE);
+        }
+    }
+
+    if (error.getCode() != ERROR_CODE_NONE)
+    {
+        entry->~Entry();
+        MemoryAllocator::deallocate(entry);
+
+        return error;
+    }
+
+    myEntries[myNEntries] = entry;
+    myNEntries++;
+
+    if ((entry->getType() == ENTRY_TYPE_EXPORTED_SERVICE) ||
+        (entry->getType() == ENTRY_TYPE_IMPORTED_SERVICE))
+    {
+        addMessageHandler(entry->getMessageId(), *entry);
+    }
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::queueSample(const std::uint16_t messageId,
+                                      const void* data,
+                                      const std::uint32_t dataSizeBytes)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    MutexLock mutexLock(myMutex);
+
+    if ((myQueueByteArray.getSize() + myRecordHeaderSize + dataSizeBytes) >
+                                                myQueueByteArray.getMaxSize())
+    {
+        myNDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+
+    myQueueByteArray.append(messageId, ENDIAN_BIG);
+    myQueueByteArray.append(static_cast<std::uint16_t>(dataSizeBytes),
+                            ENDIAN_BIG);
+    myQueueByteArray.append(static_cast<const std::uint8_t*>(data),
+                            dataSizeBytes);
+    myNQueuedSamples++;
+}
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus BinaryMessageBridge::handleBatch(
+                                                          const ByteArray& data)
+{
+    const std::uint32_t size = data.getSize();
+
+    if (size < myBatchHeaderSize)
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    giveCredits(data[0]);
+
+    std::uint32_t index = myBatchHeaderSize;
+
+    while ((index + myRecordHeaderSize) <= size)
+    {
+        const std::uint16_t messageId = (((std::uint16_t) data[index]) << 8) |
+                                         ((std::uint16_t) data[index + 1]);
+
+        const std::uint16_t dataSize =
+                                   (((std::uint16_t) data[index + 2]) << 8) |
+                                    ((std::uint16_t) data[index + 3]);
+
+        index += myRecordHeaderSize;
+
+        if ((index + dataSize) > size)
+        {
+            break;
+        }
+
+        ByteArray sampleByteArray(data.subArray(index, dataSize));
+
+        for (std::uint32_t i = 0; i < myNEntries; i++)
+        {
+            if ((myEntries[i]->getType() == ENTRY_TYPE_IMPORTED_TOPIC) &&
+                (myEntries[i]->getMessageId() == messageId))
+            {
+                if (myEntries[i]->handleSample(sampleByteArray))
+                {
+                    myNSamplesReceived.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                break;
+            }
+        }
+
+        index += dataSize;
+    }
+
+    // A frame with samples used up one of the other end's credits, give it
+    // back with the next frame
+    if (size > myBatchHeaderSize)
+    {
+        myNCreditsToGive.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::giveCredits(const std::uint32_t nCredits)
+{
+    if (nCredits == 0)
+    {
+        return;
+    }
+
+    std::uint32_t credits = myNCredits.load(std::memory_order_relaxed);
+    std::uint32_t newCredits;
+
+    // Credits reset after a timeout may still be given back late
+    do
+    {
+        newCredits = credits + nCredits;
+
+        if (newCredits > myNMaxCredits)
+        {
+            newCredits = myNMaxCredits;
+        }
+    } while (!(myNCredits.compare_exchange_weak(credits, newCredits)));
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::transmitPayload(const std::uint16_t messageId,
+                                          const ByteArray& payload,
+                                          ByteArray& frameByteArray)
+{
+    PayloadMessage message(myGroupId, messageId, payload);
+    Packet packet;
+    packet.setFrame(message);
+
+    frameByteArray.clear();
+    packet.setData(frameByteArray);
+
+    myComProtocolPlat4mBinary.transmitFrame(packet);
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::flush()
+{
+    std::uint32_t nCreditsToGive = myNCreditsToGive.exchange(0);
+
+    if (nCreditsToGive > 0xFF)
+    {
+        myNCreditsToGive.fetch_add(nCreditsToGive - 0xFF);
+        nCreditsToGive = 0xFF;
+    }
+
+    myBatchByteArray.clear();
+    myBatchByteArray.append(static_cast<std::uint8_t>(nCreditsToGive));
+
+    const std::uint32_t nSamples = takeQueuedSamples();
+
+    if ((nSamples == 0) && (nCreditsToGive == 0))
+    {
+        return;
+    }
+
+    transmitPayload(myBatchMessageId, myBatchByteArray, myFrameByteArray);
+
+    myNFramesSent.fetch_add(1, std::memory_order_relaxed);
+    myNSamplesSent.fetch_add(nSamples, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageBridge::takeQueuedSamples()
+{
+    MutexLock mutexLock(myMutex);
+
+    if (myNQueuedSamples == 0)
+    {
+        return 0;
+    }
+
+    if (myNCredits.load(std::memory_order_relaxed) == 0)
+    {
+        const TimeMs timeMs = System::getTimeMs();
+
+        if (myNoCreditsTimeMs == 0)
+        {
+            myNoCreditsTimeMs = timeMs;
+
+            return 0;
+        }
+
+        if ((timeMs - myNoCreditsTimeMs) < myCreditTimeoutMs)
+        {
+            return 0;
+        }
+
+        // Frames or credits were lost, or the other end restarted
+        myNCredits.store(myNMaxCredits);
+        myNCreditTimeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const std::uint32_t nSamples = myNQueuedSamples;
+
+    myNCredits.fetch_sub(1);
+
+    myBatchByteArray.append(myQueueByteArray);
+    myQueueByteArray.clear();
+    myNQueuedSamples = 0;
+    myNoCreditsTimeMs = 0;
+
+    return nSamples;
+}
+
+//------------------------------------------------------------------------------
+// PayloadMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::PayloadMessage::PayloadMessage(
+                                                const std::uint16_t groupId,
+                                                const std::uint16_t messageId,
+                                                const ByteArray& payload) :
+    BinaryMessage(groupId, messageId),
+    myPayload(payload)
+{
+}
+
+//------------------------------------------------------------------------------
+// PayloadMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridge::PayloadMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myPayload));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridge::PayloadMessage::binaryMessageToSegments(
+                                              ByteArray& headerByteArray,
+                                              Array<ByteArray>& segments) const
+{
+    // Transmitted straight from the queue it was batched in
+    return (appendSegment(segments, myPayload));
+}
+
+//------------------------------------------------------------------------------
+// BatchMessageHandler public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::BatchMessageHandler::BatchMessageHandler(
+                                                 BinaryMessageBridge& bridge) :
+    BinaryMessageHandler(),
+    myBridge(bridge)
+{
+}
+
+//------------------------------------------------------------------------------
+// BatchMessageHandler public methods implemented from BinaryMessageHandler
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+              BinaryMessageBridge::BatchMessageHandler::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    if (requestBinaryMessage.getMessageId() != myBatchMessageId)
+    {
+        return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+    }
+
+    return (myBridge.handleBatch(requestBinaryMessage.getData()));
+}
+
+//------------------------------------------------------------------------------
+// FlushContext public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridge::FlushContext::FlushContext(BinaryMessageBridge& bridge) :
+    myBridge(&bridge),
+    myIsFlushing(false)
+{
+}
+
+//------------------------------------------------------------------------------
+// FlushContext public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::FlushContext::detach()
+{
+    // Pairs with threadCallback(), either the thread sees no bridge or this
+    // sees it flushing and waits
+    myBridge.store(0);
+
+    while (myIsFlushing.load())
+    {
+        System::delayTimeMs(1);
+    }
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridge::FlushContext::threadCallback()
+{
+    myIsFlushing.store(true);
+
+    BinaryMessageBridge* bridge = myBridge.load();
+
+    if (isValidPointer(bridge) && bridge->isEnabled())
+    {
+        bridge->flush();
+    }
+
+    myIsFlushing.store(false);
+}
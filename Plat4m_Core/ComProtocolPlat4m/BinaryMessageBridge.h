@@ -0,0 +1,889 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridge.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridge class header file.
+///
+
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_H
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/ServiceBase.h>
+#include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/CallbackMethod2Parameters.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/Mutex.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/ComProtocol.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageServer.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Maximum number of sample bytes a bridge sends in one frame, each
+/// sample taking 4 more bytes for its message ID and size. A frame is 12 bytes
+/// larger than this. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE 244
+#endif
+
+///
+/// @brief Default time between a bridge's frames. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_FLUSH_INTERVAL_MS
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_FLUSH_INTERVAL_MS 10
+#endif
+
+///
+/// @brief Default number of sample frames a bridge may have in flight before
+/// the other end confirms them. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_N_CREDITS
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_N_CREDITS 4
+#endif
+
+///
+/// @brief Default time a bridge waits without credits before assuming its
+/// frames or the other end's credits were lost. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_CREDIT_TIMEOUT_MS
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_CREDIT_TIMEOUT_MS 1000
+#endif
+
+///
+/// @brief Time a request to an imported Service waits for the other end's
+/// response. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_SERVICE_TIMEOUT_MS
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_SERVICE_TIMEOUT_MS 1000
+#endif
+
+///
+/// @brief Maximum number of Topics and Services one bridge can map. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_MAX_N_ENTRIES
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_MAX_N_ENTRIES 32
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Carries Topics and Services across a ComLink as binary messages of
+/// one group, both ends mapping their local IDs to the same message IDs.
+///
+/// Samples of exported Topics are queued and sent together, one frame per
+/// flush interval, and republished on the imported Topics at the other end.
+/// Each frame of samples uses up a credit, which the other end gives back
+/// with its next frame once it has handled the samples. Without credits
+/// samples stay queued, and once the queue is full new samples are dropped,
+/// so publishers never wait for the link.
+///
+/// Requests to an imported Service are sent right away and wait for the
+/// response, one at a time. Requests from the other end run the exported
+/// Service on the ComLink's parsing thread.
+///
+/// Frames are sent as Packets, so the receiving end needs a PacketFrameHandler
+/// around its BinaryMessageFrameHandler. Samples, requests and responses are
+/// sent as they are in memory, so both ends must lay them out the same way.
+/// The bridge must outlive the Services it imports.
+///
+class BinaryMessageBridge : public BinaryMessageServer
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE,
+        ERROR_CODE_MESSAGE_ID_INVALID,
+        ERROR_CODE_MESSAGE_ID_IN_USE,
+        ERROR_CODE_ENTRY_LIMIT_REACHED
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageBridge(
+            const std::uint16_t groupId,
+            ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+            BinaryMessageFrameHandler& binaryMessageFrameHandler,
+            const TimeMs flushIntervalMs =
+                                 PLAT4M_BINARY_MESSAGE_BRIDGE_FLUSH_INTERVAL_MS,
+            const std::uint32_t nCredits =
+                                         PLAT4M_BINARY_MESSAGE_BRIDGE_N_CREDITS,
+            const TimeMs creditTimeoutMs =
+                                PLAT4M_BINARY_MESSAGE_BRIDGE_CREDIT_TIMEOUT_MS);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~BinaryMessageBridge();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Sends the samples published on the given Topic to the other end
+    /// as the given message.
+    ///
+    template <typename DataType>
+    Error exportTopic(const TopicBase::Id id, const std::uint16_t messageId)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "BinaryMessageBridge requires trivially copyable data");
+
+        static_assert((sizeof(DataType) + myRecordHeaderSize) <=
+                                        PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE,
+                      "Topic data too large for a BinaryMessageBridge frame");
+
+        return (addEntry(
+               MemoryAllocator::allocate<ExportedTopic<DataType>>(*this,
+                                                                  id,
+                                                                  messageId)));
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Publishes the samples the other end sends as the given message
+    /// on the given Topic.
+    ///
+    template <typename DataType>
+    Error importTopic(const TopicBase::Id id, const std::uint16_t messageId)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "BinaryMessageBridge requires trivially copyable data");
+
+        return (addEntry(
+               MemoryAllocator::allocate<ImportedTopic<DataType>>(id,
+                                                                  messageId)));
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Lets the other end make requests to the given Service as the
+    /// given message.
+    ///
+    template <typename RequestType, typename ResponseType>
+    Error exportService(const ServiceBase::Id id,
+                        const std::uint16_t messageId)
+    {
+        static_assert(std::is_trivially_copyable<RequestType>::value &&
+                      std::is_trivially_copyable<ResponseType>::value,
+                      "BinaryMessageBridge requires trivially copyable data");
+
+        return (addEntry(
+                 MemoryAllocator::allocate<
+                      ExportedService<RequestType, ResponseType>>(getGroupId(),
+                                                                  id,
+                                                                  messageId)));
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Creates the given Service locally, its requests are sent to
+    /// the other end as the given message.
+    ///
+    template <typename RequestType, typename ResponseType>
+    Error importService(const ServiceBase::Id id,
+                        const std::uint16_t messageId)
+    {
+        static_assert(std::is_trivially_copyable<RequestType>::value &&
+                      std::is_trivially_copyable<ResponseType>::value,
+                      "BinaryMessageBridge requires trivially copyable data");
+
+        return (addEntry(
+                 MemoryAllocator::allocate<
+                      ImportedService<RequestType, ResponseType>>(*this,
+                                                                  id,
+                                                                  messageId)));
+    }
+
+    std::uint16_t getGroupId() const;
+
+    ///
+    /// @brief Returns the number of sample frames that may still be sent
+    /// before the other end gives credits back.
+    ///
+    std::uint32_t getNCredits() const;
+
+    std::uint32_t getNFramesSent() const;
+
+    std::uint32_t getNSamplesSent() const;
+
+    std::uint32_t getNSamplesReceived() const;
+
+    ///
+    /// @brief Returns the number of samples dropped because the queue was
+    /// full, while waiting for credits or for the next flush.
+    ///
+    std::uint32_t getNDroppedSamples() const;
+
+    ///
+    /// @brief Returns the number of times the credits ran out for longer than
+    /// the credit timeout and were reset.
+    ///
+    std::uint32_t getNCreditTimeouts() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    // Packet identifier and header, then binary message identifier and IDs
+    static const std::uint32_t myFrameHeaderSize = 11;
+
+    // Credits given back
+    static const std::uint32_t myBatchHeaderSize = 1;
+
+    // Message ID and data size
+    static const std::uint32_t myRecordHeaderSize = 4;
+
+    // Kind and transaction ID
+    static const std::uint32_t myRequestHeaderSize = 2;
+
+    // Kind, transaction ID and error code
+    static const std::uint32_t myResponseHeaderSize = 3;
+
+    static const std::uint16_t myBatchMessageId;
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    enum EntryType
+    {
+        ENTRY_TYPE_EXPORTED_TOPIC,
+        ENTRY_TYPE_IMPORTED_TOPIC,
+        ENTRY_TYPE_EXPORTED_SERVICE,
+        ENTRY_TYPE_IMPORTED_SERVICE
+    };
+
+    enum ServiceMessageKind
+    {
+        SERVICE_MESSAGE_KIND_REQUEST = 0,
+        SERVICE_MESSAGE_KIND_RESPONSE
+    };
+
+    enum TransactionState
+    {
+        TRANSACTION_STATE_IDLE = 0,
+        TRANSACTION_STATE_PENDING,
+        TRANSACTION_STATE_RECEIVING,
+        TRANSACTION_STATE_COMPLETE
+    };
+
+    ///
+    /// @brief Binary message with a payload built elsewhere.
+    ///
+    class PayloadMessage : public BinaryMessage
+    {
+    public:
+
+        PayloadMessage(const std::uint16_t groupId,
+                       const std::uint16_t messageId,
+                       const ByteArray& payload);
+
+    private:
+
+        const ByteArray& myPayload;
+
+        bool binaryMessageToByteArray(ByteArray& byteArray) const;
+
+        bool binaryMessageToSegments(ByteArray& headerByteArray,
+                                     Array<ByteArray>& segments) const;
+    };
+
+    ///
+    /// @brief Handles the sample frames, every other message goes to the
+    /// entries for Services.
+    ///
+    class BatchMessageHandler : public BinaryMessageHandler
+    {
+    public:
+
+        BatchMessageHandler(BinaryMessageBridge& bridge);
+
+        ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage);
+
+    private:
+
+        BinaryMessageBridge& myBridge;
+    };
+
+    ///
+    /// @brief What the flush thread calls into. Threads are never destroyed
+    /// and may run once more after being disabled, so this outlives the
+    /// bridge and forgets it when the bridge is destroyed.
+    ///
+    class FlushContext
+    {
+    public:
+
+        FlushContext(BinaryMessageBridge& bridge);
+
+        void detach();
+
+        void threadCallback();
+
+    private:
+
+        std::atomic<BinaryMessageBridge*> myBridge;
+
+        std::atomic<bool> myIsFlushing;
+    };
+
+    class Entry : public BinaryMessageHandler
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        Entry(const EntryType type, const std::uint16_t messageId) :
+            BinaryMessageHandler(),
+            myType(type),
+            myMessageId(messageId)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual ~Entry()
+        {
+        }
+
+        //----------------------------------------------------------------------
+        EntryType getType() const
+        {
+            return myType;
+        }
+
+        //----------------------------------------------------------------------
+        std::uint16_t getMessageId() const
+        {
+            return myMessageId;
+        }
+
+        //----------------------------------------------------------------------
+        virtual ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+        {
+            // Topic samples only arrive in sample frames
+            return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+        }
+
+        //----------------------------------------------------------------------
+        virtual bool handleSample(const ByteArray& sampleByteArray)
+        {
+            return false;
+        }
+
+    private:
+
+        const EntryType myType;
+
+        const std::uint16_t myMessageId;
+    };
+
+    template <typename DataType>
+    class ExportedTopic : public Entry
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ExportedTopic(BinaryMessageBridge& bridge,
+                      const TopicBase::Id topicId,
+                      const std::uint16_t messageId) :
+            Entry(ENTRY_TYPE_EXPORTED_TOPIC, messageId),
+            myBridge(bridge),
+            myTopic(Topic<DataType>::create(topicId)),
+            mySampleCallback(createCallback(this,
+                                            &ExportedTopic::sampleCallback))
+        {
+            myTopic.subscribe(mySampleCallback);
+        }
+
+        //----------------------------------------------------------------------
+        virtual ~ExportedTopic()
+        {
+            myTopic.unsubscribe(mySampleCallback);
+        }
+
+    private:
+
+        BinaryMessageBridge& myBridge;
+
+        Topic<DataType>& myTopic;
+
+        typename Topic<DataType>::SampleCallback& mySampleCallback;
+
+        //----------------------------------------------------------------------
+        void sampleCallback(const TopicSample<DataType>& sample)
+        {
+            myBridge.queueSample(getMessageId(),
+                                 &(sample.data),
+                                 sizeof(DataType));
+        }
+    };
+
+    template <typename DataType>
+    class ImportedTopic : public Entry
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ImportedTopic(const TopicBase::Id topicId,
+                      const std::uint16_t messageId) :
+            Entry(ENTRY_TYPE_IMPORTED_TOPIC, messageId),
+            myTopic(Topic<DataType>::create(topicId))
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual bool handleSample(const ByteArray& sampleByteArray)
+        {
+            if (sampleByteArray.getSize() != sizeof(DataType))
+            {
+                return false;
+            }
+
+            DataType sample;
+            memcpy(&sample, sampleByteArray.getItems(), sizeof(DataType));
+
+            myTopic.publish(sample);
+
+            return true;
+        }
+
+    private:
+
+        Topic<DataType>& myTopic;
+    };
+
+    template <typename RequestType, typename ResponseType>
+    class ExportedService : public Entry
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ExportedService(const std::uint16_t groupId,
+                        const ServiceBase::Id serviceId,
+                        const std::uint16_t messageId) :
+            Entry(ENTRY_TYPE_EXPORTED_SERVICE, messageId),
+            myServiceId(serviceId),
+            myResponseByteArray(),
+            myResponseMessage(groupId, messageId, myResponseByteArray)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+        {
+            const ByteArray& data = requestBinaryMessage.getData();
+
+            if ((requestBinaryMessage.getMessageId() != getMessageId()) ||
+                (data.getSize() < myRequestHeaderSize)                  ||
+                (data[0] != SERVICE_MESSAGE_KIND_REQUEST))
+            {
+                return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+            }
+
+            if (data.getSize() != (myRequestHeaderSize + sizeof(RequestType)))
+            {
+                return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+            }
+
+            RequestType request;
+            memcpy(&request,
+                   data.getItems() + myRequestHeaderSize,
+                   sizeof(RequestType));
+
+            ResponseType response = ResponseType();
+            ServiceBase::Error error =
+                   Service<RequestType, ResponseType>::request(myServiceId,
+                                                               request,
+                                                               response);
+
+            myResponseByteArray.clear();
+            myResponseByteArray.append(static_cast<std::uint8_t>(
+                                               SERVICE_MESSAGE_KIND_RESPONSE));
+            myResponseByteArray.append(data[1]);
+            myResponseByteArray.append(
+                                  static_cast<std::uint8_t>(error.getCode()));
+            myResponseByteArray.append(
+                              reinterpret_cast<const std::uint8_t*>(&response),
+                              sizeof(ResponseType));
+
+            responseBinaryMessage = &myResponseMessage;
+
+            return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+        }
+
+    private:
+
+        const ServiceBase::Id myServiceId;
+
+        ByteArrayN<myResponseHeaderSize + sizeof(ResponseType)>
+                                                            myResponseByteArray;
+
+        PayloadMessage myResponseMessage;
+    };
+
+    template <typename RequestType, typename ResponseType>
+    class ImportedService : public Entry
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ImportedService(BinaryMessageBridge& bridge,
+                        const ServiceBase::Id serviceId,
+                        const std::uint16_t messageId) :
+            Entry(ENTRY_TYPE_IMPORTED_SERVICE, messageId),
+            myBridge(bridge),
+            mySemaphore(System::createSemaphore()),
+            myIsBusy(false),
+            myTransactionId(0),
+            myTransactionState(TRANSACTION_STATE_IDLE),
+            myResponseErrorCode(0),
+            myResponse(),
+            myRequestByteArray(),
+            myFrameByteArray()
+        {
+            Service<RequestType, ResponseType>::create(
+                       serviceId,
+                       createCallback(this, &ImportedService::serviceCallback));
+        }
+
+        //----------------------------------------------------------------------
+        virtual ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+        {
+            const ByteArray& data = requestBinaryMessage.getData();
+
+            if ((requestBinaryMessage.getMessageId() != getMessageId()) ||
+                (data.getSize() < myResponseHeaderSize)                 ||
+                (data[0] != SERVICE_MESSAGE_KIND_RESPONSE))
+            {
+                return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+            }
+
+            if (data.getSize() !=
+                                (myResponseHeaderSize + sizeof(ResponseType)))
+            {
+                return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+            }
+
+            // Responses to requests that timed out are dropped
+            std::uint32_t state =
+                     toTransactionState(TRANSACTION_STATE_PENDING, data[1]);
+
+            if (myTransactionState.compare_exchange_strong(
+                     state,
+                     toTransactionState(TRANSACTION_STATE_RECEIVING, data[1])))
+            {
+                myResponseErrorCode = data[2];
+                memcpy(&myResponse,
+                       data.getItems() + myResponseHeaderSize,
+                       sizeof(ResponseType));
+
+                myTransactionState.store(
+                          toTransactionState(TRANSACTION_STATE_COMPLETE,
+                                             data[1]),
+                          std::memory_order_release);
+                mySemaphore.post();
+            }
+
+            return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+        }
+
+    private:
+
+        BinaryMessageBridge& myBridge;
+
+        Semaphore& mySemaphore;
+
+        std::atomic<bool> myIsBusy;
+
+        std::uint8_t myTransactionId;
+
+        std::atomic<std::uint32_t> myTransactionState;
+
+        std::uint8_t myResponseErrorCode;
+
+        ResponseType myResponse;
+
+        ByteArrayN<myRequestHeaderSize + sizeof(RequestType)>
+                                                             myRequestByteArray;
+
+        ByteArrayN<myFrameHeaderSize +
+                   myRequestHeaderSize +
+                   sizeof(RequestType)> myFrameByteArray;
+
+        //----------------------------------------------------------------------
+        static std::uint32_t toTransactionState(const TransactionState state,
+                                                const std::uint8_t id)
+        {
+            return ((static_cast<std::uint32_t>(state) << 8) | id);
+        }
+
+        //----------------------------------------------------------------------
+        ServiceBase::Error serviceCallback(
+                                 const ServiceRequest<RequestType>& request,
+                                 ServiceResponse<ResponseType>& response)
+        {
+            bool isBusy = false;
+
+            if (!(myIsBusy.compare_exchange_strong(isBusy, true)))
+            {
+                return ServiceBase::Error(
+                                      ServiceBase::ERROR_CODE_REQUEST_PENDING);
+            }
+
+            myTransactionId++;
+
+            const std::uint32_t pendingState =
+                   toTransactionState(TRANSACTION_STATE_PENDING,
+                                      myTransactionId);
+            const std::uint32_t completeState =
+                   toTransactionState(TRANSACTION_STATE_COMPLETE,
+                                      myTransactionId);
+
+            myTransactionState.store(pendingState);
+
+            myRequestByteArray.clear();
+            myRequestByteArray.append(static_cast<std::uint8_t>(
+                                                SERVICE_MESSAGE_KIND_REQUEST));
+            myRequestByteArray.append(myTransactionId);
+            myRequestByteArray.append(
+                         reinterpret_cast<const std::uint8_t*>(&(request.data)),
+                         sizeof(RequestType));
+
+            myBridge.transmitPayload(getMessageId(),
+                                     myRequestByteArray,
+                                     myFrameByteArray);
+
+            const TimeMs timeoutTimeMs =
+                               System::getTimeMs() +
+                               PLAT4M_BINARY_MESSAGE_BRIDGE_SERVICE_TIMEOUT_MS;
+
+            ServiceBase::Error error(ServiceBase::ERROR_CODE_NONE);
+
+            while (myTransactionState.load(std::memory_order_acquire) !=
+                                                                  completeState)
+            {
+                const TimeMs timeMs = System::getTimeMs();
+
+                if (timeMs >= timeoutTimeMs)
+                {
+                    std::uint32_t state = pendingState;
+
+                    if (myTransactionState.compare_exchange_strong(
+                                                       state,
+                                                       TRANSACTION_STATE_IDLE))
+                    {
+                        error.setCode(ServiceBase::ERROR_CODE_TIMEOUT);
+
+                        break;
+                    }
+
+                    // The response is being copied, it won't be long
+                    continue;
+                }
+
+                mySemaphore.wait(timeoutTimeMs - timeMs);
+            }
+
+            if (error.getCode() == ServiceBase::ERROR_CODE_NONE)
+            {
+                response.data = myResponse;
+                error.setCode(
+                     static_cast<ServiceBase::ErrorCode>(myResponseErrorCode));
+                myTransactionState.store(TRANSACTION_STATE_IDLE);
+            }
+
+            myIsBusy.store(false);
+
+            return error;
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    ComProtocolPlat4mBinary& myComProtocolPlat4mBinary;
+
+    const std::uint16_t myGroupId;
+
+    const std::uint32_t myNMaxCredits;
+
+    const TimeMs myCreditTimeoutMs;
+
+    BatchMessageHandler myBatchMessageHandler;
+
+    Entry* myEntries[PLAT4M_BINARY_MESSAGE_BRIDGE_MAX_N_ENTRIES];
+
+    std::uint32_t myNEntries;
+
+    FlushContext& myFlushContext;
+
+    Thread& myFlushThread;
+
+    Mutex& myMutex;
+
+    ByteArrayN<PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE> myQueueByteArray;
+
+    std::uint32_t myNQueuedSamples;
+
+    ByteArrayN<myBatchHeaderSize + PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE>
+                                                               myBatchByteArray;
+
+    ByteArrayN<myFrameHeaderSize +
+               myBatchHeaderSize +
+               PLAT4M_BINARY_MESSAGE_BRIDGE_BATCH_SIZE> myFrameByteArray;
+
+    std::atomic<std::uint32_t> myNCredits;
+
+    std::atomic<std::uint32_t> myNCreditsToGive;
+
+    TimeMs myNoCreditsTimeMs;
+
+    std::atomic<std::uint32_t> myNFramesSent;
+
+    std::atomic<std::uint32_t> myNSamplesSent;
+
+    std::atomic<std::uint32_t> myNSamplesReceived;
+
+    std::atomic<std::uint32_t> myNDroppedSamples;
+
+    std::atomic<std::uint32_t> myNCreditTimeouts;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods implemented from Module
+    //--------------------------------------------------------------------------
+
+    virtual Module::Error driverSetEnabled(const bool enabled) override;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    Error addEntry(Entry* entry);
+
+    void queueSample(const std::uint16_t messageId,
+                     const void* data,
+                     const std::uint32_t dataSizeBytes);
+
+    ComProtocol::ParseStatus handleBatch(const ByteArray& data);
+
+    void giveCredits(const std::uint32_t nCredits);
+
+    void transmitPayload(const std::uint16_t messageId,
+                         const ByteArray& payload,
+                         ByteArray& frameByteArray);
+
+    void flush();
+
+    ///
+    /// @brief Moves the queued samples after the batch header, using up a
+    /// credit, if there is a credit for them.
+    /// @return Number of samples moved.
+    ///
+    std::uint32_t takeQueuedSamples();
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageBridge(const BinaryMessageBridge& bridge);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BINARY_MESSAGE_BRIDGE_H
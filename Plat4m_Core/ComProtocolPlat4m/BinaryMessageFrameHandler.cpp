@@ -44,10 +44,33 @@
 //------------------------------------------------------------------------------
 
 #include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/MutexLock.h>
+#include <Plat4m_Core/System.h>
 
 using Plat4m::BinaryMessageFrameHandler;
+using Plat4m::BinaryMessage;
 using Plat4m::ByteArray;
 using Plat4m::ComProtocol;
+using Plat4m::MutexLock;
+using Plat4m::System;
+using Plat4m::TimeMs;
+using Plat4m::TransactionFrame;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t maxTransactions =
+                          PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS;
+
+static_assert((maxTransactions & (maxTransactions - 1)) == 0,
+              "PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS must be a "
+              "power of 2");
+
+static_assert(maxTransactions <= 0x8000,
+              "PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS must not "
+              "exceed the number of transaction Ids");
 
 //------------------------------------------------------------------------------
 // Private static data members
@@ -65,10 +88,21 @@ BinaryMessageFrameHandler::BinaryMessageFrameHandler(
     FrameHandler(myBinaryMessageFrameIdentifier),
     myComProtocolPlat4mBinary(comProtocolPlat4mBinary),
     myMessageHandlerGroupList(),
-    myExpectedResponseBinaryMessage(0),
-    myIsResponseReceived(false)
+    myMessageHandlerGroupIndex(),
+    myIsMessageHandlerGroupIndexIncomplete(false),
+    myTransactionFrameHandler(*this),
+    myResponseTransactionFrame(),
+    myMutex(System::createMutex(
+                comProtocolPlat4mBinary.getComLink().getDataParsingThread())),
+    myTransactions(),
+    myTransactionSemaphores(),
+    myNextTransactionId(0),
+    myNPendingTransactions(0),
+    myNTransactionTimeouts(0),
+    myLastTimeoutCheckTimeMs(0)
 {
     myComProtocolPlat4mBinary.addFrameHandler(*this);
+    myComProtocolPlat4mBinary.addFrameHandler(myTransactionFrameHandler);
 }
 
 //------------------------------------------------------------------------------
@@ -78,6 +112,28 @@ BinaryMessageFrameHandler::BinaryMessageFrameHandler(
 //------------------------------------------------------------------------------
 BinaryMessageFrameHandler::~BinaryMessageFrameHandler()
 {
+    // Nothing can complete them once this handler is gone
+    for (uint32_t i = 0; i < maxTransactions; i++)
+    {
+        Transaction* transaction = 0;
+
+        {
+            MutexLock mutexLock(myMutex);
+
+            transaction = myTransactions[i];
+
+            if (isValidPointer(transaction))
+            {
+                myTransactions[i] = 0;
+                myNPendingTransactions--;
+            }
+        }
+
+        if (isValidPointer(transaction))
+        {
+            completeTransaction(*transaction, Error(ERROR_CODE_CANCELLED));
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -91,6 +147,41 @@ void BinaryMessageFrameHandler::addMessageHandlerGroup(
     BinaryMessageHandlerGroup* pointer = &messageHandlerGroup;
 
     myMessageHandlerGroupList.append(pointer);
+
+    MessageHandlerGroupIndex::Error error =
+                  myMessageHandlerGroupIndex.insert(pointer->getId(), pointer);
+
+    if (error.getCode() != MessageHandlerGroupIndex::ERROR_CODE_NONE)
+    {
+        // Index is full or the Id is a duplicate, fall back to searching the
+        // list for anything that misses in the index
+        myIsMessageHandlerGroupIndexIncomplete = true;
+    }
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageFrameHandler::removeMessageHandlerGroup(
+                                 BinaryMessageHandlerGroup& messageHandlerGroup)
+{
+    BinaryMessageHandlerGroup* pointer = &messageHandlerGroup;
+
+    myMessageHandlerGroupList.remove(pointer);
+
+    BinaryMessageHandlerGroup* indexedGroup = 0;
+
+    MessageHandlerGroupIndex::Error error =
+                myMessageHandlerGroupIndex.find(pointer->getId(), indexedGroup);
+
+    if ((error.getCode() == MessageHandlerGroupIndex::ERROR_CODE_NONE) &&
+        (indexedGroup == pointer))
+    {
+        myMessageHandlerGroupIndex.remove(pointer->getId());
+    }
+
+    if (myMessageHandlerGroupList.size() == 0)
+    {
+        myIsMessageHandlerGroupIndexIncomplete = false;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -100,21 +191,170 @@ void BinaryMessageFrameHandler::transmitMessage(BinaryMessage& binaryMessage)
 }
 
 //------------------------------------------------------------------------------
-void BinaryMessageFrameHandler::transmitReceiveMessage(
-                                      	   BinaryMessage& requestBinaryMessage,
-										   BinaryMessage& responseBinaryMessage)
+BinaryMessageFrameHandler::Error
+                          BinaryMessageFrameHandler::transmitReceiveMessage(
+                                     BinaryMessage& requestBinaryMessage,
+                                     BinaryMessage& responseBinaryMessage,
+                                     const TimeMs timeoutMs)
+{
+    Transaction transaction;
+
+    Error error = transmitReceiveMessageAsync(requestBinaryMessage,
+                                              responseBinaryMessage,
+                                              transaction,
+                                              0,
+                                              timeoutMs);
+
+    if (error.getCode() != ERROR_CODE_NONE)
+    {
+        return error;
+    }
+
+    // Returns once the transaction completes or times out, so it never
+    // outlives this call
+    return (transaction.wait());
+}
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::Error
+                         BinaryMessageFrameHandler::transmitReceiveMessageAsync(
+                                     BinaryMessage& requestBinaryMessage,
+                                     BinaryMessage& responseBinaryMessage,
+                                     Transaction& transaction,
+                                     CompletionCallback* completionCallback,
+                                     const TimeMs timeoutMs)
 {
-    myIsResponseReceived = false;
-    myExpectedResponseBinaryMessage = &responseBinaryMessage;
+    if (transaction.isPending())
+    {
+        return Error(ERROR_CODE_TRANSACTION_PENDING);
+    }
 
-    myComProtocolPlat4mBinary.transmitFrame(requestBinaryMessage);
+    checkTransactionTimeouts();
+
+    transaction.myFrameHandler = this;
+    transaction.myResponseBinaryMessage = &responseBinaryMessage;
+    transaction.myCompletionCallback = completionCallback;
+    transaction.myTimeoutMs = timeoutMs;
+    transaction.myError = Error(ERROR_CODE_NONE);
 
-    while (!myIsResponseReceived)
     {
-        // Do nothing
+        MutexLock mutexLock(myMutex);
+
+        // Consecutive Ids use consecutive slots, so the next free slot gives
+        // the next Id
+        uint32_t slot = maxTransactions;
+
+        for (uint32_t i = 0; i < maxTransactions; i++)
+        {
+            const uint16_t id =
+                            (myNextTransactionId + i) & TransactionFrame::maxId;
+
+            if (isNullPointer(myTransactions[id & (maxTransactions - 1)]))
+            {
+                transaction.myId = id;
+                slot = id & (maxTransactions - 1);
+
+                break;
+            }
+        }
+
+        if (slot == maxTransactions)
+        {
+            return Error(ERROR_CODE_TRANSACTIONS_FULL);
+        }
+
+        if (isNullPointer(myTransactionSemaphores[slot]))
+        {
+            myTransactionSemaphores[slot] = &(System::createSemaphore());
+        }
+
+        myNextTransactionId = (transaction.myId + 1) & TransactionFrame::maxId;
+
+        transaction.mySemaphore = myTransactionSemaphores[slot];
+        transaction.myStartTimeMs = System::getTimeMs();
+        transaction.myIsPending.store(true, std::memory_order_release);
+
+        myTransactions[slot] = &transaction;
+        myNPendingTransactions++;
+    }
+
+    TransactionFrame transactionFrame(transaction.myId,
+                                      false,
+                                      requestBinaryMessage);
+
+    if (!(myComProtocolPlat4mBinary.transmitFrameSegments(transactionFrame)))
+    {
+        // Never sent, so no response can complete it
+        takeTransaction(transaction.myId);
+        transaction.myIsPending.store(false, std::memory_order_release);
+
+        return Error(ERROR_CODE_REQUEST_TOO_LARGE);
     }
 
-    myExpectedResponseBinaryMessage = 0;
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageFrameHandler::checkTransactionTimeouts()
+{
+    if (myNPendingTransactions.load() == 0)
+    {
+        return;
+    }
+
+    // Timeouts are in milliseconds, so once per millisecond is often enough
+    const TimeMs checkTimeMs = System::getTimeMs();
+
+    if (myLastTimeoutCheckTimeMs.exchange(checkTimeMs) == checkTimeMs)
+    {
+        return;
+    }
+
+    Transaction* timedOutTransactions[maxTransactions];
+    uint32_t nTimedOutTransactions = 0;
+
+    {
+        MutexLock mutexLock(myMutex);
+
+        // Read under the lock, a transaction started after an earlier read
+        // would look like it started in the future
+        const TimeMs timeMs = System::getTimeMs();
+
+        for (uint32_t i = 0; i < maxTransactions; i++)
+        {
+            Transaction* transaction = myTransactions[i];
+
+            if (isValidPointer(transaction)              &&
+                (transaction->myTimeoutMs != 0xFFFFFFFF) &&
+                ((timeMs - transaction->myStartTimeMs) >=
+                                                    transaction->myTimeoutMs))
+            {
+                myTransactions[i] = 0;
+                myNPendingTransactions--;
+
+                timedOutTransactions[nTimedOutTransactions] = transaction;
+                nTimedOutTransactions++;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < nTimedOutTransactions; i++)
+    {
+        completeTransaction(*(timedOutTransactions[i]),
+                            Error(ERROR_CODE_TIMEOUT));
+    }
+}
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageFrameHandler::getNPendingTransactions() const
+{
+    return (myNPendingTransactions.load());
+}
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageFrameHandler::getNTransactionTimeouts() const
+{
+    return (myNTransactionTimeouts.load());
 }
 
 //------------------------------------------------------------------------------
@@ -135,6 +375,8 @@ ComProtocol::ParseStatus BinaryMessageFrameHandler::driverHandleFrame(
     ComProtocol::ParseStatus parseStatus =
                                     ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
 
+    checkTransactionTimeouts();
+
     ByteArray frameData = requestFrame.getData();
 
     if (frameData.getSize() < 4)
@@ -154,51 +396,374 @@ ComProtocol::ParseStatus BinaryMessageFrameHandler::driverHandleFrame(
     BinaryMessage requestBinaryMessage(groupId, messageId, messageData);
     BinaryMessage* responseBinaryMessage = 0;
 
-    if (isValidPointer(myExpectedResponseBinaryMessage))
+    parseStatus = dispatchMessage(requestBinaryMessage, responseBinaryMessage);
+
+    if ((parseStatus == ComProtocol::PARSE_STATUS_FOUND_FRAME) &&
+        isValidPointer(responseBinaryMessage))
     {
-        if ((requestBinaryMessage.getGroupId() ==
-                               myExpectedResponseBinaryMessage->getGroupId()) &&
-            (requestBinaryMessage.getMessageId() ==
-                               myExpectedResponseBinaryMessage->getMessageId()))
+        responseFrame = responseBinaryMessage;
+    }
+
+    return parseStatus;
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus BinaryMessageFrameHandler::dispatchMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    ComProtocol::ParseStatus parseStatus =
+                                    ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+
+    const uint16_t groupId = requestBinaryMessage.getGroupId();
+    BinaryMessageHandlerGroup* indexedGroup = 0;
+
+    MessageHandlerGroupIndex::Error error =
+                       myMessageHandlerGroupIndex.find(groupId, indexedGroup);
+
+    if (error.getCode() == MessageHandlerGroupIndex::ERROR_CODE_NONE)
+    {
+        parseStatus = indexedGroup->handleMessage(requestBinaryMessage,
+                                                  responseBinaryMessage);
+    }
+
+    if (myIsMessageHandlerGroupIndexIncomplete)
+    {
+        List<BinaryMessageHandlerGroup*>::Iterator iterator =
+                                           myMessageHandlerGroupList.iterator();
+
+        while (iterator.hasCurrent() &&
+               (parseStatus != ComProtocol::PARSE_STATUS_FOUND_FRAME) &&
+               (parseStatus != ComProtocol::PARSE_STATUS_MID_FRAME))
         {
-            myIsResponseReceived =
-                 myExpectedResponseBinaryMessage->parseMessageData(messageData);
+            BinaryMessageHandlerGroup* messageHandlerGroup =
+                                                            iterator.current();
 
-            if (myIsResponseReceived)
+            if ((messageHandlerGroup != indexedGroup) &&
+                (messageHandlerGroup->getId() == groupId))
             {
-                parseStatus = ComProtocol::PARSE_STATUS_FOUND_FRAME;
+                parseStatus = messageHandlerGroup->handleMessage(
+                                                         requestBinaryMessage,
+                                                         responseBinaryMessage);
             }
 
-            return parseStatus;
+            iterator.next();
         }
     }
 
-    List<BinaryMessageHandlerGroup*>::Iterator iterator =
-                                           myMessageHandlerGroupList.iterator();
+    return parseStatus;
+}
 
-    while (iterator.hasCurrent())
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus BinaryMessageFrameHandler::handleTransactionFrame(
+                                                      const Frame& requestFrame,
+                                                      Frame*& responseFrame)
+{
+    checkTransactionTimeouts();
+
+    const ByteArray& frameData = requestFrame.getData();
+
+    if (frameData.getSize() < TransactionFrame::headerSize)
     {
-        BinaryMessageHandlerGroup* messageHandlerGroup = iterator.current();
+        return ComProtocol::PARSE_STATUS_MID_FRAME;
+    }
 
-        parseStatus = messageHandlerGroup->handleMessage(requestBinaryMessage,
-                                                         responseBinaryMessage);
+    uint16_t id = (((uint16_t) frameData[0]) << 8) |
+                   ((uint16_t) frameData[1]);
+
+    uint16_t dataByteCount = (((uint16_t) frameData[2]) << 8) |
+                              ((uint16_t) frameData[3]);
+
+    const uint32_t frameDataSize =
+                          TransactionFrame::headerSize + (uint32_t) dataByteCount;
 
-        if (parseStatus == ComProtocol::PARSE_STATUS_FOUND_FRAME)
+    if (frameData.getSize() < frameDataSize)
+    {
+        return ComProtocol::PARSE_STATUS_MID_FRAME;
+    }
+
+    // Only binary messages are carried, identifier, group Id and message Id
+    ByteArray embeddedFrameData =
+               frameData.subArray(TransactionFrame::headerSize, dataByteCount);
+
+    if ((dataByteCount < 5) ||
+        (embeddedFrameData[0] != myBinaryMessageFrameIdentifier))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    uint16_t groupId = (((uint16_t) embeddedFrameData[1]) << 8) |
+                        ((uint16_t) embeddedFrameData[2]);
+
+    uint16_t messageId = (((uint16_t) embeddedFrameData[3]) << 8) |
+                          ((uint16_t) embeddedFrameData[4]);
+
+    ByteArray messageData = embeddedFrameData.subArray(5);
+
+    if ((id & TransactionFrame::responseFlag) != 0)
+    {
+        Transaction* transaction =
+                                  takeTransaction(id & TransactionFrame::maxId);
+
+        // Otherwise it already timed out and nobody is waiting for it
+        if (isValidPointer(transaction))
         {
-            if (isValidPointer(responseBinaryMessage))
+            BinaryMessage& responseBinaryMessage =
+                                        *(transaction->myResponseBinaryMessage);
+            Error error(ERROR_CODE_NONE);
+
+            if ((responseBinaryMessage.getGroupId() != groupId)     ||
+                (responseBinaryMessage.getMessageId() != messageId) ||
+                !(responseBinaryMessage.parseMessageData(messageData)))
             {
-                responseFrame = responseBinaryMessage;
+                error.setCode(ERROR_CODE_RESPONSE_INVALID);
             }
 
-            break;
+            completeTransaction(*transaction, error);
         }
-        else if (parseStatus == ComProtocol::PARSE_STATUS_MID_FRAME)
+
+        return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+    }
+
+    BinaryMessage requestBinaryMessage(groupId, messageId, messageData);
+    BinaryMessage* responseBinaryMessage = 0;
+
+    ComProtocol::ParseStatus parseStatus =
+                  dispatchMessage(requestBinaryMessage, responseBinaryMessage);
+
+    if ((parseStatus == ComProtocol::PARSE_STATUS_FOUND_FRAME) &&
+        isValidPointer(responseBinaryMessage))
+    {
+        myResponseTransactionFrame.setId(id);
+        myResponseTransactionFrame.setIsResponse(true);
+        myResponseTransactionFrame.setFrame(*responseBinaryMessage);
+
+        responseFrame = &myResponseTransactionFrame;
+    }
+
+    return parseStatus;
+}
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::Transaction*
+                  BinaryMessageFrameHandler::takeTransaction(const uint16_t id)
+{
+    const uint32_t slot = id & (maxTransactions - 1);
+    MutexLock mutexLock(myMutex);
+
+    Transaction* transaction = myTransactions[slot];
+
+    if (isNullPointer(transaction) || (transaction->myId != id))
+    {
+        return 0;
+    }
+
+    myTransactions[slot] = 0;
+    myNPendingTransactions--;
+
+    return transaction;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageFrameHandler::completeTransaction(Transaction& transaction,
+                                                    Error error)
+{
+    if (error.getCode() == ERROR_CODE_TIMEOUT)
+    {
+        myNTransactionTimeouts++;
+    }
+
+    transaction.myError = error;
+
+    if (isValidPointer(transaction.myCompletionCallback))
+    {
+        transaction.myCompletionCallback->call(transaction);
+    }
+
+    // The transaction may be gone as soon as it stops pending
+    Semaphore* semaphore = transaction.mySemaphore;
+
+    transaction.myIsPending.store(false, std::memory_order_release);
+
+    semaphore->post();
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageFrameHandler::cancelTransaction(Transaction& transaction,
+                                                  Error error)
+{
+    const uint32_t slot = transaction.myId & (maxTransactions - 1);
+    bool isCancelled = false;
+
+    {
+        MutexLock mutexLock(myMutex);
+
+        if (myTransactions[slot] == &transaction)
         {
-            break;
+            myTransactions[slot] = 0;
+            myNPendingTransactions--;
+
+            isCancelled = true;
         }
+    }
 
-        iterator.next();
+    if (isCancelled)
+    {
+        completeTransaction(transaction, error);
     }
 
-    return parseStatus;
+    return isCancelled;
+}
+
+//------------------------------------------------------------------------------
+// Transaction public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::Transaction::Transaction() :
+    myFrameHandler(0),
+    myResponseBinaryMessage(0),
+    myCompletionCallback(0),
+    mySemaphore(0),
+    myStartTimeMs(0),
+    myTimeoutMs(0),
+    myId(0),
+    myError(ERROR_CODE_NONE),
+    myIsPending(false)
+{
+}
+
+//------------------------------------------------------------------------------
+// Transaction public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageFrameHandler::Transaction::isPending() const
+{
+    return (myIsPending.load(std::memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::Error BinaryMessageFrameHandler::Transaction::wait(
+                                                       const TimeMs waitTimeMs)
+{
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    while (isPending())
+    {
+        const TimeMs timeMs = System::getTimeMs();
+        TimeMs remainingTimeMs = 0xFFFFFFFF;
+
+        if (myTimeoutMs != 0xFFFFFFFF)
+        {
+            const TimeMs elapsedTimeMs = timeMs - myStartTimeMs;
+
+            if (elapsedTimeMs >= myTimeoutMs)
+            {
+                // If this loses to the thread completing the transaction, that
+                // thread posts the semaphore once it's done
+                myFrameHandler->cancelTransaction(*this,
+                                                  Error(ERROR_CODE_TIMEOUT));
+            }
+            else
+            {
+                remainingTimeMs = myTimeoutMs - elapsedTimeMs;
+            }
+        }
+
+        if (waitTimeMs != 0xFFFFFFFF)
+        {
+            const TimeMs elapsedTimeMs = timeMs - startTimeMs;
+
+            if (elapsedTimeMs >= waitTimeMs)
+            {
+                return Error(ERROR_CODE_TIMEOUT);
+            }
+
+            if ((waitTimeMs - elapsedTimeMs) < remainingTimeMs)
+            {
+                remainingTimeMs = waitTimeMs - elapsedTimeMs;
+            }
+        }
+
+        // The semaphore is shared with earlier transactions in the same slot
+        // and may hold their posts, so the state is always rechecked
+        if (isPending())
+        {
+            mySemaphore->wait(remainingTimeMs);
+        }
+    }
+
+    return myError;
+}
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::Error
+                       BinaryMessageFrameHandler::Transaction::getError() const
+{
+    return myError;
+}
+
+//------------------------------------------------------------------------------
+uint16_t BinaryMessageFrameHandler::Transaction::getId() const
+{
+    return myId;
+}
+
+//------------------------------------------------------------------------------
+BinaryMessage&
+          BinaryMessageFrameHandler::Transaction::getResponseBinaryMessage()
+{
+    return *myResponseBinaryMessage;
+}
+
+//------------------------------------------------------------------------------
+// TransactionFrameHandler public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageFrameHandler::TransactionFrameHandler::TransactionFrameHandler(
+                                     BinaryMessageFrameHandler& frameHandler) :
+    FrameHandler(TransactionFrame::frameIdentifier),
+    myFrameHandler(frameHandler)
+{
+}
+
+//------------------------------------------------------------------------------
+// TransactionFrameHandler private methods implemented from FrameHandler
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+        BinaryMessageFrameHandler::TransactionFrameHandler::driverHandleFrame(
+                                                      const Frame& requestFrame,
+                                                      Frame*& responseFrame)
+{
+    return (myFrameHandler.handleTransactionFrame(requestFrame, responseFrame));
+}
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+          BinaryMessageFrameHandler::TransactionFrameHandler::driverScanFrame(
+                                                        const Frame& frame,
+                                                        uint32_t& frameDataSize)
+{
+    const ByteArray& frameData = frame.getData();
+
+    // Id and data byte count have to arrive before the size is known
+    if (frameData.getSize() < TransactionFrame::headerSize)
+    {
+        return ComProtocol::PARSE_STATUS_MID_FRAME;
+    }
+
+    uint16_t dataByteCount = (((uint16_t) frameData[2]) << 8) |
+                              ((uint16_t) frameData[3]);
+
+    frameDataSize = TransactionFrame::headerSize + dataByteCount;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
 }
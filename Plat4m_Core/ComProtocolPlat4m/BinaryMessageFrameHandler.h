@@ -50,10 +50,49 @@
 #include <Plat4m_Core/ByteArrayN.h>
 #include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandlerGroup.h>
 #include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IdHashIndexN.h>
 #include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/TransactionFrame.h>
 #include <Plat4m_Core/ComProtocol.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/Callback.h>
+#include <Plat4m_Core/Mutex.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/TimeStamp.h>
 
 #include <stdint.h>
+#include <atomic>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of entries in the BinaryMessageFrameHandler group Id hash
+/// index. Must be a power of 2, up to 3/4 of it can be indexed. Groups beyond
+/// that are still found by a linear search. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_INDEX_SIZE
+#define PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_INDEX_SIZE 64
+#endif
+
+///
+/// @brief Maximum number of request/response transactions in flight at once
+/// per BinaryMessageFrameHandler. Must be a power of 2. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS
+#define PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS 64
+#endif
+
+///
+/// @brief Default time a transaction waits for its response. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_TRANSACTION_TIMEOUT_MS
+#define PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_TRANSACTION_TIMEOUT_MS 1000
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -70,6 +109,94 @@ class BinaryMessageFrameHandler : public FrameHandler
 {
 public:
 
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE = 0,
+        ERROR_CODE_TRANSACTION_PENDING,
+        ERROR_CODE_TRANSACTIONS_FULL,
+        ERROR_CODE_REQUEST_TOO_LARGE,
+        ERROR_CODE_TIMEOUT,
+        ERROR_CODE_RESPONSE_INVALID,
+        ERROR_CODE_CANCELLED
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    class Transaction;
+
+    ///
+    /// @brief Called on the thread that completed the transaction (the ComLink
+    /// parsing thread, or whichever thread found it timed out), just before
+    /// the transaction completes.
+    ///
+    typedef Callback<void, Transaction&> CompletionCallback;
+
+    ///
+    /// @brief Handle for one request/response transaction. Must stay alive
+    /// until the transaction completes, and can be reused once it has.
+    ///
+    class Transaction
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        // Public constructors
+        //----------------------------------------------------------------------
+
+        Transaction();
+
+        //----------------------------------------------------------------------
+        // Public methods
+        //----------------------------------------------------------------------
+
+        bool isPending() const;
+
+        ///
+        /// @brief Waits for the transaction to complete. The transaction
+        /// times out while waiting if its own timeout passes first.
+        /// @param waitTimeMs Time to wait, 0xFFFFFFFF to wait forever.
+        /// @return ERROR_CODE_TIMEOUT if the transaction is still pending,
+        /// otherwise the error it completed with.
+        ///
+        Error wait(const TimeMs waitTimeMs = 0xFFFFFFFF);
+
+        Error getError() const;
+
+        uint16_t getId() const;
+
+        BinaryMessage& getResponseBinaryMessage();
+
+    private:
+
+        //----------------------------------------------------------------------
+        // Private data members
+        //----------------------------------------------------------------------
+
+        friend class BinaryMessageFrameHandler;
+
+        BinaryMessageFrameHandler* myFrameHandler;
+
+        BinaryMessage* myResponseBinaryMessage;
+
+        CompletionCallback* myCompletionCallback;
+
+        Semaphore* mySemaphore;
+
+        TimeMs myStartTimeMs;
+
+        TimeMs myTimeoutMs;
+
+        uint16_t myId;
+
+        Error myError;
+
+        std::atomic<bool> myIsPending;
+    };
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
@@ -88,15 +215,80 @@ public:
 
     void addMessageHandlerGroup(BinaryMessageHandlerGroup& messageHandlerGroup);
 
+    void removeMessageHandlerGroup(
+                                BinaryMessageHandlerGroup& messageHandlerGroup);
+
     void transmitMessage(BinaryMessage& binaryMessage);
 
-    void transmitReceiveMessage(BinaryMessage& requestBinaryMessage,
-                                BinaryMessage& responseBinaryMessage);
+    ///
+    /// @brief Transmits a request and waits for its response, which is parsed
+    /// into responseBinaryMessage.
+    ///
+    Error transmitReceiveMessage(
+                      BinaryMessage& requestBinaryMessage,
+                      BinaryMessage& responseBinaryMessage,
+                      const TimeMs timeoutMs =
+                    PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_TRANSACTION_TIMEOUT_MS);
+
+    ///
+    /// @brief Transmits a request without waiting for its response, so many
+    /// can be in flight on the link at once. The transaction completes when
+    /// the response is parsed into responseBinaryMessage or when it times out.
+    /// @param completionCallback Optional, see CompletionCallback.
+    ///
+    Error transmitReceiveMessageAsync(
+                      BinaryMessage& requestBinaryMessage,
+                      BinaryMessage& responseBinaryMessage,
+                      Transaction& transaction,
+                      CompletionCallback* completionCallback = 0,
+                      const TimeMs timeoutMs =
+                    PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_TRANSACTION_TIMEOUT_MS);
+
+    ///
+    /// @brief Times out transactions whose response is overdue. Done whenever
+    /// a frame arrives or a transaction starts, a link that has gone quiet
+    /// needs this called periodically for asynchronous transactions nobody
+    /// waits on.
+    ///
+    void checkTransactionTimeouts();
+
+    uint32_t getNPendingTransactions() const;
+
+    uint32_t getNTransactionTimeouts() const;
 
     void transmitFrame(Frame& frame);
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef IdHashIndexN<BinaryMessageHandlerGroup*,
+                         PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_INDEX_SIZE>
+                                                       MessageHandlerGroupIndex;
+
+    ///
+    /// @brief Handles the transaction frames, which have their own frame
+    /// identifier, on behalf of the BinaryMessageFrameHandler.
+    ///
+    class TransactionFrameHandler : public FrameHandler
+    {
+    public:
+
+        TransactionFrameHandler(BinaryMessageFrameHandler& frameHandler);
+
+    private:
+
+        BinaryMessageFrameHandler& myFrameHandler;
+
+        ComProtocol::ParseStatus driverHandleFrame(const Frame& requestFrame,
+                                                   Frame*& responseFrame);
+
+        ComProtocol::ParseStatus driverScanFrame(const Frame& frame,
+                                                 uint32_t& frameDataSize);
+    };
+
     //--------------------------------------------------------------------------
     // Private static data members
     //--------------------------------------------------------------------------
@@ -111,9 +303,32 @@ private:
 
     List<BinaryMessageHandlerGroup*> myMessageHandlerGroupList;
 
-    BinaryMessage* myExpectedResponseBinaryMessage;
+    MessageHandlerGroupIndex myMessageHandlerGroupIndex;
+
+    bool myIsMessageHandlerGroupIndexIncomplete;
+
+    TransactionFrameHandler myTransactionFrameHandler;
+
+    TransactionFrame myResponseTransactionFrame;
+
+    // Shared with the ComLink parsing thread that completes transactions
+    Mutex& myMutex;
+
+    // Indexed by transaction Id
+    Transaction* myTransactions[
+                          PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS];
+
+    // Created the first time their slot is used
+    Semaphore* myTransactionSemaphores[
+                          PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS];
+
+    uint16_t myNextTransactionId;
+
+    std::atomic<uint32_t> myNPendingTransactions;
 
-    bool myIsResponseReceived;
+    std::atomic<uint32_t> myNTransactionTimeouts;
+
+    std::atomic<TimeMs> myLastTimeoutCheckTimeMs;
 
     //--------------------------------------------------------------------------
     // Private methods implemented from FrameHandler
@@ -121,6 +336,23 @@ private:
 
     ComProtocol::ParseStatus driverHandleFrame(const Frame& requestFrame,
                                                Frame*& responseFrame);
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    ComProtocol::ParseStatus dispatchMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage);
+
+    ComProtocol::ParseStatus handleTransactionFrame(const Frame& requestFrame,
+                                                    Frame*& responseFrame);
+
+    Transaction* takeTransaction(const uint16_t id);
+
+    void completeTransaction(Transaction& transaction, Error error);
+
+    bool cancelTransaction(Transaction& transaction, Error error);
 };
 
 }; // namespace Plat4m
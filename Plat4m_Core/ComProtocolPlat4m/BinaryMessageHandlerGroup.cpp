@@ -56,7 +56,10 @@ using Plat4m::ComProtocol;
 //------------------------------------------------------------------------------
 BinaryMessageHandlerGroup::BinaryMessageHandlerGroup(
                                                 const uint16_t messageGroupId) :
-    myId(messageGroupId)
+    myId(messageGroupId),
+    myMessageHandlerList(),
+    myUnindexedMessageHandlerList(),
+    myMessageHandlerIndex()
 {
 }
 
@@ -88,6 +91,24 @@ void BinaryMessageHandlerGroup::addMessageHandler(
     myMessageHandlerList.append(pointer);
 }
 
+//------------------------------------------------------------------------------
+void BinaryMessageHandlerGroup::addMessageHandler(
+                                           const uint16_t messageId,
+                                           BinaryMessageHandler& messageHandler)
+{
+    MessageHandlerIndex::Error error =
+                    myMessageHandlerIndex.insert(messageId, &messageHandler);
+
+    if (error.getCode() != MessageHandlerIndex::ERROR_CODE_NONE)
+    {
+        MessageHandlerEntry entry;
+        entry.messageId = messageId;
+        entry.messageHandler = &messageHandler;
+
+        myUnindexedMessageHandlerList.append(entry);
+    }
+}
+
 //------------------------------------------------------------------------------
 ComProtocol::ParseStatus BinaryMessageHandlerGroup::handleMessage(
                                       const BinaryMessage& requestBinaryMessage,
@@ -101,6 +122,48 @@ ComProtocol::ParseStatus BinaryMessageHandlerGroup::handleMessage(
         return parseStatus;
     }
 
+    const uint16_t messageId = requestBinaryMessage.getMessageId();
+    BinaryMessageHandler* indexedMessageHandler = 0;
+
+    MessageHandlerIndex::Error error =
+                   myMessageHandlerIndex.find(messageId, indexedMessageHandler);
+
+    if (error.getCode() == MessageHandlerIndex::ERROR_CODE_NONE)
+    {
+        parseStatus = indexedMessageHandler->handleMessage(
+                                                         requestBinaryMessage,
+                                                         responseBinaryMessage);
+
+        if ((parseStatus == ComProtocol::PARSE_STATUS_FOUND_FRAME) ||
+            (parseStatus == ComProtocol::PARSE_STATUS_MID_FRAME))
+        {
+            return parseStatus;
+        }
+    }
+
+    List<MessageHandlerEntry>::Iterator entryIterator =
+                                       myUnindexedMessageHandlerList.iterator();
+
+    while (entryIterator.hasCurrent())
+    {
+        const MessageHandlerEntry& entry = entryIterator.current();
+
+        if (entry.messageId == messageId)
+        {
+            parseStatus = entry.messageHandler->handleMessage(
+                                                         requestBinaryMessage,
+                                                         responseBinaryMessage);
+
+            if ((parseStatus == ComProtocol::PARSE_STATUS_FOUND_FRAME) ||
+                (parseStatus == ComProtocol::PARSE_STATUS_MID_FRAME))
+            {
+                return parseStatus;
+            }
+        }
+
+        entryIterator.next();
+    }
+
     List<BinaryMessageHandler*>::Iterator iterator =
                                                 myMessageHandlerList.iterator();
 
@@ -49,10 +49,25 @@
 #include <stdint.h>
 
 #include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IdHashIndexN.h>
 #include <Plat4m_Core/ComProtocol.h>
 #include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
 #include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandler.h>
 
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of entries in each BinaryMessageHandlerGroup message Id hash
+/// index. Must be a power of 2, up to 3/4 of it can be indexed. Handlers beyond
+/// that are still found by a linear search. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_BINARY_MESSAGE_HANDLER_GROUP_INDEX_SIZE
+#define PLAT4M_BINARY_MESSAGE_HANDLER_GROUP_INDEX_SIZE 32
+#endif
+
 //------------------------------------------------------------------------------
 // Namespaces
 //------------------------------------------------------------------------------
@@ -86,14 +101,40 @@ public:
 
     uint16_t getId() const;
 
+    ///
+    /// @brief Adds a handler that is offered every message of this group, in
+    /// the order handlers were added, until one takes it.
+    ///
     void addMessageHandler(BinaryMessageHandler& messageHandler);
 
+    ///
+    /// @brief Adds a handler that is only offered messages with the given Id,
+    /// found without searching. Offered before the handlers added without an
+    /// Id.
+    ///
+    void addMessageHandler(const uint16_t messageId,
+                           BinaryMessageHandler& messageHandler);
+
     ComProtocol::ParseStatus handleMessage(
                                       const BinaryMessage& requestBinaryMessage,
                                       BinaryMessage*& responseBinaryMessage);
 
 private:
-    
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef IdHashIndexN<BinaryMessageHandler*,
+                         PLAT4M_BINARY_MESSAGE_HANDLER_GROUP_INDEX_SIZE>
+                                                            MessageHandlerIndex;
+
+    struct MessageHandlerEntry
+    {
+        uint16_t messageId;
+        BinaryMessageHandler* messageHandler;
+    };
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
@@ -101,6 +142,11 @@ private:
     uint16_t myId;
 
     List<BinaryMessageHandler*> myMessageHandlerList;
+
+    // Handlers added with an Id that the index is full or already has
+    List<MessageHandlerEntry> myUnindexedMessageHandlerList;
+
+    MessageHandlerIndex myMessageHandlerIndex;
 };
 
 }; // namespace Plat4m
@@ -75,6 +75,8 @@ BinaryMessageServer::BinaryMessageServer(
 //------------------------------------------------------------------------------
 BinaryMessageServer::~BinaryMessageServer()
 {
+    myBinaryMessageFrameHandler.removeMessageHandlerGroup(
+                                                   myBinaryMessageHandlerGroup);
 }
 
 //------------------------------------------------------------------------------
@@ -88,6 +90,14 @@ void BinaryMessageServer::addMessageHandler(
     myBinaryMessageHandlerGroup.addMessageHandler(messageHandler);
 }
 
+//------------------------------------------------------------------------------
+void BinaryMessageServer::addMessageHandler(
+                                           const uint16_t messageId,
+                                           BinaryMessageHandler& messageHandler)
+{
+    myBinaryMessageHandlerGroup.addMessageHandler(messageId, messageHandler);
+}
+
 //------------------------------------------------------------------------------
 void BinaryMessageServer::transmitMessage(BinaryMessage& binaryMessage)
 {
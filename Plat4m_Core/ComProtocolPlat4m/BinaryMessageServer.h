@@ -108,6 +108,9 @@ protected:
 
     void addMessageHandler(BinaryMessageHandler& messageHandler);
 
+    void addMessageHandler(const uint16_t messageId,
+                           BinaryMessageHandler& messageHandler);
+
     void transmitMessage(BinaryMessage& binaryMessage);
 
     void transmitFrame(Frame& frame);
@@ -65,7 +65,9 @@ ComProtocolPlat4mAscii::ComProtocolPlat4mAscii(ComLink& comLink,
     myParameterValueStorage(),
     myParameterValueStorageArray(),
     myAsciiMessageTemplate(),
-    myMessageHandlerList()
+    myMessageHandlerList(),
+    myScanIndex(0),
+    myIsStartFound(false)
 {
     for (uint32_t i = 0; i < arraySize(myParameterNameStorage); i++)
     {
@@ -182,6 +184,49 @@ ComProtocol::ParseStatus ComProtocolPlat4mAscii::driverParseData(
 	return parseStatus;
 }
 
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComProtocolPlat4mAscii::driverScanData(
+                                                  const ByteArray& rxByteArray,
+                                                  uint32_t& frameSize)
+{
+    const uint32_t size = rxByteArray.getSize();
+
+    if (!myIsStartFound)
+    {
+        // Frames have to start at the first byte, ComLink drops bytes that no
+        // protocol recognizes to get back in sync
+        if ((size == 0) ||
+            (rxByteArray[0] != (uint8_t) AsciiMessage::getStartCharacter()))
+        {
+            return PARSE_STATUS_NOT_A_FRAME;
+        }
+
+        myIsStartFound = true;
+        myScanIndex    = 1;
+    }
+
+    // Bytes before myScanIndex were already scanned on a previous call
+    for (; myScanIndex < size; myScanIndex++)
+    {
+        if (rxByteArray[myScanIndex] ==
+                                    (uint8_t) AsciiMessage::getEndCharacter())
+        {
+            frameSize = myScanIndex + 1;
+
+            return PARSE_STATUS_FOUND_FRAME;
+        }
+    }
+
+    return PARSE_STATUS_MID_FRAME;
+}
+
+//------------------------------------------------------------------------------
+void ComProtocolPlat4mAscii::driverResetParser()
+{
+    myScanIndex    = 0;
+    myIsStartFound = false;
+}
+
 //------------------------------------------------------------------------------
 // Private methods
 //------------------------------------------------------------------------------
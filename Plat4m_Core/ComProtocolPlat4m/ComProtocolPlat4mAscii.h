@@ -136,6 +136,10 @@ private:
 
     List<AsciiMessageHandler*> myMessageHandlerList;
 
+    uint32_t myScanIndex;
+
+    bool myIsStartFound;
+
     //--------------------------------------------------------------------------
     // Private methods implemented from ComProtocol
     //--------------------------------------------------------------------------
@@ -144,6 +148,10 @@ private:
 	                            ByteArray& txByteArray,
 	                            Callback<>*& followUpCallback);
 
+    ParseStatus driverScanData(const ByteArray& rxByteArray,
+                               uint32_t& frameSize);
+
+    void driverResetParser();
 };
 
 }; // namespace Plat4m
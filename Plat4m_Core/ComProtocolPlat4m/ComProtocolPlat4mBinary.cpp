@@ -44,10 +44,13 @@
 //------------------------------------------------------------------------------
 
 #include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ArrayN.h>
 
 using Plat4m::ComProtocolPlat4mBinary;
 using Plat4m::ComProtocol;
 using Plat4m::ByteArray;
+using Plat4m::ByteArrayN;
+using Plat4m::ArrayN;
 
 //------------------------------------------------------------------------------
 // Public constructors
@@ -57,7 +60,10 @@ using Plat4m::ByteArray;
 ComProtocolPlat4mBinary::ComProtocolPlat4mBinary(ComLink& comLink) :
     ComProtocol(100, comLink),
 	myFrameHandlerList(),
-	myReceiveMessageByteArray()
+    myFrameHandlerTable(),
+    myHasSharedFrameIdentifiers(false),
+	myReceiveMessageByteArray(),
+	myFrameSize(0)
 {
 }
 
@@ -79,17 +85,52 @@ void ComProtocolPlat4mBinary::addFrameHandler(FrameHandler& messageHandler)
 {
     FrameHandler* pointer = &messageHandler;
     myFrameHandlerList.append(pointer);
+
+    const uint8_t frameIdentifier = pointer->getFrameIdentifier();
+
+    if (isNullPointer(myFrameHandlerTable[frameIdentifier]))
+    {
+        myFrameHandlerTable[frameIdentifier] = pointer;
+    }
+    else
+    {
+        // Handlers sharing an identifier each get a chance at the frame in the
+        // order they were added, which only the list keeps
+        myHasSharedFrameIdentifiers = true;
+    }
 }
 
 //------------------------------------------------------------------------------
 void ComProtocolPlat4mBinary::transmitFrame(Frame& frame,
                                             const bool waitUntilDone)
 {
+    if (transmitFrameSegments(frame, waitUntilDone))
+    {
+        return;
+    }
+
     frame.toByteArray(frame.getData());
 
     getComLink().transmitBytes(frame.getData(), waitUntilDone);
 }
 
+//------------------------------------------------------------------------------
+bool ComProtocolPlat4mBinary::transmitFrameSegments(const Frame& frame,
+                                                    const bool waitUntilDone)
+{
+    ByteArrayN<PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_HEADER_SIZE> headerByteArray;
+    ArrayN<ByteArray, PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_MAX_SEGMENTS> segments;
+
+    if (!(frame.toSegments(headerByteArray, segments)))
+    {
+        return false;
+    }
+
+    getComLink().transmitSegments(segments, waitUntilDone);
+
+    return true;
+}
+
 //------------------------------------------------------------------------------
 void ComProtocolPlat4mBinary::transmitReceiveFrame(Frame& transmitFrame,
                                                    Frame& receiveFrame)
@@ -101,6 +142,59 @@ void ComProtocolPlat4mBinary::transmitReceiveFrame(Frame& transmitFrame,
     getComLink().transmitBytes(transmitFrame.getData(), true);
 }
 
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComProtocolPlat4mBinary::handleFrame(
+                                                   FrameHandler& frameHandler,
+                                                   const Frame& requestFrame,
+                                                   ByteArray& transmitByteArray)
+{
+    Frame* responseFrame = 0;
+
+    ParseStatus parseStatus = frameHandler.handleFrame(requestFrame,
+                                                       responseFrame);
+
+    if (parseStatus == PARSE_STATUS_FOUND_FRAME)
+    {
+        if (isValidPointer(responseFrame))
+        {
+            // TODO: Move this further up the parsing chain so things like
+            // CRCs can be calculated before now
+            responseFrame->toByteArray(transmitByteArray);
+        }
+
+//        Callback<>* handlerFollowUpCallback =
+//                                        frameHandler.getFollowUpCallback();
+//
+//        if (isValidPointer(handlerFollowUpCallback))
+//        {
+//            followUpCallback = handlerFollowUpCallback;
+//        }
+    }
+
+    return parseStatus;
+}
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComProtocolPlat4mBinary::scanFrame(
+                                                    FrameHandler& frameHandler,
+                                                    const Frame& frame)
+{
+    uint32_t frameDataSize = 0;
+
+    ParseStatus parseStatus = frameHandler.scanFrame(frame, frameDataSize);
+
+    if ((parseStatus == PARSE_STATUS_FOUND_FRAME) && (frameDataSize != 0))
+    {
+        myFrameSize = 1 + frameDataSize;
+    }
+
+    return parseStatus;
+}
+
 //------------------------------------------------------------------------------
 // Private methods implemented from ComProtocol
 //------------------------------------------------------------------------------
@@ -122,42 +216,114 @@ ComProtocol::ParseStatus ComProtocolPlat4mBinary::driverParseData(
     ByteArray frameData(receiveByteArray.subArray(1));
     Frame requestFrame(frameIdentifier, frameData);
 
+    if (!myHasSharedFrameIdentifiers)
+    {
+        FrameHandler* frameHandler = myFrameHandlerTable[frameIdentifier];
+
+        if (isNullPointer(frameHandler))
+        {
+            return PARSE_STATUS_UNSUPPORTED_FRAME;
+        }
+
+        return (handleFrame(*frameHandler, requestFrame, transmitByteArray));
+    }
+
     List<FrameHandler*>::Iterator iterator = myFrameHandlerList.iterator();
 
     while (iterator.hasCurrent())
     {
         FrameHandler* frameHandler = iterator.current();
 
-        Frame* responseFrame = 0;
+        parseStatus = handleFrame(*frameHandler,
+                                  requestFrame,
+                                  transmitByteArray);
+
+        if ((parseStatus == PARSE_STATUS_FOUND_FRAME) ||
+            (parseStatus == PARSE_STATUS_MID_FRAME))
+        {
+            break;
+        }
+
+        iterator.next();
+    }
+
+	return parseStatus;
+}
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComProtocolPlat4mBinary::driverScanData(
+                                              const ByteArray& receiveByteArray,
+                                              uint32_t& frameSize)
+{
+    const uint32_t size = receiveByteArray.getSize();
+
+    if (size == 0)
+    {
+        return PARSE_STATUS_NOT_A_FRAME;
+    }
+
+    // Once the header has been seen only the byte count is checked
+    if (myFrameSize == 0)
+    {
+        const uint8_t frameIdentifier = receiveByteArray[0];
+        ByteArray frameData(receiveByteArray.subArray(1));
+        Frame frame(frameIdentifier, frameData);
+
+        ParseStatus parseStatus = PARSE_STATUS_NOT_A_FRAME;
 
-        parseStatus = frameHandler->handleFrame(requestFrame, responseFrame);
+        if (!myHasSharedFrameIdentifiers)
+        {
+            FrameHandler* frameHandler = myFrameHandlerTable[frameIdentifier];
 
-        if (parseStatus == PARSE_STATUS_FOUND_FRAME)
+            if (isValidPointer(frameHandler))
+            {
+                parseStatus = scanFrame(*frameHandler, frame);
+            }
+        }
+        else
         {
-            if (isValidPointer(responseFrame))
+            List<FrameHandler*>::Iterator iterator =
+                                                 myFrameHandlerList.iterator();
+
+            while (iterator.hasCurrent() &&
+                   (parseStatus != PARSE_STATUS_MID_FRAME) &&
+                   (parseStatus != PARSE_STATUS_FOUND_FRAME))
             {
-                // TODO: Move this further up the parsing chain so things like
-                // CRCs can be calculated before now
-                responseFrame->toByteArray(transmitByteArray);
+                parseStatus = scanFrame(*(iterator.current()), frame);
+
+                iterator.next();
             }
+        }
 
-//            Callback<>* handlerFollowUpCallback =
-//                                            frameHandler->getFollowUpCallback();
-//
-//            if (isValidPointer(handlerFollowUpCallback))
-//            {
-//                followUpCallback = handlerFollowUpCallback;
-//            }
+        if (parseStatus == PARSE_STATUS_MID_FRAME)
+        {
+            return parseStatus;
+        }
 
-            break;
+        if ((parseStatus == PARSE_STATUS_FOUND_FRAME) && (myFrameSize == 0))
+        {
+            // Handler can't delimit its frames, let it parse it all
+            return parseStatus;
         }
-        else if (parseStatus == PARSE_STATUS_MID_FRAME)
+
+        if (myFrameSize == 0)
         {
-            break;
+            return PARSE_STATUS_NOT_A_FRAME;
         }
+    }
 
-        iterator.next();
+    if (size < myFrameSize)
+    {
+        return PARSE_STATUS_MID_FRAME;
     }
 
-	return parseStatus;
+    frameSize = myFrameSize;
+
+    return PARSE_STATUS_FOUND_FRAME;
+}
+
+//------------------------------------------------------------------------------
+void ComProtocolPlat4mBinary::driverResetParser()
+{
+    myFrameSize = 0;
 }
@@ -58,6 +58,28 @@
 #include <Plat4m_Core/ComProtocolPlat4m/Message.h>
 #include <Plat4m_Core/ComProtocolPlat4m/FrameHandler.h>
 
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Size of the buffer frame headers are built in when a frame is
+/// transmitted as segments, on the stack of the transmitting thread. Frames
+/// that don't fit are copied into their own data instead. Can be overridden
+/// in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_HEADER_SIZE
+#define PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_HEADER_SIZE 256
+#endif
+
+///
+/// @brief Maximum number of segments a transmitted frame can be split into.
+/// Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_MAX_SEGMENTS
+#define PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_MAX_SEGMENTS 8
+#endif
+
 //------------------------------------------------------------------------------
 // Namespaces
 //------------------------------------------------------------------------------
@@ -108,8 +130,19 @@ public:
 
     void transmitFrame(Frame& frame, const bool waitUntilDone = false);
 
+    ///
+    /// @brief Transmits the frame as a gather list, see Frame::toSegments().
+    /// @return False if the frame doesn't fit in
+    /// PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_HEADER_SIZE and
+    /// PLAT4M_COM_PROTOCOL_PLAT4M_BINARY_MAX_SEGMENTS, nothing is transmitted.
+    ///
+    bool transmitFrameSegments(const Frame& frame,
+                               const bool waitUntilDone = false);
+
     void transmitReceiveFrame(Frame& transmitFrame, Frame& receiveFrame);
 
+    using ComProtocol::getComLink;
+
 private:
     
     //--------------------------------------------------------------------------
@@ -118,8 +151,25 @@ private:
 
     List<FrameHandler*> myFrameHandlerList;
 
+    // Indexed by frame identifier, the first handler added for each
+    FrameHandler* myFrameHandlerTable[256];
+
+    bool myHasSharedFrameIdentifiers;
+
     ByteArrayN<256> myReceiveMessageByteArray;
 
+    uint32_t myFrameSize;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    ParseStatus handleFrame(FrameHandler& frameHandler,
+                            const Frame& requestFrame,
+                            ByteArray& transmitByteArray);
+
+    ParseStatus scanFrame(FrameHandler& frameHandler, const Frame& frame);
+
     //--------------------------------------------------------------------------
     // Private methods implemented from ComProtocol
     //--------------------------------------------------------------------------
@@ -127,6 +177,11 @@ private:
 	ParseStatus driverParseData(const ByteArray& receiveByteArray,
 	                            ByteArray& transmitByteArray,
 	                            Callback<>*& followUpCallback);
+
+    ParseStatus driverScanData(const ByteArray& receiveByteArray,
+                               uint32_t& frameSize);
+
+    void driverResetParser();
 };
 
 }; // namespace Plat4m
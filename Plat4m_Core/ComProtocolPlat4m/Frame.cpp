@@ -47,6 +47,7 @@
 
 using Plat4m::Frame;
 using Plat4m::ByteArray;
+using Plat4m::Array;
 
 //------------------------------------------------------------------------------
 // Public constructors
@@ -108,7 +109,19 @@ const ByteArray& Frame::getData() const
 //------------------------------------------------------------------------------
 bool Frame::toByteArray(ByteArray& byteArray) const
 {
-    return (byteArray.append(myIdentifier) & frameToByteArray(byteArray));
+    // Sequenced so the identifier is always appended before the frame
+    return (byteArray.append(myIdentifier) && frameToByteArray(byteArray));
+}
+
+//------------------------------------------------------------------------------
+bool Frame::toSegments(ByteArray& headerByteArray,
+                       Array<ByteArray>& segments) const
+{
+    const uint32_t headerIndex = headerByteArray.getSize();
+
+    return (headerByteArray.append(myIdentifier)                            &&
+            appendSegment(segments, headerByteArray.subArray(headerIndex)) &&
+            frameToSegments(headerByteArray, segments));
 }
 
 //------------------------------------------------------------------------------
@@ -132,6 +145,33 @@ void Frame::setIdentifier(const uint8_t identifier)
     myIdentifier = identifier;
 }
 
+//------------------------------------------------------------------------------
+bool Frame::appendSegment(Array<ByteArray>& segments, const ByteArray& segment)
+{
+    if (segment.getSize() == 0)
+    {
+        return true;
+    }
+
+    const uint32_t nSegments = segments.getSize();
+
+    if (nSegments > 0)
+    {
+        ByteArray& lastSegment = segments[nSegments - 1];
+
+        // Consecutive headers written to the same header array end up as one
+        // segment
+        if (((lastSegment.getItems() + lastSegment.getSize()) ==
+                                                         segment.getItems()) &&
+            lastSegment.setSize(lastSegment.getSize() + segment.getSize()))
+        {
+            return true;
+        }
+    }
+
+    return (segments.append(segment));
+}
+
 //------------------------------------------------------------------------------
 void Frame::setData(ByteArray& byteArray)
 {
@@ -155,3 +195,13 @@ bool Frame::frameParseByteArray(const ByteArray& data)
     // Intentionally blank, not implemented by subclass
     return true;
 }
+
+//------------------------------------------------------------------------------
+bool Frame::frameToSegments(ByteArray& headerByteArray,
+                            Array<ByteArray>& segments) const
+{
+    const uint32_t index = headerByteArray.getSize();
+
+    return (frameToByteArray(headerByteArray) &&
+            appendSegment(segments, headerByteArray.subArray(index)));
+}
@@ -48,6 +48,7 @@
 
 #include <Plat4m_Core/Plat4m.h>
 #include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/Array.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -96,6 +97,16 @@ public:
 
     bool toByteArray(ByteArray& byteArray) const;
 
+    ///
+    /// @brief Appends the frame to a gather list for transmitting with
+    /// ComLink::transmitSegments(). Bytes the frame builds (identifiers,
+    /// headers) are appended to headerByteArray and pointed to from there,
+    /// payloads held elsewhere are pointed to without being copied.
+    /// @return False if headerByteArray or segments is too small.
+    ///
+    bool toSegments(ByteArray& headerByteArray,
+                    Array<ByteArray>& segments) const;
+
     bool parseByteArray(const ByteArray& data);
 
     void setData(ByteArray& data);
@@ -108,6 +119,12 @@ protected:
 
     void setIdentifier(const uint8_t identifier);
 
+    ///
+    /// @brief Appends segment to segments, extending the last segment instead
+    /// if segment follows on from it in memory. Empty segments are skipped.
+    ///
+    static bool appendSegment(Array<ByteArray>& segments,
+                              const ByteArray& segment);
 
 private:
     
@@ -126,6 +143,14 @@ private:
     virtual bool frameToByteArray(ByteArray& byteArray) const;
 
     virtual bool frameParseByteArray(const ByteArray& data);
+
+    ///
+    /// @brief By default the frame is built in headerByteArray by
+    /// frameToByteArray(), subclasses override this to point at their
+    /// payload instead.
+    ///
+    virtual bool frameToSegments(ByteArray& headerByteArray,
+                                 Array<ByteArray>& segments) const;
 };
 
 }; // namespace Plat4m
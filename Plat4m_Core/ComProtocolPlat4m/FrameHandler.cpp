@@ -52,6 +52,12 @@ using Plat4m::ComProtocol;
 // Public methods
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+uint8_t FrameHandler::getFrameIdentifier() const
+{
+    return myFrameIdentifier;
+}
+
 //------------------------------------------------------------------------------
 ComProtocol::ParseStatus FrameHandler::handleFrame(const Frame& requestFrame,
                                                    Frame*& responseFrame)
@@ -64,6 +70,20 @@ ComProtocol::ParseStatus FrameHandler::handleFrame(const Frame& requestFrame,
     return driverHandleFrame(requestFrame, responseFrame);
 }
 
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus FrameHandler::scanFrame(const Frame& frame,
+                                                 uint32_t& frameDataSize)
+{
+    frameDataSize = 0;
+
+    if (frame.getIdentifier() != myFrameIdentifier)
+    {
+        return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+    }
+
+    return driverScanFrame(frame, frameDataSize);
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
@@ -82,3 +102,15 @@ FrameHandler::FrameHandler(const uint8_t frameIdentifier) :
 FrameHandler::~FrameHandler()
 {
 }
+
+//------------------------------------------------------------------------------
+// Private virtual methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus FrameHandler::driverScanFrame(const Frame& frame,
+                                                       uint32_t& frameDataSize)
+{
+    // Size unknown, the frame is handled against the whole receive buffer
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
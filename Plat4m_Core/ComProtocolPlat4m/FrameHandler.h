@@ -69,9 +69,24 @@ public:
     // Public methods
     //--------------------------------------------------------------------------
 
+    uint8_t getFrameIdentifier() const;
+
     ComProtocol::ParseStatus handleFrame(const Frame& requestFrame,
                                          Frame*& responseFrame);
 
+    ///
+    /// @brief Works out how many frame data bytes the (possibly partially
+    /// received) frame spans, so the frame can be delimited before it is
+    /// handled.
+    /// @param frameDataSize Set to the size of the frame data, or 0 if this
+    /// handler can't tell (the whole receive buffer is then handled).
+    /// @return PARSE_STATUS_UNSUPPORTED_FRAME if the identifier doesn't match,
+    /// PARSE_STATUS_MID_FRAME if more bytes are needed to tell the size,
+    /// otherwise PARSE_STATUS_FOUND_FRAME.
+    ///
+    ComProtocol::ParseStatus scanFrame(const Frame& frame,
+                                       uint32_t& frameDataSize);
+
 protected:
 
     //--------------------------------------------------------------------------
@@ -101,6 +116,13 @@ private:
     virtual ComProtocol::ParseStatus driverHandleFrame(
                                                      const Frame& requestFrame,
                                                      Frame*& responseFrame) = 0;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods
+    //--------------------------------------------------------------------------
+
+    virtual ComProtocol::ParseStatus driverScanFrame(const Frame& frame,
+                                                     uint32_t& frameDataSize);
 };
 
 }; // namespace Plat4m
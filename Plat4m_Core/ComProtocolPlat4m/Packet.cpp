@@ -49,6 +49,8 @@
 
 using Plat4m::Packet;
 using Plat4m::Frame;
+using Plat4m::ByteArray;
+using Plat4m::Array;
 
 //------------------------------------------------------------------------------
 // Private static data members
@@ -163,6 +165,11 @@ void Packet::setFrame(Frame& frame)
 //------------------------------------------------------------------------------
 bool Packet::frameToByteArray(ByteArray& byteArray) const
 {
+    // The header follows whatever is already in the array (the packet
+    // identifier at least), so it's patched relative to where it starts
+    const uint32_t headerIndex = byteArray.getSize();
+    const uint32_t dataIndex = headerIndex + 5;
+
     uint16_t dataByteCount = 0;
     uint16_t crc = 0;
 
@@ -177,15 +184,15 @@ bool Packet::frameToByteArray(ByteArray& byteArray) const
         return false;
     }
 
-    dataByteCount = byteArray.getSize() - 5;
+    dataByteCount = byteArray.getSize() - dataIndex;
 
-    byteArray[2] = (dataByteCount >> 8) & 0xFF;
-    byteArray[3] = dataByteCount & 0xFF;
+    byteArray[headerIndex + 1] = (dataByteCount >> 8) & 0xFF;
+    byteArray[headerIndex + 2] = dataByteCount & 0xFF;
 
-    crc = Crc::calculateCrc16Ccitt(byteArray.subArray(5));
+    crc = Crc::calculateCrc16Ccitt(byteArray.subArray(dataIndex));
 
-    byteArray[4] = (crc >> 8) & 0xFF;
-    byteArray[5] = crc & 0xFF;
+    byteArray[headerIndex + 3] = (crc >> 8) & 0xFF;
+    byteArray[headerIndex + 4] = crc & 0xFF;
 
     return true;
 }
@@ -208,3 +215,63 @@ bool Packet::frameParseByteArray(const ByteArray& byteArray)
             (myDataByteCount == (byteArray.getSize() - 5)) &&
             myFrame->parseByteArray(byteArray.subArray(5)));
 }
+
+//------------------------------------------------------------------------------
+bool Packet::frameToSegments(ByteArray& headerByteArray,
+                             Array<ByteArray>& segments) const
+{
+    // Header space is reserved up front and filled in once the embedded
+    // frame is in the list, nothing after it has to move
+    const uint32_t headerIndex = headerByteArray.getSize();
+
+    uint16_t dataByteCount = 0;
+    uint16_t crc = 0;
+
+    bool toSegmentsSucceeded =
+          (headerByteArray.append(myNumber,      ENDIAN_BIG)                &&
+           headerByteArray.append(dataByteCount, ENDIAN_BIG)                &&
+           headerByteArray.append(crc,           ENDIAN_BIG)                &&
+           appendSegment(segments, headerByteArray.subArray(headerIndex)));
+
+    if (!toSegmentsSucceeded)
+    {
+        return false;
+    }
+
+    // The embedded frame starts after the header, partway into the segment
+    // the header ended up in
+    const uint32_t dataSegmentIndex = segments.getSize() - 1;
+    const uint32_t dataOffset = segments[dataSegmentIndex].getSize();
+
+    if (!(myFrame->toSegments(headerByteArray, segments)))
+    {
+        return false;
+    }
+
+    Crc::Crc16CcittCalculator crcCalculator;
+    const uint32_t nSegments = segments.getSize();
+
+    for (uint32_t i = dataSegmentIndex; i < nSegments; i++)
+    {
+        const uint8_t* data = segments[i].getItems();
+        uint32_t size = segments[i].getSize();
+
+        if (i == dataSegmentIndex)
+        {
+            data += dataOffset;
+            size -= dataOffset;
+        }
+
+        crcCalculator.update(data, size);
+        dataByteCount += size;
+    }
+
+    crc = crcCalculator.getValue();
+
+    headerByteArray[headerIndex + 1] = (dataByteCount >> 8) & 0xFF;
+    headerByteArray[headerIndex + 2] = dataByteCount & 0xFF;
+    headerByteArray[headerIndex + 3] = (crc >> 8) & 0xFF;
+    headerByteArray[headerIndex + 4] = crc & 0xFF;
+
+    return true;
+}
@@ -140,6 +140,9 @@ private:
     bool frameToByteArray(ByteArray& byteArray) const;
 
     bool frameParseByteArray(const ByteArray& data);
+
+    bool frameToSegments(ByteArray& headerByteArray,
+                         Array<ByteArray>& segments) const;
 };
 
 }; // namespace Plat4m
@@ -177,3 +177,24 @@ ComProtocol::ParseStatus PacketFrameHandler::driverHandleFrame(
 
     return parseStatus;
 }
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus PacketFrameHandler::driverScanFrame(
+                                                        const Frame& frame,
+                                                        uint32_t& frameDataSize)
+{
+    const ByteArray& frameData = frame.getData();
+
+    // Number, data byte count and CRC have to arrive before the size is known
+    if (frameData.getSize() < 5)
+    {
+        return ComProtocol::PARSE_STATUS_MID_FRAME;
+    }
+
+    uint16_t dataByteCount = (((uint16_t) frameData[1]) << 8) |
+                              ((uint16_t) frameData[2]);
+
+    frameDataSize = 5 + dataByteCount;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
@@ -115,6 +115,9 @@ private:
 
     ComProtocol::ParseStatus driverHandleFrame(const Frame& requestFrame,
                                                Frame*& responseFrame);
+
+    ComProtocol::ParseStatus driverScanFrame(const Frame& frame,
+                                             uint32_t& frameDataSize);
 };
 
 }; // namespace Plat4m
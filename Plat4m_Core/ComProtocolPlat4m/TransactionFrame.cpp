@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TransactionFrame.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TransactionFrame class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Plat4m_Core/ComProtocolPlat4m/TransactionFrame.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+
+using Plat4m::TransactionFrame;
+using Plat4m::Frame;
+using Plat4m::ByteArray;
+using Plat4m::Array;
+
+//------------------------------------------------------------------------------
+// Public static data members
+//------------------------------------------------------------------------------
+
+const uint8_t TransactionFrame::frameIdentifier = 0xA3;
+
+const uint16_t TransactionFrame::maxId = 0x7FFF;
+
+const uint16_t TransactionFrame::responseFlag = 0x8000;
+
+const uint32_t TransactionFrame::headerSize = 4;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TransactionFrame::TransactionFrame() :
+    Frame(frameIdentifier),
+    myId(0),
+    myIsResponse(false),
+    myFrame(0)
+{
+}
+
+//------------------------------------------------------------------------------
+TransactionFrame::TransactionFrame(const uint16_t id,
+                                   const bool isResponse,
+                                   Frame& frame) :
+    Frame(frameIdentifier),
+    myId(id & maxId),
+    myIsResponse(isResponse),
+    myFrame(&frame)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TransactionFrame::~TransactionFrame()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint16_t TransactionFrame::getId() const
+{
+    return myId;
+}
+
+//------------------------------------------------------------------------------
+void TransactionFrame::setId(const uint16_t id)
+{
+    myId = id & maxId;
+}
+
+//------------------------------------------------------------------------------
+bool TransactionFrame::isResponse() const
+{
+    return myIsResponse;
+}
+
+//------------------------------------------------------------------------------
+void TransactionFrame::setIsResponse(const bool isResponse)
+{
+    myIsResponse = isResponse;
+}
+
+//------------------------------------------------------------------------------
+const Frame& TransactionFrame::getFrame() const
+{
+    return *myFrame;
+}
+
+//------------------------------------------------------------------------------
+void TransactionFrame::setFrame(Frame& frame)
+{
+    myFrame = &frame;
+}
+
+//------------------------------------------------------------------------------
+// Private methods implemented from Frame
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TransactionFrame::frameToByteArray(ByteArray& byteArray) const
+{
+    // Same as Packet, the byte count is patched once the embedded frame has
+    // been appended after it
+    const uint32_t headerIndex = byteArray.getSize();
+    const uint32_t dataIndex = headerIndex + headerSize;
+    uint16_t id = myId;
+    uint16_t dataByteCount = 0;
+
+    if (myIsResponse)
+    {
+        id |= responseFlag;
+    }
+
+    bool toByteArraySucceeded = (byteArray.append(id,            ENDIAN_BIG) &&
+                                 byteArray.append(dataByteCount, ENDIAN_BIG) &&
+                                 myFrame->toByteArray(byteArray));
+
+    if (!toByteArraySucceeded)
+    {
+        return false;
+    }
+
+    dataByteCount = byteArray.getSize() - dataIndex;
+
+    byteArray[headerIndex + 2] = (dataByteCount >> 8) & 0xFF;
+    byteArray[headerIndex + 3] = dataByteCount & 0xFF;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool TransactionFrame::frameParseByteArray(const ByteArray& byteArray)
+{
+    if (byteArray.getSize() < headerSize)
+    {
+        return false;
+    }
+
+    ByteArrayParser byteArrayParser(byteArray,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    uint16_t id = 0;
+    uint16_t dataByteCount = 0;
+
+    if (!(byteArrayParser.parse(id) && byteArrayParser.parse(dataByteCount)))
+    {
+        return false;
+    }
+
+    myId = id & maxId;
+    myIsResponse = ((id & responseFlag) != 0);
+
+    return (isValidPointer(myFrame)                                 &&
+            (dataByteCount == (byteArray.getSize() - headerSize)) &&
+            myFrame->parseByteArray(byteArray.subArray(headerSize)));
+}
+
+//------------------------------------------------------------------------------
+bool TransactionFrame::frameToSegments(ByteArray& headerByteArray,
+                                       Array<ByteArray>& segments) const
+{
+    // Same as Packet, the byte count is reserved and filled in once the
+    // embedded frame is in the list
+    const uint32_t headerIndex = headerByteArray.getSize();
+    uint16_t id = myId;
+    uint16_t dataByteCount = 0;
+
+    if (myIsResponse)
+    {
+        id |= responseFlag;
+    }
+
+    bool toSegmentsSucceeded =
+          (headerByteArray.append(id,            ENDIAN_BIG)                &&
+           headerByteArray.append(dataByteCount, ENDIAN_BIG)                &&
+           appendSegment(segments, headerByteArray.subArray(headerIndex)));
+
+    if (!toSegmentsSucceeded)
+    {
+        return false;
+    }
+
+    const uint32_t dataSegmentIndex = segments.getSize() - 1;
+    const uint32_t dataOffset = segments[dataSegmentIndex].getSize();
+
+    if (!(myFrame->toSegments(headerByteArray, segments)))
+    {
+        return false;
+    }
+
+    const uint32_t nSegments = segments.getSize();
+
+    for (uint32_t i = dataSegmentIndex; i < nSegments; i++)
+    {
+        dataByteCount += segments[i].getSize();
+    }
+
+    dataByteCount -= dataOffset;
+
+    headerByteArray[headerIndex + 2] = (dataByteCount >> 8) & 0xFF;
+    headerByteArray[headerIndex + 3] = dataByteCount & 0xFF;
+
+    return true;
+}
@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TransactionFrame.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TransactionFrame class header file.
+///
+
+#ifndef PLAT4M_TRANSACTION_FRAME_H
+#define PLAT4M_TRANSACTION_FRAME_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include <Plat4m_Core/ComProtocolPlat4m/Frame.h>
+#include <Plat4m_Core/ByteArray.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Frame carrying a request or response frame tagged with a
+/// transaction Id, so responses can be matched to requests however many are
+/// in flight. Laid out as the transaction Id (top bit set for responses), the
+/// embedded frame byte count and the embedded frame.
+///
+class TransactionFrame : public Frame
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public static data members
+    //--------------------------------------------------------------------------
+
+    static const uint8_t frameIdentifier;
+
+    static const uint16_t maxId;
+
+    // Set in the transmitted Id of responses
+    static const uint16_t responseFlag;
+
+    // Transaction Id and data byte count
+    static const uint32_t headerSize;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    TransactionFrame();
+
+    TransactionFrame(const uint16_t id,
+                     const bool isResponse,
+                     Frame& frame);
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~TransactionFrame();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    uint16_t getId() const;
+
+    void setId(const uint16_t id);
+
+    bool isResponse() const;
+
+    void setIsResponse(const bool isResponse);
+
+    const Frame& getFrame() const;
+
+    void setFrame(Frame& frame);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    uint16_t myId;
+
+    bool myIsResponse;
+
+    Frame* myFrame;
+
+    //--------------------------------------------------------------------------
+    // Private methods implemented from Frame
+    //--------------------------------------------------------------------------
+
+    bool frameToByteArray(ByteArray& byteArray) const;
+
+    bool frameParseByteArray(const ByteArray& data);
+
+    bool frameToSegments(ByteArray& headerByteArray,
+                         Array<ByteArray>& segments) const;
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TRANSACTION_FRAME_H
@@ -47,6 +47,15 @@
 //------------------------------------------------------------------------------
 
 #include <stdint.h>
+#include <string.h>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ByteArray.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <nmmintrin.h>
+#define PLAT4M_CRC_SSE42_ENABLED
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -68,6 +77,312 @@ namespace Crc
 
     static const uint16_t crc16CcittPlynomial = 0x8005;
 
+    // Bit reversed polynomials, as used by the reflected table driven engine
+    static const uint16_t crc16CcittPolynomialReflected = 0xA001;
+    static const uint32_t crc32PolynomialReflected      = 0xEDB88320;
+    static const uint32_t crc32cPolynomialReflected     = 0x82F63B78;
+
+    //--------------------------------------------------------------------------
+    // Classes
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Reflected (LSB first) CRC engine using slice-by-8 lookup tables
+    /// generated at compile time. CRC-32C uses the SSE4.2 crc32 instruction
+    /// when the CPU supports it.
+    /// @tparam TCrc CRC value type, uint16_t or uint32_t.
+    /// @tparam polynomial Bit reversed polynomial.
+    /// @tparam initialValue Value the CRC register starts at.
+    /// @tparam finalXorValue Value XORed with the CRC register by getValue().
+    ///
+    template <typename TCrc,
+              TCrc polynomial,
+              TCrc initialValue,
+              TCrc finalXorValue>
+    class Calculator
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        // Public types
+        //----------------------------------------------------------------------
+
+        struct Table
+        {
+            TCrc values[8][256];
+        };
+
+        //----------------------------------------------------------------------
+        // Public constructors
+        //----------------------------------------------------------------------
+
+        Calculator() :
+            myValue(initialValue)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        // Public static methods
+        //----------------------------------------------------------------------
+
+        //----------------------------------------------------------------------
+        static TCrc calculate(const uint8_t* data, const uint32_t size)
+        {
+            return (updateValue(initialValue, data, size) ^ finalXorValue);
+        }
+
+        //----------------------------------------------------------------------
+        static TCrc calculate(const ByteArray& data)
+        {
+            return calculate(data.getItems(), data.getSize());
+        }
+
+        //----------------------------------------------------------------------
+        static constexpr Table createTable()
+        {
+            Table table = {};
+
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                TCrc value = static_cast<TCrc>(i);
+
+                for (uint32_t j = 0; j < 8; j++)
+                {
+                    if ((value & 1) != 0)
+                    {
+                        value = static_cast<TCrc>((value >> 1) ^ polynomial);
+                    }
+                    else
+                    {
+                        value = static_cast<TCrc>(value >> 1);
+                    }
+                }
+
+                table.values[0][i] = value;
+            }
+
+            // Slice k advances a byte through k further zero bytes
+            for (uint32_t k = 1; k < 8; k++)
+            {
+                for (uint32_t i = 0; i < 256; i++)
+                {
+                    const TCrc value = table.values[k - 1][i];
+
+                    table.values[k][i] =
+                            static_cast<TCrc>((value >> 8) ^
+                                              table.values[0][value & 0xFF]);
+                }
+            }
+
+            return table;
+        }
+
+        //----------------------------------------------------------------------
+        static const Table& getTable()
+        {
+            static constexpr Table table = createTable();
+
+            return table;
+        }
+
+        ///
+        /// @brief Updates the raw CRC register (no initial value or final XOR
+        /// applied) in software, 8 bytes per iteration.
+        ///
+        static TCrc updateValueSoftware(TCrc value,
+                                        const uint8_t* data,
+                                        uint32_t size)
+        {
+            const Table& table = getTable();
+
+            while (size >= 8)
+            {
+                // Assembled a byte at a time so it works on any endianness
+                // and alignment, compilers turn this into a single load
+                const uint32_t low = (static_cast<uint32_t>(value)        ^
+                                     (static_cast<uint32_t>(data[0])      |
+                                     (static_cast<uint32_t>(data[1]) << 8)  |
+                                     (static_cast<uint32_t>(data[2]) << 16) |
+                                     (static_cast<uint32_t>(data[3]) << 24)));
+
+                value = static_cast<TCrc>(table.values[7][low & 0xFF]         ^
+                                          table.values[6][(low >> 8) & 0xFF]  ^
+                                          table.values[5][(low >> 16) & 0xFF] ^
+                                          table.values[4][low >> 24]          ^
+                                          table.values[3][data[4]]            ^
+                                          table.values[2][data[5]]            ^
+                                          table.values[1][data[6]]            ^
+                                          table.values[0][data[7]]);
+
+                data += 8;
+                size -= 8;
+            }
+
+            while (size > 0)
+            {
+                value = static_cast<TCrc>(
+                                   (value >> 8) ^
+                                   table.values[0][(value ^ (*data)) & 0xFF]);
+
+                data++;
+                size--;
+            }
+
+            return value;
+        }
+
+        ///
+        /// @brief Updates the raw CRC register (no initial value or final XOR
+        /// applied), using hardware support when available.
+        ///
+        static TCrc updateValue(const TCrc value,
+                                const uint8_t* data,
+                                const uint32_t size)
+        {
+#ifdef PLAT4M_CRC_SSE42_ENABLED
+            if (isHardwareSupported())
+            {
+                return static_cast<TCrc>(updateValueSse42(value, data, size));
+            }
+#endif
+
+            return updateValueSoftware(value, data, size);
+        }
+
+        //----------------------------------------------------------------------
+        static bool isHardwareSupported()
+        {
+#ifdef PLAT4M_CRC_SSE42_ENABLED
+            // The crc32 instruction only implements the CRC-32C polynomial
+            static const bool isSupported =
+                           (sizeof(TCrc) == 4)                                &&
+                           (polynomial ==
+                                static_cast<TCrc>(crc32cPolynomialReflected)) &&
+                           __builtin_cpu_supports("sse4.2");
+
+            return isSupported;
+#else
+            return false;
+#endif
+        }
+
+        //----------------------------------------------------------------------
+        // Public methods
+        //----------------------------------------------------------------------
+
+        //----------------------------------------------------------------------
+        void reset()
+        {
+            myValue = initialValue;
+        }
+
+        //----------------------------------------------------------------------
+        void update(const uint8_t* data, const uint32_t size)
+        {
+            myValue = updateValue(myValue, data, size);
+        }
+
+        //----------------------------------------------------------------------
+        void update(const ByteArray& data)
+        {
+            update(data.getItems(), data.getSize());
+        }
+
+        //----------------------------------------------------------------------
+        void update(const uint8_t byte)
+        {
+            myValue = updateValueSoftware(myValue, &byte, 1);
+        }
+
+        //----------------------------------------------------------------------
+        TCrc getValue() const
+        {
+            return (myValue ^ finalXorValue);
+        }
+
+    private:
+
+        //----------------------------------------------------------------------
+        // Private data members
+        //----------------------------------------------------------------------
+
+        TCrc myValue;
+
+        //----------------------------------------------------------------------
+        // Private static methods
+        //----------------------------------------------------------------------
+
+#ifdef PLAT4M_CRC_SSE42_ENABLED
+
+        //----------------------------------------------------------------------
+        __attribute__((target("sse4.2")))
+        static uint32_t updateValueSse42(uint32_t value,
+                                         const uint8_t* data,
+                                         uint32_t size)
+        {
+#ifdef __x86_64__
+            uint64_t value64 = value;
+
+            while (size >= 8)
+            {
+                uint64_t word;
+                memcpy(&word, data, 8);
+
+                value64 = _mm_crc32_u64(value64, word);
+
+                data += 8;
+                size -= 8;
+            }
+
+            value = static_cast<uint32_t>(value64);
+#endif
+
+            while (size >= 4)
+            {
+                uint32_t word;
+                memcpy(&word, data, 4);
+
+                value = _mm_crc32_u32(value, word);
+
+                data += 4;
+                size -= 4;
+            }
+
+            while (size > 0)
+            {
+                value = _mm_crc32_u8(value, *data);
+
+                data++;
+                size--;
+            }
+
+            return value;
+        }
+
+#endif // PLAT4M_CRC_SSE42_ENABLED
+    };
+
+    //--------------------------------------------------------------------------
+    // Types
+    //--------------------------------------------------------------------------
+
+    // CRC-16 as used by the Plat4m packet protocol (reflected 0x8005, no
+    // initial value or final XOR, also known as CRC-16/ARC)
+    typedef Calculator<uint16_t,
+                       crc16CcittPolynomialReflected,
+                       0x0000,
+                       0x0000> Crc16CcittCalculator;
+
+    typedef Calculator<uint32_t,
+                       crc32PolynomialReflected,
+                       0xFFFFFFFF,
+                       0xFFFFFFFF> Crc32Calculator;
+
+    typedef Calculator<uint32_t,
+                       crc32cPolynomialReflected,
+                       0xFFFFFFFF,
+                       0xFFFFFFFF> Crc32cCalculator;
+
     //--------------------------------------------------------------------------
     // Inline functions
     //--------------------------------------------------------------------------
@@ -117,31 +432,19 @@ namespace Crc
     //--------------------------------------------------------------------------
     inline uint16_t calculateCrc16Ccitt(const ByteArray& data)
     {
-        uint16_t crc = 0;
-        uint32_t size = data.getSize();
-
-        for (uint32_t i = 0; i < size; i++)
-        {
-            uint8_t reversedByte = reverseBitOrder(data[i]);
-
-            crc ^= (((uint16_t) reversedByte) << 8);
-
-            for (uint32_t j = 8; j > 0; j--)
-            {
-                if (areBitsSet(crc, 0x8000))
-                {
-                    crc = (crc << 1) ^ crc16CcittPlynomial;
-                }
-                else
-                {
-                    crc = (crc << 1);
-                }
-            }
-        }
+        return (Crc16CcittCalculator::calculate(data));
+    }
 
-        crc = reverseBitOrder(crc);
+    //--------------------------------------------------------------------------
+    inline uint32_t calculateCrc32(const ByteArray& data)
+    {
+        return (Crc32Calculator::calculate(data));
+    }
 
-        return crc;
+    //--------------------------------------------------------------------------
+    inline uint32_t calculateCrc32c(const ByteArray& data)
+    {
+        return (Crc32cCalculator::calculate(data));
     }
 
     //--------------------------------------------------------------------------
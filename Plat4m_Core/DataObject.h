@@ -124,7 +124,8 @@ protected:
 
     //--------------------------------------------------------------------------
     DataObject(const DataObjectBase::Id id) :
-        DataObjectInterface<DataType>(id)
+        DataObjectInterface<DataType>(id,
+                                      Plat4m::getTypeId<DataObject>())
     {
     }
 
@@ -240,7 +241,8 @@ protected:
 
     //--------------------------------------------------------------------------
     DataObject(const DataObjectBase::Id id) :
-        DataObjectInterface<DataType>(id),
+        DataObjectInterface<DataType>(id,
+                                      Plat4m::getTypeId<DataObject>()),
         myIsIncrementalWriteInProgress(false)
     {
     }
@@ -346,7 +348,8 @@ protected:
 
     //--------------------------------------------------------------------------
     DataObject(const DataObjectBase::Id id) :
-        DataObjectInterface<DataType>(id),
+        DataObjectInterface<DataType>(id,
+                                      Plat4m::getTypeId<DataObject>()),
         myIsIncrementalWriteInProgress(false)
     {
     }
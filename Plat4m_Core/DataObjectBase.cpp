@@ -55,7 +55,17 @@ using namespace Plat4m;
 //------------------------------------------------------------------------------
 void DataObjectBase::setId(const Id id)
 {
+    if (id == myId)
+    {
+        return;
+    }
+
+    // Re-register so the DataObjectManager index is keyed by the new Id
+    DataObjectBase* pointer = this;
+
+    DataObjectManager::remove(*pointer);
     myId = id;
+    DataObjectManager::add(*pointer);
 }
 
 //------------------------------------------------------------------------------
@@ -64,6 +74,12 @@ Id DataObjectBase::getId() const
     return myId;
 }
 
+//------------------------------------------------------------------------------
+TypeId DataObjectBase::getTypeId() const
+{
+    return myTypeId;
+}
+
 //------------------------------------------------------------------------------
 // Public virtual destructors
 //------------------------------------------------------------------------------
@@ -81,8 +97,9 @@ DataObjectBase::~DataObjectBase()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-DataObjectBase::DataObjectBase(const Id id) :
-    myId(id)
+DataObjectBase::DataObjectBase(const Id id, const TypeId typeId) :
+    myId(id),
+    myTypeId(typeId)
 {
     DataObjectBase* pointer = this;
 
@@ -49,6 +49,7 @@
 #include <cstdint>
 
 #include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TypeId.h>
 #include <Plat4m_Core/Module.h>
 
 //------------------------------------------------------------------------------
@@ -105,13 +106,15 @@ public:
 
     Id getId() const;
 
+    TypeId getTypeId() const;
+
 protected:
 
     //--------------------------------------------------------------------------
     // Protected constructors
     //--------------------------------------------------------------------------
 
-    DataObjectBase(const Id id);
+    DataObjectBase(const Id id, const TypeId typeId);
 
 private:
 
@@ -120,6 +123,8 @@ private:
     //--------------------------------------------------------------------------
 
     Id myId;
+
+    const TypeId myTypeId;
 };
 
 }; // namespace Plat4m
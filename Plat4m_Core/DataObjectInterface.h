@@ -46,10 +46,13 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include <Plat4m_Core/DataObjectBase.h>
 #include <Plat4m_Core/DataObjectManager.h>
 #include <Plat4m_Core/Callback.h>
 #include <Plat4m_Core/List.h>
+#include <Plat4m_Core/SeqLock.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -81,9 +84,14 @@ public:
     template <typename DataObjectDervied>
     static DataObjectDervied* find(const DataObjectBase::Id id)
     {
-        DataObjectBase* dataObjectBase = DataObjectManager::find(id);
+        DataObjectBase* dataObjectBase = 0;
+
+        Error error =
+            DataObjectManager::find(id,
+                                    Plat4m::getTypeId<DataObjectDervied>(),
+                                    dataObjectBase);
 
-        if (isNullPointer(dataObjectBase))
+        if (error.getCode() == ERROR_CODE_DATA_OBJECT_NOT_INSTANTIATED)
         {
             Error error(ERROR_CODE_DATA_OBJECT_NOT_INSTANTIATED);
 
@@ -97,17 +105,12 @@ public:
             return 0;
         }
 
-        DataObjectDervied* dataObjectDerived =
-                               dynamic_cast<DataObjectDervied*>(dataObjectBase);
-
-        if (isNullPointer(dataObjectDerived))
+        if (error.getCode() == ERROR_CODE_DATA_OBJECT_TYPE_ID_MISMATCH)
         {
-            Error error(ERROR_CODE_DATA_OBJECT_TYPE_ID_MISMATCH);
-
             return 0;
         }
 
-        return dataObjectDerived;
+        return static_cast<DataObjectDervied*>(dataObjectBase);
     }
 
     //--------------------------------------------------------------------------
@@ -135,13 +138,30 @@ public:
         myDataChangedCallbackList.append(callback);
     }
 
-    //--------------------------------------------------------------------------
+    ///
+    /// @brief Keeps a copy of the current data in the given SeqLock on every
+    /// update, so other threads can read consistent snapshots of it without
+    /// blocking the updating thread. Call before the first update. DataObjects
+    /// without a snapshot pay nothing for it.
+    ///
+    void setSnapshot(SeqLock<DataType>& snapshot)
+    {
+        mySnapshot = &snapshot;
+    }
+
+    ///
+    /// @brief Returns the current data. Only safe on the thread that updates
+    /// this DataObject, other threads read a snapshot, see setSnapshot().
+    ///
     DataType& getCurrentData()
     {
         return myCurrentData;
     }
 
-    //--------------------------------------------------------------------------
+    ///
+    /// @brief Returns the current data. Only safe on the thread that updates
+    /// this DataObject, other threads read a snapshot, see setSnapshot().
+    ///
     const DataType& getCurrentData() const
     {
         return myCurrentData;
@@ -154,9 +174,10 @@ protected:
     //--------------------------------------------------------------------------
 
     //--------------------------------------------------------------------------
-    DataObjectInterface(const DataObjectBase::Id id) :
-        DataObjectBase(id),
+    DataObjectInterface(const DataObjectBase::Id id, const TypeId typeId) :
+        DataObjectBase(id, typeId),
         myCurrentData(),
+        mySnapshot(0),
         myDataUpdatedCallbackList(),
         myDataChangedCallbackList()
     {
@@ -188,6 +209,11 @@ protected:
         }
 
         myCurrentData = data;
+
+        if (isValidPointer(mySnapshot))
+        {
+            mySnapshot->write(data);
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -214,6 +240,8 @@ private:
 
     DataType myCurrentData;
 
+    SeqLock<DataType>* mySnapshot;
+
     List<DataCallback&> myDataUpdatedCallbackList;
 
     List<DataCallback&> myDataChangedCallbackList;
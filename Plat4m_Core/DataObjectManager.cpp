@@ -103,7 +103,29 @@ DataObjectBase* DataObjectManager::find(const DataObjectBase::Id id)
         }
     }
 
-    return (myInstance->findPrivate(id));
+    DataObjectBase* dataObject = 0;
+
+    myInstance->findPrivate(id, 0, dataObject);
+
+    return dataObject;
+}
+
+//------------------------------------------------------------------------------
+DataObjectBase::Error DataObjectManager::find(const DataObjectBase::Id id,
+                                              const TypeId typeId,
+                                              DataObjectBase*& dataObject)
+{
+    if (isNullPointer(myInstance))
+    {
+        Error error(ERROR_CODE_INSTANCE_NOT_CREATED);
+
+        // Lock up
+        while (true)
+        {
+        }
+    }
+
+    return (myInstance->findPrivate(id, typeId, dataObject));
 }
 
 //------------------------------------------------------------------------------
@@ -111,7 +133,10 @@ DataObjectBase* DataObjectManager::find(const DataObjectBase::Id id)
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-DataObjectManager::DataObjectManager()
+DataObjectManager::DataObjectManager() :
+    myDataObjectList(),
+    myDataObjectIndex(),
+    myIsDataObjectIndexIncomplete(false)
 {
     if (isValidPointer(myInstance))
     {
@@ -158,6 +183,18 @@ void DataObjectManager::addPrivate(DataObjectBase& dataObject)
     DataObjectBase* pointer = &dataObject;
 
     myDataObjectList.append(pointer);
+
+    DataObjectIndex::Error error =
+                        myDataObjectIndex.insert(pointer->getId(),
+                                                 pointer,
+                                                 pointer->getTypeId());
+
+    if (error.getCode() != DataObjectIndex::ERROR_CODE_NONE)
+    {
+        // Index is full or the Id is a duplicate, fall back to searching the
+        // list for anything that misses in the index
+        myIsDataObjectIndexIncomplete = true;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -166,29 +203,71 @@ void DataObjectManager::removePrivate(DataObjectBase& dataobject)
     DataObjectBase* pointer = &dataobject;
 
     myDataObjectList.remove(pointer);
+
+    DataObjectBase* indexedDataObject = 0;
+
+    DataObjectIndex::Error error =
+                myDataObjectIndex.find(pointer->getId(), indexedDataObject);
+
+    if ((error.getCode() == DataObjectIndex::ERROR_CODE_NONE) &&
+        (indexedDataObject == pointer))
+    {
+        myDataObjectIndex.remove(pointer->getId());
+    }
+
+    if (myDataObjectList.size() == 0)
+    {
+        myIsDataObjectIndexIncomplete = false;
+    }
 }
 
 //------------------------------------------------------------------------------
-DataObjectBase* DataObjectManager::findPrivate(const DataObjectBase::Id id)
+DataObjectBase::Error DataObjectManager::findPrivate(
+                                                    const DataObjectBase::Id id,
+                                                    const TypeId typeId,
+                                                    DataObjectBase*& dataObject)
 {
-    DataObjectBase* existingDataObject = 0;
+    DataObjectIndex::Error error =
+                                 myDataObjectIndex.find(id, dataObject, typeId);
 
-    typename List<DataObjectBase*>::Iterator iterator =
-                                                    myDataObjectList.iterator();
+    if (error.getCode() == DataObjectIndex::ERROR_CODE_NONE)
+    {
+        return DataObjectBase::Error(DataObjectBase::ERROR_CODE_NONE);
+    }
 
-    while (iterator.hasCurrent())
+    if (error.getCode() == DataObjectIndex::ERROR_CODE_TYPE_ID_MISMATCH)
     {
-        DataObjectBase* dataObject = iterator.current();
-        
-        if (dataObject->getId() == id)
+        return DataObjectBase::Error(
+                       DataObjectBase::ERROR_CODE_DATA_OBJECT_TYPE_ID_MISMATCH);
+    }
+
+    if (myIsDataObjectIndexIncomplete)
+    {
+        typename List<DataObjectBase*>::Iterator iterator =
+                                                    myDataObjectList.iterator();
+
+        while (iterator.hasCurrent())
         {
-            existingDataObject = dataObject;
+            DataObjectBase* existingDataObject = iterator.current();
 
-            break;
-        }
+            if (existingDataObject->getId() == id)
+            {
+                if ((typeId != 0) &&
+                    (existingDataObject->getTypeId() != typeId))
+                {
+                    return DataObjectBase::Error(
+                       DataObjectBase::ERROR_CODE_DATA_OBJECT_TYPE_ID_MISMATCH);
+                }
 
-        iterator.next();
+                dataObject = existingDataObject;
+
+                return DataObjectBase::Error(DataObjectBase::ERROR_CODE_NONE);
+            }
+
+            iterator.next();
+        }
     }
 
-    return existingDataObject;
+    return DataObjectBase::Error(
+                       DataObjectBase::ERROR_CODE_DATA_OBJECT_NOT_INSTANTIATED);
 }
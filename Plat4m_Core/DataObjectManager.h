@@ -49,6 +49,21 @@
 #include <Plat4m_Core/ErrorTemplate.h>
 #include <Plat4m_Core/DataObjectBase.h>
 #include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IdHashIndexN.h>
+#include <Plat4m_Core/TypeId.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of entries in the DataObjectManager Id hash index. Must be a
+/// power of 2, up to 3/4 of it can be indexed. DataObjects beyond that are
+/// still found by a linear search. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_DATA_OBJECT_MANAGER_INDEX_SIZE
+#define PLAT4M_DATA_OBJECT_MANAGER_INDEX_SIZE 64
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -88,6 +103,10 @@ public:
 
     static DataObjectBase* find(const DataObjectBase::Id id);
 
+    static DataObjectBase::Error find(const DataObjectBase::Id id,
+                                      const TypeId typeId,
+                                      DataObjectBase*& dataObject);
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
@@ -102,6 +121,13 @@ public:
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef IdHashIndexN<DataObjectBase*, PLAT4M_DATA_OBJECT_MANAGER_INDEX_SIZE>
+                                                                DataObjectIndex;
+
     //--------------------------------------------------------------------------
     // Private static data members
     //--------------------------------------------------------------------------
@@ -114,6 +140,10 @@ private:
 
     List<DataObjectBase*> myDataObjectList;
 
+    DataObjectIndex myDataObjectIndex;
+
+    bool myIsDataObjectIndexIncomplete;
+
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
@@ -122,7 +152,9 @@ private:
 
     void removePrivate(DataObjectBase& dataobject);
 
-    DataObjectBase* findPrivate(const DataObjectBase::Id id);
+    DataObjectBase::Error findPrivate(const DataObjectBase::Id id,
+                                      const TypeId typeId,
+                                      DataObjectBase*& dataObject);
 };
 
 }; // namespace Plat4m
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file DescriptorSet.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief DescriptorSet class header file.
+///
+
+#ifndef PLAT4M_DESCRIPTOR_SET_H
+#define PLAT4M_DESCRIPTOR_SET_H
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Compile time list of TopicDescriptors or ServiceDescriptors, used
+/// to reject duplicate Ids before anything runs:
+///
+///     typedef DescriptorSet<ImuTopic, GpsTopic, StatusTopic> AppTopics;
+///     static_assert(AppTopics::hasUniqueIds(), "Duplicate Topic Id");
+///
+template <typename... Descriptors>
+class DescriptorSet;
+
+//------------------------------------------------------------------------------
+template <>
+class DescriptorSet<>
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    template <typename IdType>
+    static constexpr bool containsId(const IdType)
+    {
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr bool hasUniqueIds()
+    {
+        return true;
+    }
+};
+
+//------------------------------------------------------------------------------
+template <typename FirstDescriptor, typename... OtherDescriptors>
+class DescriptorSet<FirstDescriptor, OtherDescriptors...>
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef DescriptorSet<OtherDescriptors...> OtherDescriptorSet;
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    template <typename IdType>
+    static constexpr bool containsId(const IdType id)
+    {
+        return ((id == FirstDescriptor::id) ||
+                OtherDescriptorSet::containsId(id));
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr bool hasUniqueIds()
+    {
+        return (!OtherDescriptorSet::containsId(FirstDescriptor::id) &&
+                OtherDescriptorSet::hasUniqueIds());
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_DESCRIPTOR_SET_H
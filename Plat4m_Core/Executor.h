@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file Executor.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief Executor class header file.
+///
+
+#ifndef PLAT4M_EXECUTOR_H
+#define PLAT4M_EXECUTOR_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/Callback.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Fixed pool of worker threads that runs submitted tasks, so many
+/// short pieces of work (e.g. TopicSubscriberExecutor) can share a few
+/// threads instead of each owning one. Tasks may run on any worker and in
+/// any order relative to each other.
+///
+class Executor
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE,
+        ERROR_CODE_QUEUE_FULL
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    typedef Callback<> TaskCallback;
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~Executor();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Runs the task once on one of the workers. The task must stay
+    /// valid until it has run. Submitting a task that is still queued queues
+    /// it again.
+    /// @return ERROR_CODE_QUEUE_FULL if the task could not be queued.
+    ///
+    Error submit(TaskCallback& taskCallback);
+
+    std::uint32_t getNWorkers() const;
+
+    ///
+    /// @brief Returns the number of submit() calls that failed because the
+    /// queues were full.
+    ///
+    std::uint32_t getNRejectedTasks() const;
+
+protected:
+
+    //--------------------------------------------------------------------------
+    // Protected constructors
+    //--------------------------------------------------------------------------
+
+    Executor(const std::uint32_t nWorkers);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const std::uint32_t myNWorkers;
+
+    std::atomic<std::uint32_t> myNRejectedTasks;
+
+    //--------------------------------------------------------------------------
+    // Private pure virtual methods
+    //--------------------------------------------------------------------------
+
+    virtual Error driverSubmit(TaskCallback& taskCallback) = 0;
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_EXECUTOR_H
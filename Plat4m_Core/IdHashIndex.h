@@ -0,0 +1,336 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IdHashIndex.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IdHashIndex template class header file.
+///
+
+#ifndef PLAT4M_ID_HASH_INDEX_H
+#define PLAT4M_ID_HASH_INDEX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TypeId.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Fixed capacity open addressing hash table that maps an Id to a
+/// value and an optional TypeId. Uses Fibonacci hashing with linear probing
+/// and backward shift deletion, so no allocation or tombstones are needed.
+/// Inserts fail once the table is 3/4 full to keep probe sequences short.
+/// @tparam TValue Type of value to store for each Id.
+///
+template <typename TValue>
+class IdHashIndex
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE = 0,
+        ERROR_CODE_ID_NOT_FOUND,
+        ERROR_CODE_ID_ALREADY_EXISTS,
+        ERROR_CODE_FULL,
+        ERROR_CODE_TYPE_ID_MISMATCH,
+        ERROR_CODE_N_ENTRIES_INVALID
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    struct Entry
+    {
+        Id id;
+        TypeId typeId;
+        TValue value;
+        bool isUsed;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Constructor for IdHashIndex.
+    /// @param entries Entry storage to use, must outlive this object.
+    /// @param nEntries Number of entries in storage, must be a power of 2 and
+    /// at least 2.
+    ///
+    IdHashIndex(Entry* entries, const std::uint32_t nEntries) :
+        myEntries(entries),
+        myNEntries(nEntries),
+        myMask(nEntries - 1),
+        myHashShift(32),
+        myNMaxUsedEntries(nEntries - (nEntries / 4)),
+        myNUsedEntries(0)
+    {
+        if ((nEntries < 2) || ((nEntries & (nEntries - 1)) != 0))
+        {
+            Error error(ERROR_CODE_N_ENTRIES_INVALID);
+
+            // Lock up, invalid number of entries
+            while (true)
+            {
+            }
+        }
+
+        std::uint32_t n = nEntries;
+
+        while (n > 1)
+        {
+            myHashShift--;
+            n >>= 1;
+        }
+
+        clear();
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Inserts the given Id and value.
+    /// @param id Id to insert.
+    /// @param value Value to associate with the Id.
+    /// @param typeId TypeId to associate with the Id, 0 for none.
+    /// @return ERROR_CODE_ID_ALREADY_EXISTS if the Id is already present (the
+    /// existing entry is kept), ERROR_CODE_FULL if the index is full.
+    ///
+    Error insert(const Id id, const TValue& value, const TypeId typeId = 0)
+    {
+        if (myNUsedEntries >= myNMaxUsedEntries)
+        {
+            return Error(ERROR_CODE_FULL);
+        }
+
+        std::uint32_t index = hash(id);
+
+        while (myEntries[index].isUsed)
+        {
+            if (myEntries[index].id == id)
+            {
+                return Error(ERROR_CODE_ID_ALREADY_EXISTS);
+            }
+
+            index = (index + 1) & myMask;
+        }
+
+        Entry& entry = myEntries[index];
+        entry.id = id;
+        entry.typeId = typeId;
+        entry.value = value;
+        entry.isUsed = true;
+
+        myNUsedEntries++;
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    ///
+    /// @brief Removes the given Id.
+    /// @param id Id to remove.
+    /// @return ERROR_CODE_ID_NOT_FOUND if the Id isn't present.
+    ///
+    Error remove(const Id id)
+    {
+        std::uint32_t index;
+
+        if (!findIndex(id, index))
+        {
+            return Error(ERROR_CODE_ID_NOT_FOUND);
+        }
+
+        // Backward shift deletion: pull every following entry of the cluster
+        // that is allowed to live in the hole back into it, so lookups never
+        // terminate early on a removed entry
+        std::uint32_t next = (index + 1) & myMask;
+
+        while (myEntries[next].isUsed)
+        {
+            const std::uint32_t home = hash(myEntries[next].id);
+
+            if (((next - home) & myMask) >= ((next - index) & myMask))
+            {
+                myEntries[index] = myEntries[next];
+                index = next;
+            }
+
+            next = (next + 1) & myMask;
+        }
+
+        myEntries[index].isUsed = false;
+
+        myNUsedEntries--;
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    ///
+    /// @brief Finds the value associated with the given Id.
+    /// @param id Id to find.
+    /// @param value Found value, unmodified if an error is returned.
+    /// @param typeId TypeId the entry must have been inserted with, 0 to skip
+    /// the check.
+    /// @return ERROR_CODE_ID_NOT_FOUND if the Id isn't present,
+    /// ERROR_CODE_TYPE_ID_MISMATCH if the Id is present with another TypeId.
+    ///
+    Error find(const Id id, TValue& value, const TypeId typeId = 0) const
+    {
+        std::uint32_t index;
+
+        if (!findIndex(id, index))
+        {
+            return Error(ERROR_CODE_ID_NOT_FOUND);
+        }
+
+        const Entry& entry = myEntries[index];
+
+        if ((typeId != 0) && (entry.typeId != typeId))
+        {
+            return Error(ERROR_CODE_TYPE_ID_MISMATCH);
+        }
+
+        value = entry.value;
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    //--------------------------------------------------------------------------
+    bool contains(const Id id) const
+    {
+        std::uint32_t index;
+
+        return findIndex(id, index);
+    }
+
+    //--------------------------------------------------------------------------
+    void clear()
+    {
+        for (std::uint32_t i = 0; i < myNEntries; i++)
+        {
+            myEntries[i].isUsed = false;
+        }
+
+        myNUsedEntries = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getSize() const
+    {
+        return myNUsedEntries;
+    }
+
+    ///
+    /// @brief Returns the maximum number of Ids that can be inserted.
+    ///
+    std::uint32_t getCapacity() const
+    {
+        return myNMaxUsedEntries;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    Entry* myEntries;
+
+    const std::uint32_t myNEntries;
+
+    const std::uint32_t myMask;
+
+    std::uint32_t myHashShift;
+
+    const std::uint32_t myNMaxUsedEntries;
+
+    std::uint32_t myNUsedEntries;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    std::uint32_t hash(const Id id) const
+    {
+        // Fibonacci hashing, the upper bits of the product are well mixed even
+        // for sequential Ids
+        return (static_cast<std::uint32_t>(id * 2654435769u) >> myHashShift);
+    }
+
+    //--------------------------------------------------------------------------
+    bool findIndex(const Id id, std::uint32_t& index) const
+    {
+        index = hash(id);
+
+        while (myEntries[index].isUsed)
+        {
+            if (myEntries[index].id == id)
+            {
+                return true;
+            }
+
+            index = (index + 1) & myMask;
+        }
+
+        return false;
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_ID_HASH_INDEX_H
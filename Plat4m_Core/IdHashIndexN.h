@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IdHashIndexN.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IdHashIndexN template class header file.
+///
+
+#ifndef PLAT4M_ID_HASH_INDEX_N_H
+#define PLAT4M_ID_HASH_INDEX_N_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/IdHashIndex.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief IdHashIndex with inline storage for N entries. Up to 3/4 of N Ids
+/// can be inserted.
+/// @tparam TValue Type of value to store for each Id.
+/// @tparam N Number of entries, must be a power of 2.
+///
+template <typename TValue, std::uint32_t N>
+class IdHashIndexN : public IdHashIndex<TValue>
+{
+public:
+
+    static_assert((N >= 2) && ((N & (N - 1)) == 0), "N must be a power of 2");
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    IdHashIndexN() :
+        IdHashIndex<TValue>(myEntries, N),
+        myEntries()
+    {
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    typename IdHashIndex<TValue>::Entry myEntries[N];
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    IdHashIndexN(const IdHashIndexN<TValue, N>& idHashIndexN);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_ID_HASH_INDEX_N_H
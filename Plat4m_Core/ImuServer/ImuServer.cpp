@@ -61,6 +61,15 @@
 
 using Plat4m::ImuServer;
 using Plat4m::Module;
+using Plat4m::WaitCondition;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+// Upper bound on how long the output thread blocks without a measurement, so
+// it stays responsive to being disabled or destroyed
+static const Plat4m::TimeMs outputWaitTimeMs = 100;
 
 //------------------------------------------------------------------------------
 // Public constructors
@@ -214,7 +223,11 @@ void ImuServer::initialize()
 //------------------------------------------------------------------------------
 void ImuServer::outputThreadCallback()
 {
-	myWaitCondition.wait();
+    if (myWaitCondition.wait(outputWaitTimeMs).getCode() ==
+                                             WaitCondition::ERROR_CODE_TIMEOUT)
+    {
+        return;
+    }
 
     uint8_t i = 0;
     List<Imu*>::Iterator iterator = myImuList.iterator();
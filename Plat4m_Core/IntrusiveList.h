@@ -0,0 +1,417 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IntrusiveList.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IntrusiveList class header file.
+///
+
+#ifndef PLAT4M_INTRUSIVE_LIST_H
+#define PLAT4M_INTRUSIVE_LIST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Links embedded in an object so it can be put in an IntrusiveList.
+/// An object can be in one list per hook it has. Copying an object gives the
+/// copy an unlinked hook.
+///
+template <typename T>
+class IntrusiveListHook
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    IntrusiveListHook() :
+        myList(0),
+        myPreviousItem(0),
+        myNextItem(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    IntrusiveListHook(const IntrusiveListHook<T>& hook) :
+        myList(0),
+        myPreviousItem(0),
+        myNextItem(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public operator overloads
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    IntrusiveListHook<T>& operator=(const IntrusiveListHook<T>& hook)
+    {
+        // Keep this object's own links
+        return (*this);
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    bool isLinked() const
+    {
+        return (isValidPointer(myList));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private friend classes
+    //--------------------------------------------------------------------------
+
+    template <typename U, IntrusiveListHook<U> U::*Hook>
+    friend class IntrusiveList;
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const void* myList;
+
+    T* myPreviousItem;
+
+    T* myNextItem;
+};
+
+///
+/// @brief List of objects linked through an IntrusiveListHook member, with
+/// the same interface as List<T> except that it holds the objects themselves
+/// (by reference) instead of copies. Nothing is allocated, and remove() only
+/// unlinks the object so it is O(1). The list doesn't own the objects, they
+/// must be removed before they are destroyed.
+/// @code
+/// class Node
+/// {
+///     IntrusiveListHook<Node> myHook;
+/// };
+///
+/// IntrusiveList<Node, &Node::myHook> list;
+/// @endcode
+///
+template <typename T, IntrusiveListHook<T> T::*Hook>
+class IntrusiveList
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public friend classes
+    //--------------------------------------------------------------------------
+
+    class Iterator
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        Iterator(IntrusiveList<T, Hook>& list) :
+            myList(list),
+            myCurrentItem(myList.myFirstItem)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        bool hasCurrent()
+        {
+            return (isValidPointer(myCurrentItem));
+        }
+
+        //----------------------------------------------------------------------
+        bool next()
+        {
+            if (!hasCurrent())
+            {
+                return false;
+            }
+
+            myCurrentItem = (myCurrentItem->*Hook).myNextItem;
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        bool previous()
+        {
+            if (!hasCurrent())
+            {
+                return false;
+            }
+
+            myCurrentItem = (myCurrentItem->*Hook).myPreviousItem;
+
+            return true;
+        }
+
+        //----------------------------------------------------------------------
+        void first()
+        {
+            myCurrentItem = myList.myFirstItem;
+        }
+
+        //----------------------------------------------------------------------
+        void last()
+        {
+            myCurrentItem = myList.myLastItem;
+        }
+
+        //----------------------------------------------------------------------
+        T& current()
+        {
+            return (*myCurrentItem);
+        }
+
+    private:
+
+        IntrusiveList<T, Hook>& myList;
+
+        T* myCurrentItem;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    // constexpr so static lists are initialized before any static object
+    // links itself in
+    constexpr IntrusiveList() :
+        mySize(0),
+        myFirstItem(0),
+        myLastItem(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    std::uint32_t size() const
+    {
+        return mySize;
+    }
+
+    //--------------------------------------------------------------------------
+    bool isEmpty()
+    {
+        return (mySize == 0);
+    }
+
+    //--------------------------------------------------------------------------
+    bool contains(const T& item) const
+    {
+        return ((item.*Hook).myList == this);
+    }
+
+    //--------------------------------------------------------------------------
+    void append(T& item)
+    {
+        IntrusiveListHook<T>& hook = item.*Hook;
+
+        if (hook.isLinked())
+        {
+            return;
+        }
+
+        hook.myList = this;
+        hook.myPreviousItem = myLastItem;
+        hook.myNextItem = 0;
+
+        if (isValidPointer(myLastItem))
+        {
+            (myLastItem->*Hook).myNextItem = &item;
+        }
+        else
+        {
+            myFirstItem = &item;
+        }
+
+        myLastItem = &item;
+        mySize++;
+    }
+
+    //--------------------------------------------------------------------------
+    void prepend(T& item)
+    {
+        IntrusiveListHook<T>& hook = item.*Hook;
+
+        if (hook.isLinked())
+        {
+            return;
+        }
+
+        hook.myList = this;
+        hook.myPreviousItem = 0;
+        hook.myNextItem = myFirstItem;
+
+        if (isValidPointer(myFirstItem))
+        {
+            (myFirstItem->*Hook).myPreviousItem = &item;
+        }
+        else
+        {
+            myLastItem = &item;
+        }
+
+        myFirstItem = &item;
+        mySize++;
+    }
+
+    //--------------------------------------------------------------------------
+    T* first()
+    {
+        return myFirstItem;
+    }
+
+    //--------------------------------------------------------------------------
+    T* last()
+    {
+        return myLastItem;
+    }
+
+    //--------------------------------------------------------------------------
+    Iterator iterator()
+    {
+        return Iterator(*this);
+    }
+
+    //--------------------------------------------------------------------------
+    void remove(T& item)
+    {
+        IntrusiveListHook<T>& hook = item.*Hook;
+
+        // Not in this list
+        if (hook.myList != this)
+        {
+            return;
+        }
+
+        if (isValidPointer(hook.myPreviousItem))
+        {
+            (hook.myPreviousItem->*Hook).myNextItem = hook.myNextItem;
+        }
+        else
+        {
+            myFirstItem = hook.myNextItem;
+        }
+
+        if (isValidPointer(hook.myNextItem))
+        {
+            (hook.myNextItem->*Hook).myPreviousItem = hook.myPreviousItem;
+        }
+        else
+        {
+            myLastItem = hook.myPreviousItem;
+        }
+
+        hook.myList = 0;
+        hook.myPreviousItem = 0;
+        hook.myNextItem = 0;
+
+        mySize--;
+    }
+
+    //--------------------------------------------------------------------------
+    void clear()
+    {
+        while (isValidPointer(myFirstItem))
+        {
+            remove(*myFirstItem);
+        }
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::uint32_t mySize;
+
+    T* myFirstItem;
+
+    T* myLastItem;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    // Objects can only be linked into one list through a given hook
+    IntrusiveList(const IntrusiveList<T, Hook>& list);
+
+    //--------------------------------------------------------------------------
+    // Private operator overloads
+    //--------------------------------------------------------------------------
+
+    IntrusiveList<T, Hook>& operator=(const IntrusiveList<T, Hook>& list);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_INTRUSIVE_LIST_H
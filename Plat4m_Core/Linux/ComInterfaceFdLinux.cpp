@@ -0,0 +1,703 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceFdLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceFdLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <Plat4m_Core/Linux/ComInterfaceFdLinux.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+using namespace std;
+
+using Plat4m::ComInterfaceFdLinux;
+using Plat4m::ComInterface;
+using Plat4m::Thread;
+using Plat4m::Mutex;
+using Plat4m::Buffer;
+using Plat4m::ByteArray;
+using Plat4m::MutexLock;
+using Plat4m::System;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t maxIoVectors = 16;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void writeBuffer(Buffer<uint8_t>& buffer,
+                        const uint8_t* bytes,
+                        const uint32_t nBytes)
+{
+    // Caller has checked there's room, copy in at most two runs around the end
+    const uint32_t size = buffer.getSize();
+    const uint32_t writeIndex = buffer.getWriteIndex();
+    uint32_t nFirstBytes = size - writeIndex;
+
+    if (nFirstBytes > nBytes)
+    {
+        nFirstBytes = nBytes;
+    }
+
+    memcpy(buffer.getItems() + writeIndex, bytes, nFirstBytes);
+    memcpy(buffer.getItems(), bytes + nFirstBytes, nBytes - nFirstBytes);
+
+    buffer.setWriteIndex((writeIndex + nBytes) % size);
+    buffer.setCount(buffer.count() + nBytes);
+}
+
+//------------------------------------------------------------------------------
+static ssize_t writeIoVectors(const int fileDescriptor,
+                              struct iovec ioVectors[],
+                              const uint32_t nIoVectors,
+                              const bool isSocket)
+{
+    if (!isSocket)
+    {
+        return writev(fileDescriptor, ioVectors, nIoVectors);
+    }
+
+    struct msghdr message = {};
+    message.msg_iov = ioVectors;
+    message.msg_iovlen = nIoVectors;
+
+    // MSG_NOSIGNAL, a peer that closed is an error here and not SIGPIPE
+    return sendmsg(fileDescriptor, &message, MSG_NOSIGNAL);
+}
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceFdLinux::ComInterfaceFdLinux(const char* threadName,
+                                         const uint32_t events,
+                                         ReceiveCallback& receiveCallback,
+                                         Buffer<uint8_t>& transmitBuffer,
+                                         const bool isSocket) :
+    myEvents(events),
+    myIsSocket(isSocket),
+    myReceiveCallback(receiveCallback),
+    myTransmitCallback(0),
+    myTransmitBuffer(&transmitBuffer),
+    myFileDescriptor(-1),
+    myEpollFileDescriptor(epoll_create1(EPOLL_CLOEXEC)),
+    myEventFileDescriptor(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+    myIsWaitingToTransmit(false),
+    myReceiveContext(*(MemoryAllocator::allocate<ReceiveContext>(*this))),
+    myReceiveThread(System::createThread(
+                                createCallback(&myReceiveContext,
+                                               &ReceiveContext::threadCallback),
+                                0,
+                                0,
+                                false,
+                                threadName)),
+    myMutex(System::createMutex(myReceiveThread))
+{
+    initialize();
+}
+
+//------------------------------------------------------------------------------
+ComInterfaceFdLinux::ComInterfaceFdLinux(const char* threadName,
+                                         const uint32_t events,
+                                         ReceiveCallback& receiveCallback,
+                                         TransmitCallback& transmitCallback) :
+    myEvents(events),
+    myIsSocket(true),
+    myReceiveCallback(receiveCallback),
+    myTransmitCallback(&transmitCallback),
+    myTransmitBuffer(0),
+    myFileDescriptor(-1),
+    myEpollFileDescriptor(epoll_create1(EPOLL_CLOEXEC)),
+    myEventFileDescriptor(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+    myIsWaitingToTransmit(false),
+    myReceiveContext(*(MemoryAllocator::allocate<ReceiveContext>(*this))),
+    myReceiveThread(System::createThread(
+                                createCallback(&myReceiveContext,
+                                               &ReceiveContext::threadCallback),
+                                0,
+                                0,
+                                false,
+                                threadName)),
+    myMutex(System::createMutex(myReceiveThread))
+{
+    initialize();
+}
+
+//------------------------------------------------------------------------------
+// Public destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceFdLinux::~ComInterfaceFdLinux()
+{
+    // The driver has closed its descriptors by now. Like the thread, the
+    // receive context is never deallocated.
+    stopReceiving();
+
+    close(myEpollFileDescriptor);
+    close(myEventFileDescriptor);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+int ComInterfaceFdLinux::getFileDescriptor() const
+{
+    return myFileDescriptor;
+}
+
+//------------------------------------------------------------------------------
+Thread& ComInterfaceFdLinux::getReceiveThread()
+{
+    return myReceiveThread;
+}
+
+//------------------------------------------------------------------------------
+Mutex& ComInterfaceFdLinux::getMutex()
+{
+    return myMutex;
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceFdLinux::addFileDescriptor(const int fileDescriptor)
+{
+    struct epoll_event event = {};
+    event.events = myEvents;
+    event.data.fd = fileDescriptor;
+
+    return (epoll_ctl(myEpollFileDescriptor,
+                      EPOLL_CTL_ADD,
+                      fileDescriptor,
+                      &event) == 0);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::removeFileDescriptor(const int fileDescriptor)
+{
+    epoll_ctl(myEpollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, 0);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::setFileDescriptor(const int fileDescriptor)
+{
+    if (myFileDescriptor >= 0)
+    {
+        removeFileDescriptor(myFileDescriptor);
+        close(myFileDescriptor);
+    }
+
+    myFileDescriptor = fileDescriptor;
+    clearTransmitQueue();
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::closeFileDescriptor()
+{
+    if (myFileDescriptor < 0)
+    {
+        return;
+    }
+
+    removeFileDescriptor(myFileDescriptor);
+    close(myFileDescriptor);
+
+    myFileDescriptor = -1;
+    clearTransmitQueue();
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::startReceiving()
+{
+    myReceiveContext.start();
+    myReceiveThread.setEnabled(true);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::stopReceiving()
+{
+    myReceiveThread.setEnabled(false);
+
+    // Once the descriptor is out of the epoll set a receive pass that starts
+    // now can only see the wake up
+    if (myFileDescriptor >= 0)
+    {
+        removeFileDescriptor(myFileDescriptor);
+    }
+
+    if (myReceiveContext.stop())
+    {
+        uint64_t value = 1;
+
+        if (write(myEventFileDescriptor, &value, sizeof(value)) < 0)
+        {
+            // Already signaled
+        }
+
+        myReceiveContext.waitUntilStopped();
+    }
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceFdLinux::transmit(
+                       const ByteArray segments[],
+                       const uint32_t nSegments,
+                       const bool waitUntilDone,
+                       const ComInterface::ErrorCode noFileDescriptorErrorCode)
+{
+    uint32_t nBytes = 0;
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        nBytes += segments[i].getSize();
+    }
+
+    MutexLock mutexLock(myMutex);
+
+    if (myFileDescriptor < 0)
+    {
+        return ComInterface::Error(noFileDescriptorErrorCode);
+    }
+
+    // All or nothing, so a frame is never cut short
+    if (nBytes > (myTransmitBuffer->getSize() - myTransmitBuffer->count()))
+    {
+        return ComInterface::Error(
+                                 ComInterface::ERROR_CODE_TRANSMIT_BUFFER_FULL);
+    }
+
+    ssize_t nWrittenBytes = 0;
+
+    // Anything already queued has to go first
+    if (myTransmitBuffer->isEmpty())
+    {
+        struct iovec ioVectors[maxIoVectors];
+        uint32_t nIoVectors = 0;
+
+        for (uint32_t i = 0; (i < nSegments) && (nIoVectors < maxIoVectors); i++)
+        {
+            ioVectors[nIoVectors].iov_base = segments[i].getItems();
+            ioVectors[nIoVectors].iov_len = segments[i].getSize();
+            nIoVectors++;
+        }
+
+        nWrittenBytes = writeIoVectors(myFileDescriptor,
+                                       ioVectors,
+                                       nIoVectors,
+                                       myIsSocket);
+
+        if (nWrittenBytes < 0)
+        {
+            if ((errno != EAGAIN) && (errno != EINTR))
+            {
+                return ComInterface::Error(
+                                     ComInterface::ERROR_CODE_TRANSMIT_FAILED);
+            }
+
+            nWrittenBytes = 0;
+        }
+    }
+
+    // Queue what the descriptor didn't take
+    uint32_t nSkippedBytes = static_cast<uint32_t>(nWrittenBytes);
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        const uint32_t size = segments[i].getSize();
+
+        if (nSkippedBytes >= size)
+        {
+            nSkippedBytes -= size;
+
+            continue;
+        }
+
+        writeBuffer(*myTransmitBuffer,
+                    segments[i].getItems() + nSkippedBytes,
+                    size - nSkippedBytes);
+        nSkippedBytes = 0;
+    }
+
+    if (myTransmitBuffer->isEmpty())
+    {
+        return ComInterface::Error(ComInterface::ERROR_CODE_NONE);
+    }
+
+    setWaitingToTransmit(true);
+
+    if (waitUntilDone)
+    {
+        return waitUntilTransmitted(mutexLock, noFileDescriptorErrorCode);
+    }
+
+    return ComInterface::Error(ComInterface::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceFdLinux::waitUntilTransmitted(
+                       MutexLock& mutexLock,
+                       const ComInterface::ErrorCode noFileDescriptorErrorCode)
+{
+    const int fileDescriptor = myFileDescriptor;
+
+    // Waiting to transmit for as long as anything is queued
+    while (myIsWaitingToTransmit)
+    {
+        mutexLock.setLocked(false);
+
+        // Timeout so a descriptor closed meanwhile is noticed
+        struct pollfd pollFileDescriptor = {fileDescriptor, POLLOUT, 0};
+        poll(&pollFileDescriptor, 1, 100);
+
+        mutexLock.setLocked(true);
+
+        if (myFileDescriptor != fileDescriptor)
+        {
+            return ComInterface::Error(noFileDescriptorErrorCode);
+        }
+
+        if (!writeTransmitQueue())
+        {
+            return ComInterface::Error(
+                                     ComInterface::ERROR_CODE_TRANSMIT_FAILED);
+        }
+    }
+
+    return ComInterface::Error(ComInterface::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::setWaitingToTransmit(const bool isWaitingToTransmit)
+{
+    if (isWaitingToTransmit == myIsWaitingToTransmit)
+    {
+        return;
+    }
+
+    struct epoll_event event = {};
+    event.events = myEvents;
+    event.data.fd = myFileDescriptor;
+
+    if (isWaitingToTransmit)
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    epoll_ctl(myEpollFileDescriptor, EPOLL_CTL_MOD, myFileDescriptor, &event);
+
+    myIsWaitingToTransmit = isWaitingToTransmit;
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceFdLinux::getTransmitBufferCount()
+{
+    MutexLock mutexLock(myMutex);
+
+    return (myTransmitBuffer->count());
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceFdLinux::getReceivedBytesCount(
+                                                Buffer<uint8_t>* receiveBuffer)
+{
+    if (isNullPointer(receiveBuffer))
+    {
+        return 0;
+    }
+
+    MutexLock mutexLock(myMutex);
+
+    return (receiveBuffer->count());
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceFdLinux::getReceivedBytes(
+                                                Buffer<uint8_t>* receiveBuffer,
+                                                ByteArray& byteArray,
+                                                const uint32_t nBytes)
+{
+    if (isNullPointer(receiveBuffer))
+    {
+        return ComInterface::Error(ComInterface::ERROR_CODE_RECEIVE_FAILED);
+    }
+
+    MutexLock mutexLock(myMutex);
+
+    uint32_t nBytesToRead = receiveBuffer->count();
+
+    if ((nBytes != 0) && (nBytes < nBytesToRead))
+    {
+        nBytesToRead = nBytes;
+    }
+
+    uint8_t byte;
+
+    while ((nBytesToRead--) && receiveBuffer->read(byte))
+    {
+        byteArray.append(byte);
+    }
+
+    return ComInterface::Error(ComInterface::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::initialize()
+{
+    // Wakes the receive thread so it can be disabled
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = myEventFileDescriptor;
+
+    epoll_ctl(myEpollFileDescriptor,
+              EPOLL_CTL_ADD,
+              myEventFileDescriptor,
+              &event);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceFdLinux::writeTransmitQueue()
+{
+    if (isValidPointer(myTransmitCallback))
+    {
+        return (myTransmitCallback->call());
+    }
+
+    return writeTransmitBuffer();
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceFdLinux::writeTransmitBuffer()
+{
+    const uint32_t count = myTransmitBuffer->count();
+
+    if (count == 0)
+    {
+        setWaitingToTransmit(false);
+
+        return true;
+    }
+
+    const uint32_t size = myTransmitBuffer->getSize();
+    const uint32_t readIndex = myTransmitBuffer->getReadIndex();
+    uint32_t nFirstBytes = size - readIndex;
+
+    if (nFirstBytes > count)
+    {
+        nFirstBytes = count;
+    }
+
+    struct iovec ioVectors[2];
+    ioVectors[0].iov_base = myTransmitBuffer->getItems() + readIndex;
+    ioVectors[0].iov_len = nFirstBytes;
+    ioVectors[1].iov_base = myTransmitBuffer->getItems();
+    ioVectors[1].iov_len = count - nFirstBytes;
+
+    ssize_t nWrittenBytes = writeIoVectors(myFileDescriptor,
+                                           ioVectors,
+                                           (nFirstBytes == count) ? 1 : 2,
+                                           myIsSocket);
+
+    if (nWrittenBytes < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EINTR))
+        {
+            return true;
+        }
+
+        // The descriptor is gone (a tty unplugged, a connection the receive
+        // thread closes when it sees the hang up), drop what was queued
+        // rather than wait on it forever
+        myTransmitBuffer->clear();
+        setWaitingToTransmit(false);
+
+        return false;
+    }
+
+    myTransmitBuffer->setReadIndex((readIndex + nWrittenBytes) % size);
+    myTransmitBuffer->setCount(count - nWrittenBytes);
+
+    if (myTransmitBuffer->isEmpty())
+    {
+        setWaitingToTransmit(false);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::clearTransmitQueue()
+{
+    // Datagram drivers clear their own queue
+    if (isValidPointer(myTransmitBuffer))
+    {
+        myTransmitBuffer->clear();
+    }
+
+    myIsWaitingToTransmit = false;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::receive()
+{
+    struct epoll_event events[4];
+
+    int nEvents = epoll_wait(myEpollFileDescriptor,
+                             events,
+                             arraySize(events),
+                             -1);
+
+    for (int i = 0; i < nEvents; i++)
+    {
+        const int fileDescriptor = events[i].data.fd;
+
+        if (fileDescriptor == myEventFileDescriptor)
+        {
+            uint64_t value;
+
+            if (read(myEventFileDescriptor, &value, sizeof(value)) < 0)
+            {
+                // Already cleared
+            }
+
+            continue;
+        }
+
+        // Not for a descriptor replaced earlier in this pass
+        if (((events[i].events & EPOLLOUT) != 0) &&
+            (fileDescriptor == myFileDescriptor))
+        {
+            MutexLock mutexLock(myMutex);
+
+            writeTransmitQueue();
+        }
+
+        if ((events[i].events &
+                             (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0)
+        {
+            myReceiveCallback.call(fileDescriptor);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// ReceiveContext public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceFdLinux::ReceiveContext::ReceiveContext(
+                                         ComInterfaceFdLinux& comInterfaceFd) :
+    myComInterfaceFd(comInterfaceFd),
+    myState(stoppingFlag),
+    myStoppedSemaphore(System::createSemaphore(1, 0))
+{
+}
+
+//------------------------------------------------------------------------------
+// ReceiveContext public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::ReceiveContext::start()
+{
+    myState.fetch_and(~stoppingFlag, memory_order_acq_rel);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceFdLinux::ReceiveContext::stop()
+{
+    const uint32_t state = myState.fetch_or(stoppingFlag, memory_order_acq_rel);
+
+    return ((state & (receivingFlag | stoppingFlag)) == receivingFlag);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::ReceiveContext::waitUntilStopped()
+{
+    myStoppedSemaphore.wait();
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceFdLinux::ReceiveContext::threadCallback()
+{
+    const uint32_t enterState =
+                       myState.fetch_or(receivingFlag, memory_order_acq_rel);
+
+    if ((enterState & stoppingFlag) != 0)
+    {
+        // Stopped before this pass, possibly with the driver gone
+        myState.fetch_and(~receivingFlag, memory_order_acq_rel);
+
+        return;
+    }
+
+    myComInterfaceFd.receive();
+
+    const uint32_t exitState =
+                      myState.fetch_and(~receivingFlag, memory_order_acq_rel);
+
+    // Only stop() calls that saw this pass in progress are waiting
+    if ((exitState & stoppingFlag) != 0)
+    {
+        myStoppedSemaphore.post();
+    }
+}
@@ -0,0 +1,293 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceFdLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceFdLinux class header file.
+///
+
+#ifndef PLAT4M_COM_INTERFACE_FD_LINUX_H
+#define PLAT4M_COM_INTERFACE_FD_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/Buffer.h>
+#include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/Callback.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Mutex.h>
+#include <Plat4m_Core/MutexLock.h>
+#include <Plat4m_Core/Semaphore.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief What the Linux ComInterfaces on a non-blocking file descriptor
+/// (SerialPortLinux, ComInterfaceTcpLinux, ComInterfaceUdpLinux) share: a
+/// receive thread waiting on epoll with an eventfd to wake it for disabling,
+/// the mutex guarding the descriptor and everything queued on it, and
+/// transmitting through a queue the receive thread drains when the
+/// descriptor is writable. Byte stream drivers hand it their transmit ring,
+/// datagram drivers keep their own queue and drain it in a TransmitCallback.
+/// Drivers only read and write their descriptor.
+///
+class ComInterfaceFdLinux
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Called on the receive thread when a descriptor added with
+    /// addFileDescriptor() is readable, hung up or has an error.
+    ///
+    typedef Callback<void, int> ReceiveCallback;
+
+    ///
+    /// @brief Called with the mutex locked to write what's queued. Returns
+    /// false when the descriptor failed.
+    ///
+    typedef Callback<bool> TransmitCallback;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief For byte streams, bytes the descriptor can't take right away
+    /// wait in transmitBuffer. Sockets are written with sendmsg() and
+    /// MSG_NOSIGNAL, anything else with writev().
+    ///
+    ComInterfaceFdLinux(const char* threadName,
+                        const std::uint32_t events,
+                        ReceiveCallback& receiveCallback,
+                        Buffer<std::uint8_t>& transmitBuffer,
+                        const bool isSocket);
+
+    ///
+    /// @brief For drivers that queue and write transmissions themselves.
+    ///
+    ComInterfaceFdLinux(const char* threadName,
+                        const std::uint32_t events,
+                        ReceiveCallback& receiveCallback,
+                        TransmitCallback& transmitCallback);
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    ~ComInterfaceFdLinux();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    int getFileDescriptor() const;
+
+    Thread& getReceiveThread();
+
+    Mutex& getMutex();
+
+    ///
+    /// @brief Adds a descriptor to the epoll set, waiting for the events given
+    /// at construction.
+    ///
+    bool addFileDescriptor(const int fileDescriptor);
+
+    void removeFileDescriptor(const int fileDescriptor);
+
+    ///
+    /// @brief Makes an added descriptor the one transmitted on, closing the
+    /// previous one. Call with the mutex locked.
+    ///
+    void setFileDescriptor(const int fileDescriptor);
+
+    ///
+    /// @brief Closes the descriptor and drops what was queued on it. Call with
+    /// the mutex locked.
+    ///
+    void closeFileDescriptor();
+
+    void startReceiving();
+
+    ///
+    /// @brief Disables the receive thread and waits for a receive pass in
+    /// progress to finish. Other descriptors the driver added must be
+    /// removed first.
+    ///
+    void stopReceiving();
+
+    ///
+    /// @brief Writes all segments with one call, queueing whatever the
+    /// descriptor doesn't take. Nothing is written if the ring can't hold all
+    /// of it, so a frame is never cut short. For byte streams only.
+    ///
+    ComInterface::Error transmit(
+                      const ByteArray segments[],
+                      const std::uint32_t nSegments,
+                      const bool waitUntilDone,
+                      const ComInterface::ErrorCode noFileDescriptorErrorCode);
+
+    ///
+    /// @brief Waits until nothing is queued. Call with the mutex locked by
+    /// mutexLock, it's unlocked while waiting.
+    ///
+    ComInterface::Error waitUntilTransmitted(
+                      MutexLock& mutexLock,
+                      const ComInterface::ErrorCode noFileDescriptorErrorCode);
+
+    ///
+    /// @brief Waits for the descriptor to be writable on the receive thread
+    /// while something is queued. Call with the mutex locked.
+    ///
+    void setWaitingToTransmit(const bool isWaitingToTransmit);
+
+    std::uint32_t getTransmitBufferCount();
+
+    std::uint32_t getReceivedBytesCount(Buffer<std::uint8_t>* receiveBuffer);
+
+    ComInterface::Error getReceivedBytes(Buffer<std::uint8_t>* receiveBuffer,
+                                         ByteArray& byteArray,
+                                         const std::uint32_t nBytes);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief What the receive thread calls into. Threads are never destroyed
+    /// and may run once more after being disabled, so this outlives the
+    /// driver and only calls into it between start() and stop().
+    ///
+    class ReceiveContext
+    {
+    public:
+
+        ReceiveContext(ComInterfaceFdLinux& comInterfaceFd);
+
+        void start();
+
+        ///
+        /// @brief Returns true when a receive pass is in progress, the caller
+        /// wakes the thread and waits with waitUntilStopped().
+        ///
+        bool stop();
+
+        void waitUntilStopped();
+
+        void threadCallback();
+
+    private:
+
+        // In myState while the thread is in threadCallback()
+        static const std::uint32_t receivingFlag = 0x1;
+
+        // In myState from stop() until start()
+        static const std::uint32_t stoppingFlag = 0x2;
+
+        ComInterfaceFdLinux& myComInterfaceFd;
+
+        std::atomic<std::uint32_t> myState;
+
+        Semaphore& myStoppedSemaphore;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const std::uint32_t myEvents;
+
+    const bool myIsSocket;
+
+    ReceiveCallback& myReceiveCallback;
+
+    TransmitCallback* myTransmitCallback;
+
+    Buffer<std::uint8_t>* myTransmitBuffer;
+
+    int myFileDescriptor;
+
+    int myEpollFileDescriptor;
+
+    int myEventFileDescriptor;
+
+    bool myIsWaitingToTransmit;
+
+    ReceiveContext& myReceiveContext;
+
+    Thread& myReceiveThread;
+
+    Mutex& myMutex;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    void initialize();
+
+    bool writeTransmitQueue();
+
+    bool writeTransmitBuffer();
+
+    void clearTransmitQueue();
+
+    void receive();
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_COM_INTERFACE_FD_LINUX_H
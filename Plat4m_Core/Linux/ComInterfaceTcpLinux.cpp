@@ -0,0 +1,464 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceTcpLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceTcpLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <Plat4m_Core/Linux/ComInterfaceTcpLinux.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/MutexLock.h>
+
+using namespace std;
+
+using Plat4m::ComInterfaceTcpLinux;
+using Plat4m::Module;
+using Plat4m::ComInterface;
+using Plat4m::Thread;
+using Plat4m::Buffer;
+using Plat4m::ByteArray;
+using Plat4m::Array;
+using Plat4m::MutexLock;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void setNoDelayOption(const int fileDescriptor, const bool noDelay)
+{
+    int value = noDelay ? 1 : 0;
+
+    setsockopt(fileDescriptor, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+}
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinux::ComInterfaceTcpLinux(const Mode mode,
+                                           const char* address,
+                                           const uint16_t port) :
+    ComInterface(),
+    myMode(mode),
+    myAddress(address),
+    myPort(port),
+    myNoDelay(true),
+    myListenFileDescriptor(-1),
+    myTransmitBuffer(),
+    myReceiveByteArray(),
+    myComInterfaceFd("ComInterfaceTcpLinux",
+                     EPOLLIN | EPOLLRDHUP,
+                     createCallback(this, &ComInterfaceTcpLinux::receive),
+                     myTransmitBuffer,
+                     true)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinux::~ComInterfaceTcpLinux()
+{
+    driverSetEnabled(false);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods implemented from ComInterface
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceTcpLinux::transmitBytes(
+                                                     const ByteArray& byteArray,
+                                                     const bool waitUntilDone)
+{
+    if (!isEnabled())
+    {
+        return Error(ERROR_CODE_NOT_ENABLED);
+    }
+
+    // A server with no client yet, or a connection that was closed
+    return myComInterfaceFd.transmit(&byteArray,
+                                     1,
+                                     waitUntilDone,
+                                     ERROR_CODE_TRANSMIT_FAILED);
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceTcpLinux::getReceivedBytesCount()
+{
+    return myComInterfaceFd.getReceivedBytesCount(getReceiveBuffer());
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceTcpLinux::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return myComInterfaceFd.getReceivedBytes(getReceiveBuffer(),
+                                             byteArray,
+                                             nBytes);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods overridden for ComInterface
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceTcpLinux::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    if (!isEnabled())
+    {
+        return Error(ERROR_CODE_NOT_ENABLED);
+    }
+
+    return myComInterfaceFd.transmit(segments.getItems(),
+                                     segments.getSize(),
+                                     waitUntilDone,
+                                     ERROR_CODE_TRANSMIT_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinux::Mode ComInterfaceTcpLinux::getMode() const
+{
+    return myMode;
+}
+
+//------------------------------------------------------------------------------
+uint16_t ComInterfaceTcpLinux::getPort()
+{
+    return myPort;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinux::setNoDelay(const bool noDelay)
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    myNoDelay = noDelay;
+
+    const int fileDescriptor = myComInterfaceFd.getFileDescriptor();
+
+    if (fileDescriptor >= 0)
+    {
+        setNoDelayOption(fileDescriptor, myNoDelay);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinux::getNoDelay()
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    return myNoDelay;
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinux::isConnected()
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    return (myComInterfaceFd.getFileDescriptor() >= 0);
+}
+
+//------------------------------------------------------------------------------
+Thread& ComInterfaceTcpLinux::getReceiveThread()
+{
+    return myComInterfaceFd.getReceiveThread();
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceTcpLinux::getTransmitBufferCount()
+{
+    return myComInterfaceFd.getTransmitBufferCount();
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods overridden for Module
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Module::Error ComInterfaceTcpLinux::driverSetEnabled(const bool enabled)
+{
+    if (enabled)
+    {
+        if ((myListenFileDescriptor >= 0) ||
+            (myComInterfaceFd.getFileDescriptor() >= 0))
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(myPort);
+
+        if (inet_pton(AF_INET, myAddress, &(address.sin_addr)) != 1)
+        {
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        int fileDescriptor = socket(AF_INET,
+                                    SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                                    0);
+
+        if (fileDescriptor < 0)
+        {
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        if (myMode == MODE_SERVER)
+        {
+            // A restarted server can listen again while the last connection's
+            // port is in TIME_WAIT
+            int reuseAddress = 1;
+            setsockopt(fileDescriptor,
+                       SOL_SOCKET,
+                       SO_REUSEADDR,
+                       &reuseAddress,
+                       sizeof(reuseAddress));
+
+            socklen_t addressSize = sizeof(address);
+
+            if ((bind(fileDescriptor,
+                      reinterpret_cast<struct sockaddr*>(&address),
+                      sizeof(address)) != 0)                          ||
+                (listen(fileDescriptor, 1) != 0)                      ||
+                (getsockname(fileDescriptor,
+                             reinterpret_cast<struct sockaddr*>(&address),
+                             &addressSize) != 0)                      ||
+                !(myComInterfaceFd.addFileDescriptor(fileDescriptor)))
+            {
+                close(fileDescriptor);
+
+                return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+            }
+
+            myPort = ntohs(address.sin_port);
+            myListenFileDescriptor = fileDescriptor;
+        }
+        else
+        {
+            // Bytes transmitted before the connection is up wait in the ring
+            if (((connect(fileDescriptor,
+                          reinterpret_cast<struct sockaddr*>(&address),
+                          sizeof(address)) != 0) &&
+                 (errno != EINPROGRESS))                              ||
+                !setConnection(fileDescriptor))
+            {
+                close(fileDescriptor);
+
+                return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+            }
+        }
+
+        myComInterfaceFd.startReceiving();
+    }
+    else
+    {
+        if ((myListenFileDescriptor < 0) &&
+            (myComInterfaceFd.getFileDescriptor() < 0))
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        if (myListenFileDescriptor >= 0)
+        {
+            myComInterfaceFd.removeFileDescriptor(myListenFileDescriptor);
+        }
+
+        myComInterfaceFd.stopReceiving();
+
+        if (myListenFileDescriptor >= 0)
+        {
+            close(myListenFileDescriptor);
+            myListenFileDescriptor = -1;
+        }
+
+        closeConnection();
+    }
+
+    return Module::Error(Module::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinux::setConnection(const int fileDescriptor)
+{
+    if (!(myComInterfaceFd.addFileDescriptor(fileDescriptor)))
+    {
+        return false;
+    }
+
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    setNoDelayOption(fileDescriptor, myNoDelay);
+
+    // Only one connection at a time, the newest wins
+    myComInterfaceFd.setFileDescriptor(fileDescriptor);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinux::closeConnection()
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    myComInterfaceFd.closeFileDescriptor();
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinux::acceptConnections()
+{
+    while (true)
+    {
+        int fileDescriptor = accept4(myListenFileDescriptor,
+                                     0,
+                                     0,
+                                     SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (fileDescriptor >= 0)
+        {
+            if (!setConnection(fileDescriptor))
+            {
+                close(fileDescriptor);
+            }
+        }
+        else if ((errno != EINTR) && (errno != ECONNABORTED))
+        {
+            // EAGAIN, nothing left to accept
+            break;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinux::receiveBytes(const int fileDescriptor)
+{
+    const uint32_t maxSize = myReceiveByteArray.getMaxSize();
+
+    while (true)
+    {
+        ssize_t nBytes = recv(fileDescriptor,
+                              myReceiveByteArray.getItems(),
+                              maxSize,
+                              0);
+
+        if (nBytes > 0)
+        {
+            myReceiveByteArray.setSize(static_cast<uint32_t>(nBytes));
+
+            Buffer<uint8_t>* receiveBuffer = getReceiveBuffer();
+
+            if (isValidPointer(receiveBuffer))
+            {
+                MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+                for (ssize_t i = 0; i < nBytes; i++)
+                {
+                    if (!(receiveBuffer->write(myReceiveByteArray[i])))
+                    {
+                        // Buffer overflow
+                        break;
+                    }
+                }
+            }
+
+            bytesReceived(myReceiveByteArray);
+
+            // A short read emptied the socket, epoll says when there's more
+            if (static_cast<uint32_t>(nBytes) < maxSize)
+            {
+                break;
+            }
+        }
+        else if ((nBytes < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((nBytes < 0) && (errno == EAGAIN))
+        {
+            break;
+        }
+        else
+        {
+            // Closed by the peer or reset, a server waits for the next client
+            // and a client stays disconnected until re-enabled
+            closeConnection();
+
+            break;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinux::receive(const int fileDescriptor)
+{
+    if (fileDescriptor == myListenFileDescriptor)
+    {
+        acceptConnections();
+    }
+    // Not for a connection replaced earlier in this receive pass
+    else if (fileDescriptor == myComInterfaceFd.getFileDescriptor())
+    {
+        receiveBytes(fileDescriptor);
+    }
+}
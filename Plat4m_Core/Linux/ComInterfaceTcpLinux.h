@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceTcpLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceTcpLinux class header file.
+///
+
+#ifndef PLAT4M_COM_INTERFACE_TCP_LINUX_H
+#define PLAT4M_COM_INTERFACE_TCP_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/BufferN.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Linux/ComInterfaceFdLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Size of the ring bytes wait in when the socket can't take them
+/// right away. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_TCP_LINUX_TRANSMIT_BUFFER_SIZE
+#define PLAT4M_COM_INTERFACE_TCP_LINUX_TRANSMIT_BUFFER_SIZE 262144
+#endif
+
+///
+/// @brief Maximum number of bytes read from the socket and handed up in one
+/// block. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_TCP_LINUX_RECEIVE_BLOCK_SIZE
+#define PLAT4M_COM_INTERFACE_TCP_LINUX_RECEIVE_BLOCK_SIZE 16384
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief ComInterface over one IPv4 TCP connection. As a client it connects
+/// to the given address and port when enabled, as a server it listens there
+/// and takes the latest connection (a new one replaces the current one, whose
+/// peer most likely went away without closing). The socket is non-blocking:
+/// a receive thread waits on epoll and hands received bytes up a block per
+/// read() (see ComInterface::setBytesReceivedCallback()), and bytes the
+/// socket can't take right away are queued in a ring the receive thread
+/// drains when the socket is writable.
+///
+class ComInterfaceTcpLinux : public ComInterface
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public enumerations
+    //--------------------------------------------------------------------------
+
+    enum Mode
+    {
+        MODE_CLIENT,
+        MODE_SERVER
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Port 0 makes a server listen on any free port, see getPort().
+    ///
+    ComInterfaceTcpLinux(const Mode mode,
+                         const char* address,
+                         const std::uint16_t port);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~ComInterfaceTcpLinux();
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods implemented from ComInterface
+    //--------------------------------------------------------------------------
+
+    virtual ComInterface::Error transmitBytes(
+                                      const ByteArray& byteArray,
+                                      const bool waitUntilDone = true) override;
+
+    virtual std::uint32_t getReceivedBytesCount() override;
+
+    virtual ComInterface::Error getReceivedBytes(
+                                       ByteArray& byteArray,
+                                       const std::uint32_t nBytes = 0) override;
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods overridden for ComInterface
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Sends all segments with one sendmsg(), queueing whatever the
+    /// socket doesn't take. Nothing is sent if the ring can't hold all of it.
+    ///
+    virtual ComInterface::Error transmitSegments(
+                                      const Array<ByteArray>& segments,
+                                      const bool waitUntilDone = false) override;
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    Mode getMode() const;
+
+    ///
+    /// @brief Returns the port listened on or connected to.
+    ///
+    std::uint16_t getPort();
+
+    ///
+    /// @brief Sets TCP_NODELAY on this and later connections. On by default,
+    /// so small frames go out right away instead of waiting on Nagle's
+    /// algorithm for the previous one to be acknowledged.
+    ///
+    void setNoDelay(const bool noDelay);
+
+    bool getNoDelay();
+
+    ///
+    /// @brief Returns true while there's a connection (for a client, also
+    /// while it's still being established).
+    ///
+    bool isConnected();
+
+    Thread& getReceiveThread();
+
+    std::uint32_t getTransmitBufferCount();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const Mode myMode;
+
+    const char* myAddress;
+
+    std::uint16_t myPort;
+
+    bool myNoDelay;
+
+    int myListenFileDescriptor;
+
+    BufferN<std::uint8_t, PLAT4M_COM_INTERFACE_TCP_LINUX_TRANSMIT_BUFFER_SIZE>
+                                                              myTransmitBuffer;
+
+    ByteArrayN<PLAT4M_COM_INTERFACE_TCP_LINUX_RECEIVE_BLOCK_SIZE>
+                                                            myReceiveByteArray;
+
+    ComInterfaceFdLinux myComInterfaceFd;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for Module
+    //--------------------------------------------------------------------------
+
+    virtual Module::Error driverSetEnabled(const bool enabled) override;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    bool setConnection(const int fileDescriptor);
+
+    void closeConnection();
+
+    void acceptConnections();
+
+    void receiveBytes(const int fileDescriptor);
+
+    void receive(const int fileDescriptor);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_COM_INTERFACE_TCP_LINUX_H
@@ -0,0 +1,577 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceUdpLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceUdpLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <cstring>
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <Plat4m_Core/Linux/ComInterfaceUdpLinux.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/MutexLock.h>
+
+using namespace std;
+
+using Plat4m::ComInterfaceUdpLinux;
+using Plat4m::Module;
+using Plat4m::ComInterface;
+using Plat4m::Thread;
+using Plat4m::Buffer;
+using Plat4m::ByteArray;
+using Plat4m::Array;
+using Plat4m::MutexLock;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t maxIoVectors = 16;
+
+static const uint32_t batchSize = PLAT4M_COM_INTERFACE_UDP_LINUX_BATCH_SIZE;
+
+static const uint32_t maxDatagramSize =
+                               PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static bool isTransmitRetryable(const int error)
+{
+    // ENOBUFS, the interface queue is full (a datagram socket's way of saying
+    // EAGAIN on some paths)
+    return ((error == EAGAIN) || (error == EINTR) || (error == ENOBUFS));
+}
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinux::ComInterfaceUdpLinux(const char* localAddress,
+                                           const uint16_t localPort,
+                                           const char* remoteAddress,
+                                           const uint16_t remotePort) :
+    ComInterface(),
+    myLocalAddress(localAddress),
+    myLocalPort(localPort),
+    myRemoteAddress(remoteAddress),
+    myRemotePort(remotePort),
+    myPeerAddress(),
+    myHasPeer(false),
+    myTransmitQueue(),
+    myComInterfaceFd(
+             "ComInterfaceUdpLinux",
+             EPOLLIN,
+             createCallback(this, &ComInterfaceUdpLinux::receiveDatagrams),
+             createCallback(this, &ComInterfaceUdpLinux::writeTransmitQueue))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinux::~ComInterfaceUdpLinux()
+{
+    driverSetEnabled(false);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods implemented from ComInterface
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceUdpLinux::transmitBytes(
+                                                     const ByteArray& byteArray,
+                                                     const bool waitUntilDone)
+{
+    if (!isEnabled())
+    {
+        return Error(ERROR_CODE_NOT_ENABLED);
+    }
+
+    return transmit(&byteArray, 1, waitUntilDone);
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceUdpLinux::getReceivedBytesCount()
+{
+    return myComInterfaceFd.getReceivedBytesCount(getReceiveBuffer());
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceUdpLinux::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return myComInterfaceFd.getReceivedBytes(getReceiveBuffer(),
+                                             byteArray,
+                                             nBytes);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods overridden for ComInterface
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceUdpLinux::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    if (!isEnabled())
+    {
+        return Error(ERROR_CODE_NOT_ENABLED);
+    }
+
+    return transmit(segments.getItems(), segments.getSize(), waitUntilDone);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint16_t ComInterfaceUdpLinux::getLocalPort()
+{
+    return myLocalPort;
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinux::hasPeer()
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    return myHasPeer;
+}
+
+//------------------------------------------------------------------------------
+Thread& ComInterfaceUdpLinux::getReceiveThread()
+{
+    return myComInterfaceFd.getReceiveThread();
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComInterfaceUdpLinux::getTransmitQueueCount()
+{
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    return (myTransmitQueue.count());
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods overridden for Module
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Module::Error ComInterfaceUdpLinux::driverSetEnabled(const bool enabled)
+{
+    if (enabled)
+    {
+        if (myComInterfaceFd.getFileDescriptor() >= 0)
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        struct sockaddr_in localAddress = {};
+        localAddress.sin_family = AF_INET;
+        localAddress.sin_port = htons(myLocalPort);
+
+        struct sockaddr_in remoteAddress = {};
+        remoteAddress.sin_family = AF_INET;
+        remoteAddress.sin_port = htons(myRemotePort);
+
+        if ((inet_pton(AF_INET,
+                       myLocalAddress,
+                       &(localAddress.sin_addr)) != 1) ||
+            (isValidPointer(myRemoteAddress) &&
+             (inet_pton(AF_INET,
+                        myRemoteAddress,
+                        &(remoteAddress.sin_addr)) != 1)))
+        {
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        int fileDescriptor = socket(AF_INET,
+                                    SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                                    0);
+
+        if (fileDescriptor < 0)
+        {
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        int socketBufferSize =
+                              PLAT4M_COM_INTERFACE_UDP_LINUX_SOCKET_BUFFER_SIZE;
+        setsockopt(fileDescriptor,
+                   SOL_SOCKET,
+                   SO_RCVBUF,
+                   &socketBufferSize,
+                   sizeof(socketBufferSize));
+        setsockopt(fileDescriptor,
+                   SOL_SOCKET,
+                   SO_SNDBUF,
+                   &socketBufferSize,
+                   sizeof(socketBufferSize));
+
+        socklen_t addressSize = sizeof(localAddress);
+
+        if ((bind(fileDescriptor,
+                  reinterpret_cast<struct sockaddr*>(&localAddress),
+                  sizeof(localAddress)) != 0)                          ||
+            (getsockname(fileDescriptor,
+                         reinterpret_cast<struct sockaddr*>(&localAddress),
+                         &addressSize) != 0)                           ||
+            (isValidPointer(myRemoteAddress) &&
+             (connect(fileDescriptor,
+                      reinterpret_cast<struct sockaddr*>(&remoteAddress),
+                      sizeof(remoteAddress)) != 0))                    ||
+            !(myComInterfaceFd.addFileDescriptor(fileDescriptor)))
+        {
+            close(fileDescriptor);
+
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+        myLocalPort = ntohs(localAddress.sin_port);
+        myPeerAddress = remoteAddress;
+        myHasPeer = isValidPointer(myRemoteAddress);
+        myComInterfaceFd.setFileDescriptor(fileDescriptor);
+        myTransmitQueue.clear();
+
+        mutexLock.setLocked(false);
+
+        myComInterfaceFd.startReceiving();
+    }
+    else
+    {
+        if (myComInterfaceFd.getFileDescriptor() < 0)
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        myComInterfaceFd.stopReceiving();
+
+        MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+        myComInterfaceFd.closeFileDescriptor();
+        myHasPeer = false;
+        myTransmitQueue.clear();
+    }
+
+    return Module::Error(Module::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComInterfaceUdpLinux::transmit(const ByteArray segments[],
+                                                   const uint32_t nSegments,
+                                                   const bool waitUntilDone)
+{
+    uint32_t nBytes = 0;
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        nBytes += segments[i].getSize();
+    }
+
+    if (nBytes > maxDatagramSize)
+    {
+        return Error(ERROR_CODE_PARAMETER_INVALID);
+    }
+
+    MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+    const int fileDescriptor = myComInterfaceFd.getFileDescriptor();
+
+    if (fileDescriptor < 0)
+    {
+        return Error(ERROR_CODE_NOT_ENABLED);
+    }
+
+    if (!myHasPeer)
+    {
+        return Error(ERROR_CODE_TRANSMIT_FAILED);
+    }
+
+    // Anything already queued has to go first
+    if (myTransmitQueue.isEmpty() && (nSegments <= maxIoVectors))
+    {
+        struct iovec ioVectors[maxIoVectors];
+
+        for (uint32_t i = 0; i < nSegments; i++)
+        {
+            ioVectors[i].iov_base = segments[i].getItems();
+            ioVectors[i].iov_len = segments[i].getSize();
+        }
+
+        struct msghdr message = {};
+        message.msg_iov = ioVectors;
+        message.msg_iovlen = nSegments;
+
+        if (isNullPointer(myRemoteAddress))
+        {
+            message.msg_name = &myPeerAddress;
+            message.msg_namelen = sizeof(myPeerAddress);
+        }
+
+        // A datagram goes whole or not at all
+        if (sendmsg(fileDescriptor, &message, 0) >= 0)
+        {
+            return Error(ERROR_CODE_NONE);
+        }
+
+        if (!isTransmitRetryable(errno))
+        {
+            return Error(ERROR_CODE_TRANSMIT_FAILED);
+        }
+    }
+
+    if (myTransmitQueue.isFull())
+    {
+        return Error(ERROR_CODE_TRANSMIT_BUFFER_FULL);
+    }
+
+    const uint32_t writeIndex = myTransmitQueue.getWriteIndex();
+    Datagram& datagram = myTransmitQueue.getItems()[writeIndex];
+    datagram.size = 0;
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        memcpy(datagram.bytes + datagram.size,
+               segments[i].getItems(),
+               segments[i].getSize());
+        datagram.size += segments[i].getSize();
+    }
+
+    myTransmitQueue.setWriteIndex((writeIndex + 1) % myTransmitQueue.getSize());
+    myTransmitQueue.setCount(myTransmitQueue.count() + 1);
+
+    if (!writeTransmitQueue())
+    {
+        return Error(ERROR_CODE_TRANSMIT_FAILED);
+    }
+
+    if (waitUntilDone)
+    {
+        return myComInterfaceFd.waitUntilTransmitted(mutexLock,
+                                                     ERROR_CODE_NOT_ENABLED);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinux::writeTransmitQueue()
+{
+    const uint32_t size = myTransmitQueue.getSize();
+    Datagram* datagrams = myTransmitQueue.getItems();
+
+    while (!(myTransmitQueue.isEmpty()))
+    {
+        const uint32_t readIndex = myTransmitQueue.getReadIndex();
+        uint32_t nMessages = myTransmitQueue.count();
+
+        if (nMessages > batchSize)
+        {
+            nMessages = batchSize;
+        }
+
+        struct mmsghdr messages[batchSize];
+        struct iovec ioVectors[batchSize];
+
+        for (uint32_t i = 0; i < nMessages; i++)
+        {
+            Datagram& datagram = datagrams[(readIndex + i) % size];
+
+            ioVectors[i].iov_base = datagram.bytes;
+            ioVectors[i].iov_len = datagram.size;
+
+            memset(&(messages[i]), 0, sizeof(messages[i]));
+            messages[i].msg_hdr.msg_iov = &(ioVectors[i]);
+            messages[i].msg_hdr.msg_iovlen = 1;
+
+            if (isNullPointer(myRemoteAddress))
+            {
+                messages[i].msg_hdr.msg_name = &myPeerAddress;
+                messages[i].msg_hdr.msg_namelen = sizeof(myPeerAddress);
+            }
+        }
+
+        int nSentMessages = sendmmsg(myComInterfaceFd.getFileDescriptor(),
+                                     messages,
+                                     nMessages,
+                                     0);
+
+        if (nSentMessages < 0)
+        {
+            if (isTransmitRetryable(errno))
+            {
+                myComInterfaceFd.setWaitingToTransmit(true);
+
+                return true;
+            }
+
+            // Drop the datagram that failed (e.g. ECONNREFUSED left by the
+            // previous one reaching a closed port), the rest may still go
+            myTransmitQueue.setReadIndex((readIndex + 1) % size);
+            myTransmitQueue.setCount(myTransmitQueue.count() - 1);
+
+            return false;
+        }
+
+        myTransmitQueue.setReadIndex((readIndex + nSentMessages) % size);
+        myTransmitQueue.setCount(myTransmitQueue.count() - nSentMessages);
+
+        if (static_cast<uint32_t>(nSentMessages) < nMessages)
+        {
+            myComInterfaceFd.setWaitingToTransmit(true);
+
+            return true;
+        }
+    }
+
+    myComInterfaceFd.setWaitingToTransmit(false);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceUdpLinux::receiveDatagrams(const int fileDescriptor)
+{
+    struct mmsghdr messages[batchSize];
+    struct iovec ioVectors[batchSize];
+
+    while (true)
+    {
+        for (uint32_t i = 0; i < batchSize; i++)
+        {
+            ioVectors[i].iov_base = myReceiveDatagrams[i].bytes;
+            ioVectors[i].iov_len = maxDatagramSize;
+
+            memset(&(messages[i]), 0, sizeof(messages[i]));
+            messages[i].msg_hdr.msg_iov = &(ioVectors[i]);
+            messages[i].msg_hdr.msg_iovlen = 1;
+            messages[i].msg_hdr.msg_name = &(myReceiveAddresses[i]);
+            messages[i].msg_hdr.msg_namelen = sizeof(myReceiveAddresses[i]);
+        }
+
+        int nMessages = recvmmsg(fileDescriptor,
+                                 messages,
+                                 batchSize,
+                                 MSG_DONTWAIT,
+                                 0);
+
+        if (nMessages < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            // EAGAIN, or an error left by a transmit (ECONNREFUSED) that
+            // reading has now cleared
+            break;
+        }
+
+        Buffer<uint8_t>* receiveBuffer = getReceiveBuffer();
+
+        for (int i = 0; i < nMessages; i++)
+        {
+            // Longer than PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE,
+            // dropped rather than handed up cut short
+            if ((messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0)
+            {
+                continue;
+            }
+
+            // Unconnected, reply to whoever sent last. Set before handing the
+            // datagram up so a reply from the callback goes to its sender
+            if (isNullPointer(myRemoteAddress) &&
+                (!myHasPeer ||
+                 (memcmp(&myPeerAddress,
+                         &(myReceiveAddresses[i]),
+                         sizeof(myPeerAddress)) != 0)))
+            {
+                MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+                myPeerAddress = myReceiveAddresses[i];
+                myHasPeer = true;
+            }
+
+            ByteArray byteArray(myReceiveDatagrams[i].bytes,
+                                maxDatagramSize,
+                                messages[i].msg_len);
+
+            if (isValidPointer(receiveBuffer))
+            {
+                MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+                if (!(receiveBuffer->write(byteArray)))
+                {
+                    // Buffer overflow, drop the datagram rather than split it
+                }
+            }
+
+            bytesReceived(byteArray);
+        }
+
+        if (static_cast<uint32_t>(nMessages) < batchSize)
+        {
+            break;
+        }
+    }
+}
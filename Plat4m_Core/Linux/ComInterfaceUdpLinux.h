@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceUdpLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceUdpLinux class header file.
+///
+
+#ifndef PLAT4M_COM_INTERFACE_UDP_LINUX_H
+#define PLAT4M_COM_INTERFACE_UDP_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <netinet/in.h>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/BufferN.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Linux/ComInterfaceFdLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Largest datagram transmitted or received, larger received
+/// datagrams are dropped. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE
+#define PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE 8192
+#endif
+
+///
+/// @brief Maximum number of datagrams moved by one recvmmsg() or sendmmsg().
+/// Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_UDP_LINUX_BATCH_SIZE
+#define PLAT4M_COM_INTERFACE_UDP_LINUX_BATCH_SIZE 16
+#endif
+
+///
+/// @brief Number of datagrams that can wait when the socket can't take them
+/// right away. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_UDP_LINUX_TRANSMIT_QUEUE_SIZE
+#define PLAT4M_COM_INTERFACE_UDP_LINUX_TRANSMIT_QUEUE_SIZE 32
+#endif
+
+///
+/// @brief Socket receive and transmit buffer size requested when enabled.
+/// UDP drops what doesn't fit, so this is how much the receive thread can
+/// fall behind a burst (the kernel caps it at net.core.rmem_max and
+/// net.core.wmem_max). Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_COM_INTERFACE_UDP_LINUX_SOCKET_BUFFER_SIZE
+#define PLAT4M_COM_INTERFACE_UDP_LINUX_SOCKET_BUFFER_SIZE 1048576
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief ComInterface over an IPv4 UDP socket. Every transmitBytes() or
+/// transmitSegments() call is one datagram, so a ComLink transmitting a frame
+/// per call gets a frame per datagram. Given a remote address and port the
+/// socket is connected to it, otherwise it transmits to whoever it last
+/// received from. A receive thread waits on epoll, takes datagrams a batch
+/// per recvmmsg() and hands each up as one block (see
+/// ComInterface::setBytesReceivedCallback()). Datagrams the socket can't
+/// take right away are queued and sent a batch per sendmmsg() when it's
+/// writable.
+///
+class ComInterfaceUdpLinux : public ComInterface
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Local port 0 binds any free port, see getLocalPort().
+    ///
+    ComInterfaceUdpLinux(const char* localAddress,
+                         const std::uint16_t localPort,
+                         const char* remoteAddress = 0,
+                         const std::uint16_t remotePort = 0);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~ComInterfaceUdpLinux();
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods implemented from ComInterface
+    //--------------------------------------------------------------------------
+
+    virtual ComInterface::Error transmitBytes(
+                                      const ByteArray& byteArray,
+                                      const bool waitUntilDone = true) override;
+
+    virtual std::uint32_t getReceivedBytesCount() override;
+
+    virtual ComInterface::Error getReceivedBytes(
+                                       ByteArray& byteArray,
+                                       const std::uint32_t nBytes = 0) override;
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods overridden for ComInterface
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Sends all segments as one datagram with one sendmsg().
+    ///
+    virtual ComInterface::Error transmitSegments(
+                                      const Array<ByteArray>& segments,
+                                      const bool waitUntilDone = false) override;
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    std::uint16_t getLocalPort();
+
+    ///
+    /// @brief Returns true once there's somewhere to transmit to: right away
+    /// when connected to a remote, otherwise after the first datagram
+    /// received.
+    ///
+    bool hasPeer();
+
+    Thread& getReceiveThread();
+
+    std::uint32_t getTransmitQueueCount();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    struct Datagram
+    {
+        std::uint32_t size;
+        std::uint8_t bytes[PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE];
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const char* myLocalAddress;
+
+    std::uint16_t myLocalPort;
+
+    const char* myRemoteAddress;
+
+    const std::uint16_t myRemotePort;
+
+    struct sockaddr_in myPeerAddress;
+
+    bool myHasPeer;
+
+    BufferN<Datagram, PLAT4M_COM_INTERFACE_UDP_LINUX_TRANSMIT_QUEUE_SIZE>
+                                                              myTransmitQueue;
+
+    Datagram myReceiveDatagrams[PLAT4M_COM_INTERFACE_UDP_LINUX_BATCH_SIZE];
+
+    struct sockaddr_in
+                myReceiveAddresses[PLAT4M_COM_INTERFACE_UDP_LINUX_BATCH_SIZE];
+
+    ComInterfaceFdLinux myComInterfaceFd;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for Module
+    //--------------------------------------------------------------------------
+
+    virtual Module::Error driverSetEnabled(const bool enabled) override;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    ComInterface::Error transmit(const ByteArray segments[],
+                                 const std::uint32_t nSegments,
+                                 const bool waitUntilDone);
+
+    bool writeTransmitQueue();
+
+    void receiveDatagrams(const int fileDescriptor);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_COM_INTERFACE_UDP_LINUX_H
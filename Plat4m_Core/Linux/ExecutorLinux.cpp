@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ExecutorLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ExecutorLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <new>
+
+#include <unistd.h>
+
+#include <Plat4m_Core/Linux/ExecutorLinux.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+using Plat4m::ExecutorLinux;
+using Plat4m::Executor;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+thread_local ExecutorLinux::Worker* ExecutorLinux::myCurrentWorker = 0;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ExecutorLinux::ExecutorLinux(const std::uint32_t nWorkers) :
+    Executor((nWorkers == 0) ? getNCpus() : nWorkers),
+    myWorkers(0),
+    myQueue(),
+    myMutexHandle(PTHREAD_MUTEX_INITIALIZER),
+    myConditionHandle(PTHREAD_COND_INITIALIZER),
+    myWakeCounter(0),
+    myNSleepingWorkers(0),
+    myNSteals(0),
+    myShouldExit(false)
+{
+    void* memoryPointer =
+                MemoryAllocator::allocateArray(sizeof(Worker) * getNWorkers());
+    myWorkers = static_cast<Worker*>(memoryPointer);
+
+    // All workers exist before any thread starts looking for one to steal
+    // from
+    for (std::uint32_t i = 0; i < getNWorkers(); i++)
+    {
+        Worker* worker = new(&(myWorkers[i])) Worker();
+        worker->executor = this;
+        worker->index    = i;
+    }
+
+    for (std::uint32_t i = 0; i < getNWorkers(); i++)
+    {
+        if (pthread_create(&(myWorkers[i].threadHandle),
+                           NULL,
+                           &threadCallback,
+                           &(myWorkers[i])) != 0)
+        {
+            while (true)
+            {
+                // Lock up, unable to create thread
+            }
+        }
+
+        pthread_setname_np(myWorkers[i].threadHandle, "Executor");
+    }
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ExecutorLinux::~ExecutorLinux()
+{
+    myShouldExit.store(true, std::memory_order_seq_cst);
+
+    pthread_mutex_lock(&myMutexHandle);
+    myWakeCounter++;
+    pthread_cond_broadcast(&myConditionHandle);
+    pthread_mutex_unlock(&myMutexHandle);
+
+    for (std::uint32_t i = 0; i < getNWorkers(); i++)
+    {
+        pthread_join(myWorkers[i].threadHandle, NULL);
+        myWorkers[i].~Worker();
+    }
+
+    MemoryAllocator::deallocateArray(myWorkers);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t ExecutorLinux::getNSteals() const
+{
+    return (myNSteals.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t ExecutorLinux::getNCpus()
+{
+    const long nCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (nCpus < 1)
+    {
+        return 1;
+    }
+
+    return (static_cast<std::uint32_t>(nCpus));
+}
+
+//------------------------------------------------------------------------------
+void* ExecutorLinux::threadCallback(void* arg)
+{
+    Worker* worker = static_cast<Worker*>(arg);
+
+    myCurrentWorker = worker;
+    worker->executor->runWorker(*worker);
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods overridden for Executor
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Executor::Error ExecutorLinux::driverSubmit(TaskCallback& taskCallback)
+{
+    TaskCallback* pointer = &taskCallback;
+    bool isQueued = false;
+
+    if (isValidPointer(myCurrentWorker) && (myCurrentWorker->executor == this))
+    {
+        isQueued = myCurrentWorker->queue.push(pointer);
+    }
+
+    if (!isQueued)
+    {
+        isQueued = myQueue.enqueue(pointer);
+    }
+
+    if (!isQueued)
+    {
+        return Error(ERROR_CODE_QUEUE_FULL);
+    }
+
+    // Pairs with the fence in runWorker(), either this sees the worker going
+    // to sleep or the worker sees the task
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (myNSleepingWorkers.load(std::memory_order_relaxed) != 0)
+    {
+        wakeWorker();
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void ExecutorLinux::runWorker(Worker& worker)
+{
+    while (!(myShouldExit.load(std::memory_order_relaxed)))
+    {
+        TaskCallback* taskCallback = 0;
+
+        if (takeTask(worker, taskCallback))
+        {
+            taskCallback->call();
+
+            continue;
+        }
+
+        // Nothing to run, announce going to sleep and look once more so a
+        // task submitted in between isn't missed
+        myNSleepingWorkers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        pthread_mutex_lock(&myMutexHandle);
+        const std::uint32_t wakeCounter = myWakeCounter;
+        pthread_mutex_unlock(&myMutexHandle);
+
+        if (takeTask(worker, taskCallback))
+        {
+            myNSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+            taskCallback->call();
+
+            continue;
+        }
+
+        pthread_mutex_lock(&myMutexHandle);
+
+        while ((myWakeCounter == wakeCounter) &&
+               !(myShouldExit.load(std::memory_order_relaxed)))
+        {
+            pthread_cond_wait(&myConditionHandle, &myMutexHandle);
+        }
+
+        pthread_mutex_unlock(&myMutexHandle);
+
+        myNSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ExecutorLinux::takeTask(Worker& worker, TaskCallback*& taskCallback)
+{
+    // Shared queue first, so tasks submitted from outside aren't held up by
+    // tasks that workers keep submitting to themselves
+    if (myQueue.dequeue(taskCallback))
+    {
+        return true;
+    }
+
+    if (worker.queue.steal(taskCallback))
+    {
+        return true;
+    }
+
+    for (std::uint32_t i = 1; i < getNWorkers(); i++)
+    {
+        Worker& victim = myWorkers[(worker.index + i) % getNWorkers()];
+
+        if (victim.queue.steal(taskCallback))
+        {
+            myNSteals.fetch_add(1, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void ExecutorLinux::wakeWorker()
+{
+    pthread_mutex_lock(&myMutexHandle);
+    myWakeCounter++;
+    pthread_cond_signal(&myConditionHandle);
+    pthread_mutex_unlock(&myMutexHandle);
+}
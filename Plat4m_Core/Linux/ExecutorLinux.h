@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ExecutorLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ExecutorLinux class header file.
+///
+
+#ifndef PLAT4M_EXECUTOR_LINUX_H
+#define PLAT4M_EXECUTOR_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <pthread.h>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/Executor.h>
+#include <Plat4m_Core/LockFreeQueue.h>
+#include <Plat4m_Core/WorkStealingQueue.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of tasks each worker can queue for itself. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_EXECUTOR_LINUX_WORKER_QUEUE_SIZE
+#define PLAT4M_EXECUTOR_LINUX_WORKER_QUEUE_SIZE 256
+#endif
+
+///
+/// @brief Number of tasks threads outside the executor can queue. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_EXECUTOR_LINUX_QUEUE_SIZE
+#define PLAT4M_EXECUTOR_LINUX_QUEUE_SIZE 256
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Linux Executor driver, one pthread per worker. Tasks submitted
+/// from a worker go on that worker's own queue, tasks submitted from any
+/// other thread go on a shared queue. A worker runs tasks from the shared
+/// queue first, then its own, then steals from the other workers. Workers
+/// with nothing to run sleep on a condition variable, submit() only takes
+/// the lock when a worker is asleep.
+///
+class ExecutorLinux : public Executor
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ExecutorLinux(const std::uint32_t nWorkers = 0);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~ExecutorLinux();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Returns the number of tasks a worker took from another worker's
+    /// queue.
+    ///
+    std::uint32_t getNSteals() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef WorkStealingQueue<TaskCallback*,
+                              PLAT4M_EXECUTOR_LINUX_WORKER_QUEUE_SIZE>
+                                                                    WorkerQueue;
+
+    struct Worker
+    {
+        ExecutorLinux* executor;
+        std::uint32_t index;
+        pthread_t threadHandle;
+        WorkerQueue queue;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    Worker* myWorkers;
+
+    LockFreeQueue<TaskCallback*, PLAT4M_EXECUTOR_LINUX_QUEUE_SIZE> myQueue;
+
+    pthread_mutex_t myMutexHandle;
+
+    pthread_cond_t myConditionHandle;
+
+    std::uint32_t myWakeCounter;
+
+    std::atomic<std::uint32_t> myNSleepingWorkers;
+
+    std::atomic<std::uint32_t> myNSteals;
+
+    std::atomic<bool> myShouldExit;
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static thread_local Worker* myCurrentWorker;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static std::uint32_t getNCpus();
+
+    static void* threadCallback(void* arg);
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for Executor
+    //--------------------------------------------------------------------------
+
+    virtual Error driverSubmit(TaskCallback& taskCallback) override;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    void runWorker(Worker& worker);
+
+    bool takeTask(Worker& worker, TaskCallback*& taskCallback);
+
+    void wakeWorker();
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_EXECUTOR_LINUX_H
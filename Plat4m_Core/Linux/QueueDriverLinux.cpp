@@ -79,6 +79,7 @@ QueueDriverLinux::QueueDriverLinux(const uint32_t valueSizeBytes) :
 //------------------------------------------------------------------------------
 QueueDriverLinux::~QueueDriverLinux()
 {
+    msgctl(myMessageQueueId, IPC_RMID, NULL);
 }
 
 //------------------------------------------------------------------------------
@@ -123,13 +124,16 @@ bool QueueDriverLinux::driverDequeue(void* value)
     Message message;
     message.value = value;
 
-    return messageReceive(message);
+    return messageReceive(message, true);
 }
 
 //------------------------------------------------------------------------------
 bool QueueDriverLinux::driverDequeueFast(void* value)
 {
-    return (driverDequeue(value));
+    Message message;
+    message.value = value;
+
+    return messageReceive(message, false);
 }
 
 //------------------------------------------------------------------------------
@@ -163,16 +167,27 @@ bool QueueDriverLinux::messageSend(const Message& message)
                myValueSizeBytes);
     }
 
-    return msgsnd(myMessageQueueId, messageBytes, myValueSizeBytes, 1);
+    return (msgsnd(myMessageQueueId, messageBytes, myValueSizeBytes, 0) == 0);
 }
 
 //------------------------------------------------------------------------------
-bool QueueDriverLinux::messageReceive(Message& message)
+bool QueueDriverLinux::messageReceive(Message& message, const bool isBlocking)
 {
     uint8_t messageBytes[sizeof(message.messageType) + myValueSizeBytes];
     memset(messageBytes, 0, sizeof(messageBytes));
 
-    msgrcv(myMessageQueueId, messageBytes, myValueSizeBytes, 0, 0);
+    int flags = 0;
+
+    if (!isBlocking)
+    {
+        flags = IPC_NOWAIT;
+    }
+
+    if (msgrcv(myMessageQueueId, messageBytes, myValueSizeBytes, 0, flags) < 0)
+    {
+        // Queue empty (non-blocking) or interrupted
+        return false;
+    }
 
     memcpy(&(message.messageType),
            &(messageBytes[0]),
@@ -130,7 +130,7 @@ private:
 
     bool messageSend(const Message& message);
 
-    bool messageReceive(Message& message);
+    bool messageReceive(Message& message, const bool isBlocking);
 };
 
 }; // namespace Plat4m
@@ -0,0 +1,424 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file QueueDriverLinuxLockFree.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief QueueDriverLinuxLockFree class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstring>
+#include <cstdlib>
+#include <climits>
+#include <new>
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include <Plat4m_Core/Linux/QueueDriverLinuxLockFree.h>
+#include <Plat4m_Core/Plat4m.h>
+
+using namespace std;
+using Plat4m::QueueDriverLinuxLockFree;
+
+static_assert(sizeof(atomic<uint32_t>) == sizeof(uint32_t),
+              "Futex words must be plain 32-bit integers");
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverLinuxLockFree::QueueDriverLinuxLockFree(
+                                                const uint32_t nValues,
+                                                const uint32_t valueSizeBytes) :
+    QueueDriver(),
+    myNValues((nValues == 0) ? 1 : nValues),
+    myValueSizeBytes(valueSizeBytes),
+    mySlotSizeBytes(
+           ((sizeof(Slot) + valueSizeBytes + sizeof(Slot) - 1) / sizeof(Slot)) *
+                                                                  sizeof(Slot)),
+    myMemory(0),
+    myControl(0),
+    mySlots(0)
+{
+    size_t nBytes = sizeof(Control) + (myNValues * mySlotSizeBytes);
+
+    if (posix_memalign(&myMemory, myCacheLineSizeBytes, nBytes) != 0)
+    {
+        while (true)
+        {
+            // Lock up, unable to allocate queue memory
+        }
+    }
+
+    myControl = new(myMemory) Control();
+    myControl->enqueueCursor.position.store(0, memory_order_relaxed);
+    myControl->dequeueCursor.position.store(0, memory_order_relaxed);
+    myControl->waitState.notifyCounter.store(0, memory_order_relaxed);
+    myControl->waitState.waiterCount.store(0, memory_order_relaxed);
+    myControl->waitState.flushCounter.store(0, memory_order_relaxed);
+
+    mySlots = static_cast<uint8_t*>(myMemory) + sizeof(Control);
+
+    for (uint32_t i = 0; i < myNValues; i++)
+    {
+        Slot* slot = new(mySlots + (i * mySlotSizeBytes)) Slot();
+        slot->turn.store(0, memory_order_relaxed);
+    }
+
+    atomic_thread_fence(memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverLinuxLockFree::~QueueDriverLinuxLockFree()
+{
+    free(myMemory);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriverLinuxLockFree::getCapacity() const
+{
+    return myNValues;
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods overridden for QueueDriver
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriverLinuxLockFree::driverGetSize()
+{
+    uint64_t dequeuePosition =
+                 myControl->dequeueCursor.position.load(memory_order_acquire);
+    uint64_t enqueuePosition =
+                 myControl->enqueueCursor.position.load(memory_order_acquire);
+
+    if (enqueuePosition <= dequeuePosition)
+    {
+        return 0;
+    }
+
+    uint64_t size = enqueuePosition - dequeuePosition;
+
+    if (size > myNValues)
+    {
+        size = myNValues;
+    }
+
+    return static_cast<uint32_t>(size);
+}
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriverLinuxLockFree::driverGetSizeFast()
+{
+    return driverGetSize();
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::driverEnqueue(const void* value)
+{
+    if (!tryEnqueue(value))
+    {
+        return false;
+    }
+
+    WaitState& waitState = myControl->waitState;
+
+    waitState.notifyCounter.fetch_add(1, memory_order_seq_cst);
+
+    // Only pay for the syscall when a consumer is actually parked
+    if (waitState.waiterCount.load(memory_order_seq_cst) != 0)
+    {
+        futexWake(waitState.notifyCounter, 1);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::driverEnqueueFast(const void* value)
+{
+    return (driverEnqueue(value));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::driverDequeue(void* value)
+{
+    WaitState& waitState = myControl->waitState;
+
+    const uint32_t flushCounter =
+                             waitState.flushCounter.load(memory_order_acquire);
+
+    while (true)
+    {
+        if (tryDequeue(value))
+        {
+            return true;
+        }
+
+        waitState.waiterCount.fetch_add(1, memory_order_seq_cst);
+
+        uint32_t notifyCounter =
+                             waitState.notifyCounter.load(memory_order_seq_cst);
+
+        // Re-check after registering as a waiter so that an enqueue between
+        // the first attempt and the futex wait can't be missed
+        if (tryDequeue(value))
+        {
+            waitState.waiterCount.fetch_sub(1, memory_order_seq_cst);
+
+            return true;
+        }
+
+        if (waitState.flushCounter.load(memory_order_acquire) != flushCounter)
+        {
+            waitState.waiterCount.fetch_sub(1, memory_order_seq_cst);
+
+            return false;
+        }
+
+        futexWait(waitState.notifyCounter, notifyCounter);
+
+        waitState.waiterCount.fetch_sub(1, memory_order_seq_cst);
+
+        if (waitState.flushCounter.load(memory_order_acquire) != flushCounter)
+        {
+            return false;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::driverDequeueFast(void* value)
+{
+    return (tryDequeue(value));
+}
+
+//------------------------------------------------------------------------------
+void QueueDriverLinuxLockFree::driverClear()
+{
+    while (tryDequeue(0))
+    {
+    }
+
+    WaitState& waitState = myControl->waitState;
+
+    // Wake any blocked consumers, they return false just like a flush message
+    // on the SysV queue driver
+    waitState.flushCounter.fetch_add(1, memory_order_release);
+    waitState.notifyCounter.fetch_add(1, memory_order_seq_cst);
+
+    if (waitState.waiterCount.load(memory_order_seq_cst) != 0)
+    {
+        futexWake(waitState.notifyCounter, INT_MAX);
+    }
+}
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriverLinuxLockFree::driverEnqueueBatch(
+                                                 const void* values,
+                                                 const uint32_t valueSizeBytes,
+                                                 const uint32_t nValues)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(values);
+    uint32_t nEnqueuedValues = 0;
+
+    while ((nEnqueuedValues < nValues) &&
+           tryEnqueue(bytes + (nEnqueuedValues * valueSizeBytes)))
+    {
+        nEnqueuedValues++;
+    }
+
+    if (nEnqueuedValues == 0)
+    {
+        return 0;
+    }
+
+    WaitState& waitState = myControl->waitState;
+
+    // One notification for the whole batch instead of one per value
+    waitState.notifyCounter.fetch_add(1, memory_order_seq_cst);
+
+    if (waitState.waiterCount.load(memory_order_seq_cst) != 0)
+    {
+        futexWake(waitState.notifyCounter, 1);
+    }
+
+    return nEnqueuedValues;
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void QueueDriverLinuxLockFree::futexWait(atomic<uint32_t>& futex,
+                                         const uint32_t expectedValue)
+{
+    // Returns immediately (EAGAIN) if the counter already moved on, spurious
+    // wake-ups and EINTR are handled by the caller's retry loop
+    syscall(SYS_futex,
+            reinterpret_cast<uint32_t*>(&futex),
+            FUTEX_WAIT_PRIVATE,
+            expectedValue,
+            NULL,
+            NULL,
+            0);
+}
+
+//------------------------------------------------------------------------------
+void QueueDriverLinuxLockFree::futexWake(atomic<uint32_t>& futex,
+                                         const int nWaiters)
+{
+    syscall(SYS_futex,
+            reinterpret_cast<uint32_t*>(&futex),
+            FUTEX_WAKE_PRIVATE,
+            nWaiters,
+            NULL,
+            NULL,
+            0);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverLinuxLockFree::Slot& QueueDriverLinuxLockFree::getSlot(
+                                                  const uint64_t position)
+{
+    uint64_t index = position % myNValues;
+
+    return *(reinterpret_cast<Slot*>(mySlots + (index * mySlotSizeBytes)));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::tryEnqueue(const void* value)
+{
+    atomic<uint64_t>& cursor = myControl->enqueueCursor.position;
+
+    uint64_t position = cursor.load(memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& slot = getSlot(position);
+        uint64_t turn = (position / myNValues) * 2;
+        uint64_t slotTurn = slot.turn.load(memory_order_acquire);
+
+        if (slotTurn == turn)
+        {
+            if (cursor.compare_exchange_weak(position,
+                                             position + 1,
+                                             memory_order_relaxed))
+            {
+                memcpy(reinterpret_cast<uint8_t*>(&slot) + sizeof(Slot),
+                       value,
+                       myValueSizeBytes);
+
+                slot.turn.store(turn + 1, memory_order_release);
+
+                return true;
+            }
+        }
+        else if (slotTurn < turn)
+        {
+            // Slot still holds a value from the previous lap, queue is full
+            return false;
+        }
+        else
+        {
+            // Another producer already claimed this position
+            position = cursor.load(memory_order_relaxed);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFree::tryDequeue(void* value)
+{
+    atomic<uint64_t>& cursor = myControl->dequeueCursor.position;
+
+    uint64_t position = cursor.load(memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& slot = getSlot(position);
+        uint64_t turn = ((position / myNValues) * 2) + 1;
+        uint64_t slotTurn = slot.turn.load(memory_order_acquire);
+
+        if (slotTurn == turn)
+        {
+            if (cursor.compare_exchange_weak(position,
+                                             position + 1,
+                                             memory_order_relaxed))
+            {
+                if (isValidPointer(value))
+                {
+                    memcpy(value,
+                           reinterpret_cast<uint8_t*>(&slot) + sizeof(Slot),
+                           myValueSizeBytes);
+                }
+
+                slot.turn.store(turn + 1, memory_order_release);
+
+                return true;
+            }
+        }
+        else if (slotTurn < turn)
+        {
+            // Slot hasn't been filled for this lap yet, queue is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer already took this position
+            position = cursor.load(memory_order_relaxed);
+        }
+    }
+}
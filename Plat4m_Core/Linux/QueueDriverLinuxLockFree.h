@@ -0,0 +1,202 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file QueueDriverLinuxLockFree.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief QueueDriverLinuxLockFree class header file.
+///
+
+#ifndef PLAT4M_QUEUE_DRIVER_LINUX_LOCK_FREE_H
+#define PLAT4M_QUEUE_DRIVER_LINUX_LOCK_FREE_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+
+#include <Plat4m_Core/QueueDriver.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief In-process queue driver built on a bounded ring buffer of nValues
+/// slots. Any number of producers and consumers are supported without locks.
+/// Enqueue never blocks and fails when the queue is full. Dequeue blocks on a
+/// futex only while the queue is empty. DequeueFast never blocks.
+///
+class QueueDriverLinuxLockFree : public QueueDriver
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    QueueDriverLinuxLockFree(const std::uint32_t nValues,
+                             const std::uint32_t valueSizeBytes);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~QueueDriverLinuxLockFree();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    std::uint32_t getCapacity() const;
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods overridden for QueueDriver
+    //--------------------------------------------------------------------------
+
+    virtual std::uint32_t driverGetSize() override;
+
+    virtual std::uint32_t driverGetSizeFast() override;
+
+    virtual bool driverEnqueue(const void* value) override;
+
+    virtual bool driverEnqueueFast(const void* value) override;
+
+    virtual bool driverDequeue(void* value) override;
+
+    virtual bool driverDequeueFast(void* value) override;
+
+    virtual void driverClear() override;
+
+    virtual std::uint32_t driverEnqueueBatch(
+                                     const void* values,
+                                     const std::uint32_t valueSizeBytes,
+                                     const std::uint32_t nValues) override;
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private constants
+    //--------------------------------------------------------------------------
+
+    static const std::size_t myCacheLineSizeBytes = 64;
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Slot header, the value bytes follow directly after it. Turn 2*n
+    /// means the slot is free for lap n, 2*n+1 means it holds the value of
+    /// lap n.
+    ///
+    struct Slot
+    {
+        std::atomic<std::uint64_t> turn;
+    };
+
+    struct alignas(myCacheLineSizeBytes) Cursor
+    {
+        std::atomic<std::uint64_t> position;
+    };
+
+    struct alignas(myCacheLineSizeBytes) WaitState
+    {
+        std::atomic<std::uint32_t> notifyCounter;
+        std::atomic<std::uint32_t> waiterCount;
+        std::atomic<std::uint32_t> flushCounter;
+    };
+
+    ///
+    /// @brief Producer and consumer cursors each get their own cache line so
+    /// that the two sides never share one.
+    ///
+    struct Control
+    {
+        Cursor enqueueCursor;
+        Cursor dequeueCursor;
+        WaitState waitState;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const std::uint32_t myNValues;
+
+    const std::uint32_t myValueSizeBytes;
+
+    const std::uint32_t mySlotSizeBytes;
+
+    void* myMemory;
+
+    Control* myControl;
+
+    std::uint8_t* mySlots;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void futexWait(std::atomic<std::uint32_t>& futex,
+                          const std::uint32_t expectedValue);
+
+    static void futexWake(std::atomic<std::uint32_t>& futex,
+                          const int nWaiters);
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    Slot& getSlot(const std::uint64_t position);
+
+    bool tryEnqueue(const void* value);
+
+    bool tryDequeue(void* value);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_QUEUE_DRIVER_LINUX_LOCK_FREE_H
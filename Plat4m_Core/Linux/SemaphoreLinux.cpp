@@ -43,6 +43,9 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cerrno>
+#include <ctime>
+
 #include <Plat4m_Core/Linux/SemaphoreLinux.h>
 #include <Plat4m_Core/Plat4m.h>
 
@@ -77,6 +80,7 @@ SemaphoreLinux::SemaphoreLinux(const uint32_t maxValue,
 //------------------------------------------------------------------------------
 SemaphoreLinux::~SemaphoreLinux()
 {
+    sem_destroy(&mySemaphoreHandle);
 }
 
 //------------------------------------------------------------------------------
@@ -84,9 +88,39 @@ SemaphoreLinux::~SemaphoreLinux()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-Semaphore::Error SemaphoreLinux::driverWait()
+Semaphore::Error SemaphoreLinux::driverWait(const TimeMs waitTimeMs)
 {
-    sem_wait(&mySemaphoreHandle);
+    if (waitTimeMs == 0xFFFFFFFF)
+    {
+        while ((sem_wait(&mySemaphoreHandle) != 0) && (errno == EINTR))
+        {
+            // Interrupted by a signal, wait again
+        }
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    struct timespec timeoutTime;
+    clock_gettime(CLOCK_MONOTONIC, &timeoutTime);
+
+    timeoutTime.tv_sec += waitTimeMs / 1000;
+    timeoutTime.tv_nsec += (waitTimeMs % 1000) * 1000000;
+
+    if (timeoutTime.tv_nsec >= 1000000000)
+    {
+        timeoutTime.tv_sec++;
+        timeoutTime.tv_nsec -= 1000000000;
+    }
+
+    while (sem_clockwait(&mySemaphoreHandle,
+                         CLOCK_MONOTONIC,
+                         &timeoutTime) != 0)
+    {
+        if (errno != EINTR)
+        {
+            return Error(ERROR_CODE_TIMEOUT);
+        }
+    }
 
     return Error(ERROR_CODE_NONE);
 }
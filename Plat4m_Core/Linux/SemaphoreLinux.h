@@ -64,6 +64,10 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Linux Semaphore driver. Timed waits are measured against
+/// CLOCK_MONOTONIC so they aren't affected by wall clock changes.
+///
 class SemaphoreLinux : public Semaphore
 {
 public:
@@ -93,7 +97,7 @@ private:
     // Private virtual methods overridden for Semaphore
     //--------------------------------------------------------------------------
 
-    virtual Error driverWait() override;
+    virtual Error driverWait(const TimeMs waitTimeMs) override;
 
     virtual Error driverPost() override;
 
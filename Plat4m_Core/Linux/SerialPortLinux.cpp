@@ -0,0 +1,387 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SerialPortLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SerialPortLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// termios2 and BOTHER, which <termios.h> doesn't have (and can't be included
+// alongside)
+#include <asm/termbits.h>
+
+#include <Plat4m_Core/Linux/SerialPortLinux.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/MutexLock.h>
+
+using namespace std;
+
+using Plat4m::SerialPortLinux;
+using Plat4m::SerialPort;
+using Plat4m::Module;
+using Plat4m::ComInterface;
+using Plat4m::Thread;
+using Plat4m::Buffer;
+using Plat4m::ByteArray;
+using Plat4m::Array;
+using Plat4m::MutexLock;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void setRawMode(struct termios2& termios)
+{
+    termios.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR |
+                         ICRNL | IXON | IXOFF | IXANY);
+    termios.c_oflag &= ~OPOST;
+    termios.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    termios.c_cflag |= (CREAD | CLOCAL);
+    termios.c_cc[VMIN]  = 0;
+    termios.c_cc[VTIME] = 0;
+}
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinux::SerialPortLinux(const char* deviceName) :
+    SerialPort(deviceName),
+    myTransmitBuffer(),
+    myReceiveByteArray(),
+    myComInterfaceFd("SerialPortLinux",
+                     EPOLLIN,
+                     createCallback(this, &SerialPortLinux::receiveBytes),
+                     myTransmitBuffer,
+                     false)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinux::~SerialPortLinux()
+{
+    driverSetEnabled(false);
+}
+
+//------------------------------------------------------------------------------
+// Public virtual methods overridden for ComInterface
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error SerialPortLinux::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    if (!isEnabled())
+    {
+        return ComInterface::Error(ComInterface::ERROR_CODE_NOT_ENABLED);
+    }
+
+    return transmit(segments.getItems(), segments.getSize(), waitUntilDone);
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Thread& SerialPortLinux::getReceiveThread()
+{
+    return myComInterfaceFd.getReceiveThread();
+}
+
+//------------------------------------------------------------------------------
+uint32_t SerialPortLinux::getTransmitBufferCount()
+{
+    return myComInterfaceFd.getTransmitBufferCount();
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods overridden for Module
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Module::Error SerialPortLinux::driverSetEnabled(const bool enabled)
+{
+    if (enabled)
+    {
+        if (myComInterfaceFd.getFileDescriptor() >= 0)
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        int fileDescriptor = open(getName(),
+                                  O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+
+        if (fileDescriptor < 0)
+        {
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        // Raw until configured, a tty left in canonical mode would echo and
+        // translate bytes
+        struct termios2 termios;
+
+        if (ioctl(fileDescriptor, TCGETS2, &termios) != 0)
+        {
+            close(fileDescriptor);
+
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        setRawMode(termios);
+
+        if ((ioctl(fileDescriptor, TCSETS2, &termios) != 0) ||
+            !(myComInterfaceFd.addFileDescriptor(fileDescriptor)))
+        {
+            close(fileDescriptor);
+
+            return Module::Error(Module::ERROR_CODE_ENABLE_FAILED);
+        }
+
+        MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+        myComInterfaceFd.setFileDescriptor(fileDescriptor);
+
+        mutexLock.setLocked(false);
+
+        myComInterfaceFd.startReceiving();
+    }
+    else
+    {
+        if (myComInterfaceFd.getFileDescriptor() < 0)
+        {
+            return Module::Error(Module::ERROR_CODE_NONE);
+        }
+
+        myComInterfaceFd.stopReceiving();
+
+        MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+        myComInterfaceFd.closeFileDescriptor();
+    }
+
+    return Module::Error(Module::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private virtual methods overridden for SerialPort
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPort::Error SerialPortLinux::driverSetConfig(const Config& config)
+{
+    // termios has no 9 bit words
+    if ((config.wordBits != WORD_BITS_8) || (config.baudRate == 0))
+    {
+        return Error(ERROR_CODE_SET_CONFIG_FAILED);
+    }
+
+    struct termios2 termios;
+
+    if (ioctl(myComInterfaceFd.getFileDescriptor(), TCGETS2, &termios) != 0)
+    {
+        return Error(ERROR_CODE_SET_CONFIG_FAILED);
+    }
+
+    setRawMode(termios);
+
+    termios.c_cflag &= ~(CBAUD | CIBAUD | CSIZE | CSTOPB | PARENB | PARODD |
+                         CRTSCTS);
+    termios.c_iflag &= ~INPCK;
+
+    // BOTHER takes the rate from c_ospeed as is, so rates without a Bxxx
+    // constant (250000, 1000000, 3000000...) work too
+    termios.c_cflag |= (BOTHER | CS8);
+    termios.c_ospeed = config.baudRate;
+    termios.c_ispeed = config.baudRate;
+
+    if (config.stopBits == STOP_BITS_2)
+    {
+        termios.c_cflag |= CSTOPB;
+    }
+
+    switch (config.parityBit)
+    {
+        case PARITY_BIT_EVEN:
+        {
+            termios.c_cflag |= PARENB;
+            termios.c_iflag |= INPCK;
+
+            break;
+        }
+        case PARITY_BIT_ODD:
+        {
+            termios.c_cflag |= (PARENB | PARODD);
+            termios.c_iflag |= INPCK;
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+    if (ioctl(myComInterfaceFd.getFileDescriptor(), TCSETS2, &termios) != 0)
+    {
+        return Error(ERROR_CODE_SET_CONFIG_FAILED);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error SerialPortLinux::driverTransmitBytes(
+                                                     const ByteArray& byteArray,
+                                                     const bool waitUntilDone)
+{
+    return transmit(&byteArray, 1, waitUntilDone);
+}
+
+//------------------------------------------------------------------------------
+uint32_t SerialPortLinux::driverGetReceivedBytesCount()
+{
+    return myComInterfaceFd.getReceivedBytesCount(getReceiveBuffer());
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error SerialPortLinux::driverGetReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return myComInterfaceFd.getReceivedBytes(getReceiveBuffer(),
+                                             byteArray,
+                                             nBytes);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error SerialPortLinux::transmit(const ByteArray segments[],
+                                              const uint32_t nSegments,
+                                              const bool waitUntilDone)
+{
+    ComInterface::Error error =
+                myComInterfaceFd.transmit(segments,
+                                          nSegments,
+                                          waitUntilDone,
+                                          ComInterface::ERROR_CODE_NOT_ENABLED);
+
+    if (waitUntilDone && (error.getCode() == ComInterface::ERROR_CODE_NONE))
+    {
+        // tcdrain(), waits for the last byte to leave the hardware
+        ioctl(myComInterfaceFd.getFileDescriptor(), TCSBRK, 1);
+    }
+
+    return error;
+}
+
+//------------------------------------------------------------------------------
+void SerialPortLinux::receiveBytes(const int fileDescriptor)
+{
+    const uint32_t maxSize = myReceiveByteArray.getMaxSize();
+
+    while (true)
+    {
+        ssize_t nBytes = read(fileDescriptor,
+                              myReceiveByteArray.getItems(),
+                              maxSize);
+
+        if (nBytes > 0)
+        {
+            myReceiveByteArray.setSize(static_cast<uint32_t>(nBytes));
+
+            Buffer<uint8_t>* receiveBuffer = getReceiveBuffer();
+
+            if (isValidPointer(receiveBuffer))
+            {
+                MutexLock mutexLock(myComInterfaceFd.getMutex());
+
+                for (ssize_t i = 0; i < nBytes; i++)
+                {
+                    if (!(receiveBuffer->write(myReceiveByteArray[i])))
+                    {
+                        // Buffer overflow
+                        break;
+                    }
+                }
+            }
+
+            bytesReceived(myReceiveByteArray);
+
+            // A short read emptied the tty, epoll says when there's more
+            if (static_cast<uint32_t>(nBytes) < maxSize)
+            {
+                break;
+            }
+        }
+        else if ((nBytes < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((nBytes < 0) && (errno == EAGAIN))
+        {
+            break;
+        }
+        else
+        {
+            // Hung up (the other end of a pty closed, a USB adapter was
+            // unplugged), stop waiting on it until re-enabled
+            myComInterfaceFd.removeFileDescriptor(fileDescriptor);
+
+            break;
+        }
+    }
+}
@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SerialPortLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SerialPortLinux class header file.
+///
+
+#ifndef PLAT4M_SERIAL_PORT_LINUX_H
+#define PLAT4M_SERIAL_PORT_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/SerialPort.h>
+#include <Plat4m_Core/BufferN.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Linux/ComInterfaceFdLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Size of the ring bytes wait in when the tty can't take them right
+/// away. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_SERIAL_PORT_LINUX_TRANSMIT_BUFFER_SIZE
+#define PLAT4M_SERIAL_PORT_LINUX_TRANSMIT_BUFFER_SIZE 65536
+#endif
+
+///
+/// @brief Maximum number of bytes read from the tty and handed up in one
+/// block. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_SERIAL_PORT_LINUX_RECEIVE_BLOCK_SIZE
+#define PLAT4M_SERIAL_PORT_LINUX_RECEIVE_BLOCK_SIZE 4096
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief SerialPort on a Linux tty (/dev/ttyUSB0, /dev/ttyS0, a pty...).
+/// The tty is put in raw mode when enabled and configured through termios2,
+/// so any baud rate the hardware supports can be set, not just the Bxxx
+/// constants. A receive thread waits on epoll and hands received bytes up a
+/// block per read() (see ComInterface::setBytesReceivedCallback()).
+/// Transmitting never blocks: bytes the tty can't take right away are queued
+/// in a ring and written by the receive thread when the tty is writable.
+///
+class SerialPortLinux : public SerialPort
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    SerialPortLinux(const char* deviceName);
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~SerialPortLinux();
+
+    //--------------------------------------------------------------------------
+    // Public virtual methods overridden for ComInterface
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Writes all segments with one writev(), queueing whatever the
+    /// tty doesn't take. Nothing is written if the ring can't hold all of it.
+    ///
+    virtual ComInterface::Error transmitSegments(
+                                      const Array<ByteArray>& segments,
+                                      const bool waitUntilDone = false) override;
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    Thread& getReceiveThread();
+
+    std::uint32_t getTransmitBufferCount();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    BufferN<std::uint8_t, PLAT4M_SERIAL_PORT_LINUX_TRANSMIT_BUFFER_SIZE>
+                                                              myTransmitBuffer;
+
+    ByteArrayN<PLAT4M_SERIAL_PORT_LINUX_RECEIVE_BLOCK_SIZE> myReceiveByteArray;
+
+    ComInterfaceFdLinux myComInterfaceFd;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for Module
+    //--------------------------------------------------------------------------
+
+    virtual Module::Error driverSetEnabled(const bool enabled) override;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for SerialPort
+    //--------------------------------------------------------------------------
+
+    virtual SerialPort::Error driverSetConfig(const Config& config) override;
+
+    virtual ComInterface::Error driverTransmitBytes(
+                                             const ByteArray& byteArray,
+                                             const bool waitUntilDone) override;
+
+    virtual std::uint32_t driverGetReceivedBytesCount() override;
+
+    virtual ComInterface::Error driverGetReceivedBytes(
+                                           ByteArray& byteArray,
+                                           const std::uint32_t nBytes) override;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    ComInterface::Error transmit(const ByteArray segments[],
+                                 const std::uint32_t nSegments,
+                                 const bool waitUntilDone);
+
+    void receiveBytes(const int fileDescriptor);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SERIAL_PORT_LINUX_H
@@ -0,0 +1,452 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SharedMemoryRingLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SharedMemoryRingLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include <Plat4m_Core/Linux/SharedMemoryRingLinux.h>
+
+using namespace std;
+using Plat4m::SharedMemoryRingLinux;
+
+static_assert(sizeof(atomic<uint32_t>) == sizeof(uint32_t),
+              "Futex words must be plain 32-bit integers");
+
+static_assert(atomic<uint64_t>::is_always_lock_free,
+              "Shared memory atomics must be lock-free to work across "
+              "processes");
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const uint32_t SharedMemoryRingLinux::myMagic = 0x504C3452; // "PL4R"
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::SharedMemoryRingLinux() :
+    myName(),
+    myIsWriter(false),
+    myMemory(0),
+    myMemorySizeBytes(0),
+    myHeader(0),
+    mySlots(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::~SharedMemoryRingLinux()
+{
+    close();
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::Error SharedMemoryRingLinux::create(
+                                            const char* name,
+                                            const uint32_t nSlots,
+                                            const uint32_t dataSizeBytes)
+{
+    if (isOpen())
+    {
+        return Error(ERROR_CODE_ALREADY_OPEN);
+    }
+
+    // Readers still attached to a stale segment keep their mapping but will
+    // see no further writes
+    shm_unlink(name);
+
+    int fileDescriptor = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if (fileDescriptor < 0)
+    {
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    const size_t memorySizeBytes = getMemorySizeBytes(nSlots, dataSizeBytes);
+
+    if (ftruncate(fileDescriptor, memorySizeBytes) != 0)
+    {
+        ::close(fileDescriptor);
+        shm_unlink(name);
+
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    Error error = map(fileDescriptor, memorySizeBytes);
+
+    if (error.getCode() != ERROR_CODE_NONE)
+    {
+        shm_unlink(name);
+
+        return error;
+    }
+
+    // New segments are zero filled, so every slot starts at version 0
+    myHeader = new(myMemory) Header();
+    myHeader->nSlots        = nSlots;
+    myHeader->dataSizeBytes = dataSizeBytes;
+    myHeader->slotSizeBytes = getSlotSizeBytes(dataSizeBytes);
+    myHeader->nWrites.store(0, memory_order_relaxed);
+    myHeader->wakeCounter.store(0, memory_order_relaxed);
+    myHeader->nWaiters.store(0, memory_order_relaxed);
+
+    for (uint32_t i = 0; i < nSlots; i++)
+    {
+        new(&(getSlotHeader(i))) SlotHeader();
+    }
+
+    // Readers that see the magic number see the layout
+    myHeader->magic.store(myMagic, memory_order_release);
+
+    strncpy(myName, name, sizeof(myName) - 1);
+    myIsWriter = true;
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::Error SharedMemoryRingLinux::open(
+                                            const char* name,
+                                            const uint32_t nSlots,
+                                            const uint32_t dataSizeBytes)
+{
+    if (isOpen())
+    {
+        return Error(ERROR_CODE_ALREADY_OPEN);
+    }
+
+    int fileDescriptor = shm_open(name, O_RDWR, 0600);
+
+    if (fileDescriptor < 0)
+    {
+        return Error(ERROR_CODE_NOT_FOUND);
+    }
+
+    const size_t memorySizeBytes = getMemorySizeBytes(nSlots, dataSizeBytes);
+
+    struct stat fileStatus;
+
+    if ((fstat(fileDescriptor, &fileStatus) != 0) ||
+        (static_cast<size_t>(fileStatus.st_size) != memorySizeBytes))
+    {
+        ::close(fileDescriptor);
+
+        // Also the case while the writer is still sizing the segment
+        return Error(ERROR_CODE_SIZE_MISMATCH);
+    }
+
+    Error error = map(fileDescriptor, memorySizeBytes);
+
+    if (error.getCode() != ERROR_CODE_NONE)
+    {
+        return error;
+    }
+
+    Header* header = static_cast<Header*>(myMemory);
+
+    if ((header->magic.load(memory_order_acquire) != myMagic) ||
+        (header->nSlots != nSlots)                            ||
+        (header->dataSizeBytes != dataSizeBytes))
+    {
+        munmap(myMemory, myMemorySizeBytes);
+        myMemory = 0;
+        mySlots = 0;
+
+        return Error(ERROR_CODE_SIZE_MISMATCH);
+    }
+
+    myHeader = header;
+    myIsWriter = false;
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void SharedMemoryRingLinux::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    munmap(myMemory, myMemorySizeBytes);
+
+    if (myIsWriter)
+    {
+        shm_unlink(myName);
+    }
+
+    myMemory = 0;
+    myMemorySizeBytes = 0;
+    myHeader = 0;
+    mySlots = 0;
+    myIsWriter = false;
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinux::isOpen() const
+{
+    return isValidPointer(myHeader);
+}
+
+//------------------------------------------------------------------------------
+uint32_t SharedMemoryRingLinux::getNSlots() const
+{
+    return (myHeader->nSlots);
+}
+
+//------------------------------------------------------------------------------
+uint64_t SharedMemoryRingLinux::getNWrites() const
+{
+    return (myHeader->nWrites.load(memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+void SharedMemoryRingLinux::write(const void* data,
+                                  const uint32_t sequenceId,
+                                  const TimeStamp& timeStamp)
+{
+    const uint64_t writeIndex = myHeader->nWrites.load(memory_order_relaxed);
+    SlotHeader& slotHeader = getSlotHeader(writeIndex);
+
+    slotHeader.version.store(getVersion(writeIndex) - 1,
+                             memory_order_relaxed);
+
+    // Readers that see the new data also see the odd version
+    atomic_thread_fence(memory_order_release);
+
+    slotHeader.sequenceId = sequenceId;
+    slotHeader.timeStamp  = timeStamp;
+    memcpy(reinterpret_cast<uint8_t*>(&slotHeader) + sizeof(SlotHeader),
+           data,
+           myHeader->dataSizeBytes);
+
+    slotHeader.version.store(getVersion(writeIndex), memory_order_release);
+    myHeader->nWrites.store(writeIndex + 1, memory_order_release);
+
+    // Pairs with the reader announcing itself in waitForWrite(), either the
+    // reader sees the new write or this sees the reader
+    myHeader->wakeCounter.fetch_add(1, memory_order_seq_cst);
+
+    if (myHeader->nWaiters.load(memory_order_seq_cst) != 0)
+    {
+        syscall(SYS_futex,
+                reinterpret_cast<uint32_t*>(&(myHeader->wakeCounter)),
+                FUTEX_WAKE,
+                INT32_MAX,
+                NULL,
+                NULL,
+                0);
+    }
+}
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::ReadResult SharedMemoryRingLinux::read(
+                                                const uint64_t writeIndex,
+                                                void* data,
+                                                uint32_t& sequenceId,
+                                                TimeStamp& timeStamp) const
+{
+    const SlotHeader& slotHeader = getSlotHeader(writeIndex);
+    const uint64_t version = getVersion(writeIndex);
+
+    while (true)
+    {
+        const uint64_t firstVersion =
+                                slotHeader.version.load(memory_order_acquire);
+
+        if (firstVersion > version)
+        {
+            return READ_RESULT_OVERWRITTEN;
+        }
+
+        if (firstVersion < (version - 1))
+        {
+            return READ_RESULT_NOT_WRITTEN;
+        }
+
+        if (firstVersion == version)
+        {
+            sequenceId = slotHeader.sequenceId;
+            timeStamp  = slotHeader.timeStamp;
+            memcpy(data,
+                   reinterpret_cast<const uint8_t*>(&slotHeader) +
+                                                            sizeof(SlotHeader),
+                   myHeader->dataSizeBytes);
+
+            // The copy completes before the version is checked again
+            atomic_thread_fence(memory_order_acquire);
+
+            if (slotHeader.version.load(memory_order_relaxed) == version)
+            {
+                return READ_RESULT_OK;
+            }
+        }
+
+        // Slot is being written, retry
+    }
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinux::waitForWrite(const uint64_t nWrites,
+                                         const TimeMs waitTimeMs)
+{
+    myHeader->nWaiters.fetch_add(1, memory_order_seq_cst);
+
+    const uint32_t wakeCounter =
+                          myHeader->wakeCounter.load(memory_order_seq_cst);
+
+    if (getNWrites() == nWrites)
+    {
+        struct timespec timeout;
+        timeout.tv_sec  = waitTimeMs / 1000;
+        timeout.tv_nsec = (waitTimeMs % 1000) * 1000000;
+
+        // Returns immediately if the writer already moved the counter on,
+        // shared (not private) since the waker is another process
+        syscall(SYS_futex,
+                reinterpret_cast<uint32_t*>(&(myHeader->wakeCounter)),
+                FUTEX_WAIT,
+                wakeCounter,
+                &timeout,
+                NULL,
+                0);
+    }
+
+    myHeader->nWaiters.fetch_sub(1, memory_order_seq_cst);
+
+    return (getNWrites() != nWrites);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t SharedMemoryRingLinux::getSlotSizeBytes(const uint32_t dataSizeBytes)
+{
+    const uint32_t alignment = alignof(SlotHeader);
+
+    return ((sizeof(SlotHeader) + dataSizeBytes + alignment - 1) /
+            alignment * alignment);
+}
+
+//------------------------------------------------------------------------------
+size_t SharedMemoryRingLinux::getMemorySizeBytes(const uint32_t nSlots,
+                                                 const uint32_t dataSizeBytes)
+{
+    return (sizeof(Header) +
+            (static_cast<size_t>(nSlots) * getSlotSizeBytes(dataSizeBytes)));
+}
+
+//------------------------------------------------------------------------------
+uint64_t SharedMemoryRingLinux::getVersion(const uint64_t writeIndex)
+{
+    // Unwritten slots have version 0
+    return ((writeIndex + 1) * 2);
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::Error SharedMemoryRingLinux::map(
+                                               const int fileDescriptor,
+                                               const size_t memorySizeBytes)
+{
+    void* memory = mmap(NULL,
+                        memorySizeBytes,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED,
+                        fileDescriptor,
+                        0);
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fileDescriptor);
+
+    if (memory == MAP_FAILED)
+    {
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    myMemory = memory;
+    myMemorySizeBytes = memorySizeBytes;
+    mySlots = static_cast<uint8_t*>(memory) + sizeof(Header);
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinux::SlotHeader& SharedMemoryRingLinux::getSlotHeader(
+                                                const uint64_t writeIndex) const
+{
+    // Only called once the layout is known, through create() or open()
+    const uint32_t nSlots = static_cast<const Header*>(myMemory)->nSlots;
+    const uint32_t slotSizeBytes =
+                        static_cast<const Header*>(myMemory)->slotSizeBytes;
+
+    return *(reinterpret_cast<SlotHeader*>(
+                  mySlots + ((writeIndex % nSlots) * slotSizeBytes)));
+}
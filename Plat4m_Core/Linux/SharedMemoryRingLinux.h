@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SharedMemoryRingLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SharedMemoryRingLinux class header file.
+///
+
+#ifndef PLAT4M_SHARED_MEMORY_RING_LINUX_H
+#define PLAT4M_SHARED_MEMORY_RING_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TimeStamp.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Ring of fixed-size samples in a named POSIX shared memory segment,
+/// with a single writer process and any number of reader processes. Each
+/// slot carries a version that is odd while the slot is being written, so
+/// readers never block the writer: they copy a slot and retry if its version
+/// changed. Readers can sleep on a futex in the segment until the next write.
+///
+class SharedMemoryRingLinux
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE,
+        ERROR_CODE_ALREADY_OPEN,
+        ERROR_CODE_NOT_FOUND,
+        ERROR_CODE_OPEN_FAILED,
+        ERROR_CODE_SIZE_MISMATCH
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    enum ReadResult
+    {
+        READ_RESULT_OK,
+        READ_RESULT_NOT_WRITTEN,
+        READ_RESULT_OVERWRITTEN
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    SharedMemoryRingLinux();
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    ~SharedMemoryRingLinux();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Creates the segment as its writer, replacing any segment left
+    /// behind with the same name. The segment is unlinked on close().
+    /// @param name Segment name, starting with '/'.
+    ///
+    Error create(const char* name,
+                 const std::uint32_t nSlots,
+                 const std::uint32_t dataSizeBytes);
+
+    ///
+    /// @brief Opens a segment created by a writer as a reader.
+    /// @return ERROR_CODE_NOT_FOUND if the writer has not created it yet.
+    ///
+    Error open(const char* name,
+               const std::uint32_t nSlots,
+               const std::uint32_t dataSizeBytes);
+
+    void close();
+
+    bool isOpen() const;
+
+    std::uint32_t getNSlots() const;
+
+    ///
+    /// @brief Returns the total number of samples written. The samples still
+    /// held are write indexes max(0, nWrites - nSlots) to nWrites - 1.
+    ///
+    std::uint64_t getNWrites() const;
+
+    ///
+    /// @brief Stores a sample, overwriting the oldest once the ring is full.
+    /// Only the writer may call this.
+    ///
+    void write(const void* data,
+               const std::uint32_t sequenceId,
+               const TimeStamp& timeStamp);
+
+    ///
+    /// @brief Copies the sample with the given write index.
+    ///
+    ReadResult read(const std::uint64_t writeIndex,
+                    void* data,
+                    std::uint32_t& sequenceId,
+                    TimeStamp& timeStamp) const;
+
+    ///
+    /// @brief Waits until the number of writes differs from the given one.
+    /// @return False on timeout.
+    ///
+    bool waitForWrite(const std::uint64_t nWrites, const TimeMs waitTimeMs);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private constants
+    //--------------------------------------------------------------------------
+
+    static const std::uint32_t myMagic;
+
+    static const std::size_t myCacheLineSizeBytes = 64;
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Start of the segment. The writer fills in the layout before
+    /// storing the magic number, readers check it matches their own.
+    ///
+    struct Header
+    {
+        std::atomic<std::uint32_t> magic;
+        std::uint32_t nSlots;
+        std::uint32_t dataSizeBytes;
+        std::uint32_t slotSizeBytes;
+        alignas(myCacheLineSizeBytes) std::atomic<std::uint64_t> nWrites;
+        std::atomic<std::uint32_t> wakeCounter;
+        std::atomic<std::uint32_t> nWaiters;
+    };
+
+    ///
+    /// @brief Slot header, the sample data follows directly after it.
+    ///
+    struct SlotHeader
+    {
+        std::atomic<std::uint64_t> version;
+        std::uint32_t sequenceId;
+        TimeStamp timeStamp;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    char myName[64];
+
+    bool myIsWriter;
+
+    void* myMemory;
+
+    std::size_t myMemorySizeBytes;
+
+    Header* myHeader;
+
+    std::uint8_t* mySlots;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static std::uint32_t getSlotSizeBytes(const std::uint32_t dataSizeBytes);
+
+    static std::size_t getMemorySizeBytes(const std::uint32_t nSlots,
+                                          const std::uint32_t dataSizeBytes);
+
+    static std::uint64_t getVersion(const std::uint64_t writeIndex);
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    Error map(const int fileDescriptor, const std::size_t memorySizeBytes);
+
+    SlotHeader& getSlotHeader(const std::uint64_t writeIndex) const;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    SharedMemoryRingLinux(const SharedMemoryRingLinux& ring);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SHARED_MEMORY_RING_LINUX_H
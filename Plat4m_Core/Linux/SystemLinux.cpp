@@ -53,51 +53,26 @@
 #include <Plat4m_Core/Linux/MutexLinux.h>
 #include <Plat4m_Core/Linux/WaitConditionLinux.h>
 #include <Plat4m_Core/Linux/QueueDriverLinux.h>
+#include <Plat4m_Core/Linux/QueueDriverLinuxLockFree.h>
 #include <Plat4m_Core/Linux/SemaphoreLinux.h>
+#include <Plat4m_Core/Linux/ExecutorLinux.h>
 #include <Plat4m_Core/MemoryAllocator.h>
 
 using namespace std;
 using namespace Plat4m;
 
-//------------------------------------------------------------------------------
-// Public static methods
-//------------------------------------------------------------------------------
-
-//------------------------------------------------------------------------------
-inline TimeMs SystemLinux::getCurrentLinuxTimeMs()
-{
-    struct timespec timeSpec;
-    clock_gettime(CLOCK_REALTIME, &timeSpec);
-
-    return (timeSpec.tv_sec * 1000 + timeSpec.tv_nsec / 1000000);
-}
-
-//------------------------------------------------------------------------------
-inline TimeUs SystemLinux::getCurrentLinuxTimeUs()
-{
-    struct timespec timeSpec;
-    clock_gettime(CLOCK_REALTIME, &timeSpec);
-
-    return (timeSpec.tv_sec * 1000000 + timeSpec.tv_nsec / 1000);
-}
-
 //------------------------------------------------------------------------------
 // Public constructors
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-SystemLinux::SystemLinux() :
+SystemLinux::SystemLinux(const QueueDriverType queueDriverType) :
     System(),
     myFirstTimeSpec(),
-    myIsRunning(false)
+    myIsRunning(false),
+    myQueueDriverType(queueDriverType)
 {
-    clock_gettime(CLOCK_REALTIME, &myFirstTimeSpec);
-
-    myFirstTimeMs =
-            (myFirstTimeSpec.tv_sec * 1000 + myFirstTimeSpec.tv_nsec / 1000000);
-
-    myFirstTimeUs =
-            (myFirstTimeSpec.tv_sec * 1000000 + myFirstTimeSpec.tv_nsec / 1000);
+    clock_gettime(PLAT4M_SYSTEM_LINUX_CLOCK_ID, &myFirstTimeSpec);
 }
 
 //------------------------------------------------------------------------------
@@ -117,9 +92,9 @@ SystemLinux::~SystemLinux()
 //------------------------------------------------------------------------------
 TimeUs SystemLinux::driverGetTimeUs()
 {
-    Plat4m::TimeUs timeUs = getCurrentLinuxTimeUs() - myFirstTimeUs;
+    TimeStamp timeStamp = getElapsedTimeStamp();
 
-    return timeUs;
+    return (timeStamp.timeS * 1000000 + timeStamp.timeNs / 1000);
 }
 
 //------------------------------------------------------------------------------
@@ -149,7 +124,14 @@ QueueDriver& SystemLinux::driverCreateQueueDriver(const uint32_t nValues,
                                                   const uint32_t valueSizeBytes,
                                                   Thread& thread)
 {
-    return *(MemoryAllocator::allocate<QueueDriverLinux>(valueSizeBytes));
+    if (myQueueDriverType == QUEUE_DRIVER_TYPE_MESSAGE_QUEUE)
+    {
+        return *(MemoryAllocator::allocate<QueueDriverLinux>(valueSizeBytes));
+    }
+
+    return *(MemoryAllocator::allocate<QueueDriverLinuxLockFree>(
+                                                              nValues,
+                                                              valueSizeBytes));
 }
 
 //------------------------------------------------------------------------------
@@ -173,9 +155,9 @@ void SystemLinux::driverRun()
 //------------------------------------------------------------------------------
 TimeMs SystemLinux::driverGetTimeMs()
 {
-    TimeMs timeMs = getCurrentLinuxTimeMs() - myFirstTimeMs;
+    TimeStamp timeStamp = getElapsedTimeStamp();
 
-    return timeMs;
+    return (timeStamp.timeS * 1000 + timeStamp.timeNs / 1000000);
 }
 
 //------------------------------------------------------------------------------
@@ -196,18 +178,65 @@ void SystemLinux::driverExit()
 //------------------------------------------------------------------------------
 TimeStamp SystemLinux::driverGetTimeStamp()
 {
+    return (getElapsedTimeStamp());
+}
+
+//------------------------------------------------------------------------------
+TimeStamp SystemLinux::driverGetWallTimeStamp()
+{
+    // Time since the epoch, follows changes to the system clock
     struct timespec timeSpec;
     clock_gettime(CLOCK_REALTIME, &timeSpec);
 
     TimeStamp timeStamp;
-    timeStamp.timeS  = timeSpec.tv_sec - myFirstTimeSpec.tv_sec;
-    timeStamp.timeNs = timeSpec.tv_nsec - myFirstTimeSpec.tv_nsec;
+    timeStamp.timeS  = timeSpec.tv_sec;
+    timeStamp.timeNs = timeSpec.tv_nsec;
 
     return timeStamp;
 }
 
 //------------------------------------------------------------------------------
-TimeStamp SystemLinux::driverGetWallTimeStamp()
+Executor& SystemLinux::driverCreateExecutor(const uint32_t nWorkers)
+{
+    return *(MemoryAllocator::allocate<ExecutorLinux>(nWorkers));
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SystemLinux::QueueDriverType SystemLinux::getQueueDriverType() const
 {
-    return (driverGetTimeStamp());
+    return myQueueDriverType;
+}
+
+//------------------------------------------------------------------------------
+void SystemLinux::setQueueDriverType(const QueueDriverType queueDriverType)
+{
+    myQueueDriverType = queueDriverType;
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+inline TimeStamp SystemLinux::getElapsedTimeStamp() const
+{
+    struct timespec timeSpec;
+    clock_gettime(PLAT4M_SYSTEM_LINUX_CLOCK_ID, &timeSpec);
+
+    TimeStamp timeStamp;
+    timeStamp.timeS  = timeSpec.tv_sec - myFirstTimeSpec.tv_sec;
+    timeStamp.timeNs = timeSpec.tv_nsec - myFirstTimeSpec.tv_nsec;
+
+    // Borrow a second so timeNs stays within [0, 1e9)
+    if (timeStamp.timeNs < 0)
+    {
+        timeStamp.timeS--;
+        timeStamp.timeNs += 1000000000;
+    }
+
+    return timeStamp;
 }
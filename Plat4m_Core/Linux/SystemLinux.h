@@ -57,6 +57,20 @@
 #include <Plat4m_Core/QueueDriver.h>
 #include <Plat4m_Core/Semaphore.h>
 
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Clock SystemLinux time (everything but the wall time) is read from.
+/// CLOCK_MONOTONIC_RAW is neither stepped nor slewed by NTP, and is read
+/// through the vDSO (no system call). Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_SYSTEM_LINUX_CLOCK_ID
+#define PLAT4M_SYSTEM_LINUX_CLOCK_ID CLOCK_MONOTONIC_RAW
+#endif
+
 //------------------------------------------------------------------------------
 // Namespaces
 //------------------------------------------------------------------------------
@@ -73,18 +87,21 @@ class SystemLinux : public System
 public:
 
     //--------------------------------------------------------------------------
-    // Public static inline methods
+    // Public types
     //--------------------------------------------------------------------------
 
-    static inline TimeMs getCurrentLinuxTimeMs();
-
-    static inline TimeUs getCurrentLinuxTimeUs();
+    enum QueueDriverType
+    {
+        QUEUE_DRIVER_TYPE_LOCK_FREE = 0,
+        QUEUE_DRIVER_TYPE_MESSAGE_QUEUE
+    };
 
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
 
-    SystemLinux();
+    SystemLinux(
+             const QueueDriverType queueDriverType = QUEUE_DRIVER_TYPE_LOCK_FREE);
 
     //--------------------------------------------------------------------------
     // Public virtual destructors
@@ -129,6 +146,17 @@ public:
 
     virtual TimeStamp driverGetWallTimeStamp() override;
 
+    virtual Executor& driverCreateExecutor(
+                                        const std::uint32_t nWorkers) override;
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    QueueDriverType getQueueDriverType() const;
+
+    void setQueueDriverType(const QueueDriverType queueDriverType);
+
 private:
 
     //--------------------------------------------------------------------------
@@ -137,11 +165,15 @@ private:
 
     timespec myFirstTimeSpec;
 
-    TimeMs myFirstTimeMs;
+    bool myIsRunning;
 
-    TimeUs myFirstTimeUs;
+    QueueDriverType myQueueDriverType;
 
-    bool myIsRunning;
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    TimeStamp getElapsedTimeStamp() const;
 };
 
 }; // namespace Plat4m
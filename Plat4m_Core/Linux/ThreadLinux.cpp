@@ -44,13 +44,47 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <cerrno>
+#include <ctime>
 #include <unistd.h>
+#include <sched.h>
 
 #include <Plat4m_Core/Linux/ThreadLinux.h>
 #include <Plat4m_Core/System.h>
 
 using Plat4m::ThreadLinux;
 using Plat4m::Module;
+using Plat4m::TimeUs;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static std::uint64_t getMonotonicTimeNs()
+{
+    struct timespec timeSpec;
+    clock_gettime(CLOCK_MONOTONIC, &timeSpec);
+
+    return ((static_cast<std::uint64_t>(timeSpec.tv_sec) * 1000000000) +
+            static_cast<std::uint64_t>(timeSpec.tv_nsec));
+}
+
+//------------------------------------------------------------------------------
+static void sleepUntilMonotonicTimeNs(const std::uint64_t timeNs)
+{
+    struct timespec timeSpec;
+    timeSpec.tv_sec = static_cast<time_t>(timeNs / 1000000000);
+    timeSpec.tv_nsec = static_cast<long>(timeNs % 1000000000);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC,
+                           TIMER_ABSTIME,
+                           &timeSpec,
+                           NULL) == EINTR)
+    {
+        // Interrupted by a signal, deadline is absolute so just sleep again
+    }
+}
 
 //------------------------------------------------------------------------------
 // Public constructors
@@ -64,7 +98,11 @@ ThreadLinux::ThreadLinux(RunCallback& callback,
     myThreadHandle(0),
     myMutexHandle(PTHREAD_MUTEX_INITIALIZER),
     myConditionHandle(PTHREAD_COND_INITIALIZER),
-    myNextCallTimeMs(0),
+    myPeriodUs(periodMs * 1000),
+    mySchedulingPolicy(SCHEDULING_POLICY_FIFO),
+    myCpuAffinity(0),
+    myScheduledTimeNs(0),
+    myNOverruns(0),
     myIsEnabled(false),
     myShouldExit(false)
 {
@@ -107,6 +145,89 @@ ThreadLinux::~ThreadLinux()
     pthread_join(myThreadHandle, NULL);
 }
 
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TimeUs ThreadLinux::getPeriodUs() const
+{
+    return (myPeriodUs.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+void ThreadLinux::setPeriodUs(const TimeUs periodUs)
+{
+    // Stored first, so the running thread never sees the period truncated to
+    // milliseconds (0, no period, for anything under 1 ms) and
+    // driverSetPeriodMs() leaves it alone
+    myPeriodUs.store(periodUs, std::memory_order_relaxed);
+
+    setPeriodMs(periodUs / 1000);
+}
+
+//------------------------------------------------------------------------------
+ThreadLinux::SchedulingPolicy ThreadLinux::getSchedulingPolicy() const
+{
+    return mySchedulingPolicy;
+}
+
+//------------------------------------------------------------------------------
+void ThreadLinux::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
+{
+    mySchedulingPolicy = schedulingPolicy;
+
+    if (getPriority() != 0)
+    {
+        setPriority(getPriority());
+    }
+}
+
+//------------------------------------------------------------------------------
+std::uint64_t ThreadLinux::getCpuAffinity() const
+{
+    return myCpuAffinity;
+}
+
+//------------------------------------------------------------------------------
+ThreadLinux::Error ThreadLinux::setCpuAffinity(const std::uint64_t cpuMask)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    const long nCpus = sysconf(_SC_NPROCESSORS_CONF);
+
+    for (long i = 0; (i < nCpus) && (i < CPU_SETSIZE); i++)
+    {
+        if ((cpuMask == 0) || ((i < 64) && ((cpuMask >> i) & 1)))
+        {
+            CPU_SET(i, &cpuSet);
+        }
+    }
+
+    if ((CPU_COUNT(&cpuSet) == 0) ||
+        (pthread_setaffinity_np(myThreadHandle, sizeof(cpuSet), &cpuSet) != 0))
+    {
+        return Error(ERROR_CODE_CPU_AFFINITY_INVALID);
+    }
+
+    myCpuAffinity = cpuMask;
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+std::uint64_t ThreadLinux::getScheduledTimeNs() const
+{
+    return (myScheduledTimeNs.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t ThreadLinux::getNOverruns() const
+{
+    return (myNOverruns.load(std::memory_order_relaxed));
+}
+
 //------------------------------------------------------------------------------
 // Private static methods
 //------------------------------------------------------------------------------
@@ -115,14 +236,18 @@ ThreadLinux::~ThreadLinux()
 void* ThreadLinux::threadCallback(void* arg)
 {
     ThreadLinux* thread = static_cast<ThreadLinux*>(arg);
-    thread->myNextCallTimeMs = thread->getPeriodMs();
+
+    std::uint64_t nextCallTimeNs = 0;
+    bool isScheduled = false;
 
     while (!(thread->myShouldExit)) // Loop forever
     {
         pthread_mutex_lock(&(thread->myMutexHandle));
 
-        if (!(thread->myIsEnabled))
+        while (!(thread->myIsEnabled) && !(thread->myShouldExit))
         {
+            isScheduled = false;
+
             pthread_cond_wait(&(thread->myConditionHandle),
                               &(thread->myMutexHandle));
         }
@@ -131,26 +256,47 @@ void* ThreadLinux::threadCallback(void* arg)
 
         if (thread->myShouldExit)
         {
-            pthread_exit(NULL);
-
             break;
         }
 
-        TimeMs periodMs = thread->getPeriodMs();
+        if (!isScheduled)
+        {
+            // (Re)enabled, schedule relative to now rather than catching up
+            // on the time spent disabled
+            nextCallTimeNs = getMonotonicTimeNs();
+            isScheduled = true;
+        }
+
+        const std::uint64_t periodNs =
+               static_cast<std::uint64_t>(thread->getPeriodUs()) * 1000;
 
-        if (periodMs != 0)
+        if (periodNs != 0)
         {
-            TimeMs sleepTimeMs = thread->getPeriodMs();
+            nextCallTimeNs += periodNs;
+
+            sleepUntilMonotonicTimeNs(nextCallTimeNs);
+
+            const std::uint64_t timeNs = getMonotonicTimeNs();
 
-            struct timespec timeSpec;
-            timeSpec.tv_sec = sleepTimeMs / 1000;
-            timeSpec.tv_nsec = (sleepTimeMs % 1000) * 1000000;
-            nanosleep(&timeSpec, NULL);
+            if (timeNs >= (nextCallTimeNs + periodNs))
+            {
+                // Last run overran one or more whole periods, skip them
+                // instead of running back to back to catch up
+                const std::uint64_t nMissedPeriods =
+                                         (timeNs - nextCallTimeNs) / periodNs;
+
+                nextCallTimeNs += nMissedPeriods * periodNs;
+
+                thread->myNOverruns.fetch_add(
+                                     static_cast<std::uint32_t>(nMissedPeriods),
+                                     std::memory_order_relaxed);
+            }
+
+            thread->myScheduledTimeNs.store(nextCallTimeNs,
+                                            std::memory_order_relaxed);
         }
 
         thread->run();
-
-        thread->myNextCallTimeMs += periodMs;
     }
 
     return 0;
@@ -184,11 +330,56 @@ Module::Error ThreadLinux::driverSetEnabled(const bool enabled)
 //------------------------------------------------------------------------------
 void ThreadLinux::driverSetPeriodMs(const TimeMs periodMs)
 {
-    // Do nothing
+    // Already set with microsecond resolution by setPeriodUs()
+    if (periodMs == (getPeriodUs() / 1000))
+    {
+        return;
+    }
+
+    // Picked up by the thread at its next deadline
+    myPeriodUs.store(periodMs * 1000, std::memory_order_relaxed);
 }
 
 //------------------------------------------------------------------------------
 uint32_t ThreadLinux::driverSetPriority(const uint32_t priority)
 {
-    return 0;
+    int policy = SCHED_OTHER;
+
+    struct sched_param schedulingParameters;
+    schedulingParameters.sched_priority = 0;
+
+    if (priority != 0)
+    {
+        policy = SCHED_FIFO;
+
+        if (mySchedulingPolicy == SCHEDULING_POLICY_ROUND_ROBIN)
+        {
+            policy = SCHED_RR;
+        }
+
+        std::uint32_t schedulingPriority = priority;
+        limitValue(schedulingPriority,
+                   sched_get_priority_min(policy),
+                   sched_get_priority_max(policy));
+
+        schedulingParameters.sched_priority =
+                                        static_cast<int>(schedulingPriority);
+    }
+
+    if (pthread_setschedparam(myThreadHandle,
+                              policy,
+                              &schedulingParameters) != 0)
+    {
+        // Not permitted to use real-time scheduling, stay on the normal
+        // scheduler
+        schedulingParameters.sched_priority = 0;
+
+        pthread_setschedparam(myThreadHandle,
+                              SCHED_OTHER,
+                              &schedulingParameters);
+
+        return 0;
+    }
+
+    return (static_cast<uint32_t>(schedulingParameters.sched_priority));
 }
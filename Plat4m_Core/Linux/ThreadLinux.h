@@ -46,10 +46,14 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdint>
+
 #include <pthread.h>
 
 #include <Plat4m_Core/Thread.h>
 #include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -62,10 +66,35 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Linux Thread driver. Periodic threads wake up on absolute
+/// CLOCK_MONOTONIC deadlines, so callback runtime doesn't accumulate as drift.
+/// A priority of 0 uses the normal scheduler, any other priority uses the
+/// real-time scheduling policy (clamped to its priority range) if the process
+/// is permitted to (CAP_SYS_NICE or RLIMIT_RTPRIO), otherwise it stays at 0.
+///
 class ThreadLinux : public Thread
 {
 public:
 
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE = 0,
+        ERROR_CODE_CPU_AFFINITY_INVALID
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    enum SchedulingPolicy
+    {
+        SCHEDULING_POLICY_FIFO = 0,
+        SCHEDULING_POLICY_ROUND_ROBIN
+    };
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
@@ -80,6 +109,49 @@ public:
 
     virtual ~ThreadLinux();
 
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    TimeUs getPeriodUs() const;
+
+    ///
+    /// @brief Sets the period with microsecond resolution, getPeriodMs()
+    /// returns the period truncated to milliseconds.
+    /// @param periodUs Period, 0 to run continuously.
+    ///
+    void setPeriodUs(const TimeUs periodUs);
+
+    SchedulingPolicy getSchedulingPolicy() const;
+
+    ///
+    /// @brief Sets the real-time scheduling policy used for priorities other
+    /// than 0.
+    ///
+    void setSchedulingPolicy(const SchedulingPolicy schedulingPolicy);
+
+    std::uint64_t getCpuAffinity() const;
+
+    ///
+    /// @brief Restricts this thread to the given CPUs.
+    /// @param cpuMask Bit N set allows CPU N, 0 allows all CPUs.
+    /// @return ERROR_CODE_CPU_AFFINITY_INVALID if none of the CPUs exist.
+    ///
+    Error setCpuAffinity(const std::uint64_t cpuMask);
+
+    ///
+    /// @brief Returns the absolute CLOCK_MONOTONIC time in nanoseconds the
+    /// current (or last) periodic run was scheduled for. Comparing it to the
+    /// current time from within the callback gives the wake-up error.
+    ///
+    std::uint64_t getScheduledTimeNs() const;
+
+    ///
+    /// @brief Returns the number of periods skipped because a run overran
+    /// one or more whole periods.
+    ///
+    std::uint32_t getNOverruns() const;
+
 private:
 
     //--------------------------------------------------------------------------
@@ -89,7 +161,11 @@ private:
     pthread_t myThreadHandle;
     pthread_mutex_t myMutexHandle;
     pthread_cond_t myConditionHandle;
-    TimeMs myNextCallTimeMs;
+    std::atomic<TimeUs> myPeriodUs;
+    SchedulingPolicy mySchedulingPolicy;
+    std::uint64_t myCpuAffinity;
+    std::atomic<std::uint64_t> myScheduledTimeNs;
+    std::atomic<std::uint32_t> myNOverruns;
     bool myIsEnabled;
     bool myShouldExit;
 
@@ -0,0 +1,375 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicBridgeShmLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicBridgeShmLinux class header file.
+///
+
+#ifndef PLAT4M_TOPIC_BRIDGE_SHM_LINUX_H
+#define PLAT4M_TOPIC_BRIDGE_SHM_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/Module.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Linux/SharedMemoryRingLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Default number of samples held in a bridge's shared memory ring.
+/// Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_BRIDGE_SHM_LINUX_N_SLOTS
+#define PLAT4M_TOPIC_BRIDGE_SHM_LINUX_N_SLOTS 256
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Carries a Topic between processes on the same machine through a
+/// named shared memory ring, without serializing the samples. The exporting
+/// side copies each published sample into the ring, each importing side
+/// reads them on its own thread and republishes them on its local Topic.
+/// Only one process may export a given ring, and the Topic it exports must
+/// only be published from one thread at a time. An importer that falls more
+/// than nSlots samples behind skips ahead and counts the lost samples as
+/// overruns.
+///
+template <typename DataType>
+class TopicBridgeShmLinux : public Module
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum Direction
+    {
+        DIRECTION_EXPORT,
+        DIRECTION_IMPORT
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @param name Shared memory segment name, starting with '/'.
+    ///
+    TopicBridgeShmLinux(
+                const TopicBase::Id id,
+                const char* name,
+                const Direction direction,
+                const std::uint32_t nSlots =
+                                        PLAT4M_TOPIC_BRIDGE_SHM_LINUX_N_SLOTS) :
+        Module(),
+        myTopicId(id),
+        myName(name),
+        myDirection(direction),
+        myNSlots(nSlots),
+        mySampleCallback(
+                   createCallback(this, &TopicBridgeShmLinux::sampleCallback)),
+        myThread(0),
+        myRing(),
+        myReadIndex(0),
+        myNSamples(0),
+        myNOverruns(0),
+        myIsThreadRunning(false)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "TopicBridgeShmLinux requires trivially copyable data");
+
+        if (myDirection == DIRECTION_EXPORT)
+        {
+            if (myRing.create(myName, myNSlots, sizeof(DataType)).getCode() !=
+                                       SharedMemoryRingLinux::ERROR_CODE_NONE)
+            {
+                while (true)
+                {
+                    // Lock up, unable to create shared memory
+                }
+            }
+
+            Topic<DataType>::subscribe(myTopicId, mySampleCallback);
+        }
+        else
+        {
+            myThread = &(System::createThread(
+                    createCallback(this, &TopicBridgeShmLinux::threadCallback),
+                    0,
+                    0,
+                    false,
+                    name));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual ~TopicBridgeShmLinux()
+    {
+        if (myDirection == DIRECTION_EXPORT)
+        {
+            Topic<DataType>::unsubscribe(myTopicId, mySampleCallback);
+        }
+        else
+        {
+            disable();
+
+            // The ring is unmapped below, let the thread finish with it
+            while (myIsThreadRunning.load())
+            {
+                System::delayTimeMs(1);
+            }
+        }
+
+        myRing.close();
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    Direction getDirection() const
+    {
+        return myDirection;
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Returns whether the importing side has found the ring yet. The
+    /// exporting side always has.
+    ///
+    bool isConnected() const
+    {
+        return (myRing.isOpen());
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Returns the number of samples exported or imported.
+    ///
+    std::uint32_t getNSamples() const
+    {
+        return (myNSamples.load(std::memory_order_relaxed));
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Returns the number of samples the importing side lost by
+    /// falling behind the exporting side.
+    ///
+    std::uint32_t getNOverruns() const
+    {
+        return (myNOverruns.load(std::memory_order_relaxed));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const TopicBase::Id myTopicId;
+
+    const char* myName;
+
+    const Direction myDirection;
+
+    const std::uint32_t myNSlots;
+
+    typename Topic<DataType>::SampleCallback& mySampleCallback;
+
+    Thread* myThread;
+
+    SharedMemoryRingLinux myRing;
+
+    std::uint64_t myReadIndex;
+
+    std::atomic<std::uint32_t> myNSamples;
+
+    std::atomic<std::uint32_t> myNOverruns;
+
+    std::atomic<bool> myIsThreadRunning;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods implemented from Module
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual Module::Error driverSetEnabled(const bool enabled) override
+    {
+        if (isValidPointer(myThread))
+        {
+            return (myThread->setEnabled(enabled));
+        }
+
+        return Module::Error(Module::ERROR_CODE_NONE);
+    }
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    void sampleCallback(const TopicSample<DataType>& sample)
+    {
+        if (isEnabled())
+        {
+            myRing.write(&(sample.data), sample.sequenceId, sample.timeStamp);
+            myNSamples.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void threadCallback()
+    {
+        // Pairs with the destructor disabling this bridge before waiting for
+        // the thread, either this sees it disabled or the destructor waits
+        myIsThreadRunning.store(true);
+
+        if (isEnabled())
+        {
+            importSamples();
+        }
+
+        myIsThreadRunning.store(false, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------
+    void importSamples()
+    {
+        if (!(myRing.isOpen()))
+        {
+            // The exporting process may not have created the ring yet
+            if (myRing.open(myName, myNSlots, sizeof(DataType)).getCode() !=
+                                        SharedMemoryRingLinux::ERROR_CODE_NONE)
+            {
+                System::delayTimeMs(10);
+
+                return;
+            }
+
+            // Only samples exported from now on
+            myReadIndex = myRing.getNWrites();
+        }
+
+        // Times out now and then so the thread can be disabled
+        if (!(myRing.waitForWrite(myReadIndex, 100)))
+        {
+            return;
+        }
+
+        const std::uint64_t nWrites = myRing.getNWrites();
+
+        if ((nWrites - myReadIndex) > myNSlots)
+        {
+            const std::uint64_t nLostSamples = nWrites - myReadIndex - myNSlots;
+
+            myNOverruns.fetch_add(static_cast<std::uint32_t>(nLostSamples),
+                                  std::memory_order_relaxed);
+
+            myReadIndex = nWrites - myNSlots;
+        }
+
+        Topic<DataType>& topic = Topic<DataType>::create(myTopicId);
+
+        DataType data;
+        std::uint32_t sequenceId;
+        TimeStamp timeStamp;
+
+        while (myReadIndex < nWrites)
+        {
+            SharedMemoryRingLinux::ReadResult result =
+                     myRing.read(myReadIndex, &data, sequenceId, timeStamp);
+
+            if (result == SharedMemoryRingLinux::READ_RESULT_OK)
+            {
+                topic.publish(data);
+                myNSamples.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                // Overwritten while this thread was catching up
+                myNOverruns.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            myReadIndex++;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicBridgeShmLinux(const TopicBridgeShmLinux& bridge);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_BRIDGE_SHM_LINUX_H
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicLogLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicLogLinux class header file.
+///
+
+#ifndef PLAT4M_TOPIC_LOG_LINUX_H
+#define PLAT4M_TOPIC_LOG_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/TimeStamp.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief On-disk layout shared by TopicRecorderLinux and TopicReplayerLinux.
+/// A log is a sequence of fixed-size chunks. Each chunk starts with a
+/// ChunkHeader followed by records, and a record never spans two chunks.
+/// Each record is a RecordHeader followed by its sample data, padded to a
+/// multiple of 8 bytes. The chunk header holds a time index: the offset of
+/// the chunk's first record, then of the first record at least one index
+/// period or 1/nMaxIndexEntries of a chunk after the previous indexed record,
+/// so a reader can seek by time with a binary search over chunks and then
+/// over one chunk's index.
+///
+class TopicLogLinux
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constants
+    //--------------------------------------------------------------------------
+
+    static const std::uint32_t magic = 0x4C4D3450; // "P4ML"
+
+    static const std::uint32_t version = 1;
+
+    static const std::uint32_t nMaxIndexEntries = 64;
+
+    static const std::uint32_t alignmentBytes = 8;
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    struct IndexEntry
+    {
+        TimeSecondsSigned timeS;
+        TimeNanosecondsSigned timeNs;
+        std::uint32_t offsetBytes;
+        std::uint32_t reserved;
+    };
+
+    struct ChunkHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t chunkSizeBytes;
+        std::uint32_t chunkIndex;
+        std::uint32_t nRecords;
+        /// Header and records, updated after each record is complete
+        std::uint32_t usedBytes;
+        std::uint32_t nIndexEntries;
+        std::uint32_t reserved;
+        IndexEntry indexEntries[nMaxIndexEntries];
+    };
+
+    struct RecordHeader
+    {
+        std::uint32_t topicId;
+        std::uint32_t dataSizeBytes;
+        std::uint32_t sequenceId;
+        TimeSecondsSigned timeS;
+        TimeNanosecondsSigned timeNs;
+        std::uint32_t reserved;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static std::uint32_t getRecordSizeBytes(const std::uint32_t dataSizeBytes)
+    {
+        return (sizeof(RecordHeader) +
+                ((dataSizeBytes + alignmentBytes - 1) & ~(alignmentBytes - 1)));
+    }
+
+    //--------------------------------------------------------------------------
+    static TimeStamp getTimeStamp(const RecordHeader& recordHeader)
+    {
+        return TimeStamp(recordHeader.timeS, recordHeader.timeNs);
+    }
+
+    //--------------------------------------------------------------------------
+    static TimeStamp getTimeStamp(const IndexEntry& indexEntry)
+    {
+        return TimeStamp(indexEntry.timeS, indexEntry.timeNs);
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_LOG_LINUX_H
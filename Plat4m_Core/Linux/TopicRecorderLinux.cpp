@@ -0,0 +1,342 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicRecorderLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicRecorderLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include <Plat4m_Core/Linux/TopicRecorderLinux.h>
+#include <Plat4m_Core/MutexLock.h>
+
+using namespace std;
+using Plat4m::TopicRecorderLinux;
+using Plat4m::TopicLogLinux;
+using Plat4m::TimeStamp;
+using Plat4m::MutexLock;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinux::TopicRecorderLinux(const uint32_t chunkSizeBytes,
+                                       const TimeMs indexPeriodMs) :
+    myChunkSizeBytes(chunkSizeBytes),
+    myIndexPeriodTimeStamp(indexPeriodMs / 1000,
+                           (indexPeriodMs % 1000) * 1000000),
+    myChannels(),
+    myNChannels(0),
+    myMutex(),
+    myFileDescriptor(-1),
+    myChunk(0),
+    myNChunks(0),
+    myNextIndexTimeStamp(),
+    myNRecords(0),
+    myNBytes(0),
+    myNDroppedRecords(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinux::~TopicRecorderLinux()
+{
+    // Unsubscribe first so no sample is recorded during close()
+    for (uint32_t i = 0; i < myNChannels; i++)
+    {
+        myChannels[i]->~ChannelBase();
+        MemoryAllocator::deallocate(myChannels[i]);
+    }
+
+    close();
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinux::Error TopicRecorderLinux::open(const char* fileName)
+{
+    MutexLock mutexLock(myMutex);
+
+    if (myFileDescriptor >= 0)
+    {
+        return Error(ERROR_CODE_ALREADY_OPEN);
+    }
+
+    const uint32_t pageSizeBytes = sysconf(_SC_PAGESIZE);
+
+    if ((myChunkSizeBytes <= sizeof(TopicLogLinux::ChunkHeader)) ||
+        ((myChunkSizeBytes % pageSizeBytes) != 0))
+    {
+        return Error(ERROR_CODE_CHUNK_SIZE_INVALID);
+    }
+
+    myFileDescriptor = ::open(fileName, O_CREAT | O_TRUNC | O_RDWR, 0644);
+
+    if (myFileDescriptor < 0)
+    {
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    myNChunks         = 0;
+    myNRecords        = 0;
+    myNBytes          = 0;
+    myNDroppedRecords = 0;
+
+    if (!startChunk())
+    {
+        ::close(myFileDescriptor);
+        myFileDescriptor = -1;
+
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinux::close()
+{
+    MutexLock mutexLock(myMutex);
+
+    if (myFileDescriptor < 0)
+    {
+        return;
+    }
+
+    finishChunk();
+
+    ::close(myFileDescriptor);
+    myFileDescriptor = -1;
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinux::isOpen() const
+{
+    MutexLock mutexLock(myMutex);
+
+    return (myFileDescriptor >= 0);
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicRecorderLinux::getNChunks() const
+{
+    MutexLock mutexLock(myMutex);
+
+    return myNChunks;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicRecorderLinux::getNRecords() const
+{
+    MutexLock mutexLock(myMutex);
+
+    return myNRecords;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicRecorderLinux::getNBytes() const
+{
+    MutexLock mutexLock(myMutex);
+
+    return myNBytes;
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicRecorderLinux::getNDroppedRecords() const
+{
+    MutexLock mutexLock(myMutex);
+
+    return myNDroppedRecords;
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinux::record(const TopicBase::Id topicId,
+                                const uint32_t sequenceId,
+                                const TimeStamp& timeStamp,
+                                const void* data,
+                                const uint32_t dataSizeBytes)
+{
+    MutexLock mutexLock(myMutex);
+
+    if (myFileDescriptor < 0)
+    {
+        return;
+    }
+
+    const uint32_t recordSizeBytes =
+                             TopicLogLinux::getRecordSizeBytes(dataSizeBytes);
+
+    if (recordSizeBytes >
+                       (myChunkSizeBytes - sizeof(TopicLogLinux::ChunkHeader)))
+    {
+        myNDroppedRecords++;
+
+        return;
+    }
+
+    if (isNullPointer(myChunk) ||
+        ((myChunk->usedBytes + recordSizeBytes) > myChunkSizeBytes))
+    {
+        finishChunk();
+
+        if (!startChunk())
+        {
+            myNDroppedRecords++;
+
+            return;
+        }
+    }
+
+    uint8_t* recordBytes = reinterpret_cast<uint8_t*>(myChunk) +
+                                                           myChunk->usedBytes;
+
+    TopicLogLinux::RecordHeader* recordHeader =
+                  reinterpret_cast<TopicLogLinux::RecordHeader*>(recordBytes);
+    recordHeader->topicId       = topicId;
+    recordHeader->dataSizeBytes = dataSizeBytes;
+    recordHeader->sequenceId    = sequenceId;
+    recordHeader->timeS         = timeStamp.timeS;
+    recordHeader->timeNs        = timeStamp.timeNs;
+
+    memcpy(recordBytes + sizeof(TopicLogLinux::RecordHeader),
+           data,
+           dataSizeBytes);
+
+    // The first record of a chunk is always indexed, so seeking can pick a
+    // chunk by its first index entry. Fast Topics also get an entry every
+    // 1/nMaxIndexEntries of a chunk, so a seek never steps over more
+    bool isIndexed = (myChunk->nRecords == 0);
+
+    if (!isIndexed &&
+        (myChunk->nIndexEntries < TopicLogLinux::nMaxIndexEntries))
+    {
+        const uint32_t lastIndexOffsetBytes =
+              myChunk->indexEntries[myChunk->nIndexEntries - 1].offsetBytes;
+
+        isIndexed = (timeStamp >= myNextIndexTimeStamp) ||
+                    ((myChunk->usedBytes - lastIndexOffsetBytes) >=
+                     (myChunkSizeBytes / TopicLogLinux::nMaxIndexEntries));
+    }
+
+    if (isIndexed)
+    {
+        TopicLogLinux::IndexEntry& indexEntry =
+                               myChunk->indexEntries[myChunk->nIndexEntries];
+        indexEntry.timeS       = timeStamp.timeS;
+        indexEntry.timeNs      = timeStamp.timeNs;
+        indexEntry.offsetBytes = myChunk->usedBytes;
+
+        myChunk->nIndexEntries++;
+        myNextIndexTimeStamp = timeStamp + myIndexPeriodTimeStamp;
+    }
+
+    myChunk->nRecords++;
+    myChunk->usedBytes += recordSizeBytes;
+
+    myNRecords++;
+    myNBytes += recordSizeBytes;
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinux::startChunk()
+{
+    const off_t chunkOffset =
+                       static_cast<off_t>(myNChunks) * myChunkSizeBytes;
+
+    // Grows the file, the new chunk reads as zeros
+    if (ftruncate(myFileDescriptor, chunkOffset + myChunkSizeBytes) != 0)
+    {
+        return false;
+    }
+
+    void* memory = mmap(0,
+                        myChunkSizeBytes,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED,
+                        myFileDescriptor,
+                        chunkOffset);
+
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+
+    myChunk = new(memory) TopicLogLinux::ChunkHeader();
+    myChunk->magic          = TopicLogLinux::magic;
+    myChunk->version        = TopicLogLinux::version;
+    myChunk->chunkSizeBytes = myChunkSizeBytes;
+    myChunk->chunkIndex     = myNChunks;
+    myChunk->nRecords       = 0;
+    myChunk->usedBytes      = sizeof(TopicLogLinux::ChunkHeader);
+    myChunk->nIndexEntries  = 0;
+
+    myNChunks++;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinux::finishChunk()
+{
+    if (isValidPointer(myChunk))
+    {
+        // The kernel writes the pages back to the file after unmapping
+        munmap(myChunk, myChunkSizeBytes);
+        myChunk = 0;
+    }
+}
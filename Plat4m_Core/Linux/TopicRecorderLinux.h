@@ -0,0 +1,329 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicRecorderLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicRecorderLinux class header file.
+///
+
+#ifndef PLAT4M_TOPIC_RECORDER_LINUX_H
+#define PLAT4M_TOPIC_RECORDER_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TimeStamp.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/Linux/MutexLinux.h>
+#include <Plat4m_Core/Linux/TopicLogLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Default size of the chunks a log is written in, a multiple of the
+/// page size. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_RECORDER_LINUX_CHUNK_SIZE_BYTES
+#define PLAT4M_TOPIC_RECORDER_LINUX_CHUNK_SIZE_BYTES (1024 * 1024)
+#endif
+
+///
+/// @brief Default minimum time between a log's time index entries. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_RECORDER_LINUX_INDEX_PERIOD_MS
+#define PLAT4M_TOPIC_RECORDER_LINUX_INDEX_PERIOD_MS 10
+#endif
+
+///
+/// @brief Maximum number of Topics one recorder can subscribe to. Can be
+/// overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_RECORDER_LINUX_MAX_N_TOPICS
+#define PLAT4M_TOPIC_RECORDER_LINUX_MAX_N_TOPICS 32
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Records the samples published on a set of Topics to an append-only
+/// log file (see TopicLogLinux), with each sample's sequence ID and time
+/// stamp. The file grows one chunk at a time and only the chunk being written
+/// is mapped, so recording a sample is a copy into memory. Samples are only
+/// recorded while the log is open, and are recorded in the order they are
+/// published in even when published from several threads.
+///
+class TopicRecorderLinux
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE,
+        ERROR_CODE_ALREADY_OPEN,
+        ERROR_CODE_OPEN_FAILED,
+        ERROR_CODE_CHUNK_SIZE_INVALID,
+        ERROR_CODE_TOPIC_LIMIT_REACHED,
+        ERROR_CODE_TOPIC_ALREADY_ADDED
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    TopicRecorderLinux(
+          const std::uint32_t chunkSizeBytes =
+                                   PLAT4M_TOPIC_RECORDER_LINUX_CHUNK_SIZE_BYTES,
+          const TimeMs indexPeriodMs =
+                                   PLAT4M_TOPIC_RECORDER_LINUX_INDEX_PERIOD_MS);
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    ~TopicRecorderLinux();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Subscribes to the given Topic, samples published on it are
+    /// recorded whenever the log is open.
+    ///
+    template <typename DataType>
+    Error addTopic(const TopicBase::Id id)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "TopicRecorderLinux requires trivially copyable data");
+
+        for (std::uint32_t i = 0; i < myNChannels; i++)
+        {
+            if (myChannels[i]->getTopicId() == id)
+            {
+                return Error(ERROR_CODE_TOPIC_ALREADY_ADDED);
+            }
+        }
+
+        if (myNChannels == PLAT4M_TOPIC_RECORDER_LINUX_MAX_N_TOPICS)
+        {
+            return Error(ERROR_CODE_TOPIC_LIMIT_REACHED);
+        }
+
+        myChannels[myNChannels] =
+                   MemoryAllocator::allocate<Channel<DataType>>(*this, id);
+        myNChannels++;
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    ///
+    /// @brief Creates the log file, replacing any existing file.
+    ///
+    Error open(const char* fileName);
+
+    ///
+    /// @brief Finishes the chunk being written and closes the log file. The
+    /// last chunk is left at full size, its header says how much is used.
+    ///
+    void close();
+
+    bool isOpen() const;
+
+    std::uint32_t getNChunks() const;
+
+    std::uint64_t getNRecords() const;
+
+    ///
+    /// @brief Returns the number of bytes recorded, headers included.
+    ///
+    std::uint64_t getNBytes() const;
+
+    ///
+    /// @brief Returns the number of samples that couldn't be recorded,
+    /// because they were larger than a chunk or the file couldn't grow.
+    ///
+    std::uint32_t getNDroppedRecords() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    class ChannelBase
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ChannelBase(const TopicBase::Id topicId) :
+            myTopicId(topicId)
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual ~ChannelBase()
+        {
+        }
+
+        //----------------------------------------------------------------------
+        TopicBase::Id getTopicId() const
+        {
+            return myTopicId;
+        }
+
+    private:
+
+        const TopicBase::Id myTopicId;
+    };
+
+    template <typename DataType>
+    class Channel : public ChannelBase
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        Channel(TopicRecorderLinux& recorder, const TopicBase::Id topicId) :
+            ChannelBase(topicId),
+            myRecorder(recorder),
+            mySampleCallback(createCallback(this, &Channel::sampleCallback))
+        {
+            Topic<DataType>::subscribe(topicId, mySampleCallback);
+        }
+
+        //----------------------------------------------------------------------
+        virtual ~Channel()
+        {
+            Topic<DataType>::unsubscribe(getTopicId(), mySampleCallback);
+        }
+
+    private:
+
+        TopicRecorderLinux& myRecorder;
+
+        typename Topic<DataType>::SampleCallback& mySampleCallback;
+
+        //----------------------------------------------------------------------
+        void sampleCallback(const TopicSample<DataType>& sample)
+        {
+            myRecorder.record(getTopicId(),
+                              sample.sequenceId,
+                              sample.timeStamp,
+                              &(sample.data),
+                              sizeof(DataType));
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    const std::uint32_t myChunkSizeBytes;
+
+    const TimeStamp myIndexPeriodTimeStamp;
+
+    ChannelBase* myChannels[PLAT4M_TOPIC_RECORDER_LINUX_MAX_N_TOPICS];
+
+    std::uint32_t myNChannels;
+
+    mutable MutexLinux myMutex;
+
+    int myFileDescriptor;
+
+    TopicLogLinux::ChunkHeader* myChunk;
+
+    std::uint32_t myNChunks;
+
+    TimeStamp myNextIndexTimeStamp;
+
+    std::uint64_t myNRecords;
+
+    std::uint64_t myNBytes;
+
+    std::uint32_t myNDroppedRecords;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    void record(const TopicBase::Id topicId,
+                const std::uint32_t sequenceId,
+                const TimeStamp& timeStamp,
+                const void* data,
+                const std::uint32_t dataSizeBytes);
+
+    bool startChunk();
+
+    void finishChunk();
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    TopicRecorderLinux(const TopicRecorderLinux& recorder);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_RECORDER_LINUX_H
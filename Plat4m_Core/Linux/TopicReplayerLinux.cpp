@@ -0,0 +1,482 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicReplayerLinux.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicReplayerLinux class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <limits>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <Plat4m_Core/Linux/TopicReplayerLinux.h>
+#include <Plat4m_Core/System.h>
+
+using namespace std;
+using Plat4m::TopicReplayerLinux;
+using Plat4m::TopicLogLinux;
+using Plat4m::TimeStamp;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicReplayerLinux::TopicReplayerLinux() :
+    myChannels(),
+    myChannelIndex(),
+    myNChannels(0),
+    myMemory(0),
+    myMemorySizeBytes(0),
+    myChunkSizeBytes(0),
+    myNChunks(0),
+    myChunkIndex(0),
+    myOffsetBytes(0),
+    myNBytes(0),
+    myNSkippedRecords(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Public destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicReplayerLinux::~TopicReplayerLinux()
+{
+    close();
+
+    for (uint32_t i = 0; i < myNChannels; i++)
+    {
+        myChannels[i]->~ChannelBase();
+        MemoryAllocator::deallocate(myChannels[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicReplayerLinux::Error TopicReplayerLinux::open(const char* fileName)
+{
+    if (isOpen())
+    {
+        return Error(ERROR_CODE_ALREADY_OPEN);
+    }
+
+    int fileDescriptor = ::open(fileName, O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    struct stat fileStatus;
+
+    if ((fstat(fileDescriptor, &fileStatus) != 0) ||
+        (static_cast<size_t>(fileStatus.st_size) <
+                                          sizeof(TopicLogLinux::ChunkHeader)))
+    {
+        ::close(fileDescriptor);
+
+        return Error(ERROR_CODE_FORMAT_INVALID);
+    }
+
+    const size_t memorySizeBytes = fileStatus.st_size;
+
+    void* memory =
+          mmap(0, memorySizeBytes, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping stays valid without the file descriptor
+    ::close(fileDescriptor);
+
+    if (memory == MAP_FAILED)
+    {
+        return Error(ERROR_CODE_OPEN_FAILED);
+    }
+
+    myMemory = static_cast<const uint8_t*>(memory);
+    myMemorySizeBytes = memorySizeBytes;
+
+    const TopicLogLinux::ChunkHeader& firstChunkHeader =
+                  *reinterpret_cast<const TopicLogLinux::ChunkHeader*>(memory);
+
+    myChunkSizeBytes = firstChunkHeader.chunkSizeBytes;
+
+    if ((myChunkSizeBytes < sizeof(TopicLogLinux::ChunkHeader)) ||
+        ((memorySizeBytes % myChunkSizeBytes) != 0))
+    {
+        close();
+
+        return Error(ERROR_CODE_FORMAT_INVALID);
+    }
+
+    myNChunks = memorySizeBytes / myChunkSizeBytes;
+
+    // Only touches the first page of each chunk
+    for (uint32_t i = 0; i < myNChunks; i++)
+    {
+        const TopicLogLinux::ChunkHeader& chunkHeader = getChunkHeader(i);
+
+        if ((chunkHeader.magic != TopicLogLinux::magic)                    ||
+            (chunkHeader.version != TopicLogLinux::version)                ||
+            (chunkHeader.chunkSizeBytes != myChunkSizeBytes)               ||
+            (chunkHeader.usedBytes > myChunkSizeBytes)                     ||
+            (chunkHeader.nIndexEntries > TopicLogLinux::nMaxIndexEntries))
+        {
+            close();
+
+            return Error(ERROR_CODE_FORMAT_INVALID);
+        }
+    }
+
+    madvise(memory, memorySizeBytes, MADV_SEQUENTIAL);
+
+    myChunkIndex = 0;
+    myOffsetBytes = sizeof(TopicLogLinux::ChunkHeader);
+    myNBytes = 0;
+    myNSkippedRecords = 0;
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void TopicReplayerLinux::close()
+{
+    if (isOpen())
+    {
+        munmap(const_cast<uint8_t*>(myMemory), myMemorySizeBytes);
+
+        myMemory = 0;
+        myMemorySizeBytes = 0;
+        myNChunks = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool TopicReplayerLinux::isOpen() const
+{
+    return isValidPointer(myMemory);
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicReplayerLinux::getNChunks() const
+{
+    return myNChunks;
+}
+
+//------------------------------------------------------------------------------
+TimeStamp TopicReplayerLinux::getFirstTimeStamp() const
+{
+    // Only the last chunks can be empty, and the first record of every
+    // other chunk is indexed
+    if ((myNChunks == 0) || (getChunkHeader(0).nIndexEntries == 0))
+    {
+        return TimeStamp();
+    }
+
+    return TopicLogLinux::getTimeStamp(getChunkHeader(0).indexEntries[0]);
+}
+
+//------------------------------------------------------------------------------
+bool TopicReplayerLinux::seek(const TimeStamp& timeStamp)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+
+    // Number of chunks starting at or before the time stamp. Empty chunks
+    // are only at the end, treat them as starting after it
+    uint32_t low = 0;
+    uint32_t high = myNChunks;
+
+    while (low < high)
+    {
+        const uint32_t middle = low + ((high - low) / 2);
+        const TopicLogLinux::ChunkHeader& chunkHeader = getChunkHeader(middle);
+
+        if ((chunkHeader.nIndexEntries > 0) &&
+            (TopicLogLinux::getTimeStamp(chunkHeader.indexEntries[0]) <=
+                                                                    timeStamp))
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    myChunkIndex = (low > 0) ? (low - 1) : 0;
+    myOffsetBytes = sizeof(TopicLogLinux::ChunkHeader);
+
+    // Same search over the chunk's index entries
+    const TopicLogLinux::ChunkHeader& chunkHeader =
+                                                  getChunkHeader(myChunkIndex);
+    low = 0;
+    high = chunkHeader.nIndexEntries;
+
+    while (low < high)
+    {
+        const uint32_t middle = low + ((high - low) / 2);
+
+        if (TopicLogLinux::getTimeStamp(chunkHeader.indexEntries[middle]) <=
+                                                                     timeStamp)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low > 0)
+    {
+        myOffsetBytes = chunkHeader.indexEntries[low - 1].offsetBytes;
+    }
+
+    // At most one index period or 1/nMaxIndexEntries of a chunk of records
+    // to step over
+    const TopicLogLinux::RecordHeader* recordHeader = getRecordHeader();
+
+    while (isValidPointer(recordHeader) &&
+           (TopicLogLinux::getTimeStamp(*recordHeader) < timeStamp))
+    {
+        nextRecord(*recordHeader);
+        recordHeader = getRecordHeader();
+    }
+
+    return isValidPointer(recordHeader);
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicReplayerLinux::replay(const Pacing pacing,
+                                    const TimeStamp& endTimeStamp)
+{
+    uint32_t nSamples = 0;
+    TimeStamp firstRecordTimeStamp;
+    TimeStamp firstReplayTimeStamp;
+
+    const TopicLogLinux::RecordHeader* recordHeader = getRecordHeader();
+
+    while (isValidPointer(recordHeader))
+    {
+        const TimeStamp recordTimeStamp =
+                                   TopicLogLinux::getTimeStamp(*recordHeader);
+
+        if (recordTimeStamp > endTimeStamp)
+        {
+            break;
+        }
+
+        ChannelBase* channel = 0;
+        myChannelIndex.find(recordHeader->topicId, channel);
+
+        if (isValidPointer(channel))
+        {
+            if (pacing == PACING_RECORDED)
+            {
+                if (nSamples == 0)
+                {
+                    firstRecordTimeStamp = recordTimeStamp;
+                    firstReplayTimeStamp = System::getTimeStamp();
+                }
+                else
+                {
+                    waitUntil(firstReplayTimeStamp +
+                              (recordTimeStamp - firstRecordTimeStamp));
+                }
+            }
+            else
+            {
+                // Moves a SystemSimulation's time, no effect otherwise
+                System::setTime(recordTimeStamp);
+            }
+
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(
+                                                            recordHeader + 1);
+
+            if (channel->publish(data, recordHeader->dataSizeBytes))
+            {
+                nSamples++;
+            }
+            else
+            {
+                myNSkippedRecords++;
+            }
+        }
+        else
+        {
+            myNSkippedRecords++;
+        }
+
+        myNBytes += TopicLogLinux::getRecordSizeBytes(
+                                                 recordHeader->dataSizeBytes);
+
+        nextRecord(*recordHeader);
+        recordHeader = getRecordHeader();
+    }
+
+    return nSamples;
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicReplayerLinux::replay(const Pacing pacing)
+{
+    return replay(pacing,
+                  TimeStamp(numeric_limits<TimeSecondsSigned>::max(), 0));
+}
+
+//------------------------------------------------------------------------------
+bool TopicReplayerLinux::isAtEnd() const
+{
+    for (uint32_t i = myChunkIndex; i < myNChunks; i++)
+    {
+        const uint32_t offsetBytes =
+                (i == myChunkIndex) ? myOffsetBytes
+                                    : sizeof(TopicLogLinux::ChunkHeader);
+
+        if (offsetBytes < getChunkHeader(i).usedBytes)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicReplayerLinux::getNBytes() const
+{
+    return myNBytes;
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicReplayerLinux::getNSkippedRecords() const
+{
+    return myNSkippedRecords;
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+const TopicLogLinux::ChunkHeader& TopicReplayerLinux::getChunkHeader(
+                                             const uint32_t chunkIndex) const
+{
+    return *reinterpret_cast<const TopicLogLinux::ChunkHeader*>(
+                   myMemory + (static_cast<size_t>(chunkIndex) *
+                                                           myChunkSizeBytes));
+}
+
+//------------------------------------------------------------------------------
+const TopicLogLinux::RecordHeader* TopicReplayerLinux::getRecordHeader()
+{
+    while (myChunkIndex < myNChunks)
+    {
+        const TopicLogLinux::ChunkHeader& chunkHeader =
+                                                  getChunkHeader(myChunkIndex);
+
+        if ((myOffsetBytes + sizeof(TopicLogLinux::RecordHeader)) <=
+                                                         chunkHeader.usedBytes)
+        {
+            const TopicLogLinux::RecordHeader* recordHeader =
+                   reinterpret_cast<const TopicLogLinux::RecordHeader*>(
+                       reinterpret_cast<const uint8_t*>(&chunkHeader) +
+                                                               myOffsetBytes);
+
+            // Anything past a record that doesn't fit is treated as unused
+            if ((recordHeader->dataSizeBytes <= myChunkSizeBytes) &&
+                ((myOffsetBytes +
+                  TopicLogLinux::getRecordSizeBytes(
+                                               recordHeader->dataSizeBytes)) <=
+                                                        chunkHeader.usedBytes))
+            {
+                return recordHeader;
+            }
+        }
+
+        myChunkIndex++;
+        myOffsetBytes = sizeof(TopicLogLinux::ChunkHeader);
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+void TopicReplayerLinux::nextRecord(
+                               const TopicLogLinux::RecordHeader& recordHeader)
+{
+    myOffsetBytes +=
+                 TopicLogLinux::getRecordSizeBytes(recordHeader.dataSizeBytes);
+}
+
+//------------------------------------------------------------------------------
+void TopicReplayerLinux::waitUntil(const TimeStamp& timeStamp)
+{
+    TimeStamp currentTimeStamp = System::getTimeStamp();
+
+    while (currentTimeStamp < timeStamp)
+    {
+        const TimeMsSigned remainingTimeMs =
+                                (timeStamp - currentTimeStamp).toTimeMsSigned();
+
+        // Sleep through most of the wait, then yield for the last bit
+        if (remainingTimeMs > 1)
+        {
+            System::delayTimeMs(remainingTimeMs - 1);
+        }
+        else
+        {
+            sched_yield();
+        }
+
+        currentTimeStamp = System::getTimeStamp();
+    }
+}
@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicReplayerLinux.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicReplayerLinux class header file.
+///
+
+#ifndef PLAT4M_TOPIC_REPLAYER_LINUX_H
+#define PLAT4M_TOPIC_REPLAYER_LINUX_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TimeStamp.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/IdHashIndexN.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/Linux/TopicLogLinux.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Maximum number of Topics one replayer can publish, at most 3/4 of
+/// the Id index size. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_REPLAYER_LINUX_MAX_N_TOPICS
+#define PLAT4M_TOPIC_REPLAYER_LINUX_MAX_N_TOPICS 32
+#endif
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Maps a log written by TopicRecorderLinux and publishes its samples
+/// again on their Topics, either paced like they were recorded or as fast as
+/// possible. Records of Topics that weren't added, or whose size doesn't
+/// match the added type, are skipped. Seeking uses the time index in each
+/// chunk, so it only reads a few chunk headers and the records between two
+/// index entries.
+///
+class TopicReplayerLinux
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    enum ErrorCode
+    {
+        ERROR_CODE_NONE,
+        ERROR_CODE_ALREADY_OPEN,
+        ERROR_CODE_NOT_OPEN,
+        ERROR_CODE_OPEN_FAILED,
+        ERROR_CODE_FORMAT_INVALID,
+        ERROR_CODE_TOPIC_LIMIT_REACHED,
+        ERROR_CODE_TOPIC_ALREADY_ADDED
+    };
+
+    typedef ErrorTemplate<ErrorCode> Error;
+
+    enum Pacing
+    {
+        /// Keep the recorded time between samples, measured with
+        /// System::getTimeStamp()
+        PACING_RECORDED,
+        /// Publish back to back, setting the System time to each sample's
+        /// time stamp first so a SystemSimulation follows the recording
+        PACING_AS_FAST_AS_POSSIBLE
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    TopicReplayerLinux();
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    ~TopicReplayerLinux();
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Publishes the given Topic's recorded samples on replay.
+    ///
+    template <typename DataType>
+    Error addTopic(const TopicBase::Id id)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "TopicReplayerLinux requires trivially copyable data");
+
+        if (myChannelIndex.contains(id))
+        {
+            return Error(ERROR_CODE_TOPIC_ALREADY_ADDED);
+        }
+
+        if (myNChannels == PLAT4M_TOPIC_REPLAYER_LINUX_MAX_N_TOPICS)
+        {
+            return Error(ERROR_CODE_TOPIC_LIMIT_REACHED);
+        }
+
+        myChannels[myNChannels] =
+                         MemoryAllocator::allocate<Channel<DataType>>(id);
+        myChannelIndex.insert(id, myChannels[myNChannels]);
+        myNChannels++;
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    ///
+    /// @brief Maps the log and moves to its first record.
+    ///
+    Error open(const char* fileName);
+
+    void close();
+
+    bool isOpen() const;
+
+    std::uint32_t getNChunks() const;
+
+    ///
+    /// @brief Returns the time stamp of the first record, or zero if there
+    /// are no records.
+    ///
+    TimeStamp getFirstTimeStamp() const;
+
+    ///
+    /// @brief Moves to the first record with a time stamp at or after the
+    /// given one. Assumes time stamps don't decrease through the log.
+    /// @return False if there is no such record, replay then has nothing
+    /// left to publish.
+    ///
+    bool seek(const TimeStamp& timeStamp);
+
+    ///
+    /// @brief Publishes records from the current one up to and excluding the
+    /// first with a time stamp after the given one, and stops there.
+    /// @return Number of samples published.
+    ///
+    std::uint32_t replay(const Pacing pacing, const TimeStamp& endTimeStamp);
+
+    ///
+    /// @brief Publishes every record from the current one to the end.
+    ///
+    std::uint32_t replay(const Pacing pacing);
+
+    bool isAtEnd() const;
+
+    ///
+    /// @brief Returns the number of bytes replayed, headers included.
+    ///
+    std::uint64_t getNBytes() const;
+
+    std::uint32_t getNSkippedRecords() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    class ChannelBase
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        virtual ~ChannelBase()
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual bool publish(const void* data,
+                             const std::uint32_t dataSizeBytes) = 0;
+    };
+
+    template <typename DataType>
+    class Channel : public ChannelBase
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        Channel(const TopicBase::Id topicId) :
+            myTopic(Topic<DataType>::create(topicId))
+        {
+        }
+
+        //----------------------------------------------------------------------
+        virtual bool publish(const void* data,
+                             const std::uint32_t dataSizeBytes) override
+        {
+            if (dataSizeBytes != sizeof(DataType))
+            {
+                return false;
+            }
+
+            // Records are only aligned to 8 bytes
+            DataType sample;
+            memcpy(&sample, data, sizeof(DataType));
+
+            myTopic.publish(sample);
+
+            return true;
+        }
+
+    private:
+
+        Topic<DataType>& myTopic;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    ChannelBase* myChannels[PLAT4M_TOPIC_REPLAYER_LINUX_MAX_N_TOPICS];
+
+    IdHashIndexN<ChannelBase*, 64> myChannelIndex;
+
+    std::uint32_t myNChannels;
+
+    const std::uint8_t* myMemory;
+
+    std::size_t myMemorySizeBytes;
+
+    std::uint32_t myChunkSizeBytes;
+
+    std::uint32_t myNChunks;
+
+    std::uint32_t myChunkIndex;
+
+    std::uint32_t myOffsetBytes;
+
+    std::uint64_t myNBytes;
+
+    std::uint32_t myNSkippedRecords;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    const TopicLogLinux::ChunkHeader& getChunkHeader(
+                                       const std::uint32_t chunkIndex) const;
+
+    const TopicLogLinux::RecordHeader* getRecordHeader();
+
+    void nextRecord(const TopicLogLinux::RecordHeader& recordHeader);
+
+    void waitUntil(const TimeStamp& timeStamp);
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    TopicReplayerLinux(const TopicReplayerLinux& replayer);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_REPLAYER_LINUX_H
@@ -43,6 +43,9 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cerrno>
+#include <ctime>
+
 #include <Plat4m_Core/Linux/WaitConditionLinux.h>
 
 using Plat4m::WaitConditionLinux;
@@ -55,10 +58,27 @@ using Plat4m::WaitCondition;
 //------------------------------------------------------------------------------
 WaitConditionLinux::WaitConditionLinux() :
     WaitCondition(),
-    myConditionHandle(PTHREAD_COND_INITIALIZER),
+    myConditionHandle(),
     myMutexHandle(PTHREAD_MUTEX_INITIALIZER),
-    myThreadHandle(0)
+    myThreadHandle(0),
+    myNPendingNotifications(0)
 {
+    pthread_condattr_t conditionAttributes;
+    pthread_condattr_init(&conditionAttributes);
+    pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+
+    int returnValue = pthread_cond_init(&myConditionHandle,
+                                        &conditionAttributes);
+
+    pthread_condattr_destroy(&conditionAttributes);
+
+    if (returnValue != 0)
+    {
+        while (true)
+        {
+            // Lock up, unable to create condition variable
+        }
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -68,6 +88,7 @@ WaitConditionLinux::WaitConditionLinux() :
 //------------------------------------------------------------------------------
 WaitConditionLinux::~WaitConditionLinux()
 {
+    pthread_cond_destroy(&myConditionHandle);
 }
 
 //------------------------------------------------------------------------------
@@ -77,9 +98,7 @@ WaitConditionLinux::~WaitConditionLinux()
 //------------------------------------------------------------------------------
 void WaitConditionLinux::notifyFast()
 {
-    pthread_mutex_lock(&myMutexHandle);
-    pthread_cond_broadcast(&myConditionHandle);
-    pthread_mutex_unlock(&myMutexHandle);
+    driverNotify();
 }
 
 //------------------------------------------------------------------------------
@@ -91,17 +110,60 @@ WaitCondition::Error WaitConditionLinux::driverWait(const TimeMs waitTimeMs)
 {
     myThreadHandle = pthread_self();
 
+    struct timespec timeoutTime;
+
+    if (waitTimeMs != 0xFFFFFFFF)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &timeoutTime);
+
+        timeoutTime.tv_sec += waitTimeMs / 1000;
+        timeoutTime.tv_nsec += (waitTimeMs % 1000) * 1000000;
+
+        if (timeoutTime.tv_nsec >= 1000000000)
+        {
+            timeoutTime.tv_sec++;
+            timeoutTime.tv_nsec -= 1000000000;
+        }
+    }
+
+    Error error(ERROR_CODE_NONE);
+
     pthread_mutex_lock(&myMutexHandle);
-    pthread_cond_wait(&myConditionHandle, &myMutexHandle);
+
+    // Loop to handle spurious wakeups
+    while (myNPendingNotifications == 0)
+    {
+        if (waitTimeMs == 0xFFFFFFFF)
+        {
+            pthread_cond_wait(&myConditionHandle, &myMutexHandle);
+        }
+        else if (pthread_cond_timedwait(&myConditionHandle,
+                                        &myMutexHandle,
+                                        &timeoutTime) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+
+    if (myNPendingNotifications == 0)
+    {
+        error.setCode(ERROR_CODE_TIMEOUT);
+    }
+    else
+    {
+        myNPendingNotifications--;
+    }
+
     pthread_mutex_unlock(&myMutexHandle);
 
-    return Error(ERROR_CODE_NONE);
+    return error;
 }
 
 //------------------------------------------------------------------------------
 WaitCondition::Error WaitConditionLinux::driverNotify()
 {
     pthread_mutex_lock(&myMutexHandle);
+    myNPendingNotifications++;
     pthread_cond_broadcast(&myConditionHandle);
     pthread_mutex_unlock(&myMutexHandle);
 
@@ -46,6 +46,8 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include <pthread.h>
 
 #include <Plat4m_Core/Plat4m.h>
@@ -62,6 +64,10 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Linux WaitCondition driver. Timed waits are measured against
+/// CLOCK_MONOTONIC so they aren't affected by wall clock changes.
+///
 class WaitConditionLinux : public WaitCondition
 {
 public:
@@ -96,6 +102,8 @@ private:
 
     pthread_t myThreadHandle;
 
+    std::uint32_t myNPendingNotifications;
+
     //--------------------------------------------------------------------------
     // Private virtual methods overridden for WaitCondition
     //--------------------------------------------------------------------------
@@ -0,0 +1,236 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file LockFreeQueue.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief LockFreeQueue class header file.
+///
+
+#ifndef PLAT4M_LOCK_FREE_QUEUE_H
+#define PLAT4M_LOCK_FREE_QUEUE_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Bounded FIFO queue of nValues values stored inline, any number of
+/// producers and consumers are supported without locks. Unlike Queue it
+/// needs no System driver or kernel object, and it never blocks: enqueue()
+/// fails when the queue is full and dequeue() fails when it is empty.
+/// @tparam T Value type, copied in and out of the queue.
+/// @tparam nValues Capacity.
+///
+template <typename T, std::uint32_t nValues>
+class LockFreeQueue
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    LockFreeQueue() :
+        myEnqueuePosition(0),
+        myDequeuePosition(0)
+    {
+        for (std::uint32_t i = 0; i < nValues; i++)
+        {
+            myCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    bool enqueue(const T& value)
+    {
+        std::uint64_t position =
+                             myEnqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell = 0;
+
+        while (true)
+        {
+            cell = &(myCells[position % nValues]);
+
+            const std::int64_t difference = static_cast<std::int64_t>(
+                     cell->sequence.load(std::memory_order_acquire) - position);
+
+            if (difference == 0)
+            {
+                if (myEnqueuePosition.compare_exchange_weak(
+                                                    position,
+                                                    position + 1,
+                                                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Cell still holds the value from the previous lap, full
+                return false;
+            }
+            else
+            {
+                position = myEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    bool dequeue(T& value)
+    {
+        std::uint64_t position =
+                             myDequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell = 0;
+
+        while (true)
+        {
+            cell = &(myCells[position % nValues]);
+
+            const std::int64_t difference = static_cast<std::int64_t>(
+                               cell->sequence.load(std::memory_order_acquire) -
+                               (position + 1));
+
+            if (difference == 0)
+            {
+                if (myDequeuePosition.compare_exchange_weak(
+                                                    position,
+                                                    position + 1,
+                                                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Cell not written for this lap yet, empty
+                return false;
+            }
+            else
+            {
+                position = myDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        value = cell->value;
+        cell->sequence.store(position + nValues, std::memory_order_release);
+
+        return true;
+    }
+
+    ///
+    /// @brief Returns true if no value is ready to be dequeued. Values being
+    /// enqueued concurrently are not counted until enqueue() returns.
+    ///
+    bool isEmpty() const
+    {
+        const std::uint64_t position =
+                             myDequeuePosition.load(std::memory_order_relaxed);
+        const Cell& cell = myCells[position % nValues];
+
+        return (cell.sequence.load(std::memory_order_acquire) !=
+                (position + 1));
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getCapacity() const
+    {
+        return nValues;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Sequence p means the cell is free for the value at position p,
+    /// p + 1 means it holds that value.
+    ///
+    struct Cell
+    {
+        std::atomic<std::uint64_t> sequence;
+        T value;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    Cell myCells[nValues];
+
+    std::atomic<std::uint64_t> myEnqueuePosition;
+
+    std::atomic<std::uint64_t> myDequeuePosition;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    LockFreeQueue(const LockFreeQueue<T, nValues>& lockFreeQueue);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_LOCK_FREE_QUEUE_H
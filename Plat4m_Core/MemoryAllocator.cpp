@@ -81,6 +81,12 @@ size_t MemoryAllocator::getFreeMemorySize()
     return (AllocationMemory::getFreeMemorySize());
 }
 
+//------------------------------------------------------------------------------
+Plat4m::AllocationMemory::Stats MemoryAllocator::getStats()
+{
+    return (AllocationMemory::getStats());
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
@@ -81,6 +81,8 @@ public:
 
     static std::size_t getFreeMemorySize();
 
+    static AllocationMemory::Stats getStats();
+
     //--------------------------------------------------------------------------
     template <typename T, typename ... Arguments>
     static T* allocate(Arguments&&... arguments)
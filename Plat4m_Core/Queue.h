@@ -125,6 +125,22 @@ public:
 		return (myDriver.driverDequeueFast((void*) &value));
 	}
 
+	//--------------------------------------------------------------------------
+	uint32_t dequeueBatch(T values[], const uint32_t nMaxValues)
+	{
+		return (myDriver.driverDequeueBatch((void*) values,
+		                                    sizeof(T),
+		                                    nMaxValues));
+	}
+
+	//--------------------------------------------------------------------------
+	uint32_t enqueueBatch(const T values[], const uint32_t nValues)
+	{
+		return (myDriver.driverEnqueueBatch((const void*) values,
+		                                    sizeof(T),
+		                                    nValues));
+	}
+
 	//--------------------------------------------------------------------------
 	void clear()
 	{
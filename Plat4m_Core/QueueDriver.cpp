@@ -64,3 +64,47 @@ QueueDriver::QueueDriver()
 QueueDriver::~QueueDriver()
 {
 }
+
+//------------------------------------------------------------------------------
+// Public virtual methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriver::driverDequeueBatch(void* values,
+                                         const uint32_t valueSizeBytes,
+                                         const uint32_t nMaxValues)
+{
+    uint8_t* bytes = static_cast<uint8_t*>(values);
+
+    if ((nMaxValues == 0) || !driverDequeue(bytes))
+    {
+        return 0;
+    }
+
+    uint32_t nValues = 1;
+
+    while ((nValues < nMaxValues) &&
+           driverDequeueFast(bytes + (nValues * valueSizeBytes)))
+    {
+        nValues++;
+    }
+
+    return nValues;
+}
+
+//------------------------------------------------------------------------------
+uint32_t QueueDriver::driverEnqueueBatch(const void* values,
+                                         const uint32_t valueSizeBytes,
+                                         const uint32_t nValues)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(values);
+    uint32_t nEnqueuedValues = 0;
+
+    while ((nEnqueuedValues < nValues) &&
+           driverEnqueueFast(bytes + (nEnqueuedValues * valueSizeBytes)))
+    {
+        nEnqueuedValues++;
+    }
+
+    return nEnqueuedValues;
+}
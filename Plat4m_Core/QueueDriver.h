@@ -81,6 +81,33 @@ public:
 
 	virtual void driverClear() = 0;
 
+    //--------------------------------------------------------------------------
+    // Public virtual methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Blocks until at least one value is available, then dequeues as
+    /// many values as are available without blocking, up to nMaxValues. The
+    /// default takes the rest with driverDequeueFast(), drivers whose fast
+    /// calls are for interrupts only override this.
+    /// @param values Storage for nMaxValues values of valueSizeBytes each.
+    /// @return Number of values dequeued, 0 if the blocking dequeue failed.
+    ///
+    virtual uint32_t driverDequeueBatch(void* values,
+                                        const uint32_t valueSizeBytes,
+                                        const uint32_t nMaxValues);
+
+    ///
+    /// @brief Enqueues values in order without blocking until the queue is
+    /// full. The default uses driverEnqueueFast(), drivers whose fast calls
+    /// are for interrupts only override this.
+    /// @param values nValues values of valueSizeBytes each.
+    /// @return Number of values enqueued.
+    ///
+    virtual uint32_t driverEnqueueBatch(const void* values,
+                                        const uint32_t valueSizeBytes,
+                                        const uint32_t nValues);
+
 protected:
 
     //--------------------------------------------------------------------------
@@ -54,7 +54,9 @@ using namespace Plat4m;
 
 //------------------------------------------------------------------------------
 Semaphore::Semaphore(const uint32_t maxValue,
-                     const uint32_t initialValue)
+                     const uint32_t initialValue) :
+    myNWaits(0),
+    myNTimeouts(0)
 {
 }
 
@@ -72,9 +74,18 @@ Semaphore::~Semaphore()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-Semaphore::Error Semaphore::wait()
+Semaphore::Error Semaphore::wait(const TimeMs waitTimeMs)
 {
-    return (driverWait());
+    Error error = driverWait(waitTimeMs);
+
+    myNWaits.fetch_add(1, memory_order_relaxed);
+
+    if (error.getCode() == ERROR_CODE_TIMEOUT)
+    {
+        myNTimeouts.fetch_add(1, memory_order_relaxed);
+    }
+
+    return error;
 }
 
 //------------------------------------------------------------------------------
@@ -88,3 +99,15 @@ uint32_t Semaphore::getValue()
 {
     return (driverGetValue());
 }
+
+//------------------------------------------------------------------------------
+uint32_t Semaphore::getNWaits() const
+{
+    return (myNWaits.load(memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+uint32_t Semaphore::getNTimeouts() const
+{
+    return (myNTimeouts.load(memory_order_relaxed));
+}
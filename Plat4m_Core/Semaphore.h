@@ -46,8 +46,10 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <atomic>
 #include <cstdint>
 
+#include <Plat4m_Core/Plat4m.h>
 #include <Plat4m_Core/ErrorTemplate.h>
 
 //------------------------------------------------------------------------------
@@ -71,7 +73,8 @@ public:
     
     enum ErrorCode
     {
-        ERROR_CODE_NONE
+        ERROR_CODE_NONE,
+        ERROR_CODE_TIMEOUT
     };
 
     typedef ErrorTemplate<ErrorCode> Error;
@@ -80,12 +83,25 @@ public:
     // Public virtual methods
     //--------------------------------------------------------------------------
 
-    Error wait();
+    ///
+    /// @brief Decrements the semaphore, waiting for it to be posted if it is
+    /// 0.
+    /// @param waitTimeMs Time to wait, 0xFFFFFFFF to wait forever.
+    /// @return ERROR_CODE_TIMEOUT if the semaphore wasn't posted in time.
+    ///
+    Error wait(const TimeMs waitTimeMs = 0xFFFFFFFF);
 
     Error post();
 
     std::uint32_t getValue();
 
+    std::uint32_t getNWaits() const;
+
+    ///
+    /// @brief Returns the number of wait() calls that timed out.
+    ///
+    std::uint32_t getNTimeouts() const;
+
 protected:
 
     //--------------------------------------------------------------------------
@@ -101,12 +117,20 @@ protected:
     virtual ~Semaphore();
     
 private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::atomic<std::uint32_t> myNWaits;
+
+    std::atomic<std::uint32_t> myNTimeouts;
     
     //--------------------------------------------------------------------------
     // Private pure virtual methods
     //--------------------------------------------------------------------------
     
-    virtual Error driverWait() = 0;
+    virtual Error driverWait(const TimeMs waitTimeMs) = 0;
 
     virtual Error driverPost() = 0;
 
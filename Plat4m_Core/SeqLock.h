@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SeqLock.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SeqLock class header file.
+///
+
+#ifndef PLAT4M_SEQ_LOCK_H
+#define PLAT4M_SEQ_LOCK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Value with a single writer and any number of readers on other
+/// threads. The writer never waits, the sequence is odd while a write is in
+/// progress and readers copy the value and retry if the sequence changed, so
+/// a reader only repeats its copy when it overlaps a write. Each completed
+/// write increments the version, readers can use it to skip unchanged data.
+/// Readers require DataType to be trivially copyable since they may copy the
+/// value while it is being overwritten.
+///
+template <typename DataType>
+class SeqLock
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    SeqLock() :
+        mySequence(0),
+        myData()
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Returns the number of completed writes.
+    ///
+    std::uint32_t getVersion() const
+    {
+        return (mySequence.load(std::memory_order_acquire) / 2);
+    }
+
+    ///
+    /// @brief Stores a new value. Only one thread may write.
+    ///
+    void write(const DataType& data)
+    {
+        const std::uint32_t sequence =
+                                     mySequence.load(std::memory_order_relaxed);
+
+        mySequence.store(sequence + 1, std::memory_order_relaxed);
+
+        // Readers that see the new data also see the odd sequence
+        std::atomic_thread_fence(std::memory_order_release);
+
+        myData = data;
+
+        mySequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    ///
+    /// @brief Copies a consistent snapshot of the value.
+    /// @return Version of the copied value.
+    ///
+    std::uint32_t read(DataType& data) const
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "SeqLock readers require trivially copyable data");
+
+        while (true)
+        {
+            const std::uint32_t sequence =
+                                     mySequence.load(std::memory_order_acquire);
+
+            if ((sequence & 1) == 0)
+            {
+                data = myData;
+
+                // The copy completes before the sequence is checked again
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (mySequence.load(std::memory_order_relaxed) == sequence)
+                {
+                    return (sequence / 2);
+                }
+            }
+
+            // Value is being written, retry
+        }
+    }
+
+    ///
+    /// @brief Copies the value only if it was written since the given
+    /// version was read.
+    /// @param data Copy of the value, untouched if unchanged.
+    /// @param version Last version read, updated when the value is copied.
+    /// @return True if the value was copied.
+    ///
+    bool readIfChanged(DataType& data, std::uint32_t& version) const
+    {
+        if (getVersion() == version)
+        {
+            return false;
+        }
+
+        version = read(data);
+
+        return true;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::atomic<std::uint32_t> mySequence;
+
+    DataType myData;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    SeqLock(const SeqLock<DataType>& seqLock);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SEQ_LOCK_H
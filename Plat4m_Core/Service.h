@@ -47,15 +47,35 @@
 //------------------------------------------------------------------------------
 
 #include <new>
+#include <atomic>
 #include <cstdint>
 
 #include <Plat4m_Core/ServiceBase.h>
 #include <Plat4m_Core/Callback.h>
+#include <Plat4m_Core/CallbackMethod.h>
 #include <Plat4m_Core/List.h>
 #include <Plat4m_Core/System.h>
 #include <Plat4m_Core/ServiceManager.h>
 #include <Plat4m_Core/ServiceRequest.h>
 #include <Plat4m_Core/ServiceResponse.h>
+#include <Plat4m_Core/ServiceFuture.h>
+#include <Plat4m_Core/Thread.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/Executor.h>
+#include <Plat4m_Core/LockFreeQueue.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of asynchronous requests a Service running on its own thread
+/// or on an Executor can queue. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_SERVICE_QUEUE_SIZE
+#define PLAT4M_SERVICE_QUEUE_SIZE 16
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -64,10 +84,25 @@
 namespace Plat4m
 {
 
+//------------------------------------------------------------------------------
+// Forward class declarations
+//------------------------------------------------------------------------------
+
+template <ServiceBase::Id IdValue,
+          typename RequestType,
+          typename ResponseType>
+class ServiceDescriptor;
+
 //------------------------------------------------------------------------------
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Named request/response endpoint. By default requests run the
+/// service callback on the caller's thread. After setThread() or
+/// setExecutor() all requests, synchronous ones included, are queued and run
+/// one at a time on the service's own thread or on the executor.
+///
 template <typename RequestType, typename ResponseType>
 class Service : public ServiceBase
 {
@@ -81,6 +116,10 @@ public:
                                      const ServiceRequest<RequestType>&,
                                      ServiceResponse<ResponseType>&>;
 
+    typedef ServiceFuture<RequestType, ResponseType> Future;
+
+    typedef typename Future::CompletionCallback CompletionCallback;
+
     //--------------------------------------------------------------------------
     // Public static methods
     //--------------------------------------------------------------------------
@@ -127,6 +166,37 @@ public:
         return error;
     }
 
+    //--------------------------------------------------------------------------
+    static Error requestAsync(const ServiceBase::Id id,
+                              const RequestType& request,
+                              Future& future)
+    {
+        Service* service = findPrivate(id);
+
+        if (isNullPointer(service))
+        {
+            return Error(ERROR_CODE_SERVICE_INVALID);
+        }
+
+        return (service->requestAsync(request, future));
+    }
+
+    //--------------------------------------------------------------------------
+    static Error requestAsync(const ServiceBase::Id id,
+                              const RequestType& request,
+                              Future& future,
+                              CompletionCallback& completionCallback)
+    {
+        Service* service = findPrivate(id);
+
+        if (isNullPointer(service))
+        {
+            return Error(ERROR_CODE_SERVICE_INVALID);
+        }
+
+        return (service->requestAsync(request, future, completionCallback));
+    }
+
     //--------------------------------------------------------------------------
     // Public virtual destructors
     //--------------------------------------------------------------------------
@@ -135,8 +205,40 @@ public:
     virtual ~Service()
     {
         Service* pointer = this;
-
         ServiceManager::remove(*pointer);
+
+        if (isValidPointer(myThread))
+        {
+            myThread->disable();
+
+            // Like the thread, the context is never deallocated
+            myThreadContext->detach(*myRequestSemaphore);
+        }
+
+        // Wait for a submitted task to let go of the service
+        if (isValidPointer(myReleasedSemaphore))
+        {
+            const std::uint32_t nUsers =
+                myNUsers.fetch_or(destroyingFlag, std::memory_order_acq_rel);
+
+            if (nUsers != 0)
+            {
+                myReleasedSemaphore->wait();
+            }
+        }
+
+        if (isValidPointer(myQueue))
+        {
+            Future* future = 0;
+
+            while (myQueue->dequeue(future))
+            {
+                complete(*future, Error(ERROR_CODE_SERVICE_INVALID));
+            }
+
+            myQueue->~RequestQueue();
+            MemoryAllocator::deallocate(myQueue);
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -151,34 +253,233 @@ public:
             return Error(ERROR_CODE_SERVICE_NOT_INITIALIZED);
         }
 
+        if (isValidPointer(myQueue))
+        {
+            // Queued behind any asynchronous requests so the callback only
+            // ever runs on the service's thread or executor
+            Future future;
+            future.setSemaphore(&(getRequestSemaphore()));
+
+            Error error = requestAsync(request, future);
+
+            if (error.getCode() != ERROR_CODE_NONE)
+            {
+                return error;
+            }
+
+            error = future.wait();
+            response = future.getResponse();
+
+            return error;
+        }
+
         ServiceRequest<RequestType> serviceRequest(request);
-        serviceRequest.sequenceId = myRequestSequenceId;
+        serviceRequest.sequenceId = getNextSequenceId();
         serviceRequest.timeStamp = System::getTimeStamp();
 
         ServiceResponse<ResponseType> serviceResponse(response);
 
         Error error = myCallback->call(serviceRequest, serviceResponse);
 
-        serviceResponse.sequenceId = myResponseSequeceId;
+        serviceResponse.sequenceId = serviceRequest.sequenceId;
         serviceResponse.timeStamp = System::getTimeStamp();
 
-        myRequestSequenceId++;
-        myResponseSequeceId++;
-
         return error;
     }
 
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Starts a request without waiting for it. Without setThread() or
+    /// setExecutor() the request runs on the caller's thread and has
+    /// completed by the time this returns.
+    /// @return ERROR_CODE_QUEUE_FULL if the request queue is full,
+    /// ERROR_CODE_REQUEST_PENDING if the future is still in use.
+    ///
+    Error requestAsync(const RequestType& request, Future& future)
+    {
+        return (requestAsyncPrivate(request, future, 0));
+    }
+
+    //--------------------------------------------------------------------------
+    Error requestAsync(const RequestType& request,
+                       Future& future,
+                       CompletionCallback& completionCallback)
+    {
+        return (requestAsyncPrivate(request, future, &completionCallback));
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Runs requests on a new thread of the service's own. Call
+    /// before the first request.
+    ///
+    void setThread(const std::uint32_t nStackBytes = 0,
+                   const char* name = 0)
+    {
+        if (isValidPointer(myQueue))
+        {
+            return;
+        }
+
+        myRequestSemaphore = &(System::createSemaphore());
+        myThreadContext = MemoryAllocator::allocate<ThreadContext>(*this);
+        myThread = &(System::createThread(
+                                createCallback(myThreadContext,
+                                               &ThreadContext::threadCallback),
+                                0,
+                                nStackBytes,
+                                false,
+                                name));
+        myQueue = MemoryAllocator::allocate<RequestQueue>();
+        myThread->enable();
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Runs requests as tasks on the given executor, at most one at a
+    /// time. Call before the first request.
+    ///
+    void setExecutor(Executor& executor)
+    {
+        if (isValidPointer(myQueue))
+        {
+            return;
+        }
+
+        myExecutor = &executor;
+        myReleasedSemaphore = &(System::createSemaphore(1, 0));
+        myTaskCallback = &(createCallback(this, &Service::taskCallback));
+        myQueue = MemoryAllocator::allocate<RequestQueue>();
+    }
+
+    //--------------------------------------------------------------------------
+    Thread* getThread()
+    {
+        return myThread;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getNRejectedRequests() const
+    {
+        return myNRejectedRequests.load(std::memory_order_relaxed);
+    }
+
 private:
 
+    //--------------------------------------------------------------------------
+    // Private friend classes
+    //--------------------------------------------------------------------------
+
+    template <ServiceBase::Id IdValue,
+              typename TRequestType,
+              typename TResponseType>
+    friend class ServiceDescriptor;
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef LockFreeQueue<Future*, PLAT4M_SERVICE_QUEUE_SIZE> RequestQueue;
+
+    //--------------------------------------------------------------------------
+    // Private classes
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief What the thread calls into. Threads are never destroyed and may
+    /// run once more after being disabled, so this outlives the service and
+    /// stops calling into it once detached.
+    ///
+    class ThreadContext
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        ThreadContext(Service& service) :
+            myService(service),
+            myNUsers(0),
+            myReleasedSemaphore(System::createSemaphore(1, 0))
+        {
+        }
+
+        //----------------------------------------------------------------------
+        void detach(Semaphore& requestSemaphore)
+        {
+            const std::uint32_t nUsers =
+                myNUsers.fetch_or(destroyingFlag, std::memory_order_acq_rel);
+
+            if (nUsers != 0)
+            {
+                // Wakes the thread up from waiting for a request
+                requestSemaphore.post();
+                myReleasedSemaphore.wait();
+            }
+        }
+
+        //----------------------------------------------------------------------
+        void threadCallback()
+        {
+            const std::uint32_t nUsers =
+                             myNUsers.fetch_add(1, std::memory_order_acq_rel);
+
+            if ((nUsers & destroyingFlag) == 0)
+            {
+                myService.threadCallback();
+            }
+
+            if (myNUsers.fetch_sub(1, std::memory_order_acq_rel) ==
+                                                         (destroyingFlag + 1))
+            {
+                myReleasedSemaphore.post();
+            }
+        }
+
+    private:
+
+        Service& myService;
+
+        std::atomic<std::uint32_t> myNUsers;
+
+        Semaphore& myReleasedSemaphore;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    // Set in myNUsers once the destructor is waiting for the users to finish
+    static const std::uint32_t destroyingFlag = 0x80000000;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
 
     ServiceCallback* myCallback;
 
-    std::uint32_t myRequestSequenceId;
+    std::atomic<std::uint32_t> mySequenceId;
+
+    RequestQueue* myQueue;
+
+    Thread* myThread;
+
+    ThreadContext* myThreadContext;
+
+    Semaphore* myRequestSemaphore;
+
+    Executor* myExecutor;
+
+    Executor::TaskCallback* myTaskCallback;
+
+    std::atomic<bool> myIsSubmitted;
+
+    // The submitted task, the last one out while the destructor waits posts
+    // myReleasedSemaphore
+    std::atomic<std::uint32_t> myNUsers;
 
-    std::uint32_t myResponseSequeceId;
+    Semaphore* myReleasedSemaphore;
+
+    std::atomic<std::uint32_t> myNRejectedRequests;
 
     //--------------------------------------------------------------------------
     // Private static methods
@@ -187,33 +488,27 @@ private:
     //--------------------------------------------------------------------------
     static Service* findPrivate(const ServiceBase::Id id)
     {
-        Service* service = 0;
+        ServiceBase* serviceBase = 0;
 
-        ServiceBase* serviceBase = ServiceManager::find(id);
+        Error error = ServiceManager::find(id,
+                                           Plat4m::getTypeId<Service>(),
+                                           serviceBase);
 
-        if (isValidPointer(serviceBase))
+        if (error.getCode() == ERROR_CODE_SERVICE_TYPE_ID_MISMATCH)
         {
-            service = dynamic_cast<Service*>(serviceBase);
-
-            if (isNullPointer(service))
+            // Lock up, error condition
+            while (true)
             {
-                Error error(ERROR_CODE_SERVICE_TYPE_ID_MISMATCH);
-
-                // Lock up, error condition
-                while (true)
-                {
-                }
             }
         }
 
-        return service;
+        return static_cast<Service*>(serviceBase);
     }
 
     //--------------------------------------------------------------------------
     static Service* createPrivate(const ServiceBase::Id id)
     {
         void* memoryPointer = AllocationMemory::allocate(sizeof(Service));
-
         Service* service = new(memoryPointer) Service(id);
 
         return service;
@@ -224,7 +519,6 @@ private:
                                   ServiceCallback& callback)
     {
         void* memoryPointer = AllocationMemory::allocate(sizeof(Service));
-
         Service* service = new(memoryPointer) Service(id, callback);
 
         return service;
@@ -243,35 +537,250 @@ private:
         return service;
     }
 
+    //--------------------------------------------------------------------------
+    static Semaphore& getRequestSemaphore()
+    {
+        // Synchronous requests wait on a semaphore of the calling thread's
+        // own, so concurrent callers never take each other's posts
+        static thread_local Semaphore* semaphore = 0;
+
+        if (isNullPointer(semaphore))
+        {
+            semaphore = &(System::createSemaphore());
+        }
+
+        return (*semaphore);
+    }
+
+    //--------------------------------------------------------------------------
+    static void complete(Future& future, const Error& error)
+    {
+        future.myError = error;
+
+        // Copied first, the future may be destroyed as soon as it completes
+        Semaphore* semaphore = future.mySemaphore;
+
+        if (isValidPointer(future.myCompletionCallback))
+        {
+            ServiceResponse<ResponseType> serviceResponse(future.myResponse);
+            serviceResponse.sequenceId = future.mySequenceId;
+            serviceResponse.timeStamp = future.myResponseTimeStamp;
+
+            future.myCompletionCallback->call(error, serviceResponse);
+        }
+
+        future.myIsPending.store(false, std::memory_order_release);
+
+        if (isValidPointer(semaphore))
+        {
+            semaphore->post();
+        }
+    }
+
     //--------------------------------------------------------------------------
     // Private constructors
     //--------------------------------------------------------------------------
 
     //--------------------------------------------------------------------------
     Service(const ServiceBase::Id id) :
-        ServiceBase(id),
-        myCallback(0)
+        ServiceBase(id, Plat4m::getTypeId<Service>()),
+        myCallback(0),
+        mySequenceId(0),
+        myQueue(0),
+        myThread(0),
+        myThreadContext(0),
+        myRequestSemaphore(0),
+        myExecutor(0),
+        myTaskCallback(0),
+        myIsSubmitted(false),
+        myNUsers(0),
+        myReleasedSemaphore(0),
+        myNRejectedRequests(0)
     {
         Service* pointer = this;
-
         ServiceManager::add(*pointer);
     }
 
     //--------------------------------------------------------------------------
     Service(const ServiceBase::Id id, ServiceCallback& callback) :
-        ServiceBase(id),
-        myCallback(&callback)
+        ServiceBase(id, Plat4m::getTypeId<Service>()),
+        myCallback(&callback),
+        mySequenceId(0),
+        myQueue(0),
+        myThread(0),
+        myThreadContext(0),
+        myRequestSemaphore(0),
+        myExecutor(0),
+        myTaskCallback(0),
+        myIsSubmitted(false),
+        myNUsers(0),
+        myReleasedSemaphore(0),
+        myNRejectedRequests(0)
     {
         Service* pointer = this;
-
         ServiceManager::add(*pointer);
     }
 
     //--------------------------------------------------------------------------
-    Service(const Service& service) :
-        ServiceBase(service),
-        myCallback(service.myCallback)
+    Service(const Service& service);
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getNextSequenceId()
+    {
+        return mySequenceId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    Error requestAsyncPrivate(const RequestType& request,
+                              Future& future,
+                              CompletionCallback* completionCallback)
+    {
+        if (isNullPointer(myCallback))
+        {
+            return Error(ERROR_CODE_SERVICE_NOT_INITIALIZED);
+        }
+
+        if (future.isPending())
+        {
+            return Error(ERROR_CODE_REQUEST_PENDING);
+        }
+
+        future.myRequest = request;
+        future.myError = Error(ERROR_CODE_NONE);
+        future.mySequenceId = getNextSequenceId();
+        future.myRequestTimeStamp = System::getTimeStamp();
+        future.myCompletionCallback = completionCallback;
+        future.myIsPending.store(true, std::memory_order_relaxed);
+
+        if (isNullPointer(myQueue))
+        {
+            runRequest(future);
+
+            return Error(ERROR_CODE_NONE);
+        }
+
+        if (!(myQueue->enqueue(&future)))
+        {
+            future.myIsPending.store(false, std::memory_order_relaxed);
+            myNRejectedRequests.fetch_add(1, std::memory_order_relaxed);
+
+            return Error(ERROR_CODE_QUEUE_FULL);
+        }
+
+        if (isValidPointer(myRequestSemaphore))
+        {
+            myRequestSemaphore->post();
+        }
+        else
+        {
+            submit();
+        }
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    //--------------------------------------------------------------------------
+    void runRequest(Future& future)
+    {
+        ServiceRequest<RequestType> serviceRequest(future.myRequest);
+        serviceRequest.sequenceId = future.mySequenceId;
+        serviceRequest.timeStamp = future.myRequestTimeStamp;
+
+        ServiceResponse<ResponseType> serviceResponse(future.myResponse);
+        serviceResponse.sequenceId = future.mySequenceId;
+
+        Error error = myCallback->call(serviceRequest, serviceResponse);
+
+        future.myResponseTimeStamp = System::getTimeStamp();
+
+        complete(future, error);
+    }
+
+    //--------------------------------------------------------------------------
+    void threadCallback()
     {
+        // Times out now and then so the thread can be disabled
+        if (myRequestSemaphore->wait(100).getCode() ==
+                                                  Semaphore::ERROR_CODE_NONE)
+        {
+            Future* future = 0;
+
+            if (myQueue->dequeue(future))
+            {
+                runRequest(*future);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void submit()
+    {
+        // Pairs with the fence in taskCallback(), either this sees the task
+        // is done or the task sees the request just queued
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (myIsSubmitted.exchange(true, std::memory_order_acq_rel))
+        {
+            // Already submitted, the task will get to the request
+            return;
+        }
+
+        // The task is a user until its last access to this service
+        myNUsers.fetch_add(1, std::memory_order_acq_rel);
+
+        if (myExecutor->submit(*myTaskCallback).getCode() !=
+                                                   Executor::ERROR_CODE_NONE)
+        {
+            // Executor is full, the request stays queued until the next one
+            myIsSubmitted.store(false, std::memory_order_release);
+            releaseUser();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void taskCallback()
+    {
+        // At most one queue's worth per run so other tasks on the same worker
+        // get a turn
+        Future* future = 0;
+        std::uint32_t nRequests = 0;
+
+        while ((nRequests < PLAT4M_SERVICE_QUEUE_SIZE) &&
+               myQueue->dequeue(future))
+        {
+            runRequest(*future);
+            nRequests++;
+        }
+
+        myIsSubmitted.store(false, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!(myQueue->isEmpty()))
+        {
+            submit();
+        }
+
+        // Last access to this service, it may be destroyed right after
+        releaseUser();
+    }
+
+    //--------------------------------------------------------------------------
+    void releaseUser()
+    {
+        // Taken before the count drops, this service can be gone after
+        Semaphore* releasedSemaphore = myReleasedSemaphore;
+
+        const std::uint32_t nUsers =
+                             myNUsers.fetch_sub(1, std::memory_order_acq_rel);
+
+        if (nUsers == (destroyingFlag + 1))
+        {
+            releasedSemaphore->post();
+        }
     }
 };
 
@@ -44,6 +44,7 @@
 //------------------------------------------------------------------------------
 
 #include <Plat4m_Core/ServiceBase.h>
+#include <Plat4m_Core/ServiceManager.h>
 
 using namespace Plat4m;
 
@@ -54,7 +55,17 @@ using namespace Plat4m;
 //------------------------------------------------------------------------------
 void ServiceBase::setId(const Id id)
 {
+    if (id == myId)
+    {
+        return;
+    }
+
+    // Re-register so the ServiceManager index is keyed by the new Id
+    ServiceBase* pointer = this;
+
+    ServiceManager::remove(*pointer);
     myId = id;
+    ServiceManager::add(*pointer);
 }
 
 //------------------------------------------------------------------------------
@@ -63,6 +74,12 @@ Id ServiceBase::getId() const
     return myId;
 }
 
+//------------------------------------------------------------------------------
+TypeId ServiceBase::getTypeId() const
+{
+    return myTypeId;
+}
+
 //------------------------------------------------------------------------------
 // Public virtual destructors
 //------------------------------------------------------------------------------
@@ -77,7 +94,8 @@ ServiceBase::~ServiceBase()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-ServiceBase::ServiceBase(const Id id) :
-    myId(id)
+ServiceBase::ServiceBase(const Id id, const TypeId typeId) :
+    myId(id),
+    myTypeId(typeId)
 {
 }
@@ -49,6 +49,7 @@
 #include <cstdint>
 
 #include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TypeId.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -74,7 +75,10 @@ public:
         ERROR_CODE_NONE,
         ERROR_CODE_SERVICE_NOT_INITIALIZED,
         ERROR_CODE_SERVICE_INVALID,
-        ERROR_CODE_SERVICE_TYPE_ID_MISMATCH
+        ERROR_CODE_SERVICE_TYPE_ID_MISMATCH,
+        ERROR_CODE_QUEUE_FULL,
+        ERROR_CODE_REQUEST_PENDING,
+        ERROR_CODE_TIMEOUT
     };
 
     typedef ErrorTemplate<ErrorCode> Error;
@@ -95,13 +99,15 @@ public:
 
     Id getId() const;
 
+    TypeId getTypeId() const;
+
 protected:
 
     //--------------------------------------------------------------------------
     // Protected constructors
     //--------------------------------------------------------------------------
 
-    ServiceBase(const Id id);
+    ServiceBase(const Id id, const TypeId typeId);
 
 private:
 
@@ -110,6 +116,8 @@ private:
     //--------------------------------------------------------------------------
 
     Id myId;
+
+    const TypeId myTypeId;
 };
 
 }; // namespace Plat4m
@@ -48,6 +48,9 @@
 
 #include <Plat4m_Core/ServiceBase.h>
 #include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/ServiceFuture.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/System.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -60,18 +63,33 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Client side of a Service. Any number of asynchronous requests can
+/// be in flight at once, each with its own ServiceFuture. The futures of one
+/// client share a semaphore, so they should all be waited on from the same
+/// thread.
+///
 template <typename RequestType, typename ResponseType>
 class ServiceClient
 {
 public:
 
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef ServiceFuture<RequestType, ResponseType> Future;
+
+    typedef typename Future::CompletionCallback CompletionCallback;
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
 
     //--------------------------------------------------------------------------
     ServiceClient(const ServiceBase::Id id) :
-        myService(Service<RequestType, ResponseType>::find(id))
+        myService(Service<RequestType, ResponseType>::find(id)),
+        mySemaphore(0)
     {
     }
 
@@ -95,6 +113,26 @@ public:
         return (myService.request(request, response));
     }
 
+    //--------------------------------------------------------------------------
+    typename ServiceBase::Error requestAsync(const RequestType& request,
+                                             Future& future)
+    {
+        future.setSemaphore(&(getSemaphore()));
+
+        return (myService.requestAsync(request, future));
+    }
+
+    //--------------------------------------------------------------------------
+    typename ServiceBase::Error requestAsync(
+                                        const RequestType& request,
+                                        Future& future,
+                                        CompletionCallback& completionCallback)
+    {
+        future.setSemaphore(&(getSemaphore()));
+
+        return (myService.requestAsync(request, future, completionCallback));
+    }
+
 private:
 
     //--------------------------------------------------------------------------
@@ -102,6 +140,25 @@ private:
     //--------------------------------------------------------------------------
 
     Service<RequestType, ResponseType>& myService;
+
+    Semaphore* mySemaphore;
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    Semaphore& getSemaphore()
+    {
+        // Created on first use, clients that only make synchronous requests
+        // never need one
+        if (isNullPointer(mySemaphore))
+        {
+            mySemaphore = &(System::createSemaphore());
+        }
+
+        return (*mySemaphore);
+    }
 };
 
 }; // namespace Plat4m
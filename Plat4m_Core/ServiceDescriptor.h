@@ -0,0 +1,247 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ServiceDescriptor.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ServiceDescriptor class header file.
+///
+
+#ifndef PLAT4M_SERVICE_DESCRIPTOR_H
+#define PLAT4M_SERVICE_DESCRIPTOR_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <new>
+#include <cstdint>
+
+#include <Plat4m_Core/ServiceBase.h>
+#include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/ServiceManager.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Claims the Id of the given ServiceDescriptor for its request and
+/// response types, see PLAT4M_TOPIC_DESCRIPTOR_DEFINE().
+///
+#define PLAT4M_SERVICE_DESCRIPTOR_DEFINE(...)                                  \
+    template <>                                                                \
+    const Plat4m::ServiceBase::Id                                              \
+                 Plat4m::ServiceIdOwner<__VA_ARGS__::id>::id = __VA_ARGS__::id;\
+                                                                               \
+    template <>                                                                \
+    template <>                                                                \
+    const Plat4m::ServiceBase::Id                                              \
+      Plat4m::ServiceIdOwner<__VA_ARGS__::id>::typedId<                        \
+                                                  __VA_ARGS__::ServiceType> =  \
+                                                                __VA_ARGS__::id
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Link time owner of a Service Id, see TopicIdOwner.
+///
+template <ServiceBase::Id IdValue>
+class ServiceIdOwner
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public static data members
+    //--------------------------------------------------------------------------
+
+    // Defined once per Id whatever the types
+    static const ServiceBase::Id id;
+
+    // Defined only for the Service type the Id was claimed for
+    template <typename ServiceType>
+    static const ServiceBase::Id typedId;
+};
+
+///
+/// @brief Service Id, request type and response type fixed at compile time.
+/// The Service lives in storage owned by the descriptor and is resolved once
+/// per ServiceManager, so requests skip the Id lookup and the TypeId check.
+///
+template <ServiceBase::Id IdValue,
+          typename RequestType,
+          typename ResponseType>
+class ServiceDescriptor
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef Service<RequestType, ResponseType> ServiceType;
+
+    typedef typename ServiceType::ServiceCallback ServiceCallback;
+
+    typedef typename ServiceType::Future Future;
+
+    typedef typename ServiceType::CompletionCallback CompletionCallback;
+
+    //--------------------------------------------------------------------------
+    // Public static data members
+    //--------------------------------------------------------------------------
+
+    static constexpr ServiceBase::Id id = IdValue;
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static ServiceType& get()
+    {
+        if (myGeneration != ServiceManager::getGeneration())
+        {
+            resolve();
+        }
+
+        return (*myService);
+    }
+
+    //--------------------------------------------------------------------------
+    static ServiceType& create(ServiceCallback& callback)
+    {
+        ServiceType& service = get();
+        service.myCallback = &callback;
+
+        return service;
+    }
+
+    //--------------------------------------------------------------------------
+    static ServiceBase::Error request(const RequestType& request,
+                                      ResponseType& response)
+    {
+        return (get().request(request, response));
+    }
+
+    //--------------------------------------------------------------------------
+    static ServiceBase::Error requestAsync(const RequestType& request,
+                                           Future& future)
+    {
+        return (get().requestAsync(request, future));
+    }
+
+    //--------------------------------------------------------------------------
+    static ServiceBase::Error requestAsync(
+                                        const RequestType& request,
+                                        Future& future,
+                                        CompletionCallback& completionCallback)
+    {
+        return (get().requestAsync(request, future, completionCallback));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static ServiceType* myService;
+
+    static std::uint32_t myGeneration;
+
+    alignas(ServiceType) static std::uint8_t myStorage[sizeof(ServiceType)];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static void resolve()
+    {
+        // Fails to link unless the Id was claimed for these request and
+        // response types
+        const ServiceBase::Id id =
+                     ServiceIdOwner<IdValue>::template typedId<ServiceType>;
+
+        ServiceType* service = ServiceType::findPrivate(id);
+
+        if (isNullPointer(service))
+        {
+            service = new(myStorage) ServiceType(id);
+        }
+
+        myService = service;
+        myGeneration = ServiceManager::getGeneration();
+    }
+};
+
+//------------------------------------------------------------------------------
+// Static data members
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+template <ServiceBase::Id IdValue, typename RequestType, typename ResponseType>
+constexpr ServiceBase::Id
+    ServiceDescriptor<IdValue, RequestType, ResponseType>::id;
+
+//------------------------------------------------------------------------------
+template <ServiceBase::Id IdValue, typename RequestType, typename ResponseType>
+Service<RequestType, ResponseType>*
+    ServiceDescriptor<IdValue, RequestType, ResponseType>::myService = 0;
+
+//------------------------------------------------------------------------------
+template <ServiceBase::Id IdValue, typename RequestType, typename ResponseType>
+std::uint32_t
+    ServiceDescriptor<IdValue, RequestType, ResponseType>::myGeneration = 0;
+
+//------------------------------------------------------------------------------
+template <ServiceBase::Id IdValue, typename RequestType, typename ResponseType>
+alignas(Service<RequestType, ResponseType>) std::uint8_t
+    ServiceDescriptor<IdValue, RequestType, ResponseType>::myStorage[
+                                   sizeof(Service<RequestType, ResponseType>)];
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SERVICE_DESCRIPTOR_H
@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ServiceFuture.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ServiceFuture class header file.
+///
+
+#ifndef PLAT4M_SERVICE_FUTURE_H
+#define PLAT4M_SERVICE_FUTURE_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/ServiceBase.h>
+#include <Plat4m_Core/ServiceResponse.h>
+#include <Plat4m_Core/Callback.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/TimeStamp.h>
+#include <Plat4m_Core/System.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Forward class declarations
+//------------------------------------------------------------------------------
+
+template <typename RequestType, typename ResponseType>
+class Service;
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Handle for one asynchronous Service request. Holds copies of the
+/// request and the response, so it must stay alive until the request
+/// completes. A future can be reused once its request has completed.
+///
+template <typename RequestType, typename ResponseType>
+class ServiceFuture
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Called on the thread that ran the request, just before the
+    /// future completes.
+    ///
+    using CompletionCallback = Callback<void,
+                                        ServiceBase::Error,
+                                        const ServiceResponse<ResponseType>&>;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ServiceFuture() :
+        myRequest(),
+        myResponse(),
+        myError(ServiceBase::ERROR_CODE_NONE),
+        mySequenceId(0),
+        myRequestTimeStamp(),
+        myResponseTimeStamp(),
+        myCompletionCallback(0),
+        mySemaphore(0),
+        myIsPending(false)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    bool isPending() const
+    {
+        return myIsPending.load(std::memory_order_acquire);
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Waits for the request to complete.
+    /// @param waitTimeMs Time to wait, 0xFFFFFFFF to wait forever.
+    /// @return ERROR_CODE_TIMEOUT if the request is still pending, otherwise
+    /// the error returned by the service.
+    ///
+    ServiceBase::Error wait(const TimeMs waitTimeMs = 0xFFFFFFFF)
+    {
+        const TimeMs startTimeMs = System::getTimeMs();
+
+        while (isPending())
+        {
+            TimeMs remainingTimeMs = 0xFFFFFFFF;
+
+            if (waitTimeMs != 0xFFFFFFFF)
+            {
+                const TimeMs elapsedTimeMs = System::getTimeMs() - startTimeMs;
+
+                if (elapsedTimeMs >= waitTimeMs)
+                {
+                    return ServiceBase::Error(ServiceBase::ERROR_CODE_TIMEOUT);
+                }
+
+                remainingTimeMs = waitTimeMs - elapsedTimeMs;
+            }
+
+            // The semaphore may have been posted for another future sharing
+            // it, so the state is always rechecked
+            if (isValidPointer(mySemaphore))
+            {
+                mySemaphore->wait(remainingTimeMs);
+            }
+            else
+            {
+                System::delayTimeMs(1);
+            }
+        }
+
+        return myError;
+    }
+
+    //--------------------------------------------------------------------------
+    ServiceBase::Error getError() const
+    {
+        return myError;
+    }
+
+    //--------------------------------------------------------------------------
+    const ResponseType& getResponse() const
+    {
+        return myResponse;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getSequenceId() const
+    {
+        return mySequenceId;
+    }
+
+    //--------------------------------------------------------------------------
+    TimeStamp getRequestTimeStamp() const
+    {
+        return myRequestTimeStamp;
+    }
+
+    //--------------------------------------------------------------------------
+    TimeStamp getResponseTimeStamp() const
+    {
+        return myResponseTimeStamp;
+    }
+
+    //--------------------------------------------------------------------------
+    ///
+    /// @brief Sets the semaphore posted when the request completes, shared
+    /// by all futures waited on from the same thread. Without one, wait()
+    /// polls every millisecond.
+    ///
+    void setSemaphore(Semaphore* semaphore)
+    {
+        mySemaphore = semaphore;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private friend classes
+    //--------------------------------------------------------------------------
+
+    friend class Service<RequestType, ResponseType>;
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    RequestType myRequest;
+
+    ResponseType myResponse;
+
+    ServiceBase::Error myError;
+
+    std::uint32_t mySequenceId;
+
+    TimeStamp myRequestTimeStamp;
+
+    TimeStamp myResponseTimeStamp;
+
+    CompletionCallback* myCompletionCallback;
+
+    Semaphore* mySemaphore;
+
+    std::atomic<bool> myIsPending;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ServiceFuture(const ServiceFuture& future);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SERVICE_FUTURE_H
@@ -53,6 +53,8 @@ using namespace Plat4m;
 
 ServiceManager* ServiceManager::myInstance = 0;
 
+std::uint32_t ServiceManager::myGeneration = 1;
+
 //------------------------------------------------------------------------------
 // Public static methods
 //------------------------------------------------------------------------------
@@ -102,7 +104,29 @@ ServiceBase* ServiceManager::find(const Id id)
         }
     }
 
-    return (myInstance->findPrivate(id));
+    ServiceBase* service = 0;
+
+    myInstance->findPrivate(id, 0, service);
+
+    return service;
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error ServiceManager::find(const ServiceBase::Id id,
+                                        const TypeId typeId,
+                                        ServiceBase*& service)
+{
+    if (isNullPointer(myInstance))
+    {
+        Error error(ERROR_CODE_INSTANCE_NOT_CREATED);
+
+        // Lock up
+        while (true)
+        {
+        }
+    }
+
+    return (myInstance->findPrivate(id, typeId, service));
 }
 
 //------------------------------------------------------------------------------
@@ -110,7 +134,10 @@ ServiceBase* ServiceManager::find(const Id id)
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-ServiceManager::ServiceManager()
+ServiceManager::ServiceManager() :
+    myServiceList(),
+    myServiceIndex(),
+    myIsServiceIndexIncomplete(false)
 {
     if (isValidPointer(myInstance))
     {
@@ -123,6 +150,7 @@ ServiceManager::ServiceManager()
     }
 
     myInstance = this;
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
@@ -137,13 +165,15 @@ ServiceManager::~ServiceManager()
     while (iterator.hasCurrent())
     {
         ServiceBase* service = iterator.current();
-        
-        service->~ServiceBase();
 
+        // Destroying the service removes it from the list
         iterator.next();
+
+        service->~ServiceBase();
     }
 
     myInstance = 0;
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
@@ -156,6 +186,17 @@ void ServiceManager::addPrivate(ServiceBase& service)
     ServiceBase* pointer = &service;
 
     myServiceList.append(pointer);
+
+    ServiceIndex::Error error = myServiceIndex.insert(pointer->getId(),
+                                                      pointer,
+                                                      pointer->getTypeId());
+
+    if (error.getCode() != ServiceIndex::ERROR_CODE_NONE)
+    {
+        // Index is full or the Id is a duplicate, fall back to searching the
+        // list for anything that misses in the index
+        myIsServiceIndexIncomplete = true;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -164,28 +205,69 @@ void ServiceManager::removePrivate(ServiceBase& service)
     ServiceBase* pointer = &service;
 
     myServiceList.remove(pointer);
+
+    ServiceBase* indexedService = 0;
+
+    ServiceIndex::Error error =
+                          myServiceIndex.find(pointer->getId(), indexedService);
+
+    if ((error.getCode() == ServiceIndex::ERROR_CODE_NONE) &&
+        (indexedService == pointer))
+    {
+        myServiceIndex.remove(pointer->getId());
+    }
+
+    if (myServiceList.size() == 0)
+    {
+        myIsServiceIndexIncomplete = false;
+    }
+
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
-ServiceBase* ServiceManager::findPrivate(const Id id)
+ServiceBase::Error ServiceManager::findPrivate(const ServiceBase::Id id,
+                                               const TypeId typeId,
+                                               ServiceBase*& service)
 {
-    ServiceBase* existingService = 0;
+    ServiceIndex::Error error = myServiceIndex.find(id, service, typeId);
 
-    typename List<ServiceBase*>::Iterator iterator = myServiceList.iterator();
+    if (error.getCode() == ServiceIndex::ERROR_CODE_NONE)
+    {
+        return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+    }
 
-    while (iterator.hasCurrent())
+    if (error.getCode() == ServiceIndex::ERROR_CODE_TYPE_ID_MISMATCH)
     {
-        ServiceBase* service = iterator.current();
-        
-        if (service->getId() == id)
+        return ServiceBase::Error(
+                              ServiceBase::ERROR_CODE_SERVICE_TYPE_ID_MISMATCH);
+    }
+
+    if (myIsServiceIndexIncomplete)
+    {
+        typename List<ServiceBase*>::Iterator iterator =
+                                                       myServiceList.iterator();
+
+        while (iterator.hasCurrent())
         {
-            existingService = service;
+            ServiceBase* existingService = iterator.current();
 
-            break;
-        }
+            if (existingService->getId() == id)
+            {
+                if ((typeId != 0) && (existingService->getTypeId() != typeId))
+                {
+                    return ServiceBase::Error(
+                           ServiceBase::ERROR_CODE_SERVICE_TYPE_ID_MISMATCH);
+                }
 
-        iterator.next();
+                service = existingService;
+
+                return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+            }
+
+            iterator.next();
+        }
     }
 
-    return existingService;
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_SERVICE_INVALID);
 }
@@ -46,9 +46,26 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include <Plat4m_Core/ErrorTemplate.h>
 #include <Plat4m_Core/ServiceBase.h>
 #include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IdHashIndexN.h>
+#include <Plat4m_Core/TypeId.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of entries in the ServiceManager Id hash index. Must be a
+/// power of 2, up to 3/4 of it can be indexed. Services beyond that are still
+/// found by a linear search. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_SERVICE_MANAGER_INDEX_SIZE
+#define PLAT4M_SERVICE_MANAGER_INDEX_SIZE 64
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -88,6 +105,21 @@ public:
 
     static ServiceBase* find(const ServiceBase::Id id);
 
+    static ServiceBase::Error find(const ServiceBase::Id id,
+                                   const TypeId typeId,
+                                   ServiceBase*& service);
+
+    ///
+    /// @brief Returns a counter that changes whenever a Service is removed or
+    /// the ServiceManager is created or destroyed, so a cached Service pointer is
+    /// only valid while the generation it was resolved in is current.
+    /// @return Current generation.
+    ///
+    static std::uint32_t getGeneration()
+    {
+        return myGeneration;
+    }
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
@@ -102,18 +134,31 @@ public:
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef IdHashIndexN<ServiceBase*, PLAT4M_SERVICE_MANAGER_INDEX_SIZE>
+                                                                   ServiceIndex;
+
     //--------------------------------------------------------------------------
     // Private static data members
     //--------------------------------------------------------------------------
 
     static ServiceManager* myInstance;
 
+    static std::uint32_t myGeneration;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
 
     List<ServiceBase*> myServiceList;
 
+    ServiceIndex myServiceIndex;
+
+    bool myIsServiceIndexIncomplete;
+
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
@@ -122,7 +167,9 @@ private:
 
     void removePrivate(ServiceBase& service);
 
-    ServiceBase* findPrivate(const ServiceBase::Id id);
+    ServiceBase::Error findPrivate(const ServiceBase::Id id,
+                                   const TypeId typeId,
+                                   ServiceBase*& service);
 };
 
 }; // namespace Plat4m
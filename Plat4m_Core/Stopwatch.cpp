@@ -52,10 +52,7 @@ using namespace Plat4m;
 // Private static data members
 //------------------------------------------------------------------------------
 
-List<Stopwatch*> Stopwatch::myStopwatchList;
-
-List<Stopwatch*>::Iterator Stopwatch::myStopwatchListIterator =
-                                                     myStopwatchList.iterator();
+Stopwatch::StopwatchList Stopwatch::myStopwatchList;
 
 Stopwatch* Stopwatch::myCurrentStopwatch = 0;
 
@@ -64,7 +61,7 @@ Stopwatch* Stopwatch::myCurrentStopwatch = 0;
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-List<Stopwatch*>& Stopwatch::getStopwatchList()
+Stopwatch::StopwatchList& Stopwatch::getStopwatchList()
 {
     return myStopwatchList;
 }
@@ -75,6 +72,7 @@ List<Stopwatch*>& Stopwatch::getStopwatchList()
 
 //------------------------------------------------------------------------------
 Stopwatch::Stopwatch(const char* name) :
+    myStopwatchListHook(),
     myName(name),
     myPreemptedStopwatch(0),
     myIsFirstMeasurement(true),
@@ -88,9 +86,7 @@ Stopwatch::Stopwatch(const char* name) :
     myMaxElapsedTimeStamp(),
     myPreemptedTimeStamp()
 {
-    Stopwatch* pointer = this;
-
-    myStopwatchList.append(pointer);
+    myStopwatchList.append(*this);
 }
 
 //------------------------------------------------------------------------------
@@ -100,9 +96,7 @@ Stopwatch::Stopwatch(const char* name) :
 //------------------------------------------------------------------------------
 Stopwatch::~Stopwatch()
 {
-    Stopwatch* pointer = this;
-
-    myStopwatchList.remove(pointer);
+    myStopwatchList.remove(*this);
 }
 
 //------------------------------------------------------------------------------
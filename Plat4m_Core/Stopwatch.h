@@ -47,7 +47,7 @@
 //------------------------------------------------------------------------------
 
 #include <Plat4m_Core/TimeStamp.h>
-#include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IntrusiveList.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -62,13 +62,29 @@ namespace Plat4m
 
 class Stopwatch
 {
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    // Declared ahead of StopwatchList, which refers to it
+    IntrusiveListHook<Stopwatch> myStopwatchListHook;
+
 public:
 
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef IntrusiveList<Stopwatch, &Stopwatch::myStopwatchListHook>
+                                                                  StopwatchList;
+
     //--------------------------------------------------------------------------
     // Public static methods
     //--------------------------------------------------------------------------
 
-    static List<Stopwatch*>& getStopwatchList();
+    static StopwatchList& getStopwatchList();
 
     //--------------------------------------------------------------------------
     // Public pure virtual methods
@@ -120,9 +136,7 @@ private:
     // Private static data members
     //--------------------------------------------------------------------------
 
-    static List<Stopwatch*> myStopwatchList;
-
-    static List<Stopwatch*>::Iterator myStopwatchListIterator;
+    static StopwatchList myStopwatchList;
 
     static Stopwatch* myCurrentStopwatch;
 
@@ -134,12 +134,12 @@ void StopwatchStatisticsPrinter::printStopwatchStatistics()
     bytes.append("Stopwatch Statistics\n");
     bytes.append("--------------------\n\n");
 
-    List<Stopwatch*>::Iterator stopwatchIterator =
+    Stopwatch::StopwatchList::Iterator stopwatchIterator =
                                        Stopwatch::getStopwatchList().iterator();
 
     while (stopwatchIterator.hasCurrent())
     {
-        Stopwatch* stopwatch = stopwatchIterator.current();
+        Stopwatch* stopwatch = &(stopwatchIterator.current());
 
         const char* stopwatchName = stopwatch->getName();
 
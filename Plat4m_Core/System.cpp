@@ -98,6 +98,12 @@ Semaphore& System::createSemaphore(const uint32_t maxValue,
     return (myDriver->driverCreateSemaphore(maxValue, initialValue));
 }
 
+//------------------------------------------------------------------------------
+Executor& System::createExecutor(const uint32_t nWorkers)
+{
+    return (myDriver->driverCreateExecutor(nWorkers));
+}
+
 //------------------------------------------------------------------------------
 void System::run()
 {
@@ -266,6 +272,17 @@ void System::driverExitCriticalSection()
     // Do nothing
 }
 
+//------------------------------------------------------------------------------
+Executor& System::driverCreateExecutor(const uint32_t nWorkers)
+{
+    // Not implemented by subclass, default implementation
+
+    // Lock up, this System has no Executor driver
+    while (true)
+    {
+    }
+}
+
 //------------------------------------------------------------------------------
 // Protected constructors
 //------------------------------------------------------------------------------
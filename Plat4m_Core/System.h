@@ -55,6 +55,7 @@
 #include <Plat4m_Core/WaitCondition.h>
 #include <Plat4m_Core/Queue.h>
 #include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/Executor.h>
 #include <Plat4m_Core/MemoryAllocator.h>
 #include <Plat4m_Core/TimeStamp.h>
 
@@ -115,6 +116,12 @@ public:
     static Semaphore& createSemaphore(const std::uint32_t maxValue = 0,
                                       const std::uint32_t initialValue = 0);
 
+    ///
+    /// @brief Creates a pool of worker threads to run tasks on.
+    /// @param nWorkers Number of workers, 0 for one per CPU core.
+    ///
+    static Executor& createExecutor(const std::uint32_t nWorkers = 0);
+
     static void run();
     
     static bool isRunning();
@@ -198,6 +205,8 @@ public:
 
     virtual void driverExitCriticalSection();
 
+    virtual Executor& driverCreateExecutor(const std::uint32_t nWorkers);
+
 protected:
     
     //--------------------------------------------------------------------------
@@ -139,6 +139,52 @@ public:
         xQueueReset(myQueueHandle);
     }
 
+    //--------------------------------------------------------------------------
+    virtual uint32_t driverDequeueBatch(void* values,
+                                        const uint32_t valueSizeBytes,
+                                        const uint32_t nMaxValues) override
+    {
+        // Called from tasks, so unlike the default this stays off the FromISR
+        // calls the fast hooks make
+        uint8_t* bytes = static_cast<uint8_t*>(values);
+
+        if ((nMaxValues == 0) || !driverDequeue(bytes))
+        {
+            return 0;
+        }
+
+        uint32_t nValues = 1;
+
+        while ((nValues < nMaxValues) &&
+               xQueueReceive(myQueueHandle,
+                             bytes + (nValues * valueSizeBytes),
+                             0))
+        {
+            nValues++;
+        }
+
+        return nValues;
+    }
+
+    //--------------------------------------------------------------------------
+    virtual uint32_t driverEnqueueBatch(const void* values,
+                                        const uint32_t valueSizeBytes,
+                                        const uint32_t nValues) override
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(values);
+        uint32_t nEnqueuedValues = 0;
+
+        while ((nEnqueuedValues < nValues) &&
+               xQueueSendToBack(myQueueHandle,
+                                bytes + (nEnqueuedValues * valueSizeBytes),
+                                0))
+        {
+            nEnqueuedValues++;
+        }
+
+        return nEnqueuedValues;
+    }
+
 private:
 
     //--------------------------------------------------------------------------
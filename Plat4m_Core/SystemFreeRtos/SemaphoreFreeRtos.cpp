@@ -86,9 +86,19 @@ SemaphoreFreeRtos::~SemaphoreFreeRtos()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-Semaphore::Error SemaphoreFreeRtos::driverWait()
+Semaphore::Error SemaphoreFreeRtos::driverWait(const TimeMs waitTimeMs)
 {
-    xSemaphoreTake(mySemaphoreHandle, portMAX_DELAY);
+    TickType_t waitTimeTicks = (TickType_t) waitTimeMs;
+
+    if (waitTimeMs == 0xFFFFFFFF)
+    {
+        waitTimeTicks = portMAX_DELAY;
+    }
+
+    if (xSemaphoreTake(mySemaphoreHandle, waitTimeTicks) != pdTRUE)
+    {
+        return Semaphore::Error(Semaphore::ERROR_CODE_TIMEOUT);
+    }
 
     return Semaphore::Error(Semaphore::ERROR_CODE_NONE);
 }
@@ -93,7 +93,7 @@ private:
     // Private virtual methods overridden for Semaphore
     //--------------------------------------------------------------------------
 
-    virtual Error driverWait() override;
+    virtual Error driverWait(const TimeMs waitTimeMs) override;
 
     virtual Error driverPost() override;
 
@@ -91,7 +91,10 @@ void WaitConditionFreeRtos::notifyFast()
 //------------------------------------------------------------------------------
 WaitCondition::Error WaitConditionFreeRtos::driverWait(const TimeMs waitTimeMs)
 {
-    ulTaskNotifyTake(pdFALSE, (TickType_t) waitTimeMs);
+    if (ulTaskNotifyTake(pdFALSE, (TickType_t) waitTimeMs) == 0)
+    {
+        return Error(ERROR_CODE_TIMEOUT);
+    }
 
     return Error(ERROR_CODE_NONE);
 }
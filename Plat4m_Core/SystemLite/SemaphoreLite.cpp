@@ -78,13 +78,16 @@ SemaphoreLite::~SemaphoreLite()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-Semaphore::Error SemaphoreLite::driverWait()
+Semaphore::Error SemaphoreLite::driverWait(const TimeMs waitTimeMs)
 {
-	if (myValue > 0)
+    // No scheduler to block on, fail immediately if the semaphore isn't posted
+    if (myValue == 0)
     {
-        myValue--;
+        return Error(ERROR_CODE_TIMEOUT);
     }
 
+    myValue--;
+
     return Error(ERROR_CODE_NONE);
 }
 
@@ -82,11 +82,17 @@ SemaphoreWindows::~SemaphoreWindows()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-Semaphore::Error SemaphoreWindows::driverWait()
+Semaphore::Error SemaphoreWindows::driverWait(const TimeMs waitTimeMs)
 {
-    WORD dwWaitResult;
+    DWORD dwWaitResult;
+
+    // INFINITE is 0xFFFFFFFF, same as the default wait time
+    dwWaitResult = WaitForSingleObject(mySemaphoreHandle, waitTimeMs);
 
-    dwWaitResult = WaitForSingleObject(mySemaphoreHandle, INFINITE);
+    if (dwWaitResult == WAIT_TIMEOUT)
+    {
+        return Error(ERROR_CODE_TIMEOUT);
+    }
 
     return Error(ERROR_CODE_NONE);
 }
@@ -80,6 +80,12 @@ void Thread::setPeriodMs(const TimeMs periodMs)
     driverSetPeriodMs(periodMs);
 }
 
+//------------------------------------------------------------------------------
+uint32_t Thread::getPriority() const
+{
+    return myPriority;
+}
+
 //------------------------------------------------------------------------------
 void Thread::setPriority(const uint32_t priority)
 {
@@ -47,16 +47,33 @@
 //------------------------------------------------------------------------------
 
 #include <new>
+#include <atomic>
 #include <cstdint>
 
 #include <Plat4m_Core/TopicBase.h>
 #include <Plat4m_Core/Callback.h>
-#include <Plat4m_Core/List.h>
+#include <Plat4m_Core/ArrayList.h>
 #include <Plat4m_Core/System.h>
 #include <Plat4m_Core/TimeStamp.h>
 #include <Plat4m_Core/MemoryAllocator.h>
 #include <Plat4m_Core/TopicManager.h>
 #include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/TopicSampleBatch.h>
+#include <Plat4m_Core/TopicSamplePool.h>
+#include <Plat4m_Core/TopicHistory.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of subscribers a Topic stores inline. Subscribers beyond
+/// this are moved to allocated memory. Can be overridden in
+/// Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_INLINE_SUBSCRIBERS
+#define PLAT4M_TOPIC_INLINE_SUBSCRIBERS 8
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -65,6 +82,13 @@
 namespace Plat4m
 {
 
+//------------------------------------------------------------------------------
+// Forward class declarations
+//------------------------------------------------------------------------------
+
+template <TopicBase::Id IdValue, typename DataType>
+class TopicDescriptor;
+
 //------------------------------------------------------------------------------
 // Classes
 //------------------------------------------------------------------------------
@@ -80,6 +104,11 @@ public:
 
     typedef Callback<void, const TopicSample<DataType>&> SampleCallback;
 
+    typedef Callback<void, const TopicSampleBatch<DataType>&>
+                                                            SampleBatchCallback;
+
+    typedef typename TopicHistory<DataType>::Sample HistorySample;
+
     //--------------------------------------------------------------------------
     // Public static methods
     //--------------------------------------------------------------------------
@@ -94,18 +123,32 @@ public:
 
     //--------------------------------------------------------------------------
     static void subscribe(const TopicBase::Id id,
-                          SampleCallback& sampleCallback)
+                          SampleCallback& sampleCallback,
+                          const std::uint32_t nReplaySamples = 0)
     {
         Topic* topic = findOrCreate(id);
 
-        topic->subscribe(sampleCallback);
+        topic->subscribe(sampleCallback, nReplaySamples);
+    }
+
+    //--------------------------------------------------------------------------
+    static void replay(const TopicBase::Id id,
+                       SampleCallback& sampleCallback,
+                       const std::uint32_t nReplaySamples)
+    {
+        Topic* topic = find(id);
+
+        if (isValidPointer(topic))
+        {
+            topic->replay(sampleCallback, nReplaySamples);
+        }
     }
 
     //--------------------------------------------------------------------------
     static void unsubscribe(const TopicBase::Id id,
                             SampleCallback& sampleCallback)
     {
-        Topic* topic = static_cast<Topic*>(TopicManager::find(id));
+        Topic* topic = find(id);
 
         if (isValidPointer(topic))
         {
@@ -113,6 +156,56 @@ public:
         }
     }
 
+    //--------------------------------------------------------------------------
+    static void subscribe(const TopicBase::Id id,
+                          SampleBatchCallback& sampleBatchCallback)
+    {
+        Topic* topic = findOrCreate(id);
+
+        topic->subscribe(sampleBatchCallback);
+    }
+
+    //--------------------------------------------------------------------------
+    static void unsubscribe(const TopicBase::Id id,
+                            SampleBatchCallback& sampleBatchCallback)
+    {
+        Topic* topic = find(id);
+
+        if (isValidPointer(topic))
+        {
+            topic->unsubscribe(sampleBatchCallback);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    static void reserveSamples(const TopicBase::Id id,
+                               const std::uint32_t nSamples)
+    {
+        Topic* topic = findOrCreate(id);
+
+        topic->reserveSamples(nSamples);
+    }
+
+    //--------------------------------------------------------------------------
+    static void unreserveSamples(const TopicBase::Id id,
+                                 const std::uint32_t nSamples)
+    {
+        Topic* topic = find(id);
+
+        if (isValidPointer(topic))
+        {
+            topic->unreserveSamples(nSamples);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    static void enableHistory(const TopicBase::Id id, const std::uint32_t depth)
+    {
+        Topic* topic = findOrCreate(id);
+
+        topic->enableHistory(depth);
+    }
+
     //--------------------------------------------------------------------------
     // Public virtual destructors
     //--------------------------------------------------------------------------
@@ -129,15 +222,45 @@ public:
     // Public methods
     //--------------------------------------------------------------------------
 
-    //--------------------------------------------------------------------------
-    void subscribe(SampleCallback& sampleCallback)
+    ///
+    /// @brief Subscribes to samples.
+    /// @param nReplaySamples Number of samples from the history to deliver to
+    /// the callback before it is subscribed, oldest first. See
+    /// enableHistory().
+    ///
+    void subscribe(SampleCallback& sampleCallback,
+                   const std::uint32_t nReplaySamples = 0)
     {
+        if ((nReplaySamples != 0) && myHistory.isEnabled())
+        {
+            replayHistory(sampleCallback, nReplaySamples);
+        }
+
         SampleCallback* pointer = &sampleCallback;
 
         mySampleCallbackList.append(pointer);
     }
 
-    //--------------------------------------------------------------------------
+    ///
+    /// @brief Delivers up to nReplaySamples samples from the history to a
+    /// callback, oldest first, without subscribing it. Does nothing when the
+    /// history is not enabled. See enableHistory().
+    ///
+    void replay(SampleCallback& sampleCallback,
+                const std::uint32_t nReplaySamples)
+    {
+        if ((nReplaySamples != 0) && myHistory.isEnabled())
+        {
+            replayHistory(sampleCallback, nReplaySamples);
+        }
+    }
+
+    ///
+    /// @brief Unsubscribes from samples. Safe to call from a subscriber's own
+    /// callback. Subscribing and unsubscribing may run on one thread while
+    /// another publishes, but a callback unsubscribed that way may still be
+    /// called by a publish already in progress.
+    ///
     void unsubscribe(SampleCallback& sampleCallback)
     {
         SampleCallback* pointer = &sampleCallback;
@@ -145,24 +268,220 @@ public:
         mySampleCallbackList.remove(pointer);
     }
 
+    ///
+    /// @brief Subscribes to whole batches of samples. Samples published one at
+    /// a time arrive as batches of 1.
+    ///
+    void subscribe(SampleBatchCallback& sampleBatchCallback)
+    {
+        SampleBatchCallback* pointer = &sampleBatchCallback;
+
+        mySampleBatchCallbackList.append(pointer);
+    }
+
+    //--------------------------------------------------------------------------
+    void unsubscribe(SampleBatchCallback& sampleBatchCallback)
+    {
+        SampleBatchCallback* pointer = &sampleBatchCallback;
+
+        mySampleBatchCallbackList.remove(pointer);
+    }
+
+    ///
+    /// @brief Reserves pooled samples for a subscriber that holds on to
+    /// samples after its callback returns. While any samples are reserved
+    /// publish() copies each sample once into the pool and every subscriber
+    /// shares that copy through TopicSample::slot.
+    /// @param nSamples Maximum number of samples the subscriber holds at once.
+    ///
+    void reserveSamples(const std::uint32_t nSamples)
+    {
+        mySamplePool.reserve(nSamples);
+    }
+
+    //--------------------------------------------------------------------------
+    void unreserveSamples(const std::uint32_t nSamples)
+    {
+        mySamplePool.unreserve(nSamples);
+    }
+
+    ///
+    /// @brief Returns the number of sample bytes publish() has copied, for
+    /// instrumentation.
+    ///
+    std::uint64_t getNSampleBytesCopied() const
+    {
+        return (myNSampleBytesCopied.load(std::memory_order_relaxed));
+    }
+
+    ///
+    /// @brief Keeps the last published samples so readers can get them
+    /// without subscribing, see getLatest() and getHistory(). Must be called
+    /// before the first publish, only the first call has any effect.
+    /// @param depth Number of samples to keep.
+    ///
+    void enableHistory(const std::uint32_t depth)
+    {
+        myHistory.setDepth(depth);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getHistoryDepth() const
+    {
+        return (myHistory.getDepth());
+    }
+
+    ///
+    /// @brief Copies the latest published sample. Safe to call from any
+    /// thread, never blocks the publisher.
+    /// @return False if the history is not enabled or nothing has been
+    /// published.
+    ///
+    bool getLatest(HistorySample& sample) const
+    {
+        return (myHistory.readLatest(sample));
+    }
+
+    ///
+    /// @brief Copies up to nSamples of the latest published samples, oldest
+    /// first. Safe to call from any thread, never blocks the publisher.
+    /// @return Number of samples copied.
+    ///
+    std::uint32_t getHistory(HistorySample* samples,
+                             const std::uint32_t nSamples) const
+    {
+        return (myHistory.readHistory(samples, nSamples));
+    }
+
     //--------------------------------------------------------------------------
     void publish(const DataType& sample)
     {
-        TopicSample<DataType> topicSample(sample);
+        const TimeStamp timeStamp = System::getTimeStamp();
+
+        if (myHistory.isEnabled())
+        {
+            myHistory.write(sample, mySequenceIdCounter, timeStamp);
+        }
+
+        publishSample(sample, mySequenceIdCounter, timeStamp);
+
+        if (!mySampleBatchCallbackList.isEmpty())
+        {
+            SampleBatch sampleBatch(&sample, 1);
+            sampleBatch.firstSequenceId = mySequenceIdCounter;
+            sampleBatch.firstTimeStamp  = timeStamp;
+
+            publishSampleBatch(sampleBatch);
+        }
+
+        mySequenceIdCounter++;
+        myLastTimeStamp = timeStamp;
+    }
+
+    ///
+    /// @brief Publishes a burst of samples (e.g. a sensor FIFO read) with one
+    /// time stamp read and one pass over the batch subscribers. Subscribers
+    /// of single samples get each sample in turn.
+    /// @param samples Samples, oldest first.
+    /// @param nSamples Number of samples.
+    /// @param samplePeriod Time between samples. The last sample is stamped
+    /// with the current time and the others are stamped samplePeriod apart
+    /// before it. If zero, the samples are spread evenly over the time since
+    /// the previous publish.
+    ///
+    void publishBatch(const DataType* samples,
+                      const std::uint32_t nSamples,
+                      const TimeStamp& samplePeriod = TimeStamp())
+    {
+        if (nSamples == 0)
+        {
+            return;
+        }
+
+        const TimeStamp timeStamp = System::getTimeStamp();
+
+        const std::int64_t timeNs = SampleBatch::toTimeNs(timeStamp);
+        std::int64_t samplePeriodNs = SampleBatch::toTimeNs(samplePeriod);
+
+        if ((samplePeriodNs == 0) && (myLastTimeStamp != TimeStamp()))
+        {
+            samplePeriodNs = (timeNs - SampleBatch::toTimeNs(myLastTimeStamp)) /
+                             nSamples;
+        }
+
+        SampleBatch sampleBatch(samples, nSamples);
+        sampleBatch.firstSequenceId = mySequenceIdCounter;
+        sampleBatch.samplePeriod    = SampleBatch::fromTimeNs(samplePeriodNs);
+        sampleBatch.firstTimeStamp  = SampleBatch::fromTimeNs(
+                                 timeNs - samplePeriodNs * (nSamples - 1));
+
+        if (myHistory.isEnabled())
+        {
+            for (std::uint32_t i = 0; i < nSamples; i++)
+            {
+                myHistory.write(samples[i],
+                                sampleBatch.getSequenceId(i),
+                                sampleBatch.getTimeStamp(i));
+            }
+        }
+
+        publishSampleBatch(sampleBatch);
 
-        publishPrivate(topicSample);
+        // Adapt the batch for subscribers of single samples
+        if (!mySampleCallbackList.isEmpty())
+        {
+            for (std::uint32_t i = 0; i < nSamples; i++)
+            {
+                publishSample(samples[i],
+                              sampleBatch.getSequenceId(i),
+                              sampleBatch.getTimeStamp(i));
+            }
+        }
+
+        mySequenceIdCounter += nSamples;
+        myLastTimeStamp = timeStamp;
     }
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private friend classes
+    //--------------------------------------------------------------------------
+
+    template <TopicBase::Id IdValue, typename TDataType>
+    friend class TopicDescriptor;
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    // Publishing walks the subscribers in contiguous memory, and the first
+    // PLAT4M_TOPIC_INLINE_SUBSCRIBERS of them don't need any allocation
+    typedef ArrayList<SampleCallback*, PLAT4M_TOPIC_INLINE_SUBSCRIBERS>
+                                                             SampleCallbackList;
+
+    typedef ArrayList<SampleBatchCallback*, 2> SampleBatchCallbackList;
+
+    typedef TopicSampleBatch<DataType> SampleBatch;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
 
-    List<SampleCallback*> mySampleCallbackList;
+    SampleCallbackList mySampleCallbackList;
+
+    SampleBatchCallbackList mySampleBatchCallbackList;
 
     std::uint32_t mySequenceIdCounter;
 
+    TimeStamp myLastTimeStamp;
+
+    TopicSamplePool<DataType> mySamplePool;
+
+    std::atomic<std::uint64_t> myNSampleBytesCopied;
+
+    TopicHistory<DataType> myHistory;
+
     //--------------------------------------------------------------------------
     // Private static methods
     //--------------------------------------------------------------------------
@@ -170,26 +489,21 @@ private:
     //--------------------------------------------------------------------------
     static Topic* find(const TopicBase::Id id)
     {
-        Topic* topic = 0;
+        TopicBase* topicBase = 0;
 
-        TopicBase* topicBase = TopicManager::find(id);
+        Error error = TopicManager::find(id,
+                                         Plat4m::getTypeId<Topic>(),
+                                         topicBase);
 
-        if (isValidPointer(topicBase))
+        if (error.getCode() == TopicBase::ERROR_CODE_TOPIC_TYPE_ID_MISMATCH)
         {
-            topic = dynamic_cast<Topic*>(topicBase);
-
-            if (isNullPointer(topic))
+            // Lock up, error condition
+            while (true)
             {
-                Error error(TopicBase::ERROR_CODE_TOPIC_TYPE_ID_MISMATCH);
-
-                // Lock up, error condition
-                while (true)
-                {
-                }
             }
         }
 
-        return topic;
+        return static_cast<Topic*>(topicBase);
     }
 
     //--------------------------------------------------------------------------
@@ -221,9 +535,14 @@ private:
 
     //--------------------------------------------------------------------------
     Topic(const TopicBase::Id id) :
-        TopicBase(id),
+        TopicBase(id, Plat4m::getTypeId<Topic>()),
         mySampleCallbackList(),
-        mySequenceIdCounter(0)
+        mySampleBatchCallbackList(),
+        mySequenceIdCounter(0),
+        myLastTimeStamp(),
+        mySamplePool(),
+        myNSampleBytesCopied(0),
+        myHistory()
     {
         Topic* pointer = this;
 
@@ -232,9 +551,14 @@ private:
 
     //--------------------------------------------------------------------------
     Topic(const Topic& topic) :
-        TopicBase(topic.myId),
+        TopicBase(topic.getId(), topic.getTypeId()),
         mySampleCallbackList(topic.mySampleCallbackList),
-        mySequenceIdCounter(topic.mySequenceIdCounter)
+        mySampleBatchCallbackList(topic.mySampleBatchCallbackList),
+        mySequenceIdCounter(topic.mySequenceIdCounter),
+        myLastTimeStamp(topic.myLastTimeStamp),
+        mySamplePool(),
+        myNSampleBytesCopied(0),
+        myHistory()
     {
     }
 
@@ -243,12 +567,95 @@ private:
     //--------------------------------------------------------------------------
 
     //--------------------------------------------------------------------------
-    void publishPrivate(TopicSample<DataType>& sample)
+    void publishSample(const DataType& data,
+                       const std::uint32_t sequenceId,
+                       const TimeStamp& timeStamp)
     {
-        sample.sequenceId = mySequenceIdCounter;
-        sample.timeStamp = System::getTimeStamp();
+        if (mySampleCallbackList.isEmpty())
+        {
+            return;
+        }
+
+        if (mySamplePool.isReserved())
+        {
+            typename TopicSamplePool<DataType>::Slot* slot =
+                                                        mySamplePool.acquire();
+            slot->data       = data;
+            slot->sequenceId = sequenceId;
+            slot->timeStamp  = timeStamp;
+
+            myNSampleBytesCopied.fetch_add(sizeof(DataType),
+                                           std::memory_order_relaxed);
+
+            TopicSample<DataType> sample(slot->data, slot);
+            sample.sequenceId = sequenceId;
+            sample.timeStamp  = timeStamp;
+
+            callSampleCallbacks(sample);
+
+            // Subscribers that still need the sample have retained the slot
+            slot->release();
+        }
+        else
+        {
+            TopicSample<DataType> sample(data);
+            sample.sequenceId = sequenceId;
+            sample.timeStamp  = timeStamp;
+
+            callSampleCallbacks(sample);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void replayHistory(SampleCallback& sampleCallback,
+                       const std::uint32_t nReplaySamples)
+    {
+        const std::uint32_t nWrites = myHistory.getNWrites();
+        const std::uint32_t nHistorySamples =
+                         myHistory.getNHistorySamples(nWrites, nReplaySamples);
+
+        for (std::uint32_t i = nWrites - nHistorySamples; i < nWrites; i++)
+        {
+            HistorySample historySample;
+
+            if (!myHistory.read(i, historySample))
+            {
+                continue;
+            }
+
+            // Pooling subscribers only accept samples that carry a slot, the
+            // same as publishSample()
+            if (mySamplePool.isReserved())
+            {
+                typename TopicSamplePool<DataType>::Slot* slot =
+                                                        mySamplePool.acquire();
+                slot->data       = historySample.data;
+                slot->sequenceId = historySample.sequenceId;
+                slot->timeStamp  = historySample.timeStamp;
 
-        typename List<SampleCallback*>::Iterator iterator =
+                TopicSample<DataType> sample(slot->data, slot);
+                sample.sequenceId = historySample.sequenceId;
+                sample.timeStamp  = historySample.timeStamp;
+
+                sampleCallback.call(sample);
+
+                slot->release();
+            }
+            else
+            {
+                TopicSample<DataType> sample(historySample.data);
+                sample.sequenceId = historySample.sequenceId;
+                sample.timeStamp  = historySample.timeStamp;
+
+                sampleCallback.call(sample);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void callSampleCallbacks(const TopicSample<DataType>& sample)
+    {
+        typename SampleCallbackList::Iterator iterator =
                                                 mySampleCallbackList.iterator();
 
         while (iterator.hasCurrent())
@@ -256,10 +663,34 @@ private:
             SampleCallback* sampleCallback = iterator.current();
             sampleCallback->call(sample);
 
-            iterator.next();
+            // A subscriber that unsubscribed itself (or an earlier one) from
+            // its callback shifted the next one into the current place
+            if (iterator.hasCurrent() &&
+                (iterator.current() == sampleCallback))
+            {
+                iterator.next();
+            }
         }
+    }
 
-        mySequenceIdCounter++;
+    //--------------------------------------------------------------------------
+    void publishSampleBatch(const SampleBatch& sampleBatch)
+    {
+        typename SampleBatchCallbackList::Iterator iterator =
+                                           mySampleBatchCallbackList.iterator();
+
+        while (iterator.hasCurrent())
+        {
+            SampleBatchCallback* sampleBatchCallback = iterator.current();
+            sampleBatchCallback->call(sampleBatch);
+
+            // See callSampleCallbacks()
+            if (iterator.hasCurrent() &&
+                (iterator.current() == sampleBatchCallback))
+            {
+                iterator.next();
+            }
+        }
     }
 };
 
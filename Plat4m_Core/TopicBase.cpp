@@ -44,6 +44,7 @@
 //------------------------------------------------------------------------------
 
 #include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/TopicManager.h>
 
 using namespace Plat4m;
 
@@ -54,7 +55,17 @@ using namespace Plat4m;
 //------------------------------------------------------------------------------
 void TopicBase::setId(const Id id)
 {
+    if (id == myId)
+    {
+        return;
+    }
+
+    // Re-register so the TopicManager index is keyed by the new Id
+    TopicBase* pointer = this;
+
+    TopicManager::remove(*pointer);
     myId = id;
+    TopicManager::add(*pointer);
 }
 
 //------------------------------------------------------------------------------
@@ -63,6 +74,12 @@ Id TopicBase::getId() const
     return myId;
 }
 
+//------------------------------------------------------------------------------
+TypeId TopicBase::getTypeId() const
+{
+    return myTypeId;
+}
+
 //------------------------------------------------------------------------------
 // Public virtual destructors
 //------------------------------------------------------------------------------
@@ -77,7 +94,9 @@ TopicBase::~TopicBase()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-TopicBase::TopicBase(const Id id) :
-    myId(id)
+TopicBase::TopicBase(const Id id, const TypeId typeId) :
+    myId(id),
+    myTypeId(typeId),
+    myTopicListHook()
 {
 }
@@ -49,6 +49,8 @@
 #include <cstdint>
 
 #include <Plat4m_Core/ErrorTemplate.h>
+#include <Plat4m_Core/TypeId.h>
+#include <Plat4m_Core/IntrusiveList.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -80,6 +82,22 @@ public:
 
     typedef std::uint32_t Id;
 
+    ///
+    /// @brief What a queued subscriber does with a new sample when its queue
+    /// is already full.
+    ///
+    enum OverflowPolicy
+    {
+        /// Discard the new sample
+        OVERFLOW_POLICY_DROP_NEWEST = 0,
+        /// Discard the oldest queued sample to make room for the new one
+        OVERFLOW_POLICY_DROP_OLDEST,
+        /// Keep only the newest sample, replacing any undelivered one
+        OVERFLOW_POLICY_KEEP_LATEST,
+        /// Block the publisher until the subscriber frees up room
+        OVERFLOW_POLICY_BLOCK_PUBLISHER
+    };
+
     //--------------------------------------------------------------------------
     // Public destructors
     //--------------------------------------------------------------------------
@@ -94,21 +112,33 @@ public:
 
     TopicBase::Id getId() const;
 
+    TypeId getTypeId() const;
+
 protected:
 
     //--------------------------------------------------------------------------
     // Protected constructors
     //--------------------------------------------------------------------------
 
-    TopicBase(const Id id);
+    TopicBase(const Id id, const TypeId typeId);
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private friend classes
+    //--------------------------------------------------------------------------
+
+    friend class TopicManager;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
 
     Id myId;
+
+    const TypeId myTypeId;
+
+    IntrusiveListHook<TopicBase> myTopicListHook;
 };
 
 }; // namespace Plat4m
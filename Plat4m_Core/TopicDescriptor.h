@@ -0,0 +1,246 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicDescriptor.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicDescriptor class header file.
+///
+
+#ifndef PLAT4M_TOPIC_DESCRIPTOR_H
+#define PLAT4M_TOPIC_DESCRIPTOR_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <new>
+#include <cstdint>
+
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Claims the Id of the given TopicDescriptor for its data type. Must
+/// appear once per Id in the whole program, at namespace scope and before the
+/// descriptor is used in that file. Claiming an Id twice fails to link with a
+/// multiple definition error, using a descriptor whose Id was never claimed or
+/// was claimed for another data type fails to link with an undefined
+/// reference.
+///
+#define PLAT4M_TOPIC_DESCRIPTOR_DEFINE(...)                                    \
+    template <>                                                                \
+    const Plat4m::TopicBase::Id                                                \
+                   Plat4m::TopicIdOwner<__VA_ARGS__::id>::id = __VA_ARGS__::id;\
+                                                                               \
+    template <>                                                                \
+    template <>                                                                \
+    const Plat4m::TopicBase::Id                                                \
+        Plat4m::TopicIdOwner<__VA_ARGS__::id>::typedId<__VA_ARGS__::Type> =    \
+                                                                __VA_ARGS__::id
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Link time owner of a Topic Id. Only declared here, each Id and the
+/// data type it was claimed for are defined by
+/// PLAT4M_TOPIC_DESCRIPTOR_DEFINE().
+///
+template <TopicBase::Id IdValue>
+class TopicIdOwner
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public static data members
+    //--------------------------------------------------------------------------
+
+    // Defined once per Id whatever the data type
+    static const TopicBase::Id id;
+
+    // Defined only for the data type the Id was claimed for
+    template <typename DataType>
+    static const TopicBase::Id typedId;
+};
+
+///
+/// @brief Topic Id and data type fixed at compile time. The Topic lives in
+/// storage owned by the descriptor and is resolved once per TopicManager, so
+/// publishing through a descriptor skips the Id lookup and the TypeId check.
+///
+template <TopicBase::Id IdValue, typename DataType>
+class TopicDescriptor
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef DataType Type;
+
+    typedef Topic<DataType> TopicType;
+
+    typedef typename TopicType::SampleCallback SampleCallback;
+
+    typedef typename TopicType::SampleBatchCallback SampleBatchCallback;
+
+    //--------------------------------------------------------------------------
+    // Public static data members
+    //--------------------------------------------------------------------------
+
+    static constexpr TopicBase::Id id = IdValue;
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static TopicType& get()
+    {
+        if (myGeneration != TopicManager::getGeneration())
+        {
+            resolve();
+        }
+
+        return (*myTopic);
+    }
+
+    //--------------------------------------------------------------------------
+    static void publish(const DataType& sample)
+    {
+        get().publish(sample);
+    }
+
+    //--------------------------------------------------------------------------
+    static void subscribe(SampleCallback& sampleCallback,
+                          const std::uint32_t nReplaySamples = 0)
+    {
+        get().subscribe(sampleCallback, nReplaySamples);
+    }
+
+    //--------------------------------------------------------------------------
+    static void unsubscribe(SampleCallback& sampleCallback)
+    {
+        get().unsubscribe(sampleCallback);
+    }
+
+    //--------------------------------------------------------------------------
+    static void subscribe(SampleBatchCallback& sampleBatchCallback)
+    {
+        get().subscribe(sampleBatchCallback);
+    }
+
+    //--------------------------------------------------------------------------
+    static void unsubscribe(SampleBatchCallback& sampleBatchCallback)
+    {
+        get().unsubscribe(sampleBatchCallback);
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static TopicType* myTopic;
+
+    static std::uint32_t myGeneration;
+
+    alignas(TopicType) static std::uint8_t myStorage[sizeof(TopicType)];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static void resolve()
+    {
+        // Fails to link unless the Id was claimed for this data type
+        const TopicBase::Id id =
+                          TopicIdOwner<IdValue>::template typedId<DataType>;
+
+        // A Topic created by Id before the descriptor was first used is
+        // adopted, otherwise the descriptor's own storage is used
+        TopicType* topic = TopicType::find(id);
+
+        if (isNullPointer(topic))
+        {
+            topic = new(myStorage) TopicType(id);
+        }
+
+        myTopic = topic;
+        myGeneration = TopicManager::getGeneration();
+    }
+};
+
+//------------------------------------------------------------------------------
+// Static data members
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+template <TopicBase::Id IdValue, typename DataType>
+constexpr TopicBase::Id TopicDescriptor<IdValue, DataType>::id;
+
+//------------------------------------------------------------------------------
+template <TopicBase::Id IdValue, typename DataType>
+Topic<DataType>* TopicDescriptor<IdValue, DataType>::myTopic = 0;
+
+//------------------------------------------------------------------------------
+template <TopicBase::Id IdValue, typename DataType>
+std::uint32_t TopicDescriptor<IdValue, DataType>::myGeneration = 0;
+
+//------------------------------------------------------------------------------
+template <TopicBase::Id IdValue, typename DataType>
+alignas(Topic<DataType>) std::uint8_t
+         TopicDescriptor<IdValue, DataType>::myStorage[sizeof(Topic<DataType>)];
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_DESCRIPTOR_H
@@ -0,0 +1,371 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicHistory.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicHistory class header file.
+///
+
+#ifndef PLAT4M_TOPIC_HISTORY_H
+#define PLAT4M_TOPIC_HISTORY_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/TimeStamp.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Ring buffer of the last samples published on a Topic. There is a
+/// single writer (the publisher) and any number of readers on other threads.
+/// Readers never block the writer, each entry carries a version that is odd
+/// while the entry is being written and otherwise identifies which write the
+/// entry holds, readers copy an entry and retry if the version changed.
+/// Readers require DataType to be trivially copyable since they may copy an
+/// entry while it is being overwritten.
+///
+template <typename DataType>
+class TopicHistory
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    struct Sample
+    {
+        std::uint32_t sequenceId;
+        TimeStamp timeStamp;
+        DataType data;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicHistory() :
+        myEntries(0),
+        myDepth(0),
+        myNWrites(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ~TopicHistory()
+    {
+        if (isValidPointer(myEntries))
+        {
+            for (std::uint32_t i = 0; i < myDepth; i++)
+            {
+                myEntries[i].~Entry();
+            }
+
+            MemoryAllocator::deallocateArray(myEntries);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Allocates the ring buffer. Must be called before the first
+    /// write(), only the first call has any effect.
+    /// @param depth Number of samples to keep.
+    ///
+    void setDepth(const std::uint32_t depth)
+    {
+        static_assert(std::is_trivially_copyable<DataType>::value,
+                      "TopicHistory readers require trivially copyable data");
+
+        if ((myDepth != 0) || (depth == 0))
+        {
+            return;
+        }
+
+        void* memoryPointer =
+                          MemoryAllocator::allocateArray(sizeof(Entry) * depth);
+        myEntries = static_cast<Entry*>(memoryPointer);
+
+        for (std::uint32_t i = 0; i < depth; i++)
+        {
+            new(&(myEntries[i])) Entry();
+        }
+
+        myDepth = depth;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getDepth() const
+    {
+        return myDepth;
+    }
+
+    //--------------------------------------------------------------------------
+    bool isEnabled() const
+    {
+        return (myDepth != 0);
+    }
+
+    ///
+    /// @brief Returns the total number of samples written. The samples still
+    /// held are write indexes max(0, nWrites - depth) to nWrites - 1.
+    ///
+    std::uint32_t getNWrites() const
+    {
+        return (myNWrites.load(std::memory_order_acquire));
+    }
+
+    ///
+    /// @brief Stores a sample, overwriting the oldest once the buffer is full.
+    /// Only the publisher may call this.
+    ///
+    void write(const DataType& data,
+               const std::uint32_t sequenceId,
+               const TimeStamp& timeStamp)
+    {
+        const std::uint32_t writeIndex =
+                                     myNWrites.load(std::memory_order_relaxed);
+        Entry& entry = myEntries[writeIndex % myDepth];
+
+        entry.version.store(getVersion(writeIndex) - 1,
+                            std::memory_order_relaxed);
+
+        // Readers that see the new data also see the odd version
+        std::atomic_thread_fence(std::memory_order_release);
+
+        entry.sample.sequenceId = sequenceId;
+        entry.sample.timeStamp  = timeStamp;
+        entry.sample.data       = data;
+
+        entry.version.store(getVersion(writeIndex), std::memory_order_release);
+        myNWrites.store(writeIndex + 1, std::memory_order_release);
+    }
+
+    ///
+    /// @brief Copies the sample with the given write index.
+    /// @return False if the sample has been overwritten or not written yet.
+    ///
+    bool read(const std::uint32_t writeIndex, Sample& sample) const
+    {
+        const Entry& entry = myEntries[writeIndex % myDepth];
+        const std::uint32_t version = getVersion(writeIndex);
+
+        while (true)
+        {
+            const std::uint32_t firstVersion =
+                                  entry.version.load(std::memory_order_acquire);
+
+            if ((firstVersion != version) && (firstVersion != (version - 1)))
+            {
+                return false;
+            }
+
+            if (firstVersion == version)
+            {
+                sample = entry.sample;
+
+                // The copy completes before the version is checked again
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (entry.version.load(std::memory_order_relaxed) == version)
+                {
+                    return true;
+                }
+            }
+
+            // Entry is being written, retry
+        }
+    }
+
+    ///
+    /// @brief Copies the latest sample.
+    /// @return False if no sample has been written.
+    ///
+    bool readLatest(Sample& sample) const
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        while (true)
+        {
+            const std::uint32_t nWrites = getNWrites();
+
+            if (nWrites == 0)
+            {
+                return false;
+            }
+
+            if (read(nWrites - 1, sample))
+            {
+                return true;
+            }
+
+            // Overwritten while being read, a newer sample is available
+        }
+    }
+
+    ///
+    /// @brief Copies up to the given number of latest samples, oldest first.
+    /// Samples that are overwritten while being read are skipped.
+    /// @return Number of samples copied.
+    ///
+    std::uint32_t readHistory(Sample* samples,
+                              const std::uint32_t nSamples) const
+    {
+        if (!isEnabled())
+        {
+            return 0;
+        }
+
+        const std::uint32_t nWrites = getNWrites();
+        const std::uint32_t nHistorySamples = getNHistorySamples(nWrites,
+                                                                 nSamples);
+        std::uint32_t nSamplesRead = 0;
+
+        for (std::uint32_t i = nWrites - nHistorySamples; i < nWrites; i++)
+        {
+            if (read(i, samples[nSamplesRead]))
+            {
+                nSamplesRead++;
+            }
+        }
+
+        return nSamplesRead;
+    }
+
+    ///
+    /// @brief Returns how many of the given number of latest samples are
+    /// still held after the given number of writes.
+    ///
+    std::uint32_t getNHistorySamples(const std::uint32_t nWrites,
+                                     const std::uint32_t nSamples) const
+    {
+        std::uint32_t nHistorySamples = nSamples;
+
+        if (nHistorySamples > myDepth)
+        {
+            nHistorySamples = myDepth;
+        }
+
+        if (nHistorySamples > nWrites)
+        {
+            nHistorySamples = nWrites;
+        }
+
+        return nHistorySamples;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    struct Entry
+    {
+        std::atomic<std::uint32_t> version;
+        Sample sample;
+
+        //----------------------------------------------------------------------
+        Entry() :
+            version(0),
+            sample()
+        {
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    Entry* myEntries;
+
+    std::uint32_t myDepth;
+
+    std::atomic<std::uint32_t> myNWrites;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Returns the version of an entry once the write with the given
+    /// index is complete. Unwritten entries have version 0, which no write
+    /// index maps to until the index wraps at 2^31.
+    ///
+    static std::uint32_t getVersion(const std::uint32_t writeIndex)
+    {
+        return ((writeIndex + 1) * 2);
+    }
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicHistory(const TopicHistory<DataType>& topicHistory);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_HISTORY_H
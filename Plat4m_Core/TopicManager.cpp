@@ -53,6 +53,8 @@ using namespace Plat4m;
 
 TopicManager* TopicManager::myInstance = 0;
 
+std::uint32_t TopicManager::myGeneration = 1;
+
 //------------------------------------------------------------------------------
 // Public static methods
 //------------------------------------------------------------------------------
@@ -102,7 +104,29 @@ TopicBase* TopicManager::find(const TopicBase::Id id)
         }
     }
 
-    return (myInstance->findPrivate(id));
+    TopicBase* topic = 0;
+
+    myInstance->findPrivate(id, 0, topic);
+
+    return topic;
+}
+
+//------------------------------------------------------------------------------
+TopicBase::Error TopicManager::find(const TopicBase::Id id,
+                                    const TypeId typeId,
+                                    TopicBase*& topic)
+{
+    if (isNullPointer(myInstance))
+    {
+        Error error(ERROR_CODE_INSTANCE_NOT_CREATED);
+
+        // Lock up
+        while (true)
+        {
+        }
+    }
+
+    return (myInstance->findPrivate(id, typeId, topic));
 }
 
 //------------------------------------------------------------------------------
@@ -110,7 +134,10 @@ TopicBase* TopicManager::find(const TopicBase::Id id)
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-TopicManager::TopicManager()
+TopicManager::TopicManager() :
+    myTopicList(),
+    myTopicIndex(),
+    myIsTopicIndexIncomplete(false)
 {
     if (isValidPointer(myInstance))
     {
@@ -123,6 +150,7 @@ TopicManager::TopicManager()
     }
 
     myInstance = this;
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
@@ -132,18 +160,20 @@ TopicManager::TopicManager()
 //------------------------------------------------------------------------------
 TopicManager::~TopicManager()
 {
-    typename List<TopicBase*>::Iterator iterator = myTopicList.iterator();
+    TopicList::Iterator iterator = myTopicList.iterator();
 
     while (iterator.hasCurrent())
     {
-        TopicBase* topic = iterator.current();
-        
-        topic->~TopicBase();
+        TopicBase& topic = iterator.current();
 
+        // Destroying the topic removes it from the list
         iterator.next();
+
+        topic.~TopicBase();
     }
 
     myInstance = 0;
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
@@ -155,7 +185,18 @@ void TopicManager::addPrivate(TopicBase& topic)
 {
     TopicBase* pointer = &topic;
 
-    myTopicList.append(pointer);
+    myTopicList.append(topic);
+
+    TopicIndex::Error error = myTopicIndex.insert(pointer->getId(),
+                                                  pointer,
+                                                  pointer->getTypeId());
+
+    if (error.getCode() != TopicIndex::ERROR_CODE_NONE)
+    {
+        // Index is full or the Id is a duplicate, fall back to searching the
+        // list for anything that misses in the index
+        myIsTopicIndexIncomplete = true;
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -163,29 +204,68 @@ void TopicManager::removePrivate(TopicBase& topic)
 {
     TopicBase* pointer = &topic;
 
-    myTopicList.remove(pointer);
+    myTopicList.remove(topic);
+
+    TopicBase* indexedTopic = 0;
+
+    TopicIndex::Error error =
+                              myTopicIndex.find(pointer->getId(), indexedTopic);
+
+    if ((error.getCode() == TopicIndex::ERROR_CODE_NONE) &&
+        (indexedTopic == pointer))
+    {
+        myTopicIndex.remove(pointer->getId());
+    }
+
+    if (myTopicList.size() == 0)
+    {
+        myIsTopicIndexIncomplete = false;
+    }
+
+    myGeneration++;
 }
 
 //------------------------------------------------------------------------------
-TopicBase* TopicManager::findPrivate(const TopicBase::Id id)
+TopicBase::Error TopicManager::findPrivate(const TopicBase::Id id,
+                                           const TypeId typeId,
+                                           TopicBase*& topic)
 {
-    TopicBase* existingTopic = 0;
+    TopicIndex::Error error = myTopicIndex.find(id, topic, typeId);
 
-    typename List<TopicBase*>::Iterator iterator = myTopicList.iterator();
+    if (error.getCode() == TopicIndex::ERROR_CODE_NONE)
+    {
+        return TopicBase::Error(TopicBase::ERROR_CODE_NONE);
+    }
 
-    while (iterator.hasCurrent())
+    if (error.getCode() == TopicIndex::ERROR_CODE_TYPE_ID_MISMATCH)
     {
-        TopicBase* topic = iterator.current();
-        
-        if (topic->getId() == id)
+        return TopicBase::Error(TopicBase::ERROR_CODE_TOPIC_TYPE_ID_MISMATCH);
+    }
+
+    if (myIsTopicIndexIncomplete)
+    {
+        TopicList::Iterator iterator = myTopicList.iterator();
+
+        while (iterator.hasCurrent())
         {
-            existingTopic = topic;
+            TopicBase* existingTopic = &(iterator.current());
 
-            break;
-        }
+            if (existingTopic->getId() == id)
+            {
+                if ((typeId != 0) && (existingTopic->getTypeId() != typeId))
+                {
+                    return TopicBase::Error(
+                           TopicBase::ERROR_CODE_TOPIC_TYPE_ID_MISMATCH);
+                }
 
-        iterator.next();
+                topic = existingTopic;
+
+                return TopicBase::Error(TopicBase::ERROR_CODE_NONE);
+            }
+
+            iterator.next();
+        }
     }
 
-    return existingTopic;
+    return TopicBase::Error(TopicBase::ERROR_CODE_TOPIC_INVALID);
 }
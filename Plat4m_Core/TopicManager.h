@@ -46,9 +46,26 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include <Plat4m_Core/ErrorTemplate.h>
 #include <Plat4m_Core/TopicBase.h>
-#include <Plat4m_Core/List.h>
+#include <Plat4m_Core/IntrusiveList.h>
+#include <Plat4m_Core/IdHashIndexN.h>
+#include <Plat4m_Core/TypeId.h>
+
+//------------------------------------------------------------------------------
+// Defines
+//------------------------------------------------------------------------------
+
+///
+/// @brief Number of entries in the TopicManager Id hash index. Must be a
+/// power of 2, up to 3/4 of it can be indexed. Topics beyond that are still
+/// found by a linear search. Can be overridden in Plat4mCoreConfig.h.
+///
+#ifndef PLAT4M_TOPIC_MANAGER_INDEX_SIZE
+#define PLAT4M_TOPIC_MANAGER_INDEX_SIZE 64
+#endif
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -88,6 +105,21 @@ public:
 
     static TopicBase* find(const TopicBase::Id id);
 
+    static TopicBase::Error find(const TopicBase::Id id,
+                                 const TypeId typeId,
+                                 TopicBase*& topic);
+
+    ///
+    /// @brief Returns a counter that changes whenever a Topic is removed or
+    /// the TopicManager is created or destroyed, so a cached Topic pointer is
+    /// only valid while the generation it was resolved in is current.
+    /// @return Current generation.
+    ///
+    static std::uint32_t getGeneration()
+    {
+        return myGeneration;
+    }
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
@@ -102,17 +134,33 @@ public:
 
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef IdHashIndexN<TopicBase*, PLAT4M_TOPIC_MANAGER_INDEX_SIZE>
+                                                                     TopicIndex;
+
+    // Topics link themselves in, so adding one never allocates
+    typedef IntrusiveList<TopicBase, &TopicBase::myTopicListHook> TopicList;
+
     //--------------------------------------------------------------------------
     // Private static data members
     //--------------------------------------------------------------------------
 
     static TopicManager* myInstance;
 
+    static std::uint32_t myGeneration;
+
     //--------------------------------------------------------------------------
     // Private data members
     //--------------------------------------------------------------------------
 
-    List<TopicBase*> myTopicList;
+    TopicList myTopicList;
+
+    TopicIndex myTopicIndex;
+
+    bool myIsTopicIndexIncomplete;
 
     //--------------------------------------------------------------------------
     // Private methods
@@ -122,7 +170,9 @@ private:
 
     void removePrivate(TopicBase& topic);
 
-    TopicBase* findPrivate(const TopicBase::Id id);
+    TopicBase::Error findPrivate(const TopicBase::Id id,
+                                 const TypeId typeId,
+                                 TopicBase*& topic);
 };
 
 }; // namespace Plat4m
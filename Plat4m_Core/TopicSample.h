@@ -49,6 +49,7 @@
 #include <cstdint>
 
 #include <Plat4m_Core/TimeStamp.h>
+#include <Plat4m_Core/TopicSampleSlot.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -68,15 +69,23 @@ struct TopicSample
     TimeStamp timeStamp;
     const DataType& data;
 
+    ///
+    /// @brief Pooled copy data refers to, or 0 if data refers to the
+    /// publisher's object. Subscribers that need the sample after their
+    /// callback returns must retain() it and release() it when done.
+    ///
+    TopicSampleSlot<DataType>* slot;
+
     //--------------------------------------------------------------------------
     // Public constructors
     //--------------------------------------------------------------------------
 
     //--------------------------------------------------------------------------
-    TopicSample(const DataType& data) :
+    TopicSample(const DataType& data, TopicSampleSlot<DataType>* slot = 0) :
         sequenceId(0),
         timeStamp(),
-        data(data)
+        data(data),
+        slot(slot)
     {
     }
 };
@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSampleBatch.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSampleBatch struct header file.
+///
+
+#ifndef PLAT4M_TOPIC_SAMPLE_BATCH_H
+#define PLAT4M_TOPIC_SAMPLE_BATCH_H
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/TimeStamp.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Structs
+//------------------------------------------------------------------------------
+
+///
+/// @brief Contiguous samples published together by Topic::publishBatch().
+/// Sample i has sequence Id firstSequenceId + i and was taken at
+/// firstTimeStamp + i * samplePeriod. data refers to the publisher's samples
+/// and is only valid during the callback.
+///
+template <typename DataType>
+struct TopicSampleBatch
+{
+    std::uint32_t firstSequenceId;
+    TimeStamp firstTimeStamp;
+    TimeStamp samplePeriod;
+    const DataType* data;
+    std::uint32_t nSamples;
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    static std::int64_t toTimeNs(const TimeStamp& timeStamp)
+    {
+        return (static_cast<std::int64_t>(timeStamp.timeS) * 1000000000 +
+                timeStamp.timeNs);
+    }
+
+    //--------------------------------------------------------------------------
+    static TimeStamp fromTimeNs(const std::int64_t timeNs)
+    {
+        TimeStamp timeStamp;
+        timeStamp.timeS  = static_cast<TimeSSigned>(timeNs / 1000000000);
+        timeStamp.timeNs = static_cast<TimeNsSigned>(timeNs % 1000000000);
+
+        return timeStamp;
+    }
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicSampleBatch(const DataType* data, const std::uint32_t nSamples) :
+        firstSequenceId(0),
+        firstTimeStamp(),
+        samplePeriod(),
+        data(data),
+        nSamples(nSamples)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getSequenceId(const std::uint32_t index) const
+    {
+        return (firstSequenceId + index);
+    }
+
+    //--------------------------------------------------------------------------
+    TimeStamp getTimeStamp(const std::uint32_t index) const
+    {
+        return (fromTimeNs(toTimeNs(firstTimeStamp) +
+                           toTimeNs(samplePeriod) * index));
+    }
+};
+
+}; // end namespace Plat4m
+
+#endif // PLAT4M_TOPIC_SAMPLE_BATCH_H
@@ -0,0 +1,236 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSamplePool.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSamplePool class header file.
+///
+
+#ifndef PLAT4M_TOPIC_SAMPLE_POOL_H
+#define PLAT4M_TOPIC_SAMPLE_POOL_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/TopicSampleSlot.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Pool of reference counted TopicSampleSlots used by Topic to share a
+/// single copy of each published sample between all subscribers that hold on
+/// to it after the publish call returns (e.g. TopicSubscriberThread).
+/// Subscribers reserve the number of slots they can hold at once, slots are
+/// allocated up front so acquire() normally never allocates. If more slots
+/// are in flight than were reserved (e.g. concurrent publishers) the pool
+/// grows by one slot, slots are never freed until the pool is destroyed.
+///
+template <typename DataType>
+class TopicSamplePool
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    typedef TopicSampleSlot<DataType> Slot;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicSamplePool() :
+        myFirstSlot(0),
+        myNSlots(0),
+        myNReservedSlots(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    ~TopicSamplePool()
+    {
+        Slot* slot = myFirstSlot.load(std::memory_order_acquire);
+
+        while (isValidPointer(slot))
+        {
+            Slot* nextSlot = slot->next;
+
+            slot->~Slot();
+            MemoryAllocator::deallocate(slot);
+
+            slot = nextSlot;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Reserves slots for a subscriber. One extra slot is always kept
+    /// for the publisher.
+    /// @param nSlots Maximum number of slots the subscriber can hold at once.
+    ///
+    void reserve(const std::uint32_t nSlots)
+    {
+        const std::uint32_t nReservedSlots =
+            myNReservedSlots.fetch_add(nSlots, std::memory_order_relaxed) +
+            nSlots;
+
+        while (myNSlots.load(std::memory_order_relaxed) < (nReservedSlots + 1))
+        {
+            addSlot(0);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void unreserve(const std::uint32_t nSlots)
+    {
+        myNReservedSlots.fetch_sub(nSlots, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    bool isReserved() const
+    {
+        return (myNReservedSlots.load(std::memory_order_relaxed) != 0);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getNSlots() const
+    {
+        return (myNSlots.load(std::memory_order_relaxed));
+    }
+
+    ///
+    /// @brief Acquires a free slot.
+    /// @return Slot with a reference count of 1, release it when done.
+    ///
+    Slot* acquire()
+    {
+        Slot* slot = myFirstSlot.load(std::memory_order_acquire);
+
+        while (isValidPointer(slot))
+        {
+            std::uint32_t expected = 0;
+
+            if (slot->referenceCount.compare_exchange_strong(
+                                                    expected,
+                                                    1,
+                                                    std::memory_order_acquire,
+                                                    std::memory_order_relaxed))
+            {
+                return slot;
+            }
+
+            slot = slot->next;
+        }
+
+        // More slots in flight than were reserved, grow the pool
+        return (addSlot(1));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::atomic<Slot*> myFirstSlot;
+
+    std::atomic<std::uint32_t> myNSlots;
+
+    std::atomic<std::uint32_t> myNReservedSlots;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicSamplePool(const TopicSamplePool<DataType>& topicSamplePool);
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    Slot* addSlot(const std::uint32_t referenceCount)
+    {
+        Slot* slot = MemoryAllocator::allocate<Slot>();
+        slot->referenceCount.store(referenceCount, std::memory_order_relaxed);
+
+        // Slots are only ever pushed to the front, so concurrent acquire()
+        // calls walking the list always see a valid chain
+        Slot* firstSlot = myFirstSlot.load(std::memory_order_relaxed);
+
+        do
+        {
+            slot->next = firstSlot;
+        }
+        while (!(myFirstSlot.compare_exchange_weak(firstSlot,
+                                                   slot,
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed)));
+
+        myNSlots.fetch_add(1, std::memory_order_relaxed);
+
+        return slot;
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_SAMPLE_POOL_H
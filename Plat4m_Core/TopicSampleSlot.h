@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSampleSlot.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSampleSlot struct header file.
+///
+
+#ifndef PLAT4M_TOPIC_SAMPLE_SLOT_H
+#define PLAT4M_TOPIC_SAMPLE_SLOT_H
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/TimeStamp.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Structs
+//------------------------------------------------------------------------------
+
+///
+/// @brief Reference counted copy of a published sample, owned by a
+/// TopicSamplePool. The slot is free for reuse once its reference count drops
+/// back to 0.
+///
+template <typename DataType>
+struct TopicSampleSlot
+{
+    std::atomic<std::uint32_t> referenceCount;
+    std::uint32_t sequenceId;
+    TimeStamp timeStamp;
+    DataType data;
+    TopicSampleSlot* next;
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicSampleSlot() :
+        referenceCount(0),
+        sequenceId(0),
+        timeStamp(),
+        data(),
+        next(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    void retain()
+    {
+        referenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    void release()
+    {
+        // Release ordering so all reads of data happen before the slot can be
+        // acquired and overwritten by the next publish
+        referenceCount.fetch_sub(1, std::memory_order_release);
+    }
+};
+
+}; // end namespace Plat4m
+
+#endif // PLAT4M_TOPIC_SAMPLE_SLOT_H
@@ -66,6 +66,13 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Module that subscribes to a Topic on construction and calls a
+/// callback with its samples while enabled. A non-zero nReplaySamples
+/// delivers up to that many samples from the Topic history, oldest first, the
+/// first time the subscriber is enabled. Samples published while it is being
+/// enabled may be missed. See Topic::enableHistory().
+///
 template<typename DataType>
 class TopicSubscriber : public Module
 {
@@ -88,14 +95,17 @@ public:
     TopicSubscriber(
                    const TopicBase::Id id,
                    const Config config,
-                   typename Topic<DataType>::SampleCallback& sampleCallback) :
+                   typename Topic<DataType>::SampleCallback& sampleCallback,
+                   const std::uint32_t nReplaySamples = 0) :
         Module(),
         myTopicId(id),
         myConfig(),
         mySampleCallback(&sampleCallback),
         myPrivateSampleCallback(
                         createCallback(this, &TopicSubscriber::sampleCallback)),
-        myDownsampleCounter(1)
+        myDownsampleCounter(1),
+        myIsSubscribed(true),
+        myNReplaySamples(nReplaySamples)
     {
         setConfig(config);
 
@@ -105,14 +115,17 @@ public:
     //--------------------------------------------------------------------------
     TopicSubscriber(
                    const TopicBase::Id id,
-                   typename Topic<DataType>::SampleCallback& sampleCallback) :
+                   typename Topic<DataType>::SampleCallback& sampleCallback,
+                   const std::uint32_t nReplaySamples = 0) :
         Module(),
         myTopicId(id),
         myConfig(),
         mySampleCallback(&sampleCallback),
         myPrivateSampleCallback(
                         createCallback(this, &TopicSubscriber::sampleCallback)),
-        myDownsampleCounter(1)
+        myDownsampleCounter(1),
+        myIsSubscribed(true),
+        myNReplaySamples(nReplaySamples)
     {
         myConfig.downsampleFactor = 1;
 
@@ -120,14 +133,18 @@ public:
     }
 
     //--------------------------------------------------------------------------
-    TopicSubscriber(const Config config, const TopicBase::Id id) :
+    TopicSubscriber(const Config config,
+                    const TopicBase::Id id,
+                    const std::uint32_t nReplaySamples = 0) :
         Module(),
         myTopicId(id),
         myConfig(),
         mySampleCallback(0),
         myPrivateSampleCallback(
                         createCallback(this, &TopicSubscriber::sampleCallback)),
-        myDownsampleCounter(1)
+        myDownsampleCounter(1),
+        myIsSubscribed(true),
+        myNReplaySamples(nReplaySamples)
     {
         setConfig(config);
 
@@ -135,14 +152,17 @@ public:
     }
 
     //--------------------------------------------------------------------------
-    TopicSubscriber(const TopicBase::Id id) :
+    TopicSubscriber(const TopicBase::Id id,
+                    const std::uint32_t nReplaySamples = 0) :
         Module(),
         myTopicId(id),
         myConfig(),
         mySampleCallback(0),
         myPrivateSampleCallback(
                         createCallback(this, &TopicSubscriber::sampleCallback)),
-        myDownsampleCounter(1)
+        myDownsampleCounter(1),
+        myIsSubscribed(true),
+        myNReplaySamples(nReplaySamples)
     {
         myConfig.downsampleFactor = 1;
 
@@ -155,7 +175,9 @@ public:
         myConfig(topicSubscriber.myConfig),
         mySampleCallback(topicSubscriber.mySampleCallback),
         myPrivateSampleCallback(topicSubscriber.myPrivateSampleCallback),
-        myDownsampleCounter(topicSubscriber.myDownsampleCounter)
+        myDownsampleCounter(topicSubscriber.myDownsampleCounter),
+        myIsSubscribed(false),
+        myNReplaySamples(0)
     {
     }
 
@@ -166,7 +188,7 @@ public:
     //--------------------------------------------------------------------------
     virtual ~TopicSubscriber()
     {
-        Topic<DataType>::unsubscribe(myTopicId, myPrivateSampleCallback);
+        unsubscribe();
     }
 
     //--------------------------------------------------------------------------
@@ -207,6 +229,8 @@ public:
         Topic<DataType>::subscribe(
                         myTopicId,
                         createCallback(this, &TopicSubscriber::sampleCallback));
+
+        myIsSubscribed = true;
     }
 
 protected:
@@ -215,6 +239,27 @@ protected:
     // Protected methods
     //--------------------------------------------------------------------------
 
+    ///
+    /// @brief Stops the Topic calling this subscriber. Subclasses that hand
+    /// samples to another thread call this first thing in their destructor,
+    /// before waiting for that thread to let go of them.
+    ///
+    void unsubscribe()
+    {
+        if (myIsSubscribed)
+        {
+            Topic<DataType>::unsubscribe(myTopicId, myPrivateSampleCallback);
+
+            myIsSubscribed = false;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    TopicBase::Id getTopicId() const
+    {
+        return myTopicId;
+    }
+
     //--------------------------------------------------------------------------
     typename Topic<DataType>::SampleCallback* getSampleCallback()
     {
@@ -237,6 +282,37 @@ private:
 
     std::uint32_t myDownsampleCounter;
 
+    bool myIsSubscribed;
+
+    std::uint32_t myNReplaySamples;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods implemented from Module
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual Module::Error interfaceSetEnabled(const bool enabled) override
+    {
+        // Replayed once, the first time the subscriber is enabled. Subclasses
+        // have reserved their samples and started delivering by now, which
+        // they have not while this class is being constructed.
+        if (enabled && (myNReplaySamples != 0))
+        {
+            CallbackMethodParameter<TopicSubscriber<DataType>,
+                                    void,
+                                    const TopicSample<DataType>&>
+                  replayCallback(this, &TopicSubscriber::replaySampleCallback);
+
+            Topic<DataType>::replay(myTopicId,
+                                    replayCallback,
+                                    myNReplaySamples);
+
+            myNReplaySamples = 0;
+        }
+
+        return Module::Error(Module::ERROR_CODE_NONE);
+    }
+
     //--------------------------------------------------------------------------
     // Private virtual methods
     //--------------------------------------------------------------------------
@@ -274,6 +350,13 @@ private:
         }
     }
 
+    //--------------------------------------------------------------------------
+    void replaySampleCallback(const TopicSample<DataType>& sample)
+    {
+        // Not downsampled, and isEnabled() is still false while enabling
+        sampleCallbackInternal(sample);
+    }
+
 };
 
 }; // namespace Plat4m
@@ -0,0 +1,368 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSubscriberExecutor.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSubscriberExecutor class header file.
+///
+
+#ifndef PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_H
+#define PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Module.h>
+#include <Plat4m_Core/TopicSubscriber.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSampleSlot.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Executor.h>
+#include <Plat4m_Core/LockFreeQueue.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Subscriber that calls its callback on an Executor instead of on a
+/// thread of its own, so any number of subscribers can share a fixed pool of
+/// workers. Samples are queued per subscriber and at most one task per
+/// subscriber is ever submitted, so the callback sees samples in the order
+/// they were published and never runs on two workers at once.
+/// @tparam nQueueValues Maximum number of samples waiting for the callback,
+/// samples published while the queue is full are dropped.
+///
+template<typename DataType, std::uint32_t nQueueValues = 1>
+class TopicSubscriberExecutor : public TopicSubscriber<DataType>
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    TopicSubscriberExecutor(
+                       const TopicBase::Id id,
+                       const typename TopicSubscriber<DataType>::Config config,
+                       typename Topic<DataType>::SampleCallback& sampleCallback,
+                       Executor& executor,
+                       const std::uint32_t nReplaySamples = 0) :
+        TopicSubscriber<DataType>(id, config, sampleCallback, nReplaySamples),
+        myExecutor(executor),
+        myTaskCallback(
+                 createCallback(this, &TopicSubscriberExecutor::taskCallback)),
+        myQueue(),
+        myIsSubmitted(false),
+        myNUsers(0),
+        myReleasedSemaphore(System::createSemaphore(1, 0))
+    {
+        // Queued samples plus the one being processed by the executor
+        Topic<DataType>::reserveSamples(id, nQueueValues + 1);
+    }
+
+    //--------------------------------------------------------------------------
+    TopicSubscriberExecutor(
+                       const TopicBase::Id id,
+                       typename Topic<DataType>::SampleCallback& sampleCallback,
+                       Executor& executor,
+                       const std::uint32_t nReplaySamples = 0) :
+        TopicSubscriber<DataType>(id, sampleCallback, nReplaySamples),
+        myExecutor(executor),
+        myTaskCallback(
+                 createCallback(this, &TopicSubscriberExecutor::taskCallback)),
+        myQueue(),
+        myIsSubmitted(false),
+        myNUsers(0),
+        myReleasedSemaphore(System::createSemaphore(1, 0))
+    {
+        // Queued samples plus the one being processed by the executor
+        Topic<DataType>::reserveSamples(id, nQueueValues + 1);
+    }
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual ~TopicSubscriberExecutor()
+    {
+        // Stop the Topic calling this subscriber, then wait for publishers
+        // already inside sampleCallbackInternal() and a submitted task to let
+        // go of it
+        TopicSubscriber<DataType>::unsubscribe();
+        Module::setEnabled(false);
+
+        const std::uint32_t nUsers =
+                myNUsers.fetch_or(destroyingFlag, std::memory_order_acq_rel);
+
+        if (nUsers != 0)
+        {
+            myReleasedSemaphore.wait();
+        }
+
+        releaseQueuedSamples();
+
+        Topic<DataType>::unreserveSamples(
+                                       TopicSubscriber<DataType>::getTopicId(),
+                                       nQueueValues + 1);
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    Executor& getExecutor()
+    {
+        return myExecutor;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef TopicSampleSlot<DataType> Slot;
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    // Set in myNUsers once the destructor is waiting for the users to finish
+    static const std::uint32_t destroyingFlag = 0x80000000;
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    Executor& myExecutor;
+
+    Executor::TaskCallback& myTaskCallback;
+
+    LockFreeQueue<Slot*, nQueueValues> myQueue;
+
+    std::atomic<bool> myIsSubmitted;
+
+    // Publishers inside sampleCallbackInternal() plus the submitted task,
+    // the last one out while the destructor waits posts myReleasedSemaphore
+    std::atomic<std::uint32_t> myNUsers;
+
+    Semaphore& myReleasedSemaphore;
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods implemented from Module
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual Module::Error driverSetEnabled(const bool enabled) override
+    {
+        if (!enabled)
+        {
+            releaseQueuedSamples();
+        }
+
+        return Module::Error(Module::ERROR_CODE_NONE);
+    }
+
+    //--------------------------------------------------------------------------
+    // Private virtual methods overridden for TopicSubscriber
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    virtual void sampleCallbackInternal(
+                                   const TopicSample<DataType>& sample) override
+    {
+        Slot* slot = sample.slot;
+
+        // Samples are always pooled once this subscriber has reserved samples
+        // on the Topic
+        if (isNullPointer(slot))
+        {
+            return;
+        }
+
+        if (!acquireUser())
+        {
+            return;
+        }
+
+        // Only the handle is queued, the sample data itself is never copied
+        slot->retain();
+
+        if (myQueue.enqueue(slot))
+        {
+            submit();
+        }
+        else
+        {
+            slot->release();
+        }
+
+        releaseUser();
+    }
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    void submit()
+    {
+        // Pairs with the fence in taskCallback(), either this sees the task
+        // is done or the task sees the sample just queued
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (myIsSubmitted.exchange(true, std::memory_order_acq_rel))
+        {
+            // Already submitted, the task will get to the sample
+            return;
+        }
+
+        // The task is a user until its last access to this subscriber,
+        // submit() is only called by current users so this never races the
+        // destructor
+        myNUsers.fetch_add(1, std::memory_order_acq_rel);
+
+        if (myExecutor.submit(myTaskCallback).getCode() !=
+                                                   Executor::ERROR_CODE_NONE)
+        {
+            // Executor is full, the sample stays queued until the next one
+            // is published
+            myIsSubmitted.store(false, std::memory_order_release);
+            releaseUser();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void taskCallback()
+    {
+        typename Topic<DataType>::SampleCallback* sampleCallback =
+                                TopicSubscriber<DataType>::getSampleCallback();
+
+        // At most one queue's worth per run so other subscribers on the same
+        // worker get a turn
+        Slot* slot = 0;
+        std::uint32_t nSamples = 0;
+
+        while ((nSamples < nQueueValues) && myQueue.dequeue(slot))
+        {
+            TopicSample<DataType> sample(slot->data, slot);
+            sample.sequenceId = slot->sequenceId;
+            sample.timeStamp = slot->timeStamp;
+
+            if (isValidPointer(sampleCallback) && Module::isEnabled())
+            {
+                sampleCallback->call(sample);
+            }
+
+            slot->release();
+            nSamples++;
+        }
+
+        myIsSubmitted.store(false, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!(myQueue.isEmpty()) && Module::isEnabled())
+        {
+            submit();
+        }
+
+        // Last access to this subscriber, it may be destroyed right after
+        releaseUser();
+    }
+
+    //--------------------------------------------------------------------------
+    bool acquireUser()
+    {
+        const std::uint32_t nUsers =
+                             myNUsers.fetch_add(1, std::memory_order_acq_rel);
+
+        if ((nUsers & destroyingFlag) != 0)
+        {
+            releaseUser();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    void releaseUser()
+    {
+        // Taken before the count drops, this subscriber can be gone after
+        Semaphore& releasedSemaphore = myReleasedSemaphore;
+
+        const std::uint32_t nUsers =
+                             myNUsers.fetch_sub(1, std::memory_order_acq_rel);
+
+        if (nUsers == (destroyingFlag + 1))
+        {
+            releasedSemaphore.post();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void releaseQueuedSamples()
+    {
+        Slot* slot = 0;
+
+        while (myQueue.dequeue(slot))
+        {
+            slot->release();
+        }
+    }
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_H
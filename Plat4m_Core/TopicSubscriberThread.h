@@ -47,15 +47,19 @@
 //------------------------------------------------------------------------------
 
 #include <cstdint>
+#include <atomic>
 
 #include <Plat4m_Core/Module.h>
 #include <Plat4m_Core/TopicSubscriber.h>
 #include <Plat4m_Core/TopicBase.h>
 #include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSampleSlot.h>
 #include <Plat4m_Core/CallbackMethod.h>
 #include <Plat4m_Core/System.h>
 #include <Plat4m_Core/Thread.h>
 #include <Plat4m_Core/Queue.h>
+#include <Plat4m_Core/Semaphore.h>
+#include <Plat4m_Core/TimeStamp.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -68,6 +72,11 @@ namespace Plat4m
 // Classes
 //------------------------------------------------------------------------------
 
+///
+/// @brief Topic subscriber that delivers samples on its own thread. At most
+/// nQueueValues samples are queued, what happens to samples published while
+/// the queue is full is set by the overflow policy (drop newest by default).
+///
 template<typename DataType, std::uint32_t nQueueValues = 1>
 class TopicSubscriberThread : public TopicSubscriber<DataType>
 {
@@ -84,8 +93,9 @@ public:
                        typename Topic<DataType>::SampleCallback& sampleCallback,
                        const std::uint32_t nStackBytes = 0,
                        const bool isSimulated = false,
-                       const char* name = 0) :
-        TopicSubscriber<DataType>(id, config, sampleCallback),
+                       const char* name = 0,
+                       const std::uint32_t nReplaySamples = 0) :
+        TopicSubscriber<DataType>(id, config, sampleCallback, nReplaySamples),
         myThread(
             System::createThread(
                    createCallback(this, &TopicSubscriberThread::threadCallback),
@@ -93,8 +103,22 @@ public:
                    nStackBytes,
                    isSimulated,
                    name)),
-        myQueue(System::createQueue<SampleAndDataType>(nQueueValues, myThread))
+        myQueue(System::createQueue<Slot*>(nQueueValues, myThread)),
+        myOverflowPolicy(TopicBase::OVERFLOW_POLICY_DROP_NEWEST),
+        myRoomSemaphore(0),
+        myLatestSlot(0),
+        myNQueuedSamples(0),
+        myNBlockedPublishers(0),
+        myNDroppedSamples(0),
+        myNConflatedSamples(0),
+        myQueueHighWaterMark(0),
+        myNDeliveredSamples(0),
+        myLatencySumNs(0),
+        myLastLatencyNs(0),
+        myMaxLatencyNs(0)
     {
+        // Queued samples plus the one being processed by the thread
+        Topic<DataType>::reserveSamples(id, nQueueValues + 1);
     }
 
     //--------------------------------------------------------------------------
@@ -103,8 +127,9 @@ public:
                        typename Topic<DataType>::SampleCallback& sampleCallback,
                        const std::uint32_t nStackBytes = 0,
                        const bool isSimulated = false,
-                       const char* name = 0) :
-        TopicSubscriber<DataType>(id, sampleCallback),
+                       const char* name = 0,
+                       const std::uint32_t nReplaySamples = 0) :
+        TopicSubscriber<DataType>(id, sampleCallback, nReplaySamples),
         myThread(
             System::createThread(
                    createCallback(this, &TopicSubscriberThread::threadCallback),
@@ -112,8 +137,22 @@ public:
                    nStackBytes,
                    isSimulated,
                    name)),
-        myQueue(System::createQueue<SampleAndDataType>(nQueueValues, myThread))
+        myQueue(System::createQueue<Slot*>(nQueueValues, myThread)),
+        myOverflowPolicy(TopicBase::OVERFLOW_POLICY_DROP_NEWEST),
+        myRoomSemaphore(0),
+        myLatestSlot(0),
+        myNQueuedSamples(0),
+        myNBlockedPublishers(0),
+        myNDroppedSamples(0),
+        myNConflatedSamples(0),
+        myQueueHighWaterMark(0),
+        myNDeliveredSamples(0),
+        myLatencySumNs(0),
+        myLastLatencyNs(0),
+        myMaxLatencyNs(0)
     {
+        // Queued samples plus the one being processed by the thread
+        Topic<DataType>::reserveSamples(id, nQueueValues + 1);
     }
 
     //--------------------------------------------------------------------------
@@ -123,6 +162,11 @@ public:
     //--------------------------------------------------------------------------
     virtual ~TopicSubscriberThread()
     {
+        releaseQueuedSamples();
+
+        Topic<DataType>::unreserveSamples(
+                                       TopicSubscriber<DataType>::getTopicId(),
+                                       nQueueValues + 1);
     }
 
     //--------------------------------------------------------------------------
@@ -135,28 +179,103 @@ public:
         return myThread;
     }
 
-private:
+    //--------------------------------------------------------------------------
+    /// @brief Sets what happens to samples published while the queue is full.
+    /// Must be set while the subscriber is disabled. With
+    /// OVERFLOW_POLICY_BLOCK_PUBLISHER the subscriber callback must never
+    /// publish to this Topic itself.
+    ///
+    void setOverflowPolicy(const TopicBase::OverflowPolicy overflowPolicy)
+    {
+        if ((overflowPolicy == TopicBase::OVERFLOW_POLICY_BLOCK_PUBLISHER) &&
+            isNullPointer(myRoomSemaphore))
+        {
+            myRoomSemaphore = &(System::createSemaphore());
+        }
+
+        myOverflowPolicy = overflowPolicy;
+    }
 
     //--------------------------------------------------------------------------
-    // Private types
+    TopicBase::OverflowPolicy getOverflowPolicy() const
+    {
+        return myOverflowPolicy;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getNQueuedSamples() const
+    {
+        return myNQueuedSamples.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    /// @brief Number of samples discarded because the queue was full
+    /// (OVERFLOW_POLICY_DROP_NEWEST and OVERFLOW_POLICY_DROP_OLDEST) or
+    /// because the subscriber was disabled while a publisher was blocked.
+    ///
+    std::uint32_t getNDroppedSamples() const
+    {
+        return myNDroppedSamples.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    /// @brief Number of undelivered samples replaced by a newer one
+    /// (OVERFLOW_POLICY_KEEP_LATEST).
+    ///
+    std::uint32_t getNConflatedSamples() const
+    {
+        return myNConflatedSamples.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getQueueHighWaterMark() const
+    {
+        return myQueueHighWaterMark.load(std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t getNDeliveredSamples() const
+    {
+        return myNDeliveredSamples.load(std::memory_order_relaxed);
+    }
+
     //--------------------------------------------------------------------------
+    /// @brief Time from publish (TopicSample::timeStamp) to the start of the
+    /// subscriber callback for the last delivered sample.
+    ///
+    std::int64_t getLastLatencyNs() const
+    {
+        return myLastLatencyNs.load(std::memory_order_relaxed);
+    }
 
-    struct SampleAndDataType
+    //--------------------------------------------------------------------------
+    std::int64_t getMaxLatencyNs() const
     {
-        TopicSample<DataType> sample;
-        DataType data;
+        return myMaxLatencyNs.load(std::memory_order_relaxed);
+    }
 
-        //----------------------------------------------------------------------
-        // Public constructors
-        //----------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    std::int64_t getMeanLatencyNs() const
+    {
+        const std::uint32_t nDeliveredSamples =
+                          myNDeliveredSamples.load(std::memory_order_relaxed);
 
-        //----------------------------------------------------------------------
-        SampleAndDataType(const DataType& data) :
-            sample(data),
-            data()
+        if (nDeliveredSamples == 0)
         {
+            return 0;
         }
-    };
+
+        return (myLatencySumNs.load(std::memory_order_relaxed) /
+                nDeliveredSamples);
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    typedef TopicSampleSlot<DataType> Slot;
 
     //--------------------------------------------------------------------------
     // Private data members
@@ -164,7 +283,31 @@ private:
 
     Thread& myThread;
 
-    Queue<SampleAndDataType>& myQueue;
+    Queue<Slot*>& myQueue;
+
+    TopicBase::OverflowPolicy myOverflowPolicy;
+
+    Semaphore* myRoomSemaphore;
+
+    std::atomic<Slot*> myLatestSlot;
+
+    std::atomic<std::uint32_t> myNQueuedSamples;
+
+    std::atomic<std::uint32_t> myNBlockedPublishers;
+
+    std::atomic<std::uint32_t> myNDroppedSamples;
+
+    std::atomic<std::uint32_t> myNConflatedSamples;
+
+    std::atomic<std::uint32_t> myQueueHighWaterMark;
+
+    std::atomic<std::uint32_t> myNDeliveredSamples;
+
+    std::atomic<std::int64_t> myLatencySumNs;
+
+    std::atomic<std::int64_t> myLastLatencyNs;
+
+    std::atomic<std::int64_t> myMaxLatencyNs;
 
     //--------------------------------------------------------------------------
     // Private virtual methods implemented from Module
@@ -179,7 +322,7 @@ private:
 
         if (!enabled)
         {
-            myQueue.clear();
+            releaseQueuedSamples();
         }
 
         return error;
@@ -193,12 +336,95 @@ private:
     virtual void sampleCallbackInternal(
                                    const TopicSample<DataType>& sample) override
     {
-        SampleAndDataType sampleAndData(sampleAndData.data);
-        sampleAndData.sample.sequenceId = sample.sequenceId;
-        sampleAndData.sample.timeStamp = sample.timeStamp;
-        sampleAndData.data = sample.data;
+        Slot* slot = sample.slot;
+
+        // Samples are always pooled once this subscriber has reserved samples
+        // on the Topic
+        if (isNullPointer(slot))
+        {
+            return;
+        }
 
-        myQueue.enqueue(sampleAndData);
+        // Only the handle is queued, the sample data itself is never copied
+        slot->retain();
+
+        switch (myOverflowPolicy)
+        {
+            case TopicBase::OVERFLOW_POLICY_DROP_OLDEST:
+            {
+                while (!enqueueSlot(slot))
+                {
+                    Slot* oldestSlot = 0;
+
+                    if (dequeueSlot(oldestSlot, false))
+                    {
+                        oldestSlot->release();
+                        myNDroppedSamples.fetch_add(1,
+                                                    std::memory_order_relaxed);
+                    }
+                }
+
+                break;
+            }
+            case TopicBase::OVERFLOW_POLICY_KEEP_LATEST:
+            {
+                Slot* previousSlot =
+                         myLatestSlot.exchange(slot, std::memory_order_acq_rel);
+
+                if (isValidPointer(previousSlot))
+                {
+                    previousSlot->release();
+                    myNConflatedSamples.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    // The latest slot was empty, queue a null handle to wake
+                    // the thread. At most one is ever queued.
+                    enqueueSlot(0);
+                }
+
+                break;
+            }
+            case TopicBase::OVERFLOW_POLICY_BLOCK_PUBLISHER:
+            {
+                while (!enqueueSlot(slot))
+                {
+                    if (!(Module::isEnabled()))
+                    {
+                        slot->release();
+                        myNDroppedSamples.fetch_add(1,
+                                                    std::memory_order_relaxed);
+
+                        return;
+                    }
+
+                    // Announce the wait before rechecking for room, pairs
+                    // with the thread checking for blocked publishers after
+                    // taking a sample off the queue
+                    myNBlockedPublishers.fetch_add(1);
+
+                    if (myNQueuedSamples.load() >= nQueueValues)
+                    {
+                        // Time out to recheck isEnabled()
+                        myRoomSemaphore->wait(1);
+                    }
+
+                    myNBlockedPublishers.fetch_sub(1);
+                }
+
+                break;
+            }
+            default:
+            {
+                if (!enqueueSlot(slot))
+                {
+                    slot->release();
+                    myNDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                break;
+            }
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -208,17 +434,135 @@ private:
     //--------------------------------------------------------------------------
     void threadCallback()
     {
-        SampleAndDataType sampleAndData(sampleAndData.data);
+        Slot* slot = 0;
 
-        if (myQueue.dequeue(sampleAndData))
+        if (dequeueSlot(slot, true))
         {
+            // A null handle means the sample is in the latest slot
+            if (isNullPointer(slot))
+            {
+                slot = myLatestSlot.exchange(0, std::memory_order_acq_rel);
+
+                if (isNullPointer(slot))
+                {
+                    return;
+                }
+            }
+
+            TopicSample<DataType> sample(slot->data, slot);
+            sample.sequenceId = slot->sequenceId;
+            sample.timeStamp = slot->timeStamp;
+
+            updateLatency(sample.timeStamp);
+
             typename Topic<DataType>::SampleCallback*
                 sampleCallback = TopicSubscriber<DataType>::getSampleCallback();
 
             if (isValidPointer(sampleCallback))
             {
-                sampleCallback->call(sampleAndData.sample);
+                sampleCallback->call(sample);
             }
+
+            slot->release();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    bool enqueueSlot(Slot* slot)
+    {
+        // Bound the queue here rather than relying on the queue driver, which
+        // may not enforce nQueueValues
+        const std::uint32_t nQueuedSamples = myNQueuedSamples.fetch_add(1) + 1;
+
+        if ((nQueuedSamples > nQueueValues) || !(myQueue.enqueue(slot)))
+        {
+            myNQueuedSamples.fetch_sub(1);
+
+            return false;
+        }
+
+        std::uint32_t highWaterMark =
+                        myQueueHighWaterMark.load(std::memory_order_relaxed);
+
+        while ((nQueuedSamples > highWaterMark) &&
+               !(myQueueHighWaterMark.compare_exchange_weak(
+                                                 highWaterMark,
+                                                 nQueuedSamples,
+                                                 std::memory_order_relaxed)))
+        {
+        }
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    bool dequeueSlot(Slot*& slot, const bool isBlocking)
+    {
+        bool isDequeued;
+
+        if (isBlocking)
+        {
+            isDequeued = myQueue.dequeue(slot);
+        }
+        else
+        {
+            isDequeued = myQueue.dequeueFast(slot);
+        }
+
+        if (!isDequeued)
+        {
+            return false;
+        }
+
+        myNQueuedSamples.fetch_sub(1);
+
+        if (isValidPointer(myRoomSemaphore) &&
+            (myNBlockedPublishers.load() > 0))
+        {
+            myRoomSemaphore->post();
+        }
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    void updateLatency(const TimeStamp& timeStamp)
+    {
+        const TimeStamp latency = System::getTimeStamp() - timeStamp;
+        const std::int64_t latencyNs =
+                    (static_cast<std::int64_t>(latency.timeS) * 1000000000) +
+                    latency.timeNs;
+
+        // Only ever written by this thread
+        myLastLatencyNs.store(latencyNs, std::memory_order_relaxed);
+        myLatencySumNs.fetch_add(latencyNs, std::memory_order_relaxed);
+
+        if (latencyNs > myMaxLatencyNs.load(std::memory_order_relaxed))
+        {
+            myMaxLatencyNs.store(latencyNs, std::memory_order_relaxed);
+        }
+
+        myNDeliveredSamples.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    void releaseQueuedSamples()
+    {
+        Slot* slot = 0;
+
+        while (dequeueSlot(slot, false))
+        {
+            if (isValidPointer(slot))
+            {
+                slot->release();
+            }
+        }
+
+        slot = myLatestSlot.exchange(0, std::memory_order_acq_rel);
+
+        if (isValidPointer(slot))
+        {
+            slot->release();
         }
     }
 };
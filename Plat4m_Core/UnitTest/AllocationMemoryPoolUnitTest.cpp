@@ -0,0 +1,364 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file AllocationMemoryPoolUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief AllocationMemoryPoolUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <new>
+
+#include <pthread.h>
+
+#include <Plat4m_Core/UnitTest/AllocationMemoryPoolUnitTest.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/List.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+// Constructing one makes it the current (nested) allocation memory until it
+// is destroyed
+typedef AllocationMemoryPool<16384, 1024> TestPool;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nThreadIterations = 10000;
+
+// Pools constructed here one after another share an address
+alignas(TestPool) static std::uint8_t poolMemory[sizeof(TestPool)];
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void* churnThreadCallback(void* arg)
+{
+    void* blocks[8];
+
+    for (std::uint32_t i = 0; i < nThreadIterations; i++)
+    {
+        for (std::uint32_t j = 0; j < arraySize(blocks); j++)
+        {
+            blocks[j] = MemoryAllocator::allocate(16 << (j % 6));
+        }
+
+        for (std::uint32_t j = 0; j < arraySize(blocks); j++)
+        {
+            MemoryAllocator::deallocate(blocks[j]);
+        }
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                       AllocationMemoryPoolUnitTest::myTestCallbackFunctions[] =
+{
+    &AllocationMemoryPoolUnitTest::reuseTest,
+    &AllocationMemoryPoolUnitTest::sizeClassTest,
+    &AllocationMemoryPoolUnitTest::largeBlockTest,
+    &AllocationMemoryPoolUnitTest::listChurnTest,
+    &AllocationMemoryPoolUnitTest::statsTest,
+    &AllocationMemoryPoolUnitTest::threadCacheTest,
+    &AllocationMemoryPoolUnitTest::threadCacheNewPoolTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+AllocationMemoryPoolUnitTest::AllocationMemoryPoolUnitTest() :
+    UnitTest("AllocationMemoryPoolUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+AllocationMemoryPoolUnitTest::~AllocationMemoryPoolUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::reuseTest()
+{
+    TestPool pool;
+    pool.setThreadCacheEnabled(false);
+
+    void* first = MemoryAllocator::allocate(40);
+    const std::size_t freeMemorySize = MemoryAllocator::getFreeMemorySize();
+
+    MemoryAllocator::deallocate(first);
+    void* second = MemoryAllocator::allocate(64);
+    MemoryAllocator::deallocate(second);
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(second, first) &
+                 UNIT_TEST_CASE_EQUAL(MemoryAllocator::getFreeMemorySize(),
+                                      freeMemorySize + 64));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::sizeClassTest()
+{
+    TestPool pool;
+    pool.setThreadCacheEnabled(false);
+
+    const std::size_t sizes[] = {1, 16, 17, 100, 256, 512};
+    void* blocks[arraySize(sizes)];
+
+    bool isAligned = true;
+
+    for (std::uint32_t i = 0; i < arraySize(sizes); i++)
+    {
+        blocks[i] = MemoryAllocator::allocate(sizes[i]);
+        isAligned &= ((reinterpret_cast<std::uintptr_t>(blocks[i]) % 16) == 0);
+    }
+
+    // 1 and 16 share the 16 B class, 512 B is the largest class
+    TestPool::ClassStats classStats[6];
+
+    for (std::uint32_t i = 0; i < pool.getNClasses(); i++)
+    {
+        pool.getClassStats(i, classStats[i]);
+    }
+
+    for (std::uint32_t i = 0; i < arraySize(sizes); i++)
+    {
+        MemoryAllocator::deallocate(blocks[i]);
+    }
+
+    TestPool::ClassStats classStats16;
+    pool.getClassStats(0, classStats16);
+
+    return UNIT_TEST_REPORT(
+                   UNIT_TEST_CASE_EQUAL(isAligned, true)                      &
+                   UNIT_TEST_CASE_EQUAL(pool.getNClasses(), 6u)               &
+                   UNIT_TEST_CASE_EQUAL(classStats[0].nUsedBlocks, 2u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[1].nUsedBlocks, 1u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[2].nUsedBlocks, 0u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[3].nUsedBlocks, 1u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[4].nUsedBlocks, 1u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[5].nUsedBlocks, 1u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats[5].nBlocks, 2u)            &
+                   UNIT_TEST_CASE_EQUAL(classStats16.nUsedBlocks, 0u)         &
+                   UNIT_TEST_CASE_EQUAL(classStats16.nFreeBlocks, 64u)        &
+                   UNIT_TEST_CASE_EQUAL(classStats16.nUsedBlocksHighWaterMark,
+                                        2u));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::largeBlockTest()
+{
+    TestPool pool;
+    pool.setThreadCacheEnabled(false);
+
+    const std::size_t freeMemorySize = MemoryAllocator::getFreeMemorySize();
+
+    // Bump allocated from the top like AllocationMemoryLite, never reused
+    void* large = MemoryAllocator::allocate(1000);
+    MemoryAllocator::deallocate(large);
+
+    void* small = MemoryAllocator::allocate(32);
+
+    const std::uintptr_t largeAddress = reinterpret_cast<std::uintptr_t>(large);
+    const std::uintptr_t smallAddress = reinterpret_cast<std::uintptr_t>(small);
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(freeMemorySize, (std::size_t) 16384) &
+                 UNIT_TEST_CASE_EQUAL(largeAddress % 16, (std::uintptr_t) 0) &
+                 UNIT_TEST_CASE_EQUAL(largeAddress > smallAddress, true)   &
+                 UNIT_TEST_CASE_EQUAL(MemoryAllocator::getFreeMemorySize(),
+                                      (std::size_t) (16384 - 1008 - 32)));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::listChurnTest()
+{
+    TestPool pool;
+    pool.setThreadCacheEnabled(false);
+
+    List<int> list;
+
+    int value = 0;
+    list.append(value);
+    list.remove(value);
+
+    const std::size_t freeMemorySize = MemoryAllocator::getFreeMemorySize();
+
+    // Every append allocates a List item, they used to be leaked on remove
+    for (int i = 0; i < 10000; i++)
+    {
+        list.append(i);
+        list.remove(i);
+    }
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(MemoryAllocator::getFreeMemorySize(),
+                                      freeMemorySize) &
+                 UNIT_TEST_CASE_EQUAL(list.size(), (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::statsTest()
+{
+    TestPool pool;
+    pool.setThreadCacheEnabled(false);
+
+    void* blocks[4];
+
+    for (std::uint32_t i = 0; i < arraySize(blocks); i++)
+    {
+        blocks[i] = MemoryAllocator::allocate(100);
+    }
+
+    AllocationMemory::Stats peakStats = MemoryAllocator::getStats();
+
+    for (std::uint32_t i = 0; i < arraySize(blocks); i++)
+    {
+        MemoryAllocator::deallocate(blocks[i]);
+    }
+
+    AllocationMemory::Stats stats = MemoryAllocator::getStats();
+
+    // One 1024 B page of 128 B blocks, all free again but only usable for
+    // allocations of 65 to 128 B
+    return UNIT_TEST_REPORT(
+             UNIT_TEST_CASE_EQUAL(peakStats.usedMemorySize, (std::size_t) 512) &
+             UNIT_TEST_CASE_EQUAL(stats.totalMemorySize, (std::size_t) 16384) &
+             UNIT_TEST_CASE_EQUAL(stats.usedMemorySize, (std::size_t) 0)      &
+             UNIT_TEST_CASE_EQUAL(stats.freeMemorySize, (std::size_t) 16384)  &
+             UNIT_TEST_CASE_EQUAL(stats.highWaterMarkMemorySize,
+                                  (std::size_t) 512)                           &
+             UNIT_TEST_CASE_EQUAL(stats.fragmentedMemorySize,
+                                  (std::size_t) 1024));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::threadCacheTest()
+{
+    TestPool pool;
+
+    pthread_t threadHandles[2];
+
+    for (std::uint32_t i = 0; i < arraySize(threadHandles); i++)
+    {
+        pthread_create(&(threadHandles[i]), NULL, &churnThreadCallback, NULL);
+    }
+
+    for (std::uint32_t i = 0; i < arraySize(threadHandles); i++)
+    {
+        pthread_join(threadHandles[i], NULL);
+    }
+
+    // Exiting threads hand their cached blocks back
+    AllocationMemory::Stats stats = MemoryAllocator::getStats();
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(stats.usedMemorySize, (std::size_t) 0) &
+                 UNIT_TEST_CASE_EQUAL(stats.freeMemorySize,
+                                      (std::size_t) 16384));
+}
+
+//------------------------------------------------------------------------------
+bool AllocationMemoryPoolUnitTest::threadCacheNewPoolTest()
+{
+    // Leave blocks in this thread's cache for a pool, then destroy it
+    TestPool* pool = new(poolMemory) TestPool;
+    MemoryAllocator::deallocate(MemoryAllocator::allocate(100));
+    pool->~TestPool();
+
+    // A new pool at the same address must not hand out the stale blocks
+    pool = new(poolMemory) TestPool;
+
+    void* blocks[64];
+
+    for (std::uint32_t i = 0; i < arraySize(blocks); i++)
+    {
+        blocks[i] = MemoryAllocator::allocate(100);
+    }
+
+    AllocationMemory::Stats stats = MemoryAllocator::getStats();
+
+    std::uint32_t nDuplicateBlocks = 0;
+
+    for (std::uint32_t i = 0; i < arraySize(blocks); i++)
+    {
+        for (std::uint32_t j = i + 1; j < arraySize(blocks); j++)
+        {
+            if (blocks[i] == blocks[j])
+            {
+                nDuplicateBlocks++;
+            }
+        }
+    }
+
+    for (std::uint32_t i = 0; i < arraySize(blocks); i++)
+    {
+        MemoryAllocator::deallocate(blocks[i]);
+    }
+
+    pool->~TestPool();
+
+    return UNIT_TEST_REPORT(
+             UNIT_TEST_CASE_EQUAL(nDuplicateBlocks, (std::uint32_t) 0) &
+             UNIT_TEST_CASE_EQUAL(stats.usedMemorySize >= (64 * 128), true));
+}
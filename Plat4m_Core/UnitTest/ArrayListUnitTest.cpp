@@ -0,0 +1,319 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ArrayListUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ArrayListUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/ArrayListUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+typedef ArrayList<std::uint8_t, 4> TestList;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                  ArrayListUnitTest::myTestCallbackFunctions[] =
+{
+    &ArrayListUnitTest::constructorTest,
+    &ArrayListUnitTest::appendTest,
+    &ArrayListUnitTest::prependTest,
+    &ArrayListUnitTest::removeTest,
+    &ArrayListUnitTest::removeTest2,
+    &ArrayListUnitTest::growTest,
+    &ArrayListUnitTest::copyTest,
+    &ArrayListUnitTest::iteratorTest,
+    &ArrayListUnitTest::iteratorGrowTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ArrayListUnitTest::ArrayListUnitTest() :
+    UnitTest("ArrayListUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ArrayListUnitTest::~ArrayListUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::constructorTest()
+{
+    TestList list;
+
+    std::uint8_t first = 0;
+    bool isFirst = list.first(first);
+
+    std::uint8_t last = 0;
+    bool isLast = list.last(last);
+
+    return UNIT_TEST_REPORT(
+             UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(0)) &
+             UNIT_TEST_CASE_EQUAL(list.capacity(),
+                                  static_cast<std::uint32_t>(4))              &
+             UNIT_TEST_CASE_EQUAL(list.isEmpty(), true)                       &
+             UNIT_TEST_CASE_EQUAL(isFirst, false)                             &
+             UNIT_TEST_CASE_EQUAL(isLast, false));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::appendTest()
+{
+    TestList list;
+
+    list.append(3);
+    list.append(5);
+    list.append(1);
+
+    std::uint8_t first = 0;
+    bool isFirst = list.first(first);
+
+    std::uint8_t last = 0;
+    bool isLast = list.last(last);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(3)) &
+           UNIT_TEST_CASE_EQUAL(list.isEmpty(), false)                      &
+           UNIT_TEST_CASE_EQUAL(isFirst, true)                              &
+           UNIT_TEST_CASE_EQUAL(first, static_cast<std::uint8_t>(3))        &
+           UNIT_TEST_CASE_EQUAL(list[1], static_cast<std::uint8_t>(5))      &
+           UNIT_TEST_CASE_EQUAL(isLast, true)                               &
+           UNIT_TEST_CASE_EQUAL(last, static_cast<std::uint8_t>(1)));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::prependTest()
+{
+    TestList list;
+
+    list.prepend(3);
+    list.prepend(5);
+    list.prepend(1);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(3)) &
+           UNIT_TEST_CASE_EQUAL(list[0], static_cast<std::uint8_t>(1))      &
+           UNIT_TEST_CASE_EQUAL(list[1], static_cast<std::uint8_t>(5))      &
+           UNIT_TEST_CASE_EQUAL(list[2], static_cast<std::uint8_t>(3)));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::removeTest()
+{
+    TestList list;
+
+    list.append(3);
+    list.append(5);
+    list.append(1);
+
+    list.remove(5);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(2)) &
+           UNIT_TEST_CASE_EQUAL(list[0], static_cast<std::uint8_t>(3))      &
+           UNIT_TEST_CASE_EQUAL(list[1], static_cast<std::uint8_t>(1)));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::removeTest2()
+{
+    TestList list;
+
+    list.append(3);
+    list.append(5);
+
+    // Not in the list
+    list.remove(7);
+
+    list.remove(3);
+    list.remove(5);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(0)) &
+           UNIT_TEST_CASE_EQUAL(list.isEmpty(), true));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::growTest()
+{
+    TestList list;
+
+    for (std::uint8_t i = 0; i < 10; i++)
+    {
+        list.append(i);
+    }
+
+    bool isInOrder = true;
+
+    for (std::uint32_t i = 0; i < list.size(); i++)
+    {
+        isInOrder &= (list[i] == i);
+    }
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(10)) &
+           UNIT_TEST_CASE_EQUAL(list.capacity(),
+                                static_cast<std::uint32_t>(16))              &
+           UNIT_TEST_CASE_EQUAL(isInOrder, true));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::copyTest()
+{
+    TestList list;
+
+    for (std::uint8_t i = 0; i < 6; i++)
+    {
+        list.append(i);
+    }
+
+    TestList copy(list);
+
+    list.remove(0);
+
+    TestList assigned;
+    assigned.append(9);
+    assigned = copy;
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(copy.size(), static_cast<std::uint32_t>(6)) &
+           UNIT_TEST_CASE_EQUAL(copy[0], static_cast<std::uint8_t>(0))      &
+           UNIT_TEST_CASE_EQUAL(copy[5], static_cast<std::uint8_t>(5))      &
+           UNIT_TEST_CASE_EQUAL(assigned.size(),
+                                static_cast<std::uint32_t>(6))              &
+           UNIT_TEST_CASE_EQUAL(assigned[0], static_cast<std::uint8_t>(0)));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::iteratorTest()
+{
+    TestList list;
+
+    list.append(3);
+    list.append(5);
+    list.append(1);
+
+    TestList::Iterator iterator = list.iterator();
+
+    std::uint32_t sum = 0;
+    std::uint32_t nItems = 0;
+
+    while (iterator.hasCurrent())
+    {
+        sum += iterator.current();
+        nItems++;
+
+        iterator.next();
+    }
+
+    iterator.last();
+    std::uint8_t last = iterator.current();
+    iterator.previous();
+    std::uint8_t previous = iterator.current();
+    iterator.first();
+    iterator.previous();
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(nItems, static_cast<std::uint32_t>(3))     &
+           UNIT_TEST_CASE_EQUAL(sum, static_cast<std::uint32_t>(9))        &
+           UNIT_TEST_CASE_EQUAL(last, static_cast<std::uint8_t>(1))        &
+           UNIT_TEST_CASE_EQUAL(previous, static_cast<std::uint8_t>(5))    &
+           UNIT_TEST_CASE_EQUAL(iterator.hasCurrent(), false));
+}
+
+//------------------------------------------------------------------------------
+bool ArrayListUnitTest::iteratorGrowTest()
+{
+    TestList list;
+
+    list.append(0);
+    list.append(1);
+    list.append(2);
+
+    TestList::Iterator iterator = list.iterator();
+
+    // Grows twice while iterating
+    bool isInOrder = true;
+    std::uint8_t nItems = 0;
+
+    while (iterator.hasCurrent())
+    {
+        isInOrder &= (iterator.current() == nItems);
+        nItems++;
+
+        if (list.size() < 12)
+        {
+            list.append(static_cast<std::uint8_t>(list.size()));
+        }
+
+        iterator.next();
+    }
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(nItems, static_cast<std::uint8_t>(12))      &
+           UNIT_TEST_CASE_EQUAL(list.capacity(),
+                                static_cast<std::uint32_t>(16))             &
+           UNIT_TEST_CASE_EQUAL(isInOrder, true));
+}
@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageHandlerGroupUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageHandlerGroupUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/BinaryMessageHandlerGroupUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+// Takes messages with its Id and counts every message it is offered
+class TestMessageHandler : public BinaryMessageHandler
+{
+public:
+
+    TestMessageHandler() :
+        BinaryMessageHandler(),
+        myMessageId(0),
+        myNCalls(0)
+    {
+    }
+
+    TestMessageHandler(const std::uint16_t messageId) :
+        BinaryMessageHandler(),
+        myMessageId(messageId),
+        myNCalls(0)
+    {
+    }
+
+    void setMessageId(const std::uint16_t messageId)
+    {
+        myMessageId = messageId;
+    }
+
+    std::uint32_t getNCalls() const
+    {
+        return myNCalls;
+    }
+
+    virtual ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+    {
+        myNCalls++;
+
+        if (requestBinaryMessage.getMessageId() == myMessageId)
+        {
+            return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+        }
+
+        return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+    }
+
+private:
+
+    std::uint16_t myMessageId;
+
+    std::uint32_t myNCalls;
+};
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint16_t groupId = 7;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static ComProtocol::ParseStatus handleMessage(
+                                       BinaryMessageHandlerGroup& group,
+                                       const std::uint16_t messageGroupId,
+                                       const std::uint16_t messageId)
+{
+    BinaryMessage requestBinaryMessage(messageGroupId, messageId);
+    BinaryMessage* responseBinaryMessage = 0;
+
+    return group.handleMessage(requestBinaryMessage, responseBinaryMessage);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                  BinaryMessageHandlerGroupUnitTest::myTestCallbackFunctions[] =
+{
+    &BinaryMessageHandlerGroupUnitTest::indexedDispatchTest,
+    &BinaryMessageHandlerGroupUnitTest::fallbackDispatchTest,
+    &BinaryMessageHandlerGroupUnitTest::indexOverflowTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageHandlerGroupUnitTest::BinaryMessageHandlerGroupUnitTest() :
+    UnitTest("BinaryMessageHandlerGroupUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageHandlerGroupUnitTest::~BinaryMessageHandlerGroupUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageHandlerGroupUnitTest::indexedDispatchTest()
+{
+    BinaryMessageHandlerGroup group(groupId);
+    TestMessageHandler handlers[10];
+
+    for (std::uint16_t i = 0; i < arraySize(handlers); i++)
+    {
+        handlers[i].setMessageId(i);
+        group.addMessageHandler(i, handlers[i]);
+    }
+
+    ComProtocol::ParseStatus status = handleMessage(group, groupId, 3);
+    ComProtocol::ParseStatus otherGroupStatus = handleMessage(group, 8, 3);
+    ComProtocol::ParseStatus unknownIdStatus =
+                                             handleMessage(group, groupId, 42);
+
+    // Only the handler registered for the Id is offered the message
+    std::uint32_t nCalls = 0;
+
+    for (std::uint16_t i = 0; i < arraySize(handlers); i++)
+    {
+        nCalls += handlers[i].getNCalls();
+    }
+
+    return UNIT_TEST_REPORT(
+         UNIT_TEST_CASE_EQUAL(status, ComProtocol::PARSE_STATUS_FOUND_FRAME) &
+         UNIT_TEST_CASE_EQUAL(otherGroupStatus,
+                              ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME)   &
+         UNIT_TEST_CASE_EQUAL(unknownIdStatus,
+                              ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME)   &
+         UNIT_TEST_CASE_EQUAL(handlers[3].getNCalls(), (std::uint32_t) 1)    &
+         UNIT_TEST_CASE_EQUAL(nCalls, (std::uint32_t) 1));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageHandlerGroupUnitTest::fallbackDispatchTest()
+{
+    BinaryMessageHandlerGroup group(groupId);
+
+    // Registered for Id 1 but only takes Id 2, so Id 1 falls through to the
+    // second handler registered for it and Id 2 to the handler without an Id
+    TestMessageHandler rejectingHandler(2);
+    TestMessageHandler duplicateHandler(1);
+    TestMessageHandler listHandler(2);
+
+    group.addMessageHandler(listHandler);
+    group.addMessageHandler(1, rejectingHandler);
+    group.addMessageHandler(1, duplicateHandler);
+
+    ComProtocol::ParseStatus duplicateStatus = handleMessage(group, groupId, 1);
+    const std::uint32_t nDuplicateCalls = duplicateHandler.getNCalls();
+
+    ComProtocol::ParseStatus listStatus = handleMessage(group, groupId, 2);
+
+    return UNIT_TEST_REPORT(
+            UNIT_TEST_CASE_EQUAL(duplicateStatus,
+                                 ComProtocol::PARSE_STATUS_FOUND_FRAME)      &
+            UNIT_TEST_CASE_EQUAL(nDuplicateCalls, (std::uint32_t) 1)         &
+            UNIT_TEST_CASE_EQUAL(listStatus,
+                                 ComProtocol::PARSE_STATUS_FOUND_FRAME)      &
+            UNIT_TEST_CASE_EQUAL(rejectingHandler.getNCalls(),
+                                 (std::uint32_t) 1)                          &
+            UNIT_TEST_CASE_EQUAL(listHandler.getNCalls(), (std::uint32_t) 1));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageHandlerGroupUnitTest::indexOverflowTest()
+{
+    BinaryMessageHandlerGroup group(groupId);
+
+    // More handlers than the index holds
+    TestMessageHandler handlers[PLAT4M_BINARY_MESSAGE_HANDLER_GROUP_INDEX_SIZE];
+
+    for (std::uint16_t i = 0; i < arraySize(handlers); i++)
+    {
+        handlers[i].setMessageId(i);
+        group.addMessageHandler(i, handlers[i]);
+    }
+
+    bool isFound = true;
+    bool isCalledOnce = true;
+
+    for (std::uint16_t i = 0; i < arraySize(handlers); i++)
+    {
+        isFound &= (handleMessage(group, groupId, i) ==
+                    ComProtocol::PARSE_STATUS_FOUND_FRAME);
+    }
+
+    for (std::uint16_t i = 0; i < arraySize(handlers); i++)
+    {
+        isCalledOnce &= (handlers[i].getNCalls() == 1);
+    }
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isFound, true) &
+                            UNIT_TEST_CASE_EQUAL(isCalledOnce, true));
+}
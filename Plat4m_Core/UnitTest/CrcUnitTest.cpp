@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file CrcUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief CrcUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/CrcUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t dataSize = 256;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void fillData(std::uint8_t data[], const std::uint32_t size)
+{
+    std::uint32_t state = 0x12345678;
+
+    for (std::uint32_t i = 0; i < size; i++)
+    {
+        // Xorshift, just needs to be deterministic
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        data[i] = static_cast<std::uint8_t>(state);
+    }
+}
+
+//------------------------------------------------------------------------------
+static std::uint16_t calculateCrc16CcittBitwise(const std::uint8_t data[],
+                                                const std::uint32_t size)
+{
+    // Original bit by bit implementation, kept as the reference
+    std::uint16_t crc = 0;
+
+    for (std::uint32_t i = 0; i < size; i++)
+    {
+        std::uint8_t reversedByte = Crc::reverseBitOrder(data[i]);
+
+        crc ^= (((std::uint16_t) reversedByte) << 8);
+
+        for (std::uint32_t j = 8; j > 0; j--)
+        {
+            if (areBitsSet(crc, 0x8000))
+            {
+                crc = (crc << 1) ^ Crc::crc16CcittPlynomial;
+            }
+            else
+            {
+                crc = (crc << 1);
+            }
+        }
+    }
+
+    crc = Crc::reverseBitOrder(crc);
+
+    return crc;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction CrcUnitTest::myTestCallbackFunctions[] =
+{
+    &CrcUnitTest::checkValueTest,
+    &CrcUnitTest::crc16CcittBitExactTest,
+    &CrcUnitTest::updateTest,
+    &CrcUnitTest::crc32cHardwareTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+CrcUnitTest::CrcUnitTest() :
+    UnitTest("CrcUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+CrcUnitTest::~CrcUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool CrcUnitTest::checkValueTest()
+{
+    // Standard check input "123456789"
+    ByteArray byteArray("123456789");
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(Crc::calculateCrc16Ccitt(byteArray),
+                                      static_cast<std::uint16_t>(0xBB3D))     &
+                 UNIT_TEST_CASE_EQUAL(Crc::calculateCrc32(byteArray),
+                                      static_cast<std::uint32_t>(0xCBF43926)) &
+                 UNIT_TEST_CASE_EQUAL(Crc::calculateCrc32c(byteArray),
+                                      static_cast<std::uint32_t>(0xE3069283)));
+}
+
+//------------------------------------------------------------------------------
+bool CrcUnitTest::crc16CcittBitExactTest()
+{
+    std::uint8_t data[dataSize];
+    fillData(data, dataSize);
+
+    bool isEqual = true;
+
+    // Every offset and length exercises the slice-by-8 loop and the tail
+    for (std::uint32_t offset = 0; offset < 8; offset++)
+    {
+        for (std::uint32_t size = 0; size <= (dataSize - offset); size++)
+        {
+            ByteArray byteArray(&(data[offset]), size, size);
+
+            isEqual &= (Crc::calculateCrc16Ccitt(byteArray) ==
+                        calculateCrc16CcittBitwise(&(data[offset]), size));
+        }
+    }
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isEqual, true));
+}
+
+//------------------------------------------------------------------------------
+bool CrcUnitTest::updateTest()
+{
+    std::uint8_t data[dataSize];
+    fillData(data, dataSize);
+
+    const std::uint16_t crc16 = Crc::Crc16CcittCalculator::calculate(data,
+                                                                     dataSize);
+    const std::uint32_t crc32 = Crc::Crc32Calculator::calculate(data,
+                                                                dataSize);
+    const std::uint32_t crc32c = Crc::Crc32cCalculator::calculate(data,
+                                                                  dataSize);
+
+    bool isEqual = true;
+
+    // Streaming in two chunks split anywhere must match a single pass
+    for (std::uint32_t split = 0; split <= dataSize; split++)
+    {
+        Crc::Crc16CcittCalculator crc16Calculator;
+        Crc::Crc32Calculator crc32Calculator;
+        Crc::Crc32cCalculator crc32cCalculator;
+
+        crc16Calculator.update(data, split);
+        crc16Calculator.update(&(data[split]), dataSize - split);
+        crc32Calculator.update(data, split);
+        crc32Calculator.update(&(data[split]), dataSize - split);
+        crc32cCalculator.update(data, split);
+        crc32cCalculator.update(&(data[split]), dataSize - split);
+
+        isEqual &= (crc16Calculator.getValue() == crc16)   &&
+                   (crc32Calculator.getValue() == crc32)   &&
+                   (crc32cCalculator.getValue() == crc32c);
+    }
+
+    // Byte at a time
+    Crc::Crc32Calculator crc32Calculator;
+
+    for (std::uint32_t i = 0; i < dataSize; i++)
+    {
+        crc32Calculator.update(data[i]);
+    }
+
+    const std::uint32_t crc32Bytewise = crc32Calculator.getValue();
+
+    crc32Calculator.reset();
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(isEqual, true)                                &
+           UNIT_TEST_CASE_EQUAL(crc32Bytewise, crc32)                         &
+           UNIT_TEST_CASE_EQUAL(crc32Calculator.getValue(),
+                                static_cast<std::uint32_t>(0)));
+}
+
+//------------------------------------------------------------------------------
+bool CrcUnitTest::crc32cHardwareTest()
+{
+    std::uint8_t data[dataSize];
+    fillData(data, dataSize);
+
+    bool isEqual = true;
+
+    // Falls back to software without SSE4.2, in which case this is trivial
+    for (std::uint32_t offset = 0; offset < 8; offset++)
+    {
+        for (std::uint32_t size = 0; size <= (dataSize - offset); size++)
+        {
+            isEqual &= (Crc::Crc32cCalculator::updateValue(0xFFFFFFFF,
+                                                           &(data[offset]),
+                                                           size) ==
+                        Crc::Crc32cCalculator::updateValueSoftware(
+                                                           0xFFFFFFFF,
+                                                           &(data[offset]),
+                                                           size));
+        }
+    }
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isEqual, true));
+}
@@ -0,0 +1,230 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ExecutorLinuxUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ExecutorLinuxUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <unistd.h>
+
+#include <Plat4m_Core/UnitTest/ExecutorLinuxUnitTest.h>
+#include <Plat4m_Core/AllocationMemoryPool/AllocationMemoryPool.h>
+#include <Plat4m_Core/CallbackFunction.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+// Constructing one makes it the current (nested) allocation memory until it
+// is destroyed
+typedef AllocationMemoryPool<32768, 1024> TestPool;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nSpawnedTasks = 32;
+
+static std::atomic<std::uint32_t> nTasksRun(0);
+
+static ExecutorLinux* currentExecutor = 0;
+
+static CallbackFunction<void>* currentSpawnedTask = 0;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void countTaskCallback()
+{
+    nTasksRun.fetch_add(1, std::memory_order_relaxed);
+}
+
+///
+/// @brief Waits up to 2 s for the given number of tasks to have run.
+///
+static bool waitForTasks(const std::uint32_t nTasks)
+{
+    for (std::uint32_t i = 0; i < 2000; i++)
+    {
+        if (nTasksRun.load(std::memory_order_relaxed) >= nTasks)
+        {
+            return true;
+        }
+
+        usleep(1000);
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+static void spawnTaskCallback()
+{
+    // Submitted from a worker, so these go on that worker's own queue
+    for (std::uint32_t i = 0; i < nSpawnedTasks; i++)
+    {
+        currentExecutor->submit(*currentSpawnedTask);
+    }
+}
+
+//------------------------------------------------------------------------------
+static void blockingSpawnTaskCallback()
+{
+    spawnTaskCallback();
+
+    // Keep this worker busy so the other one has to steal every task
+    waitForTasks(nSpawnedTasks);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                              ExecutorLinuxUnitTest::myTestCallbackFunctions[] =
+{
+    &ExecutorLinuxUnitTest::submitTest,
+    &ExecutorLinuxUnitTest::workerSubmitTest,
+    &ExecutorLinuxUnitTest::stealTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ExecutorLinuxUnitTest::ExecutorLinuxUnitTest() :
+    UnitTest("ExecutorLinuxUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ExecutorLinuxUnitTest::~ExecutorLinuxUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ExecutorLinuxUnitTest::submitTest()
+{
+    TestPool pool;
+    ExecutorLinux executor(2);
+    CallbackFunction<void> countTask(&countTaskCallback);
+
+    nTasksRun.store(0);
+
+    // Each submit queues the task again, even while it's already queued
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        executor.submit(countTask);
+    }
+
+    const bool isDone = waitForTasks(100);
+
+    return UNIT_TEST_REPORT(
+              UNIT_TEST_CASE_EQUAL(isDone, true)                              &
+              UNIT_TEST_CASE_EQUAL(nTasksRun.load(), (std::uint32_t) 100)     &
+              UNIT_TEST_CASE_EQUAL(executor.getNWorkers(), (std::uint32_t) 2) &
+              UNIT_TEST_CASE_EQUAL(executor.getNRejectedTasks(),
+                                   (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool ExecutorLinuxUnitTest::workerSubmitTest()
+{
+    TestPool pool;
+    ExecutorLinux executor(1);
+    CallbackFunction<void> countTask(&countTaskCallback);
+    CallbackFunction<void> spawnTask(&spawnTaskCallback);
+
+    nTasksRun.store(0);
+    currentExecutor = &executor;
+    currentSpawnedTask = &countTask;
+
+    executor.submit(spawnTask);
+
+    const bool isDone = waitForTasks(nSpawnedTasks);
+
+    return UNIT_TEST_REPORT(
+             UNIT_TEST_CASE_EQUAL(isDone, true)                               &
+             UNIT_TEST_CASE_EQUAL(nTasksRun.load(), nSpawnedTasks)            &
+             UNIT_TEST_CASE_EQUAL(executor.getNSteals(), (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool ExecutorLinuxUnitTest::stealTest()
+{
+    TestPool pool;
+    ExecutorLinux executor(2);
+    CallbackFunction<void> countTask(&countTaskCallback);
+    CallbackFunction<void> spawnTask(&blockingSpawnTaskCallback);
+
+    nTasksRun.store(0);
+    currentExecutor = &executor;
+    currentSpawnedTask = &countTask;
+
+    executor.submit(spawnTask);
+
+    const bool isDone = waitForTasks(nSpawnedTasks);
+
+    // Let the spawning task return before the executor is destroyed
+    usleep(10000);
+
+    return UNIT_TEST_REPORT(
+                    UNIT_TEST_CASE_EQUAL(isDone, true) &
+                    UNIT_TEST_CASE_EQUAL(executor.getNSteals(), nSpawnedTasks));
+}
@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IdHashIndexUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IdHashIndexUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/IdHashIndexUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                IdHashIndexUnitTest::myTestCallbackFunctions[] =
+{
+    &IdHashIndexUnitTest::insertFindTest,
+    &IdHashIndexUnitTest::insertDuplicateTest,
+    &IdHashIndexUnitTest::insertFullTest,
+    &IdHashIndexUnitTest::removeTest,
+    &IdHashIndexUnitTest::typeIdTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IdHashIndexUnitTest::IdHashIndexUnitTest() :
+    UnitTest("IdHashIndexUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IdHashIndexUnitTest::~IdHashIndexUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool IdHashIndexUnitTest::insertFindTest()
+{
+    typedef IdHashIndexN<std::uint32_t, 16> Index;
+
+    Index index;
+
+    Index::Error error1 = index.insert(7, 70);
+    Index::Error error2 = index.insert(1000, 10000);
+
+    std::uint32_t value1 = 0;
+    Index::Error error3 = index.find(7, value1);
+
+    std::uint32_t value2 = 0;
+    Index::Error error4 = index.find(1000, value2);
+
+    std::uint32_t value3 = 5;
+    Index::Error error5 = index.find(8, value3);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error1.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(error2.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(index.getSize(), static_cast<std::uint32_t>(2))  &
+        UNIT_TEST_CASE_EQUAL(error3.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(value1, static_cast<std::uint32_t>(70))          &
+        UNIT_TEST_CASE_EQUAL(error4.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(value2, static_cast<std::uint32_t>(10000))       &
+        UNIT_TEST_CASE_EQUAL(error5.getCode(), Index::ERROR_CODE_ID_NOT_FOUND)&
+        UNIT_TEST_CASE_EQUAL(value3, static_cast<std::uint32_t>(5)));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexUnitTest::insertDuplicateTest()
+{
+    typedef IdHashIndexN<std::uint32_t, 16> Index;
+
+    Index index;
+
+    index.insert(3, 30);
+    Index::Error error = index.insert(3, 31);
+
+    std::uint32_t value = 0;
+    index.find(3, value);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error.getCode(),
+                             Index::ERROR_CODE_ID_ALREADY_EXISTS)             &
+        UNIT_TEST_CASE_EQUAL(index.getSize(), static_cast<std::uint32_t>(1))  &
+        UNIT_TEST_CASE_EQUAL(value, static_cast<std::uint32_t>(30)));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexUnitTest::insertFullTest()
+{
+    typedef IdHashIndexN<std::uint32_t, 8> Index;
+
+    Index index;
+
+    bool isInserted = true;
+
+    for (std::uint32_t i = 0; i < index.getCapacity(); i++)
+    {
+        Index::Error error = index.insert(i, i);
+        isInserted &= (error.getCode() == Index::ERROR_CODE_NONE);
+    }
+
+    Index::Error error = index.insert(100, 100);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(index.getCapacity(),
+                             static_cast<std::uint32_t>(6))                   &
+        UNIT_TEST_CASE_EQUAL(isInserted, true)                                &
+        UNIT_TEST_CASE_EQUAL(error.getCode(), Index::ERROR_CODE_FULL));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexUnitTest::removeTest()
+{
+    typedef IdHashIndexN<std::uint32_t, 64> Index;
+
+    Index index;
+
+    // Ids that are multiples of the table size land in long shared clusters,
+    // removing from the middle of them exercises the backward shift
+    for (std::uint32_t i = 0; i < 40; i++)
+    {
+        index.insert(i * 64, i);
+    }
+
+    bool isRemoved = true;
+
+    for (std::uint32_t i = 0; i < 40; i += 3)
+    {
+        Index::Error error = index.remove(i * 64);
+        isRemoved &= (error.getCode() == Index::ERROR_CODE_NONE);
+    }
+
+    bool isConsistent = true;
+
+    for (std::uint32_t i = 0; i < 40; i++)
+    {
+        std::uint32_t value = 0xFFFFFFFF;
+        Index::Error error = index.find(i * 64, value);
+
+        if ((i % 3) == 0)
+        {
+            isConsistent &= (error.getCode() == Index::ERROR_CODE_ID_NOT_FOUND);
+        }
+        else
+        {
+            isConsistent &= ((error.getCode() == Index::ERROR_CODE_NONE) &&
+                             (value == i));
+        }
+    }
+
+    Index::Error error = index.remove(0);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isRemoved, true)                                 &
+        UNIT_TEST_CASE_EQUAL(isConsistent, true)                              &
+        UNIT_TEST_CASE_EQUAL(index.getSize(), static_cast<std::uint32_t>(26)) &
+        UNIT_TEST_CASE_EQUAL(error.getCode(), Index::ERROR_CODE_ID_NOT_FOUND));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexUnitTest::typeIdTest()
+{
+    typedef IdHashIndexN<std::uint32_t, 16> Index;
+
+    Index index;
+
+    index.insert(1, 10, getTypeId<std::uint8_t>());
+
+    std::uint32_t value1 = 0;
+    Index::Error error1 = index.find(1, value1, getTypeId<std::uint8_t>());
+
+    std::uint32_t value2 = 0;
+    Index::Error error2 = index.find(1, value2, getTypeId<std::int8_t>());
+
+    std::uint32_t value3 = 0;
+    Index::Error error3 = index.find(1, value3);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error1.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(value1, static_cast<std::uint32_t>(10))          &
+        UNIT_TEST_CASE_EQUAL(error2.getCode(),
+                             Index::ERROR_CODE_TYPE_ID_MISMATCH)              &
+        UNIT_TEST_CASE_EQUAL(value2, static_cast<std::uint32_t>(0))           &
+        UNIT_TEST_CASE_EQUAL(error3.getCode(), Index::ERROR_CODE_NONE)        &
+        UNIT_TEST_CASE_EQUAL(value3, static_cast<std::uint32_t>(10)));
+}
@@ -0,0 +1,271 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IntrusiveListUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IntrusiveListUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/IntrusiveListUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+struct Node
+{
+    std::uint8_t value;
+
+    IntrusiveListHook<Node> hook;
+
+    Node(const std::uint8_t nodeValue) :
+        value(nodeValue),
+        hook()
+    {
+    }
+};
+
+typedef IntrusiveList<Node, &Node::hook> TestList;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                              IntrusiveListUnitTest::myTestCallbackFunctions[] =
+{
+    &IntrusiveListUnitTest::constructorTest,
+    &IntrusiveListUnitTest::appendTest,
+    &IntrusiveListUnitTest::prependTest,
+    &IntrusiveListUnitTest::removeTest,
+    &IntrusiveListUnitTest::removeTest2,
+    &IntrusiveListUnitTest::removeTest3,
+    &IntrusiveListUnitTest::iteratorTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IntrusiveListUnitTest::IntrusiveListUnitTest() :
+    UnitTest("IntrusiveListUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IntrusiveListUnitTest::~IntrusiveListUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::constructorTest()
+{
+    TestList list;
+
+    return UNIT_TEST_REPORT(
+             UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(0)) &
+             UNIT_TEST_CASE_EQUAL(list.isEmpty(), true)                       &
+             UNIT_TEST_CASE_EQUAL(list.first(), (Node*) 0)                    &
+             UNIT_TEST_CASE_EQUAL(list.last(), (Node*) 0));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::appendTest()
+{
+    Node node1(3);
+    Node node2(5);
+    Node node3(1);
+
+    TestList list;
+
+    list.append(node1);
+    list.append(node2);
+    list.append(node3);
+
+    // Already linked, ignored
+    list.append(node2);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(3)) &
+           UNIT_TEST_CASE_EQUAL(list.isEmpty(), false)                      &
+           UNIT_TEST_CASE_EQUAL(list.first(), &node1)                       &
+           UNIT_TEST_CASE_EQUAL(list.last(), &node3)                        &
+           UNIT_TEST_CASE_EQUAL(list.contains(node2), true)                 &
+           UNIT_TEST_CASE_EQUAL(node2.hook.isLinked(), true));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::prependTest()
+{
+    Node node1(3);
+    Node node2(5);
+
+    TestList list;
+
+    list.prepend(node1);
+    list.prepend(node2);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(2)) &
+           UNIT_TEST_CASE_EQUAL(list.first(), &node2)                       &
+           UNIT_TEST_CASE_EQUAL(list.last(), &node1));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::removeTest()
+{
+    Node node1(3);
+    Node node2(5);
+    Node node3(1);
+
+    TestList list;
+
+    list.append(node1);
+    list.append(node2);
+    list.append(node3);
+
+    list.remove(node2);
+
+    TestList::Iterator iterator = list.iterator();
+    Node* first = &(iterator.current());
+    iterator.next();
+    Node* second = &(iterator.current());
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(2)) &
+           UNIT_TEST_CASE_EQUAL(first, &node1)                              &
+           UNIT_TEST_CASE_EQUAL(second, &node3)                             &
+           UNIT_TEST_CASE_EQUAL(node2.hook.isLinked(), false));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::removeTest2()
+{
+    Node node1(3);
+    Node node2(5);
+
+    TestList list;
+
+    list.append(node1);
+    list.append(node2);
+
+    list.remove(node1);
+    list.remove(node2);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(0)) &
+           UNIT_TEST_CASE_EQUAL(list.isEmpty(), true)                       &
+           UNIT_TEST_CASE_EQUAL(list.first(), (Node*) 0)                    &
+           UNIT_TEST_CASE_EQUAL(list.last(), (Node*) 0));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::removeTest3()
+{
+    Node node1(3);
+    Node node2(5);
+
+    TestList list;
+    TestList otherList;
+
+    list.append(node1);
+    otherList.append(node2);
+
+    // Linked into another list, ignored
+    list.remove(node2);
+
+    // A copy doesn't inherit the original's links
+    Node copy(node1);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(list.size(), static_cast<std::uint32_t>(1)) &
+           UNIT_TEST_CASE_EQUAL(otherList.size(),
+                                static_cast<std::uint32_t>(1))              &
+           UNIT_TEST_CASE_EQUAL(otherList.contains(node2), true)            &
+           UNIT_TEST_CASE_EQUAL(copy.hook.isLinked(), false));
+}
+
+//------------------------------------------------------------------------------
+bool IntrusiveListUnitTest::iteratorTest()
+{
+    Node node1(3);
+    Node node2(5);
+    Node node3(1);
+
+    TestList list;
+
+    list.append(node1);
+    list.append(node2);
+    list.append(node3);
+
+    TestList::Iterator iterator = list.iterator();
+
+    std::uint32_t sum = 0;
+
+    while (iterator.hasCurrent())
+    {
+        sum += iterator.current().value;
+
+        iterator.next();
+    }
+
+    iterator.last();
+    iterator.previous();
+    std::uint8_t previous = iterator.current().value;
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(sum, static_cast<std::uint32_t>(9))        &
+           UNIT_TEST_CASE_EQUAL(previous, static_cast<std::uint8_t>(5)));
+}
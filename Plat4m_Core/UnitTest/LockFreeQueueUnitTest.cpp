@@ -0,0 +1,295 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file LockFreeQueueUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief LockFreeQueueUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <Plat4m_Core/UnitTest/LockFreeQueueUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+typedef LockFreeQueue<std::uint32_t, 64> ConcurrentQueue;
+
+struct Consumer
+{
+    ConcurrentQueue* queue;
+    std::atomic<std::uint32_t>* nValuesLeft;
+    std::uint64_t sum;
+    bool isInOrder;
+};
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nValuesPerProducer = 100000;
+
+// Producer index goes in the top bit so consumers can check each producer's
+// values arrive in order
+static const std::uint32_t producerBit = 0x80000000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void* producer0ThreadCallback(void* arg)
+{
+    ConcurrentQueue* queue = static_cast<ConcurrentQueue*>(arg);
+
+    for (std::uint32_t i = 1; i <= nValuesPerProducer; i++)
+    {
+        while (!(queue->enqueue(i)))
+        {
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+static void* producer1ThreadCallback(void* arg)
+{
+    ConcurrentQueue* queue = static_cast<ConcurrentQueue*>(arg);
+
+    for (std::uint32_t i = 1; i <= nValuesPerProducer; i++)
+    {
+        while (!(queue->enqueue(producerBit | i)))
+        {
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+static void* consumerThreadCallback(void* arg)
+{
+    Consumer* consumer = static_cast<Consumer*>(arg);
+    std::uint32_t lastValues[2] = {0, 0};
+
+    while (consumer->nValuesLeft->load(std::memory_order_relaxed) != 0)
+    {
+        std::uint32_t value = 0;
+
+        if (!(consumer->queue->dequeue(value)))
+        {
+            sched_yield();
+
+            continue;
+        }
+
+        consumer->nValuesLeft->fetch_sub(1, std::memory_order_relaxed);
+
+        const std::uint32_t producerIndex = (value & producerBit) ? 1 : 0;
+        value &= ~producerBit;
+
+        consumer->isInOrder &= (value > lastValues[producerIndex]);
+        lastValues[producerIndex] = value;
+        consumer->sum += value;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                              LockFreeQueueUnitTest::myTestCallbackFunctions[] =
+{
+    &LockFreeQueueUnitTest::fifoTest,
+    &LockFreeQueueUnitTest::fullEmptyTest,
+    &LockFreeQueueUnitTest::wrapTest,
+    &LockFreeQueueUnitTest::concurrentTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+LockFreeQueueUnitTest::LockFreeQueueUnitTest() :
+    UnitTest("LockFreeQueueUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+LockFreeQueueUnitTest::~LockFreeQueueUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool LockFreeQueueUnitTest::fifoTest()
+{
+    LockFreeQueue<std::uint32_t, 4> queue;
+
+    queue.enqueue(1);
+    queue.enqueue(2);
+    queue.enqueue(3);
+
+    std::uint32_t values[3] = {0, 0, 0};
+
+    queue.dequeue(values[0]);
+    queue.dequeue(values[1]);
+    queue.dequeue(values[2]);
+
+    return UNIT_TEST_REPORT(
+                          UNIT_TEST_CASE_EQUAL(values[0], (std::uint32_t) 1) &
+                          UNIT_TEST_CASE_EQUAL(values[1], (std::uint32_t) 2) &
+                          UNIT_TEST_CASE_EQUAL(values[2], (std::uint32_t) 3) &
+                          UNIT_TEST_CASE_EQUAL(queue.isEmpty(), true));
+}
+
+//------------------------------------------------------------------------------
+bool LockFreeQueueUnitTest::fullEmptyTest()
+{
+    LockFreeQueue<std::uint32_t, 2> queue;
+    std::uint32_t value = 0;
+
+    const bool isEmptyDequeued = queue.dequeue(value);
+    const bool isEmpty = queue.isEmpty();
+
+    const bool isFirstEnqueued = queue.enqueue(1);
+    const bool isSecondEnqueued = queue.enqueue(2);
+    const bool isFullEnqueued = queue.enqueue(3);
+
+    queue.dequeue(value);
+
+    const bool isFreedEnqueued = queue.enqueue(4);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isEmptyDequeued, false)  &
+                            UNIT_TEST_CASE_EQUAL(isEmpty, true)           &
+                            UNIT_TEST_CASE_EQUAL(isFirstEnqueued, true)   &
+                            UNIT_TEST_CASE_EQUAL(isSecondEnqueued, true)  &
+                            UNIT_TEST_CASE_EQUAL(isFullEnqueued, false)   &
+                            UNIT_TEST_CASE_EQUAL(value, (std::uint32_t) 1) &
+                            UNIT_TEST_CASE_EQUAL(isFreedEnqueued, true)   &
+                            UNIT_TEST_CASE_EQUAL(queue.isEmpty(), false));
+}
+
+//------------------------------------------------------------------------------
+bool LockFreeQueueUnitTest::wrapTest()
+{
+    // Capacity that doesn't divide the position range evenly
+    LockFreeQueue<std::uint32_t, 3> queue;
+    bool isInOrder = true;
+
+    for (std::uint32_t i = 0; i < 10; i++)
+    {
+        queue.enqueue(i * 2);
+        queue.enqueue(i * 2 + 1);
+
+        std::uint32_t first = 0;
+        std::uint32_t second = 0;
+
+        isInOrder &= queue.dequeue(first) && (first == (i * 2));
+        isInOrder &= queue.dequeue(second) && (second == (i * 2 + 1));
+    }
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isInOrder, true) &
+                            UNIT_TEST_CASE_EQUAL(queue.isEmpty(), true));
+}
+
+//------------------------------------------------------------------------------
+bool LockFreeQueueUnitTest::concurrentTest()
+{
+    ConcurrentQueue queue;
+    std::atomic<std::uint32_t> nValuesLeft(2 * nValuesPerProducer);
+
+    Consumer consumers[2];
+
+    for (std::uint32_t i = 0; i < arraySize(consumers); i++)
+    {
+        consumers[i].queue       = &queue;
+        consumers[i].nValuesLeft = &nValuesLeft;
+        consumers[i].sum         = 0;
+        consumers[i].isInOrder   = true;
+    }
+
+    pthread_t threadHandles[4];
+
+    pthread_create(&(threadHandles[0]), NULL, &consumerThreadCallback,
+                   &(consumers[0]));
+    pthread_create(&(threadHandles[1]), NULL, &consumerThreadCallback,
+                   &(consumers[1]));
+    pthread_create(&(threadHandles[2]), NULL, &producer0ThreadCallback, &queue);
+    pthread_create(&(threadHandles[3]), NULL, &producer1ThreadCallback, &queue);
+
+    for (std::uint32_t i = 0; i < arraySize(threadHandles); i++)
+    {
+        pthread_join(threadHandles[i], NULL);
+    }
+
+    const std::uint64_t nValues = nValuesPerProducer;
+    const std::uint64_t expectedSum = nValues * (nValues + 1);
+
+    return UNIT_TEST_REPORT(
+          UNIT_TEST_CASE_EQUAL(consumers[0].sum + consumers[1].sum,
+                               expectedSum)                                   &
+          UNIT_TEST_CASE_EQUAL(consumers[0].isInOrder, true)                  &
+          UNIT_TEST_CASE_EQUAL(consumers[1].isInOrder, true)                  &
+          UNIT_TEST_CASE_EQUAL(queue.isEmpty(), true));
+}
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file QueueDriverLinuxLockFreeUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief QueueDriverLinuxLockFreeUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/QueueDriverLinuxLockFreeUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                   QueueDriverLinuxLockFreeUnitTest::myTestCallbackFunctions[] =
+{
+    &QueueDriverLinuxLockFreeUnitTest::enqueueDequeueTest,
+    &QueueDriverLinuxLockFreeUnitTest::capacityTest,
+    &QueueDriverLinuxLockFreeUnitTest::capacityTest2,
+    &QueueDriverLinuxLockFreeUnitTest::wrapAroundTest,
+    &QueueDriverLinuxLockFreeUnitTest::clearTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverLinuxLockFreeUnitTest::QueueDriverLinuxLockFreeUnitTest() :
+    UnitTest("QueueDriverLinuxLockFreeUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverLinuxLockFreeUnitTest::~QueueDriverLinuxLockFreeUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFreeUnitTest::enqueueDequeueTest()
+{
+    QueueDriverLinuxLockFree queueDriver(4, sizeof(std::uint32_t));
+
+    std::uint32_t value1 = 3;
+    std::uint32_t value2 = 5;
+
+    bool isEnqueued1 = queueDriver.driverEnqueue(&value1);
+    bool isEnqueued2 = queueDriver.driverEnqueue(&value2);
+
+    std::uint32_t size = queueDriver.driverGetSize();
+
+    std::uint32_t first = 0;
+    bool isDequeued1 = queueDriver.driverDequeue(&first);
+
+    std::uint32_t second = 0;
+    bool isDequeued2 = queueDriver.driverDequeue(&second);
+
+    std::uint32_t third = 0;
+    bool isDequeued3 = queueDriver.driverDequeueFast(&third);
+
+    return UNIT_TEST_REPORT(
+                UNIT_TEST_CASE_EQUAL(isEnqueued1, true)                       &
+                UNIT_TEST_CASE_EQUAL(isEnqueued2, true)                       &
+                UNIT_TEST_CASE_EQUAL(size, static_cast<std::uint32_t>(2))     &
+                UNIT_TEST_CASE_EQUAL(isDequeued1, true)                       &
+                UNIT_TEST_CASE_EQUAL(first, static_cast<std::uint32_t>(3))    &
+                UNIT_TEST_CASE_EQUAL(isDequeued2, true)                       &
+                UNIT_TEST_CASE_EQUAL(second, static_cast<std::uint32_t>(5))   &
+                UNIT_TEST_CASE_EQUAL(isDequeued3, false));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFreeUnitTest::capacityTest()
+{
+    QueueDriverLinuxLockFree queueDriver(3, sizeof(std::uint8_t));
+
+    bool isEnqueued = true;
+
+    for (std::uint8_t i = 0; i < 3; i++)
+    {
+        isEnqueued &= queueDriver.driverEnqueue(&i);
+    }
+
+    std::uint8_t value = 4;
+    bool isOverflowEnqueued = queueDriver.driverEnqueue(&value);
+
+    return UNIT_TEST_REPORT(
+          UNIT_TEST_CASE_EQUAL(isEnqueued, true)                              &
+          UNIT_TEST_CASE_EQUAL(isOverflowEnqueued, false)                     &
+          UNIT_TEST_CASE_EQUAL(queueDriver.getCapacity(),
+                               static_cast<std::uint32_t>(3))                 &
+          UNIT_TEST_CASE_EQUAL(queueDriver.driverGetSize(),
+                               static_cast<std::uint32_t>(3)));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFreeUnitTest::capacityTest2()
+{
+    QueueDriverLinuxLockFree queueDriver(1, sizeof(std::uint16_t));
+
+    std::uint16_t value1 = 1000;
+    std::uint16_t value2 = 2000;
+
+    bool isEnqueued1 = queueDriver.driverEnqueue(&value1);
+    bool isEnqueued2 = queueDriver.driverEnqueue(&value2);
+
+    std::uint16_t first = 0;
+    queueDriver.driverDequeueFast(&first);
+
+    bool isEnqueued3 = queueDriver.driverEnqueue(&value2);
+
+    std::uint16_t second = 0;
+    queueDriver.driverDequeueFast(&second);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(isEnqueued1, true)                            &
+           UNIT_TEST_CASE_EQUAL(isEnqueued2, false)                           &
+           UNIT_TEST_CASE_EQUAL(first, static_cast<std::uint16_t>(1000))      &
+           UNIT_TEST_CASE_EQUAL(isEnqueued3, true)                            &
+           UNIT_TEST_CASE_EQUAL(second, static_cast<std::uint16_t>(2000)));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFreeUnitTest::wrapAroundTest()
+{
+    QueueDriverLinuxLockFree queueDriver(3, sizeof(std::uint32_t));
+
+    bool isInOrder = true;
+
+    // Several laps around the ring with the queue partially filled
+    for (std::uint32_t i = 0; i < 20; i++)
+    {
+        std::uint32_t value1 = 2 * i;
+        std::uint32_t value2 = (2 * i) + 1;
+
+        queueDriver.driverEnqueue(&value1);
+        queueDriver.driverEnqueue(&value2);
+
+        std::uint32_t first = 0;
+        std::uint32_t second = 0;
+
+        queueDriver.driverDequeueFast(&first);
+        queueDriver.driverDequeueFast(&second);
+
+        isInOrder &= ((first == value1) && (second == value2));
+    }
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(isInOrder, true)                              &
+           UNIT_TEST_CASE_EQUAL(queueDriver.driverGetSize(),
+                                static_cast<std::uint32_t>(0)));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverLinuxLockFreeUnitTest::clearTest()
+{
+    QueueDriverLinuxLockFree queueDriver(4, sizeof(std::uint32_t));
+
+    std::uint32_t value = 7;
+
+    queueDriver.driverEnqueue(&value);
+    queueDriver.driverEnqueue(&value);
+
+    queueDriver.driverClear();
+
+    std::uint32_t sizeAfterClear = queueDriver.driverGetSize();
+
+    std::uint32_t dequeuedValue = 0;
+    bool isDequeued = queueDriver.driverDequeueFast(&dequeuedValue);
+
+    return UNIT_TEST_REPORT(
+           UNIT_TEST_CASE_EQUAL(sizeAfterClear, static_cast<std::uint32_t>(0)) &
+           UNIT_TEST_CASE_EQUAL(isDequeued, false));
+}
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SeqLockUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SeqLockUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <pthread.h>
+
+#include <Plat4m_Core/UnitTest/SeqLockUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+// Every field holds the same value so a torn read shows up as a mismatch
+struct TestData
+{
+    std::uint32_t values[8];
+};
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nConcurrentWrites = 200000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void* writerThreadCallback(void* arg)
+{
+    SeqLock<TestData>& seqLock = *(static_cast<SeqLock<TestData>*>(arg));
+
+    for (std::uint32_t i = 1; i <= nConcurrentWrites; i++)
+    {
+        TestData data;
+
+        for (std::uint32_t j = 0; j < arraySize(data.values); j++)
+        {
+            data.values[j] = i;
+        }
+
+        seqLock.write(data);
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                    SeqLockUnitTest::myTestCallbackFunctions[] =
+{
+    &SeqLockUnitTest::readWriteTest,
+    &SeqLockUnitTest::readIfChangedTest,
+    &SeqLockUnitTest::concurrentReadTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SeqLockUnitTest::SeqLockUnitTest() :
+    UnitTest("SeqLockUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SeqLockUnitTest::~SeqLockUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SeqLockUnitTest::readWriteTest()
+{
+    SeqLock<std::uint32_t> seqLock;
+
+    std::uint32_t initialData = 1;
+    const std::uint32_t initialVersion = seqLock.read(initialData);
+
+    seqLock.write(42);
+    seqLock.write(43);
+
+    std::uint32_t data = 0;
+    const std::uint32_t version = seqLock.read(data);
+
+    return UNIT_TEST_REPORT(
+               UNIT_TEST_CASE_EQUAL(initialData, (std::uint32_t) 0)          &
+               UNIT_TEST_CASE_EQUAL(initialVersion, (std::uint32_t) 0)       &
+               UNIT_TEST_CASE_EQUAL(data, (std::uint32_t) 43)                &
+               UNIT_TEST_CASE_EQUAL(version, (std::uint32_t) 2)              &
+               UNIT_TEST_CASE_EQUAL(seqLock.getVersion(), (std::uint32_t) 2));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockUnitTest::readIfChangedTest()
+{
+    SeqLock<std::uint32_t> seqLock;
+
+    std::uint32_t data = 0;
+    std::uint32_t version = 0;
+
+    const bool isInitiallyChanged = seqLock.readIfChanged(data, version);
+
+    seqLock.write(7);
+
+    const bool isChanged = seqLock.readIfChanged(data, version);
+    const std::uint32_t changedData = data;
+
+    // Unchanged data is not copied
+    data = 0;
+    const bool isChangedAgain = seqLock.readIfChanged(data, version);
+
+    return UNIT_TEST_REPORT(
+                       UNIT_TEST_CASE_EQUAL(isInitiallyChanged, false)       &
+                       UNIT_TEST_CASE_EQUAL(isChanged, true)                 &
+                       UNIT_TEST_CASE_EQUAL(changedData, (std::uint32_t) 7)  &
+                       UNIT_TEST_CASE_EQUAL(version, (std::uint32_t) 1)      &
+                       UNIT_TEST_CASE_EQUAL(isChangedAgain, false)           &
+                       UNIT_TEST_CASE_EQUAL(data, (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockUnitTest::concurrentReadTest()
+{
+    SeqLock<TestData> seqLock;
+
+    pthread_t threadHandle;
+    pthread_create(&threadHandle, NULL, &writerThreadCallback, &seqLock);
+
+    bool isConsistent = true;
+    bool isInOrder = true;
+    std::uint32_t lastVersion = 0;
+
+    while (seqLock.getVersion() < nConcurrentWrites)
+    {
+        TestData data;
+        const std::uint32_t version = seqLock.read(data);
+
+        // Write i stores i, so the data also identifies its version
+        for (std::uint32_t j = 0; j < arraySize(data.values); j++)
+        {
+            isConsistent &= (data.values[j] == version);
+        }
+
+        isInOrder &= (version >= lastVersion);
+
+        lastVersion = version;
+    }
+
+    pthread_join(threadHandle, NULL);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isConsistent, true) &
+                            UNIT_TEST_CASE_EQUAL(isInOrder, true));
+}
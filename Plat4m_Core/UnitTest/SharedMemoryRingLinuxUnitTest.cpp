@@ -0,0 +1,362 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SharedMemoryRingLinuxUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SharedMemoryRingLinuxUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <Plat4m_Core/UnitTest/SharedMemoryRingLinuxUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const char ringName[] = "/plat4m_shm_ring_unit_test";
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+///
+/// @brief Returns a time stamp derived from the given value.
+///
+static TimeStamp getTestTimeStamp(const std::uint32_t value)
+{
+    TimeStamp timeStamp;
+    timeStamp.timeS  = value;
+    timeStamp.timeNs = value * 1000;
+
+    return timeStamp;
+}
+
+///
+/// @brief Reads the given write index and checks the sample matches what
+/// writeValue() stored for the given value.
+///
+static bool isSampleValid(const SharedMemoryRingLinux& ring,
+                          const std::uint64_t writeIndex,
+                          const std::uint32_t value)
+{
+    std::uint32_t data = 0;
+    std::uint32_t sequenceId = 0;
+    TimeStamp timeStamp;
+
+    const SharedMemoryRingLinux::ReadResult result =
+                            ring.read(writeIndex, &data, sequenceId, timeStamp);
+
+    return (result == SharedMemoryRingLinux::READ_RESULT_OK) &&
+           (data == value)                                   &&
+           (sequenceId == (value + 1))                       &&
+           (timeStamp == getTestTimeStamp(value));
+}
+
+//------------------------------------------------------------------------------
+static void writeValue(SharedMemoryRingLinux& ring, const std::uint32_t value)
+{
+    ring.write(&value, value + 1, getTestTimeStamp(value));
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                      SharedMemoryRingLinuxUnitTest::myTestCallbackFunctions[] =
+{
+    &SharedMemoryRingLinuxUnitTest::createOpenTest,
+    &SharedMemoryRingLinuxUnitTest::readWriteTest,
+    &SharedMemoryRingLinuxUnitTest::overwriteTest,
+    &SharedMemoryRingLinuxUnitTest::waitForWriteTest,
+    &SharedMemoryRingLinuxUnitTest::crossProcessTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinuxUnitTest::SharedMemoryRingLinuxUnitTest() :
+    UnitTest("SharedMemoryRingLinuxUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SharedMemoryRingLinuxUnitTest::~SharedMemoryRingLinuxUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinuxUnitTest::createOpenTest()
+{
+    SharedMemoryRingLinux writer;
+    SharedMemoryRingLinux reader;
+
+    // Nothing to open until the writer creates the segment
+    SharedMemoryRingLinux::Error notFoundError =
+                                        reader.open(ringName, 8, sizeof(int));
+    SharedMemoryRingLinux::Error createError =
+                                       writer.create(ringName, 8, sizeof(int));
+    SharedMemoryRingLinux::Error mismatchError =
+                                       reader.open(ringName, 16, sizeof(int));
+    SharedMemoryRingLinux::Error openError =
+                                          reader.open(ringName, 8, sizeof(int));
+    SharedMemoryRingLinux::Error alreadyOpenError =
+                                          reader.open(ringName, 8, sizeof(int));
+
+    const bool isReaderOpen = reader.isOpen();
+    const std::uint32_t nSlots = reader.getNSlots();
+
+    reader.close();
+    writer.close();
+
+    // The writer unlinks the segment when it closes
+    SharedMemoryRingLinux::Error closedError =
+                                          reader.open(ringName, 8, sizeof(int));
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(notFoundError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_NOT_FOUND)     &
+        UNIT_TEST_CASE_EQUAL(createError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_NONE)          &
+        UNIT_TEST_CASE_EQUAL(mismatchError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_SIZE_MISMATCH) &
+        UNIT_TEST_CASE_EQUAL(openError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_NONE)          &
+        UNIT_TEST_CASE_EQUAL(alreadyOpenError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_ALREADY_OPEN)  &
+        UNIT_TEST_CASE_EQUAL(isReaderOpen, true)                              &
+        UNIT_TEST_CASE_EQUAL(nSlots, (std::uint32_t) 8)                       &
+        UNIT_TEST_CASE_EQUAL(reader.isOpen(), false)                          &
+        UNIT_TEST_CASE_EQUAL(closedError.getCode(),
+                             SharedMemoryRingLinux::ERROR_CODE_NOT_FOUND));
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinuxUnitTest::readWriteTest()
+{
+    SharedMemoryRingLinux writer;
+    SharedMemoryRingLinux reader;
+
+    writer.create(ringName, 8, sizeof(std::uint32_t));
+    reader.open(ringName, 8, sizeof(std::uint32_t));
+
+    std::uint32_t data;
+    std::uint32_t sequenceId;
+    TimeStamp timeStamp;
+
+    const SharedMemoryRingLinux::ReadResult emptyResult =
+                                   reader.read(0, &data, sequenceId, timeStamp);
+
+    for (std::uint32_t i = 0; i < 3; i++)
+    {
+        writeValue(writer, 100 + i);
+    }
+
+    const bool isValid = isSampleValid(reader, 0, 100) &
+                         isSampleValid(reader, 1, 101) &
+                         isSampleValid(reader, 2, 102);
+
+    const std::uint64_t nWrites = reader.getNWrites();
+
+    reader.close();
+    writer.close();
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(emptyResult,
+                             SharedMemoryRingLinux::READ_RESULT_NOT_WRITTEN) &
+        UNIT_TEST_CASE_EQUAL(isValid, true)                                  &
+        UNIT_TEST_CASE_EQUAL(nWrites, (std::uint64_t) 3));
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinuxUnitTest::overwriteTest()
+{
+    SharedMemoryRingLinux writer;
+
+    writer.create(ringName, 4, sizeof(std::uint32_t));
+
+    for (std::uint32_t i = 0; i < 6; i++)
+    {
+        writeValue(writer, i);
+    }
+
+    std::uint32_t data;
+    std::uint32_t sequenceId;
+    TimeStamp timeStamp;
+
+    // Write indexes 0 and 1 were replaced by 4 and 5
+    const SharedMemoryRingLinux::ReadResult result0 =
+                                   writer.read(0, &data, sequenceId, timeStamp);
+    const SharedMemoryRingLinux::ReadResult result1 =
+                                   writer.read(1, &data, sequenceId, timeStamp);
+    const SharedMemoryRingLinux::ReadResult result6 =
+                                   writer.read(6, &data, sequenceId, timeStamp);
+
+    const bool isValid = isSampleValid(writer, 2, 2) &
+                         isSampleValid(writer, 3, 3) &
+                         isSampleValid(writer, 4, 4) &
+                         isSampleValid(writer, 5, 5);
+
+    writer.close();
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(result0,
+                             SharedMemoryRingLinux::READ_RESULT_OVERWRITTEN) &
+        UNIT_TEST_CASE_EQUAL(result1,
+                             SharedMemoryRingLinux::READ_RESULT_OVERWRITTEN) &
+        UNIT_TEST_CASE_EQUAL(result6,
+                             SharedMemoryRingLinux::READ_RESULT_NOT_WRITTEN) &
+        UNIT_TEST_CASE_EQUAL(isValid, true));
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinuxUnitTest::waitForWriteTest()
+{
+    SharedMemoryRingLinux writer;
+    SharedMemoryRingLinux reader;
+
+    writer.create(ringName, 4, sizeof(std::uint32_t));
+    reader.open(ringName, 4, sizeof(std::uint32_t));
+
+    const bool isTimeoutWritten = reader.waitForWrite(0, 10);
+
+    writeValue(writer, 1);
+
+    // Returns straight away since the count already moved on
+    const bool isWritten = reader.waitForWrite(0, 1000);
+
+    reader.close();
+    writer.close();
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isTimeoutWritten, false) &
+        UNIT_TEST_CASE_EQUAL(isWritten, true));
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRingLinuxUnitTest::crossProcessTest()
+{
+    const std::uint32_t nSamples = 100;
+    const std::uint32_t nSlots = 128;
+
+    SharedMemoryRingLinux writer;
+
+    writer.create(ringName, nSlots, sizeof(std::uint32_t));
+
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        // Child: read every sample in order, waking on the futex, and report
+        // success through the exit status
+        SharedMemoryRingLinux reader;
+
+        SharedMemoryRingLinux::Error error =
+                           reader.open(ringName, nSlots, sizeof(std::uint32_t));
+
+        if (error.getCode() != SharedMemoryRingLinux::ERROR_CODE_NONE)
+        {
+            _exit(1);
+        }
+
+        std::uint64_t writeIndex = 0;
+
+        while (writeIndex < nSamples)
+        {
+            if (writeIndex == reader.getNWrites())
+            {
+                if (!reader.waitForWrite(writeIndex, 2000))
+                {
+                    _exit(2);
+                }
+
+                continue;
+            }
+
+            if (!isSampleValid(reader, writeIndex, (std::uint32_t) writeIndex))
+            {
+                _exit(3);
+            }
+
+            writeIndex++;
+        }
+
+        _exit(0);
+    }
+
+    // The ring holds every sample so the child can never be overrun, the
+    // pauses make it wait on the futex part of the time
+    for (std::uint32_t i = 0; i < nSamples; i++)
+    {
+        writeValue(writer, i);
+
+        if ((i % 10) == 9)
+        {
+            usleep(2000);
+        }
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+
+    writer.close();
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(WIFEXITED(status), true) &
+        UNIT_TEST_CASE_EQUAL(WEXITSTATUS(status), 0));
+}
@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SystemLinuxUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SystemLinuxUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <ctime>
+
+#include <Plat4m_Core/UnitTest/SystemLinuxUnitTest.h>
+#include <Plat4m_Core/System.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                SystemLinuxUnitTest::myTestCallbackFunctions[] =
+{
+    &SystemLinuxUnitTest::timeStampRangeTest,
+    &SystemLinuxUnitTest::timeConsistencyTest,
+    &SystemLinuxUnitTest::wallTimeStampTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SystemLinuxUnitTest::SystemLinuxUnitTest() :
+    UnitTest("SystemLinuxUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SystemLinuxUnitTest::~SystemLinuxUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SystemLinuxUnitTest::timeStampRangeTest()
+{
+    // Sample a full second so the nanoseconds pass the value they had when
+    // the system started, where timeNs used to go negative
+    const TimeMs endTimeMs = System::getTimeMs() + 1000;
+
+    TimeStamp previousTimeStamp = System::getTimeStamp();
+
+    bool isInRange = true;
+    bool isMonotonic = true;
+
+    while (System::getTimeMs() < endTimeMs)
+    {
+        TimeStamp timeStamp = System::getTimeStamp();
+
+        isInRange &= ((timeStamp.timeNs >= 0) &&
+                      (timeStamp.timeNs < 1000000000));
+        isMonotonic &= (timeStamp >= previousTimeStamp);
+
+        previousTimeStamp = timeStamp;
+
+        System::delayTimeMs(1);
+    }
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isInRange, true) &
+                            UNIT_TEST_CASE_EQUAL(isMonotonic, true));
+}
+
+//------------------------------------------------------------------------------
+bool SystemLinuxUnitTest::timeConsistencyTest()
+{
+    const TimeUs startTimeUs = System::getTimeUs();
+    const TimeStamp timeStamp = System::getTimeStamp();
+    const TimeUs endTimeUs = System::getTimeUs();
+
+    const TimeUs timeStampUs = timeStamp.timeS * 1000000 +
+                               timeStamp.timeNs / 1000;
+
+    // All read from the same clock and start time
+    return UNIT_TEST_REPORT(
+                       UNIT_TEST_CASE_EQUAL(timeStampUs >= startTimeUs, true) &
+                       UNIT_TEST_CASE_EQUAL(timeStampUs <= endTimeUs, true));
+}
+
+//------------------------------------------------------------------------------
+bool SystemLinuxUnitTest::wallTimeStampTest()
+{
+    const time_t startTimeS = time(NULL);
+    const TimeStamp timeStamp = System::getWallTimeStamp();
+    const time_t endTimeS = time(NULL);
+
+    // Seconds since the epoch, not since the system started
+    return UNIT_TEST_REPORT(
+              UNIT_TEST_CASE_EQUAL(timeStamp.timeS >= startTimeS, true)     &
+              UNIT_TEST_CASE_EQUAL(timeStamp.timeS <= endTimeS, true)       &
+              UNIT_TEST_CASE_EQUAL(timeStamp.timeNs < 1000000000, true));
+}
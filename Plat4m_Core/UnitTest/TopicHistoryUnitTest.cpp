@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicHistoryUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicHistoryUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <pthread.h>
+
+#include <Plat4m_Core/UnitTest/TopicHistoryUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+// Written as a pair so a torn read shows up as a mismatch
+struct TestSample
+{
+    std::uint32_t value;
+    std::uint32_t inverseValue;
+};
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nConcurrentWrites = 200000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void* writerThreadCallback(void* arg)
+{
+    TopicHistory<TestSample>& history =
+                                 *(static_cast<TopicHistory<TestSample>*>(arg));
+
+    for (std::uint32_t i = 0; i < nConcurrentWrites; i++)
+    {
+        TestSample sample;
+        sample.value        = i;
+        sample.inverseValue = ~i;
+
+        history.write(sample, i, TimeStamp());
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                               TopicHistoryUnitTest::myTestCallbackFunctions[] =
+{
+    &TopicHistoryUnitTest::emptyTest,
+    &TopicHistoryUnitTest::latestTest,
+    &TopicHistoryUnitTest::wrapTest,
+    &TopicHistoryUnitTest::concurrentReadTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicHistoryUnitTest::TopicHistoryUnitTest() :
+    UnitTest("TopicHistoryUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicHistoryUnitTest::~TopicHistoryUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicHistoryUnitTest::emptyTest()
+{
+    TopicHistory<std::uint32_t> history;
+    TopicHistory<std::uint32_t>::Sample sample;
+
+    const bool isDisabledLatestRead = history.readLatest(sample);
+    const std::uint32_t nDisabledSamples = history.readHistory(&sample, 1);
+
+    history.setDepth(4);
+
+    const bool isEmptyLatestRead = history.readLatest(sample);
+    const std::uint32_t nEmptySamples = history.readHistory(&sample, 1);
+
+    return UNIT_TEST_REPORT(
+                UNIT_TEST_CASE_EQUAL(isDisabledLatestRead, false)            &
+                UNIT_TEST_CASE_EQUAL(nDisabledSamples, (std::uint32_t) 0)    &
+                UNIT_TEST_CASE_EQUAL(history.getDepth(), (std::uint32_t) 4)  &
+                UNIT_TEST_CASE_EQUAL(isEmptyLatestRead, false)               &
+                UNIT_TEST_CASE_EQUAL(nEmptySamples, (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool TopicHistoryUnitTest::latestTest()
+{
+    TopicHistory<std::uint32_t> history;
+    history.setDepth(4);
+
+    TimeStamp timeStamp;
+    timeStamp.timeS = 7;
+
+    history.write(10, 0, TimeStamp());
+    history.write(11, 1, TimeStamp());
+    history.write(12, 2, timeStamp);
+
+    TopicHistory<std::uint32_t>::Sample sample;
+    const bool isLatestRead = history.readLatest(sample);
+
+    return UNIT_TEST_REPORT(
+                    UNIT_TEST_CASE_EQUAL(isLatestRead, true)                &
+                    UNIT_TEST_CASE_EQUAL(sample.data, (std::uint32_t) 12)   &
+                    UNIT_TEST_CASE_EQUAL(sample.sequenceId, (std::uint32_t) 2) &
+                    UNIT_TEST_CASE_EQUAL(sample.timeStamp == timeStamp, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicHistoryUnitTest::wrapTest()
+{
+    TopicHistory<std::uint32_t> history;
+    history.setDepth(4);
+
+    for (std::uint32_t i = 0; i < 10; i++)
+    {
+        history.write(100 + i, i, TimeStamp());
+    }
+
+    // Only the last 4 are kept, oldest first
+    TopicHistory<std::uint32_t>::Sample samples[8];
+    const std::uint32_t nSamples = history.readHistory(samples, 8);
+
+    TopicHistory<std::uint32_t>::Sample sample;
+    const bool isOverwrittenRead = history.read(5, sample);
+    const bool isUnwrittenRead = history.read(10, sample);
+
+    return UNIT_TEST_REPORT(
+               UNIT_TEST_CASE_EQUAL(nSamples, (std::uint32_t) 4)              &
+               UNIT_TEST_CASE_EQUAL(samples[0].sequenceId, (std::uint32_t) 6) &
+               UNIT_TEST_CASE_EQUAL(samples[0].data, (std::uint32_t) 106)     &
+               UNIT_TEST_CASE_EQUAL(samples[3].sequenceId, (std::uint32_t) 9) &
+               UNIT_TEST_CASE_EQUAL(samples[3].data, (std::uint32_t) 109)     &
+               UNIT_TEST_CASE_EQUAL(history.getNWrites(), (std::uint32_t) 10) &
+               UNIT_TEST_CASE_EQUAL(isOverwrittenRead, false)                 &
+               UNIT_TEST_CASE_EQUAL(isUnwrittenRead, false));
+}
+
+//------------------------------------------------------------------------------
+bool TopicHistoryUnitTest::concurrentReadTest()
+{
+    TopicHistory<TestSample> history;
+    history.setDepth(2);
+
+    pthread_t threadHandle;
+    pthread_create(&threadHandle, NULL, &writerThreadCallback, &history);
+
+    bool isConsistent = true;
+    bool isInOrder = true;
+    std::uint32_t lastSequenceId = 0;
+
+    while (history.getNWrites() < nConcurrentWrites)
+    {
+        TopicHistory<TestSample>::Sample sample;
+
+        if (history.readLatest(sample))
+        {
+            isConsistent &= (sample.data.value == sample.sequenceId);
+            isConsistent &= (sample.data.inverseValue == ~(sample.sequenceId));
+            isInOrder &= (sample.sequenceId >= lastSequenceId);
+
+            lastSequenceId = sample.sequenceId;
+        }
+    }
+
+    pthread_join(threadHandle, NULL);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isConsistent, true) &
+                            UNIT_TEST_CASE_EQUAL(isInOrder, true));
+}
@@ -68,7 +68,21 @@ ApplicationUnitTestLinuxApp::ApplicationUnitTestLinuxApp() :
     myByteArrayUnitTest(),
     myModuleUnitTest(),
     myTimeStampUnitTest(),
-    myListUnitTest()
+    myListUnitTest(),
+    myQueueDriverLinuxLockFreeUnitTest(),
+    myIdHashIndexUnitTest(),
+    myWaitConditionLinuxUnitTest(),
+    myCrcUnitTest(),
+    myAllocationMemoryPoolUnitTest(),
+    myArrayListUnitTest(),
+    myIntrusiveListUnitTest(),
+    mySystemLinuxUnitTest(),
+    myTopicHistoryUnitTest(),
+    myLockFreeQueueUnitTest(),
+    myExecutorLinuxUnitTest(),
+    mySharedMemoryRingLinuxUnitTest(),
+    mySeqLockUnitTest(),
+    myBinaryMessageHandlerGroupUnitTest()
 {
 }
 
@@ -114,4 +128,18 @@ void ApplicationUnitTestLinuxApp::initializeSystem()
     addUnitTest(myModuleUnitTest);
     addUnitTest(myTimeStampUnitTest);
     addUnitTest(myListUnitTest);
+    addUnitTest(myQueueDriverLinuxLockFreeUnitTest);
+    addUnitTest(myIdHashIndexUnitTest);
+    addUnitTest(myWaitConditionLinuxUnitTest);
+    addUnitTest(myCrcUnitTest);
+    addUnitTest(myAllocationMemoryPoolUnitTest);
+    addUnitTest(myArrayListUnitTest);
+    addUnitTest(myIntrusiveListUnitTest);
+    addUnitTest(mySystemLinuxUnitTest);
+    addUnitTest(myTopicHistoryUnitTest);
+    addUnitTest(myLockFreeQueueUnitTest);
+    addUnitTest(myExecutorLinuxUnitTest);
+    addUnitTest(mySharedMemoryRingLinuxUnitTest);
+    addUnitTest(mySeqLockUnitTest);
+    addUnitTest(myBinaryMessageHandlerGroupUnitTest);
 }
@@ -56,6 +56,20 @@
 #include <Plat4m_Core/UnitTest/ModuleUnitTest.h>
 #include <Plat4m_Core/UnitTest/TimeStampUnitTest.h>
 #include <Plat4m_Core/UnitTest/ListUnitTest.h>
+#include <Plat4m_Core/UnitTest/QueueDriverLinuxLockFreeUnitTest.h>
+#include <Plat4m_Core/UnitTest/IdHashIndexUnitTest.h>
+#include <Plat4m_Core/UnitTest/WaitConditionLinuxUnitTest.h>
+#include <Plat4m_Core/UnitTest/CrcUnitTest.h>
+#include <Plat4m_Core/UnitTest/AllocationMemoryPoolUnitTest.h>
+#include <Plat4m_Core/UnitTest/ArrayListUnitTest.h>
+#include <Plat4m_Core/UnitTest/IntrusiveListUnitTest.h>
+#include <Plat4m_Core/UnitTest/SystemLinuxUnitTest.h>
+#include <Plat4m_Core/UnitTest/TopicHistoryUnitTest.h>
+#include <Plat4m_Core/UnitTest/LockFreeQueueUnitTest.h>
+#include <Plat4m_Core/UnitTest/ExecutorLinuxUnitTest.h>
+#include <Plat4m_Core/UnitTest/SharedMemoryRingLinuxUnitTest.h>
+#include <Plat4m_Core/UnitTest/SeqLockUnitTest.h>
+#include <Plat4m_Core/UnitTest/BinaryMessageHandlerGroupUnitTest.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -105,6 +119,20 @@ private:
     ModuleUnitTest myModuleUnitTest;
     TimeStampUnitTest myTimeStampUnitTest;
     ListUnitTest myListUnitTest;
+    QueueDriverLinuxLockFreeUnitTest myQueueDriverLinuxLockFreeUnitTest;
+    IdHashIndexUnitTest myIdHashIndexUnitTest;
+    WaitConditionLinuxUnitTest myWaitConditionLinuxUnitTest;
+    CrcUnitTest myCrcUnitTest;
+    AllocationMemoryPoolUnitTest myAllocationMemoryPoolUnitTest;
+    ArrayListUnitTest myArrayListUnitTest;
+    IntrusiveListUnitTest myIntrusiveListUnitTest;
+    SystemLinuxUnitTest mySystemLinuxUnitTest;
+    TopicHistoryUnitTest myTopicHistoryUnitTest;
+    LockFreeQueueUnitTest myLockFreeQueueUnitTest;
+    ExecutorLinuxUnitTest myExecutorLinuxUnitTest;
+    SharedMemoryRingLinuxUnitTest mySharedMemoryRingLinuxUnitTest;
+    SeqLockUnitTest mySeqLockUnitTest;
+    BinaryMessageHandlerGroupUnitTest myBinaryMessageHandlerGroupUnitTest;
 
     //--------------------------------------------------------------------------
     // Private methods implemented from Application
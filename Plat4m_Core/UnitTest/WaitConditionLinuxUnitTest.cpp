@@ -0,0 +1,227 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file WaitConditionLinuxUnitTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief WaitConditionLinuxUnitTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <ctime>
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <Plat4m_Core/UnitTest/WaitConditionLinuxUnitTest.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static std::uint64_t getMonotonicTimeMs()
+{
+    struct timespec timeSpec;
+    clock_gettime(CLOCK_MONOTONIC, &timeSpec);
+
+    return ((static_cast<std::uint64_t>(timeSpec.tv_sec) * 1000) +
+            (static_cast<std::uint64_t>(timeSpec.tv_nsec) / 1000000));
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                         WaitConditionLinuxUnitTest::myTestCallbackFunctions[] =
+{
+    &WaitConditionLinuxUnitTest::waitTimeoutTest,
+    &WaitConditionLinuxUnitTest::waitPendingNotificationTest,
+    &WaitConditionLinuxUnitTest::waitNotifyTest,
+    &WaitConditionLinuxUnitTest::semaphoreWaitTimeoutTest,
+    &WaitConditionLinuxUnitTest::semaphoreWaitPostTest
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+WaitConditionLinuxUnitTest::WaitConditionLinuxUnitTest() :
+    UnitTest("WaitConditionLinuxUnitTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+WaitConditionLinuxUnitTest::~WaitConditionLinuxUnitTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool WaitConditionLinuxUnitTest::waitTimeoutTest()
+{
+    WaitConditionLinux waitCondition;
+
+    std::uint64_t startTimeMs = getMonotonicTimeMs();
+
+    WaitCondition::Error error = waitCondition.wait(20);
+
+    std::uint64_t elapsedTimeMs = getMonotonicTimeMs() - startTimeMs;
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(error.getCode(),
+                                      WaitCondition::ERROR_CODE_TIMEOUT)      &
+                 UNIT_TEST_CASE_EQUAL(elapsedTimeMs >= 20, true)              &
+                 UNIT_TEST_CASE_EQUAL(waitCondition.getNWaits(),
+                                      static_cast<std::uint32_t>(1))          &
+                 UNIT_TEST_CASE_EQUAL(waitCondition.getNTimeouts(),
+                                      static_cast<std::uint32_t>(1)));
+}
+
+//------------------------------------------------------------------------------
+bool WaitConditionLinuxUnitTest::waitPendingNotificationTest()
+{
+    WaitConditionLinux waitCondition;
+
+    // Notifications that arrive before the wait must not be lost
+    waitCondition.notify();
+    waitCondition.notify();
+
+    WaitCondition::Error error1 = waitCondition.wait(0);
+    WaitCondition::Error error2 = waitCondition.wait(0);
+    WaitCondition::Error error3 = waitCondition.wait(0);
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(error1.getCode(),
+                                      WaitCondition::ERROR_CODE_NONE)         &
+                 UNIT_TEST_CASE_EQUAL(error2.getCode(),
+                                      WaitCondition::ERROR_CODE_NONE)         &
+                 UNIT_TEST_CASE_EQUAL(error3.getCode(),
+                                      WaitCondition::ERROR_CODE_TIMEOUT)      &
+                 UNIT_TEST_CASE_EQUAL(waitCondition.getNWaits(),
+                                      static_cast<std::uint32_t>(3))          &
+                 UNIT_TEST_CASE_EQUAL(waitCondition.getNTimeouts(),
+                                      static_cast<std::uint32_t>(1)));
+}
+
+//------------------------------------------------------------------------------
+bool WaitConditionLinuxUnitTest::waitNotifyTest()
+{
+    WaitConditionLinux waitCondition;
+
+    pthread_t threadHandle;
+    pthread_create(&threadHandle, NULL, &notifyThreadCallback, &waitCondition);
+
+    WaitCondition::Error error = waitCondition.wait(5000);
+
+    pthread_join(threadHandle, NULL);
+
+    return UNIT_TEST_REPORT(
+                 UNIT_TEST_CASE_EQUAL(error.getCode(),
+                                      WaitCondition::ERROR_CODE_NONE)         &
+                 UNIT_TEST_CASE_EQUAL(waitCondition.getNTimeouts(),
+                                      static_cast<std::uint32_t>(0)));
+}
+
+//------------------------------------------------------------------------------
+bool WaitConditionLinuxUnitTest::semaphoreWaitTimeoutTest()
+{
+    SemaphoreLinux semaphore(1, 0);
+
+    std::uint64_t startTimeMs = getMonotonicTimeMs();
+
+    Semaphore::Error error = semaphore.wait(20);
+
+    std::uint64_t elapsedTimeMs = getMonotonicTimeMs() - startTimeMs;
+
+    return UNIT_TEST_REPORT(
+                     UNIT_TEST_CASE_EQUAL(error.getCode(),
+                                          Semaphore::ERROR_CODE_TIMEOUT)      &
+                     UNIT_TEST_CASE_EQUAL(elapsedTimeMs >= 20, true)          &
+                     UNIT_TEST_CASE_EQUAL(semaphore.getNTimeouts(),
+                                          static_cast<std::uint32_t>(1)));
+}
+
+//------------------------------------------------------------------------------
+bool WaitConditionLinuxUnitTest::semaphoreWaitPostTest()
+{
+    SemaphoreLinux semaphore(1, 0);
+
+    semaphore.post();
+
+    Semaphore::Error error1 = semaphore.wait(20);
+    Semaphore::Error error2 = semaphore.wait(0);
+
+    return UNIT_TEST_REPORT(
+                     UNIT_TEST_CASE_EQUAL(error1.getCode(),
+                                          Semaphore::ERROR_CODE_NONE)         &
+                     UNIT_TEST_CASE_EQUAL(error2.getCode(),
+                                          Semaphore::ERROR_CODE_TIMEOUT)      &
+                     UNIT_TEST_CASE_EQUAL(semaphore.getNWaits(),
+                                          static_cast<std::uint32_t>(2)));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void* WaitConditionLinuxUnitTest::notifyThreadCallback(void* arg)
+{
+    WaitConditionLinux* waitCondition = static_cast<WaitConditionLinux*>(arg);
+
+    usleep(10000);
+
+    waitCondition->notify();
+
+    return 0;
+}
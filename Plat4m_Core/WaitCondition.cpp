@@ -52,7 +52,9 @@ using Plat4m::WaitCondition;
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-WaitCondition::WaitCondition()
+WaitCondition::WaitCondition() :
+    myNWaits(0),
+    myNTimeouts(0)
 {
 }
 
@@ -74,6 +76,13 @@ WaitCondition::Error WaitCondition::wait(const TimeMs waitTimeMs)
 {
     Error error = driverWait(waitTimeMs);
 
+    myNWaits.fetch_add(1, std::memory_order_relaxed);
+
+    if (error.getCode() == ERROR_CODE_TIMEOUT)
+    {
+        myNTimeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+
     return error;
 }
 
@@ -84,3 +93,15 @@ WaitCondition::Error WaitCondition::notify()
 
     return error;
 }
+
+//------------------------------------------------------------------------------
+std::uint32_t WaitCondition::getNWaits() const
+{
+    return (myNWaits.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t WaitCondition::getNTimeouts() const
+{
+    return (myNTimeouts.load(std::memory_order_relaxed));
+}
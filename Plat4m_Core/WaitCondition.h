@@ -46,6 +46,9 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdint>
+
 #include <Plat4m_Core/Plat4m.h>
 #include <Plat4m_Core/ErrorTemplate.h>
 
@@ -70,7 +73,8 @@ public:
     
     enum ErrorCode
     {
-        ERROR_CODE_NONE
+        ERROR_CODE_NONE,
+        ERROR_CODE_TIMEOUT
     };
 
     typedef ErrorTemplate<ErrorCode> Error;
@@ -85,10 +89,23 @@ public:
     // Public methods
     //--------------------------------------------------------------------------
 
+    ///
+    /// @brief Waits for a notification. Notifications are counted, one that
+    /// arrives while nothing is waiting is consumed by the next wait().
+    /// @param waitTimeMs Time to wait, 0xFFFFFFFF to wait forever.
+    /// @return ERROR_CODE_TIMEOUT if no notification arrived in time.
+    ///
     Error wait(const TimeMs waitTimeMs = 0xFFFFFFFF);
 
     Error notify();
 
+    std::uint32_t getNWaits() const;
+
+    ///
+    /// @brief Returns the number of wait() calls that timed out.
+    ///
+    std::uint32_t getNTimeouts() const;
+
     // TODO May need notifyFromIsr() method
 
 protected:
@@ -111,6 +128,9 @@ private:
     // Private data members
     //--------------------------------------------------------------------------
 
+    std::atomic<std::uint32_t> myNWaits;
+
+    std::atomic<std::uint32_t> myNTimeouts;
 
     //--------------------------------------------------------------------------
     // Private pure virtual methods
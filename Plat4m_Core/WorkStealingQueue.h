@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file WorkStealingQueue.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief WorkStealingQueue class header file.
+///
+
+#ifndef PLAT4M_WORK_STEALING_QUEUE_H
+#define PLAT4M_WORK_STEALING_QUEUE_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/Plat4m.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Bounded Chase-Lev style queue owned by one thread. Only the owner
+/// may push(), which is a plain store. Any thread, including the owner, may
+/// steal() the oldest value with a single compare and swap. Values are taken
+/// oldest first by everyone so a task that keeps resubmitting itself can't
+/// starve the ones queued before it.
+/// @tparam T Value type, must be trivially copyable (e.g. a pointer).
+/// @tparam nValues Capacity.
+///
+template <typename T, std::uint32_t nValues>
+class WorkStealingQueue
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    WorkStealingQueue() :
+        myTop(0),
+        myBottom(0)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Public methods
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Adds a value. Owner thread only.
+    /// @return False if the queue is full.
+    ///
+    bool push(const T& value)
+    {
+        const std::uint64_t bottom = myBottom.load(std::memory_order_relaxed);
+        const std::uint64_t top = myTop.load(std::memory_order_acquire);
+
+        if ((bottom - top) >= nValues)
+        {
+            return false;
+        }
+
+        // The cell is free, whoever took the value at bottom - nValues has
+        // already moved myTop past it
+        myValues[bottom % nValues].store(value, std::memory_order_relaxed);
+        myBottom.store(bottom + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    ///
+    /// @brief Takes the oldest value. Any thread.
+    /// @return False if the queue is empty.
+    ///
+    bool steal(T& value)
+    {
+        std::uint64_t top = myTop.load(std::memory_order_acquire);
+
+        while (top < myBottom.load(std::memory_order_acquire))
+        {
+            value = myValues[top % nValues].load(std::memory_order_relaxed);
+
+            // Fails if another thread took it first, then try the next one
+            if (myTop.compare_exchange_strong(top,
+                                              top + 1,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    bool isEmpty() const
+    {
+        return (myTop.load(std::memory_order_acquire) >=
+                myBottom.load(std::memory_order_acquire));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    std::atomic<T> myValues[nValues];
+
+    std::atomic<std::uint64_t> myTop;
+
+    std::atomic<std::uint64_t> myBottom;
+
+    //--------------------------------------------------------------------------
+    // Private constructors
+    //--------------------------------------------------------------------------
+
+    //--------------------------------------------------------------------------
+    WorkStealingQueue(const WorkStealingQueue<T, nValues>& workStealingQueue);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_WORK_STEALING_QUEUE_H
@@ -68,6 +68,15 @@ ApplicationAcceptanceTestLinuxApp::ApplicationAcceptanceTestLinuxApp() :
     myTopicTest(),
     myTopicSubscriberTest(),
     myTopicSubscriberThreadTest(),
+    myTopicSubscriberExecutorTest(),
+    myTopicBridgeShmLinuxTest(),
+    myTopicRecorderLinuxTest(),
+    myDescriptorTest(),
+    myBinaryMessageBridgeTest(),
+    myBinaryMessageTransactionTest(),
+    mySerialPortLinuxTest(),
+    myComInterfaceTcpLinuxTest(),
+    myComInterfaceUdpLinuxTest(),
     myServiceTest(),
     myServiceClientTest(),
     myDataObjectTopicServiceTest()
@@ -112,6 +121,15 @@ void ApplicationAcceptanceTestLinuxApp::initializeSystem()
     addUnitTest(myTopicTest);
     addUnitTest(myTopicSubscriberTest);
     addUnitTest(myTopicSubscriberThreadTest);
+    addUnitTest(myTopicSubscriberExecutorTest);
+    addUnitTest(myTopicBridgeShmLinuxTest);
+    addUnitTest(myTopicRecorderLinuxTest);
+    addUnitTest(myDescriptorTest);
+    addUnitTest(myBinaryMessageBridgeTest);
+    addUnitTest(myBinaryMessageTransactionTest);
+    addUnitTest(mySerialPortLinuxTest);
+    addUnitTest(myComInterfaceTcpLinuxTest);
+    addUnitTest(myComInterfaceUdpLinuxTest);
     addUnitTest(myServiceTest);
     addUnitTest(myServiceClientTest);
     addUnitTest(myDataObjectTopicServiceTest);
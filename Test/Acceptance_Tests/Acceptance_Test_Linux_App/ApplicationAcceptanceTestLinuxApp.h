@@ -53,6 +53,15 @@
 #include <Test/Acceptance_Tests/TopicTest.h>
 #include <Test/Acceptance_Tests/TopicSubscriberTest.h>
 #include <Test/Acceptance_Tests/TopicSubscriberThreadTest.h>
+#include <Test/Acceptance_Tests/TopicSubscriberExecutorTest.h>
+#include <Test/Acceptance_Tests/TopicBridgeShmLinuxTest.h>
+#include <Test/Acceptance_Tests/TopicRecorderLinuxTest.h>
+#include <Test/Acceptance_Tests/DescriptorTest.h>
+#include <Test/Acceptance_Tests/BinaryMessageBridgeTest.h>
+#include <Test/Acceptance_Tests/BinaryMessageTransactionTest.h>
+#include <Test/Acceptance_Tests/SerialPortLinuxTest.h>
+#include <Test/Acceptance_Tests/ComInterfaceTcpLinuxTest.h>
+#include <Test/Acceptance_Tests/ComInterfaceUdpLinuxTest.h>
 #include <Test/Acceptance_Tests/ServiceTest.h>
 #include <Test/Acceptance_Tests/ServiceClientTest.h>
 #include <Test/Acceptance_Tests/DataObjectTopicServiceTest.h>
@@ -94,7 +103,7 @@ private:
     // Private data members
     //--------------------------------------------------------------------------
 
-    AllocationMemoryLite<4096> myAllocationMemory;
+    AllocationMemoryLite<131072> myAllocationMemory;
 
     SystemLinux mySystem;
 
@@ -106,6 +115,24 @@ private:
 
     TopicSubscriberThreadTest myTopicSubscriberThreadTest;
 
+    TopicSubscriberExecutorTest myTopicSubscriberExecutorTest;
+
+    TopicBridgeShmLinuxTest myTopicBridgeShmLinuxTest;
+
+    TopicRecorderLinuxTest myTopicRecorderLinuxTest;
+
+    DescriptorTest myDescriptorTest;
+
+    BinaryMessageBridgeTest myBinaryMessageBridgeTest;
+
+    BinaryMessageTransactionTest myBinaryMessageTransactionTest;
+
+    SerialPortLinuxTest mySerialPortLinuxTest;
+
+    ComInterfaceTcpLinuxTest myComInterfaceTcpLinuxTest;
+
+    ComInterfaceUdpLinuxTest myComInterfaceUdpLinuxTest;
+
     ServiceTest myServiceTest;
 
     ServiceClientTest myServiceClientTest;
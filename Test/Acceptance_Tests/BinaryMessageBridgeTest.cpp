@@ -0,0 +1,511 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridgeTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridgeTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Test/Acceptance_Tests/BinaryMessageBridgeTest.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/ServiceManager.h>
+#include <Plat4m_Core/CallbackFunction.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/PacketFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageBridge.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const std::uint32_t receiveBufferSize = 1024;
+
+static const std::uint16_t bridgeGroupId = 0x0100;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ByteArrayN<256> transmitByteArray;
+
+static ByteArrayN<receiveBufferSize> receiveByteArray;
+
+static ComLink* comLink = 0;
+
+static ComProtocolPlat4mBinary* comProtocol = 0;
+
+static BinaryMessageFrameHandler* binaryMessageFrameHandler = 0;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+///
+/// @brief Waits up to 1 s for the bridge to get all its credits back, so no
+/// frame for it is left on the link.
+///
+static bool waitForCredits(const BinaryMessageBridge& bridge,
+                           const std::uint32_t nCredits)
+{
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        if (bridge.getNCredits() == nCredits)
+        {
+            // Let the parsing thread return from the frame
+            System::delayTimeMs(10);
+
+            return true;
+        }
+
+        System::delayTimeMs(10);
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                            BinaryMessageBridgeTest::myTestCallbackFunctions[] =
+{
+    &BinaryMessageBridgeTest::acceptanceTest1,
+    &BinaryMessageBridgeTest::acceptanceTest2,
+    &BinaryMessageBridgeTest::acceptanceTest3
+};
+
+std::atomic<std::uint32_t> BinaryMessageBridgeTest::nSamples(0);
+
+std::atomic<std::uint32_t> BinaryMessageBridgeTest::lastSampleIndex(0);
+
+bool BinaryMessageBridgeTest::isInOrder = true;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeTest::BinaryMessageBridgeTest() :
+    UnitTest("BinaryMessageBridgeTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeTest::~BinaryMessageBridgeTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeTest::acceptanceTest1()
+{
+    //
+    // Procedure: Export one Topic and import the same message on a second
+    // Topic, then publish 20 samples on the first
+    //
+    // Test: Verify the second Topic receives every sample in order, in fewer
+    // frames than samples, and the credit used by each frame comes back
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    const TopicBase::Id exportTopicId = 60;
+    const TopicBase::Id importTopicId = 61;
+    const std::uint32_t nPublishedSamples = 20;
+
+    nSamples.store(0);
+    lastSampleIndex.store(0);
+    isInOrder = true;
+
+    TopicManager topicManager;
+    ServiceManager serviceManager;
+
+    BinaryMessageBridge bridge(bridgeGroupId,
+                               *comProtocol,
+                               *binaryMessageFrameHandler);
+
+    BinaryMessageBridge::Error exportError =
+                             bridge.exportTopic<Sample>(exportTopicId, 1);
+    BinaryMessageBridge::Error importError =
+                             bridge.importTopic<Sample>(importTopicId, 1);
+    BinaryMessageBridge::Error duplicateError =
+                             bridge.importTopic<Sample>(importTopicId + 1, 1);
+
+    Topic<Sample>::subscribe(importTopicId, createCallback(&sampleCallback));
+
+    bridge.enable();
+
+    for (std::uint32_t i = 1; i <= nPublishedSamples; i++)
+    {
+        Sample sample;
+        sample.index = i;
+        sample.value = i * 0.5f;
+
+        Topic<Sample>::create(exportTopicId).publish(sample);
+    }
+
+    const bool isReceived = waitForSamples(nPublishedSamples);
+    const bool isCreditReturned =
+                 waitForCredits(bridge, PLAT4M_BINARY_MESSAGE_BRIDGE_N_CREDITS);
+
+    bridge.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(exportError.getCode(),
+                             BinaryMessageBridge::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(importError.getCode(),
+                             BinaryMessageBridge::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(
+                           duplicateError.getCode(),
+                           BinaryMessageBridge::ERROR_CODE_MESSAGE_ID_IN_USE) &
+        UNIT_TEST_CASE_EQUAL(isReceived, true) &
+        UNIT_TEST_CASE_EQUAL(isInOrder, true) &
+        UNIT_TEST_CASE_EQUAL(lastSampleIndex.load(), nPublishedSamples) &
+        UNIT_TEST_CASE_EQUAL(bridge.getNSamplesSent(), nPublishedSamples) &
+        UNIT_TEST_CASE_EQUAL(bridge.getNSamplesReceived(), nPublishedSamples) &
+        UNIT_TEST_CASE_EQUAL(bridge.getNDroppedSamples(), (std::uint32_t) 0) &
+        UNIT_TEST_CASE_EQUAL((bridge.getNFramesSent() < nPublishedSamples),
+                             true) &
+        UNIT_TEST_CASE_EQUAL(isCreditReturned, true));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeTest::acceptanceTest2()
+{
+    //
+    // Procedure: Export a Service and import the same message as a second
+    // Service, then make a request to the second. Import another message
+    // nothing answers and make a request to it
+    //
+    // Test: Verify the first request is answered by the exported Service and
+    // the second times out
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    const ServiceBase::Id exportServiceId = 60;
+    const ServiceBase::Id importServiceId = 61;
+    const ServiceBase::Id unansweredServiceId = 62;
+
+    TopicManager topicManager;
+    ServiceManager serviceManager;
+
+    Service<std::uint32_t, std::uint32_t>::create(
+                                             exportServiceId,
+                                             createCallback(&serviceCallback));
+
+    BinaryMessageBridge bridge(bridgeGroupId,
+                               *comProtocol,
+                               *binaryMessageFrameHandler);
+
+    bridge.exportService<std::uint32_t, std::uint32_t>(exportServiceId, 2);
+    bridge.importService<std::uint32_t, std::uint32_t>(importServiceId, 2);
+    bridge.importService<std::uint32_t, std::uint32_t>(unansweredServiceId,
+                                                       3);
+
+    bridge.enable();
+
+    std::uint32_t response = 0;
+    ServiceBase::Error error =
+              Service<std::uint32_t, std::uint32_t>::request(importServiceId,
+                                                             21,
+                                                             response);
+
+    std::uint32_t unansweredResponse = 0;
+    ServiceBase::Error unansweredError =
+          Service<std::uint32_t, std::uint32_t>::request(unansweredServiceId,
+                                                         21,
+                                                         unansweredResponse);
+
+    bridge.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+                UNIT_TEST_CASE_EQUAL(error.getCode(),
+                                     ServiceBase::ERROR_CODE_NONE) &
+                UNIT_TEST_CASE_EQUAL(response, (std::uint32_t) 42) &
+                UNIT_TEST_CASE_EQUAL(unansweredError.getCode(),
+                                     ServiceBase::ERROR_CODE_TIMEOUT) &
+                UNIT_TEST_CASE_EQUAL(unansweredResponse, (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeTest::acceptanceTest3()
+{
+    //
+    // Procedure: Export and import a Topic through a bridge with 2 credits,
+    // stop the link receiving and publish 500 samples, then let the link
+    // receive again and publish one more sample
+    //
+    // Test: Verify publishing carries on once the credits run out by dropping
+    // samples, and that the credits are reset after the credit timeout so the
+    // last sample gets through
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    const TopicBase::Id exportTopicId = 62;
+    const TopicBase::Id importTopicId = 63;
+    const std::uint32_t nPublishedSamples = 500;
+    const std::uint32_t nCredits = 2;
+
+    nSamples.store(0);
+    lastSampleIndex.store(0);
+    isInOrder = true;
+
+    TopicManager topicManager;
+    ServiceManager serviceManager;
+
+    BinaryMessageBridge bridge(bridgeGroupId,
+                               *comProtocol,
+                               *binaryMessageFrameHandler,
+                               1,
+                               nCredits,
+                               100);
+
+    bridge.exportTopic<Sample>(exportTopicId, 4);
+    bridge.importTopic<Sample>(importTopicId, 4);
+
+    Topic<Sample>::subscribe(importTopicId, createCallback(&sampleCallback));
+
+    bridge.enable();
+
+    // Bytes received while the link is disabled are dropped
+    comLink->disable();
+
+    Topic<Sample>& topic = Topic<Sample>::create(exportTopicId);
+
+    Sample sample;
+    sample.value = 0.0f;
+
+    std::uint32_t minNCredits = nCredits;
+
+    for (std::uint32_t i = 1; i <= nPublishedSamples; i++)
+    {
+        sample.index = i;
+        topic.publish(sample);
+
+        if (bridge.getNCredits() < minNCredits)
+        {
+            minNCredits = bridge.getNCredits();
+        }
+
+        System::delayTimeMs(1);
+    }
+
+    const std::uint32_t nStalledSamplesReceived = nSamples.load();
+    const std::uint32_t nDroppedSamples = bridge.getNDroppedSamples();
+
+    comLink->enable();
+
+    // Wait out the queue before the last sample
+    System::delayTimeMs(300);
+
+    const std::uint32_t nSamplesBefore = nSamples.load();
+
+    sample.index = nPublishedSamples + 1;
+    topic.publish(sample);
+
+    const bool isReceived = waitForSamples(nSamplesBefore + 1);
+    const bool isCreditReturned = waitForCredits(bridge, nCredits);
+
+    bridge.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+            UNIT_TEST_CASE_EQUAL(nStalledSamplesReceived, (std::uint32_t) 0) &
+            UNIT_TEST_CASE_EQUAL(minNCredits, (std::uint32_t) 0) &
+            UNIT_TEST_CASE_EQUAL((nDroppedSamples > 0), true) &
+            UNIT_TEST_CASE_EQUAL((bridge.getNCreditTimeouts() > 0), true) &
+            UNIT_TEST_CASE_EQUAL(isReceived, true) &
+            UNIT_TEST_CASE_EQUAL(lastSampleIndex.load(),
+                                 nPublishedSamples + 1) &
+            UNIT_TEST_CASE_EQUAL(isCreditReturned, true));
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeTest::sampleCallback(const TopicSample<Sample>& sample)
+{
+    if (sample.data.index <= lastSampleIndex.load())
+    {
+        isInOrder = false;
+    }
+
+    lastSampleIndex.store(sample.data.index);
+    nSamples.fetch_add(1);
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error BinaryMessageBridgeTest::serviceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response)
+{
+    response.data = request.data * 2;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeTest::setUpComLink()
+{
+    // Shared by all tests, ComLink and its parsing thread live for the rest of
+    // the process
+    static LoopbackComInterface comInterface;
+    static ComInterfaceDeviceTemplate<256, 256>
+                                              comInterfaceDevice(comInterface);
+    static ComLink link(transmitByteArray,
+                        receiveByteArray,
+                        comInterfaceDevice,
+                        comInterface,
+                        receiveBufferSize);
+    static ComProtocolPlat4mBinary protocol(link);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+    static PacketFrameHandler packetFrameHandler(protocol, frameHandler);
+
+    if (isNullPointer(comLink))
+    {
+        // The default real-time priority would preempt the sender on every
+        // byte
+        link.getDataParsingThread().setPriority(0);
+
+        comLink = &link;
+        comProtocol = &protocol;
+        binaryMessageFrameHandler = &frameHandler;
+    }
+
+    comLink->enable();
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeTest::waitForSamples(
+                                         const std::uint32_t nExpectedSamples)
+{
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        if (nSamples.load() >= nExpectedSamples)
+        {
+            return true;
+        }
+
+        System::delayTimeMs(10);
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeTest::LoopbackComInterface::LoopbackComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+             BinaryMessageBridgeTest::LoopbackComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    const std::uint32_t size = byteArray.getSize();
+
+    for (std::uint32_t i = 0; i < size; i++)
+    {
+        byteReceived(byteArray[i]);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t
+           BinaryMessageBridgeTest::LoopbackComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+              BinaryMessageBridgeTest::LoopbackComInterface::getReceivedBytes(
+                                                    ByteArray& byteArray,
+                                                    const std::uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
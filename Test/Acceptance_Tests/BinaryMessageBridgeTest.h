@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridgeTest.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridgeTest class header file.
+///
+
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_TEST_H
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_TEST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/ServiceBase.h>
+#include <Plat4m_Core/ServiceRequest.h>
+#include <Plat4m_Core/ServiceResponse.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Runs BinaryMessageBridge over a ComLink looped back on itself, so
+/// each bridge exchanges frames with itself.
+///
+class BinaryMessageBridgeTest : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    struct Sample
+    {
+        std::uint32_t index;
+        float value;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageBridgeTest();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~BinaryMessageBridgeTest();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool acceptanceTest1();
+
+    static bool acceptanceTest2();
+
+    static bool acceptanceTest3();
+
+    static void sampleCallback(const TopicSample<Sample>& sample);
+
+    static ServiceBase::Error serviceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Hands every transmitted byte straight back to the byte received
+    /// callback, the way a UART receive interrupt would.
+    ///
+    class LoopbackComInterface : public ComInterface
+    {
+    public:
+
+        LoopbackComInterface();
+
+        Error transmitBytes(const ByteArray& byteArray,
+                            const bool waitUntilDone = true);
+
+        std::uint32_t getReceivedBytesCount();
+
+        Error getReceivedBytes(ByteArray& byteArray,
+                               const std::uint32_t nBytes = 0);
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    static std::atomic<std::uint32_t> nSamples;
+
+    static std::atomic<std::uint32_t> lastSampleIndex;
+
+    static bool isInOrder;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void setUpComLink();
+
+    static bool waitForSamples(const std::uint32_t nExpectedSamples);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BINARY_MESSAGE_BRIDGE_TEST_H
@@ -0,0 +1,556 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageTransactionTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageTransactionTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Test/Acceptance_Tests/BinaryMessageTransactionTest.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const std::uint32_t receiveBufferSize = 2048;
+
+static const std::uint16_t groupId = 0x0400;
+
+static const std::uint16_t incrementMessageId = 1;
+
+// Accepted but never answered
+static const std::uint16_t ignoreMessageId = 2;
+
+static const std::uint32_t maxTransactions =
+                          PLAT4M_BINARY_MESSAGE_FRAME_HANDLER_MAX_TRANSACTIONS;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ByteArrayN<256> transmitByteArray;
+
+static ByteArrayN<receiveBufferSize> receiveByteArray;
+
+static ComProtocolPlat4mBinary* comProtocol = 0;
+
+static BinaryMessageFrameHandler* binaryMessageFrameHandler = 0;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                       BinaryMessageTransactionTest::myTestCallbackFunctions[] =
+{
+    &BinaryMessageTransactionTest::acceptanceTest1,
+    &BinaryMessageTransactionTest::acceptanceTest2,
+    &BinaryMessageTransactionTest::acceptanceTest3
+};
+
+std::atomic<std::uint32_t> BinaryMessageTransactionTest::nCompletions(0);
+
+std::atomic<std::uint32_t> BinaryMessageTransactionTest::nTimeoutCompletions(0);
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionTest::BinaryMessageTransactionTest() :
+    UnitTest("BinaryMessageTransactionTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionTest::~BinaryMessageTransactionTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionTest::acceptanceTest1()
+{
+    //
+    // Procedure: Send 16 increment requests without waiting, each with a
+    // completion callback, then wait for each of them
+    //
+    // Test: Verify every transaction completes without error, each response
+    // matches its own request and the completion callback is called once per
+    // transaction
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    const std::uint32_t nRequests = 16;
+
+    IncrementServer server(*comProtocol, *binaryMessageFrameHandler);
+
+    static BinaryMessageFrameHandler::Transaction transactions[nRequests];
+    static ValueMessage responseMessages[nRequests] =
+    {
+        incrementMessageId, incrementMessageId, incrementMessageId,
+        incrementMessageId, incrementMessageId, incrementMessageId,
+        incrementMessageId, incrementMessageId, incrementMessageId,
+        incrementMessageId, incrementMessageId, incrementMessageId,
+        incrementMessageId, incrementMessageId, incrementMessageId,
+        incrementMessageId
+    };
+    ValueMessage requestMessage(incrementMessageId);
+    BinaryMessageFrameHandler::CompletionCallback& callback =
+                                         createCallback(&completionCallback);
+
+    nCompletions.store(0);
+
+    std::uint32_t nTransmitErrors = 0;
+    std::uint32_t nErrors = 0;
+    std::uint32_t nWrongResponses = 0;
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        requestMessage.setValue(i * 10);
+
+        BinaryMessageFrameHandler::Error error =
+                binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                   requestMessage,
+                                   responseMessages[i],
+                                   transactions[i],
+                                   &callback);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nTransmitErrors++;
+        }
+    }
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        BinaryMessageFrameHandler::Error error = transactions[i].wait(1000);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+
+        if (responseMessages[i].getValue() != ((i * 10) + 1))
+        {
+            nWrongResponses++;
+        }
+    }
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nTransmitErrors, (std::uint32_t) 0) &
+        UNIT_TEST_CASE_EQUAL(nErrors, (std::uint32_t) 0) &
+        UNIT_TEST_CASE_EQUAL(nWrongResponses, (std::uint32_t) 0) &
+        UNIT_TEST_CASE_EQUAL(nCompletions.load(), nRequests) &
+        UNIT_TEST_CASE_EQUAL(binaryMessageFrameHandler->getNPendingTransactions(),
+                             (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionTest::acceptanceTest2()
+{
+    //
+    // Procedure: Make a blocking request nothing answers with a 50 ms timeout.
+    // Send another one without waiting with a 20 ms timeout, try to reuse its
+    // transaction while pending, then check for timeouts after 40 ms
+    //
+    // Test: Verify the blocking request times out after at least 50 ms, the
+    // pending transaction can't be reused and the asynchronous request
+    // completes with a timeout through its completion callback
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    IncrementServer server(*comProtocol, *binaryMessageFrameHandler);
+
+    static BinaryMessageFrameHandler::Transaction transaction;
+    static ValueMessage responseMessage(ignoreMessageId);
+    ValueMessage requestMessage(ignoreMessageId);
+    BinaryMessageFrameHandler::CompletionCallback& callback =
+                                         createCallback(&completionCallback);
+
+    nCompletions.store(0);
+    nTimeoutCompletions.store(0);
+
+    const std::uint32_t nTimeoutsBefore =
+                            binaryMessageFrameHandler->getNTransactionTimeouts();
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    BinaryMessageFrameHandler::Error blockingError =
+             binaryMessageFrameHandler->transmitReceiveMessage(requestMessage,
+                                                               responseMessage,
+                                                               50);
+
+    const TimeMs elapsedTimeMs = System::getTimeMs() - startTimeMs;
+
+    BinaryMessageFrameHandler::Error asyncError =
+                binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                   requestMessage,
+                                   responseMessage,
+                                   transaction,
+                                   &callback,
+                                   20);
+
+    BinaryMessageFrameHandler::Error reuseError =
+                binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                   requestMessage,
+                                   responseMessage,
+                                   transaction);
+
+    const bool isPendingBefore = transaction.isPending();
+
+    System::delayTimeMs(40);
+    binaryMessageFrameHandler->checkTransactionTimeouts();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(blockingError.getCode(),
+                             BinaryMessageFrameHandler::ERROR_CODE_TIMEOUT) &
+        UNIT_TEST_CASE_EQUAL((elapsedTimeMs >= 50), true) &
+        UNIT_TEST_CASE_EQUAL(asyncError.getCode(),
+                             BinaryMessageFrameHandler::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(
+                     reuseError.getCode(),
+                     BinaryMessageFrameHandler::ERROR_CODE_TRANSACTION_PENDING) &
+        UNIT_TEST_CASE_EQUAL(isPendingBefore, true) &
+        UNIT_TEST_CASE_EQUAL(transaction.isPending(), false) &
+        UNIT_TEST_CASE_EQUAL(transaction.getError().getCode(),
+                             BinaryMessageFrameHandler::ERROR_CODE_TIMEOUT) &
+        UNIT_TEST_CASE_EQUAL(nCompletions.load(), (std::uint32_t) 1) &
+        UNIT_TEST_CASE_EQUAL(nTimeoutCompletions.load(), (std::uint32_t) 1) &
+        UNIT_TEST_CASE_EQUAL(
+                   binaryMessageFrameHandler->getNTransactionTimeouts() -
+                                                               nTimeoutsBefore,
+                   (std::uint32_t) 2));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionTest::acceptanceTest3()
+{
+    //
+    // Procedure: Send as many requests nothing answers as there are
+    // transaction slots, then one more
+    //
+    // Test: Verify the extra request is refused with ERROR_CODE_TRANSACTIONS_FULL
+    // and every slot frees up again once the requests time out
+    //
+
+    // Setup / Operation
+
+    setUpComLink();
+
+    IncrementServer server(*comProtocol, *binaryMessageFrameHandler);
+
+    static BinaryMessageFrameHandler::Transaction transactions[maxTransactions];
+    static BinaryMessageFrameHandler::Transaction extraTransaction;
+    static ValueMessage responseMessage(ignoreMessageId);
+    ValueMessage requestMessage(ignoreMessageId);
+
+    std::uint32_t nTransmitErrors = 0;
+
+    for (std::uint32_t i = 0; i < maxTransactions; i++)
+    {
+        BinaryMessageFrameHandler::Error error =
+                binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                                              requestMessage,
+                                                              responseMessage,
+                                                              transactions[i],
+                                                              0,
+                                                              50);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nTransmitErrors++;
+        }
+    }
+
+    const std::uint32_t nPendingTransactions =
+                            binaryMessageFrameHandler->getNPendingTransactions();
+
+    BinaryMessageFrameHandler::Error fullError =
+                binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                                              requestMessage,
+                                                              responseMessage,
+                                                              extraTransaction,
+                                                              0,
+                                                              50);
+
+    std::uint32_t nTimeouts = 0;
+
+    for (std::uint32_t i = 0; i < maxTransactions; i++)
+    {
+        BinaryMessageFrameHandler::Error error = transactions[i].wait();
+
+        if (error.getCode() == BinaryMessageFrameHandler::ERROR_CODE_TIMEOUT)
+        {
+            nTimeouts++;
+        }
+    }
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nTransmitErrors, (std::uint32_t) 0) &
+        UNIT_TEST_CASE_EQUAL(nPendingTransactions, maxTransactions) &
+        UNIT_TEST_CASE_EQUAL(
+                       fullError.getCode(),
+                       BinaryMessageFrameHandler::ERROR_CODE_TRANSACTIONS_FULL) &
+        UNIT_TEST_CASE_EQUAL(extraTransaction.isPending(), false) &
+        UNIT_TEST_CASE_EQUAL(nTimeouts, maxTransactions) &
+        UNIT_TEST_CASE_EQUAL(binaryMessageFrameHandler->getNPendingTransactions(),
+                             (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageTransactionTest::completionCallback(
+                            BinaryMessageFrameHandler::Transaction& transaction)
+{
+    if (transaction.getError().getCode() ==
+                                     BinaryMessageFrameHandler::ERROR_CODE_TIMEOUT)
+    {
+        nTimeoutCompletions.fetch_add(1);
+    }
+
+    nCompletions.fetch_add(1);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageTransactionTest::setUpComLink()
+{
+    // Shared by all tests, ComLink and its parsing thread live for the rest of
+    // the process
+    static LoopbackComInterface comInterface;
+    static ComInterfaceDeviceTemplate<256, 256>
+                                              comInterfaceDevice(comInterface);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           comInterface,
+                           receiveBufferSize);
+    static ComProtocolPlat4mBinary protocol(comLink);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+
+    if (isNullPointer(comProtocol))
+    {
+        // The default real-time priority would preempt the sender on every
+        // byte
+        comLink.getDataParsingThread().setPriority(0);
+        comLink.enable();
+
+        comProtocol = &protocol;
+        binaryMessageFrameHandler = &frameHandler;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionTest::LoopbackComInterface::LoopbackComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+        BinaryMessageTransactionTest::LoopbackComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    const std::uint32_t size = byteArray.getSize();
+
+    for (std::uint32_t i = 0; i < size; i++)
+    {
+        byteReceived(byteArray[i]);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+std::uint32_t
+      BinaryMessageTransactionTest::LoopbackComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+         BinaryMessageTransactionTest::LoopbackComInterface::getReceivedBytes(
+                                                    ByteArray& byteArray,
+                                                    const std::uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionTest::ValueMessage::ValueMessage(
+                                                 const std::uint16_t messageId) :
+    BinaryMessage(groupId, messageId),
+    myValue(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t BinaryMessageTransactionTest::ValueMessage::getValue() const
+{
+    return myValue;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageTransactionTest::ValueMessage::setValue(
+                                                     const std::uint32_t value)
+{
+    myValue = value;
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionTest::ValueMessage::parseMessageData(
+                                                          const ByteArray& data)
+{
+    ByteArrayParser byteArrayParser(data,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    return (byteArrayParser.parse(myValue));
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionTest::ValueMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myValue, ENDIAN_BIG));
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionTest::IncrementServer::IncrementServer(
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myResponseMessage(incrementMessageId)
+{
+    addMessageHandler(incrementMessageId, *this);
+    addMessageHandler(ignoreMessageId, *this);
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+               BinaryMessageTransactionTest::IncrementServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    if (requestBinaryMessage.getMessageId() == ignoreMessageId)
+    {
+        return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+    }
+
+    ByteArrayParser byteArrayParser(requestBinaryMessage.getData(),
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+    std::uint32_t value = 0;
+
+    if (!byteArrayParser.parse(value))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    myResponseMessage.setValue(value + 1);
+    responseBinaryMessage = &myResponseMessage;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
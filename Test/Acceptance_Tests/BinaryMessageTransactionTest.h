@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageTransactionTest.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageTransactionTest class header file.
+///
+
+#ifndef PLAT4M_BINARY_MESSAGE_TRANSACTION_TEST_H
+#define PLAT4M_BINARY_MESSAGE_TRANSACTION_TEST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageServer.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Runs request/response transactions through a
+/// BinaryMessageFrameHandler over a ComLink looped back on itself, so the
+/// handler answers its own requests.
+///
+class BinaryMessageTransactionTest : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageTransactionTest();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~BinaryMessageTransactionTest();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool acceptanceTest1();
+
+    static bool acceptanceTest2();
+
+    static bool acceptanceTest3();
+
+    static void completionCallback(
+                           BinaryMessageFrameHandler::Transaction& transaction);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Hands every transmitted byte straight back to the byte received
+    /// callback, the way a UART receive interrupt would.
+    ///
+    class LoopbackComInterface : public ComInterface
+    {
+    public:
+
+        LoopbackComInterface();
+
+        Error transmitBytes(const ByteArray& byteArray,
+                            const bool waitUntilDone = true);
+
+        std::uint32_t getReceivedBytesCount();
+
+        Error getReceivedBytes(ByteArray& byteArray,
+                               const std::uint32_t nBytes = 0);
+    };
+
+    ///
+    /// @brief Carries one value in the test message group.
+    ///
+    class ValueMessage : public BinaryMessage
+    {
+    public:
+
+        ValueMessage(const std::uint16_t messageId);
+
+        std::uint32_t getValue() const;
+
+        void setValue(const std::uint32_t value);
+
+        bool parseMessageData(const ByteArray& data);
+
+    private:
+
+        std::uint32_t myValue;
+
+        bool binaryMessageToByteArray(ByteArray& byteArray) const;
+    };
+
+    ///
+    /// @brief Answers increment requests with their value plus one and
+    /// accepts ignore requests without answering them.
+    ///
+    class IncrementServer : public BinaryMessageServer,
+                            public BinaryMessageHandler
+    {
+    public:
+
+        IncrementServer(ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                        BinaryMessageFrameHandler& binaryMessageFrameHandler);
+
+        ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage);
+
+    private:
+
+        ValueMessage myResponseMessage;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    static std::atomic<std::uint32_t> nCompletions;
+
+    static std::atomic<std::uint32_t> nTimeoutCompletions;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void setUpComLink();
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BINARY_MESSAGE_TRANSACTION_TEST_H
@@ -0,0 +1,539 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceTcpLinuxTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceTcpLinuxTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstring>
+
+#include <Test/Acceptance_Tests/ComInterfaceTcpLinuxTest.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/Linux/ComInterfaceTcpLinux.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nStreamBytes = 100000;
+
+static const std::uint16_t groupId = 0x0500;
+
+static const std::uint16_t messageId = 1;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static std::uint8_t receivedBytes[nStreamBytes];
+
+static std::atomic<std::uint32_t> nReceivedBytes(0);
+
+static std::atomic<std::uint32_t> nReceivedBlocks(0);
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static bool waitUntilConnected(ComInterfaceTcpLinux& comInterface,
+                               const bool isConnected,
+                               const std::uint32_t timeoutMs)
+{
+    for (std::uint32_t i = 0; i < timeoutMs; i++)
+    {
+        if (comInterface.isConnected() == isConnected)
+        {
+            return true;
+        }
+
+        System::delayTimeMs(1);
+    }
+
+    return (comInterface.isConnected() == isConnected);
+}
+
+//------------------------------------------------------------------------------
+static bool waitUntilReceived(const std::uint32_t nBytes,
+                              const std::uint32_t timeoutMs)
+{
+    for (std::uint32_t i = 0; i < timeoutMs; i++)
+    {
+        if (nReceivedBytes.load(std::memory_order_acquire) >= nBytes)
+        {
+            return true;
+        }
+
+        System::delayTimeMs(1);
+    }
+
+    return (nReceivedBytes.load(std::memory_order_acquire) >= nBytes);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                           ComInterfaceTcpLinuxTest::myTestCallbackFunctions[] =
+{
+    &ComInterfaceTcpLinuxTest::acceptanceTest1,
+    &ComInterfaceTcpLinuxTest::acceptanceTest2,
+    &ComInterfaceTcpLinuxTest::acceptanceTest3
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinuxTest::ComInterfaceTcpLinuxTest() :
+    UnitTest("ComInterfaceTcpLinuxTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinuxTest::~ComInterfaceTcpLinuxTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinuxTest::acceptanceTest1()
+{
+    //
+    // Procedure: Listen on any free port, connect a client through a
+    // ComInterfaceDevice, stream 100000 bytes to the server in 1000 byte
+    // writes, then answer from the server
+    //
+    // Test: Verify both ends connect, TCP_NODELAY is on by default, the
+    // server gets every byte in order in blocks, and the answer arrives in
+    // the client's receive buffer through the ComInterfaceDevice
+    //
+
+    // Setup / Operation
+
+    ComInterfaceTcpLinux server(ComInterfaceTcpLinux::MODE_SERVER,
+                                "127.0.0.1",
+                                0);
+    server.setBytesReceivedCallback(
+                                 createCallback(&serverBytesReceivedCallback));
+    server.enable();
+
+    ComInterfaceTcpLinux client(ComInterfaceTcpLinux::MODE_CLIENT,
+                                "127.0.0.1",
+                                server.getPort());
+    ComInterfaceDeviceTemplate<256, 256> comInterfaceDevice(client);
+    client.enable();
+
+    bool isServerConnected = waitUntilConnected(server, true, 1000);
+
+    nReceivedBytes.store(0);
+    nReceivedBlocks.store(0);
+
+    std::uint8_t streamBytes[nStreamBytes];
+
+    for (std::uint32_t i = 0; i < nStreamBytes; i++)
+    {
+        streamBytes[i] = static_cast<std::uint8_t>((i * 7) + (i >> 8));
+    }
+
+    std::uint32_t nErrors = 0;
+
+    for (std::uint32_t i = 0; i < nStreamBytes; i += 1000)
+    {
+        ByteArray byteArray(streamBytes + i, 1000, 1000);
+
+        if (comInterfaceDevice.transmitBytes(byteArray).getCode() !=
+                                         ComInterfaceDevice::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+    }
+
+    bool isStreamReceived = waitUntilReceived(nStreamBytes, 1000);
+
+    ByteArray answerByteArray("answer");
+    ComInterface::Error answerError = server.transmitBytes(answerByteArray);
+
+    for (std::uint32_t i = 0;
+         (i < 1000) && (comInterfaceDevice.getReceivedBytesCount() < 6);
+         i++)
+    {
+        System::delayTimeMs(1);
+    }
+
+    ByteArrayN<16> receivedAnswerByteArray;
+    comInterfaceDevice.getReceivedBytes(receivedAnswerByteArray);
+
+    bool isNoDelay = client.getNoDelay();
+
+    client.disable();
+    server.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isServerConnected, true) &
+        UNIT_TEST_CASE_EQUAL(isNoDelay, true) &
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL(isStreamReceived, true) &
+        UNIT_TEST_CASE_EQUAL(nReceivedBytes.load(), nStreamBytes) &
+        UNIT_TEST_CASE_EQUAL(memcmp(receivedBytes, streamBytes, nStreamBytes),
+                             0) &
+        UNIT_TEST_CASE_EQUAL(nReceivedBlocks.load() < 100U, true) &
+        UNIT_TEST_CASE_EQUAL(answerError.getCode(),
+                             ComInterface::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(receivedAnswerByteArray.getSize(), 6U) &
+        UNIT_TEST_CASE_EQUAL(memcmp(receivedAnswerByteArray.getItems(),
+                                    "answer",
+                                    6),
+                             0));
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinuxTest::acceptanceTest2()
+{
+    //
+    // Procedure: Transmit from a disabled interface and from a server with no
+    // client, connect a client then disable it, connect a second client with
+    // TCP_NODELAY off and transmit from it, then connect a client to a port
+    // nobody listens on
+    //
+    // Test: Verify the disabled interface reports not enabled and the lone
+    // server reports a failed transmit, the server notices the first client
+    // leave and takes the second, whose bytes arrive, and the client to the
+    // closed port ends up disconnected
+    //
+
+    // Setup / Operation
+
+    ComInterfaceTcpLinux server(ComInterfaceTcpLinux::MODE_SERVER,
+                                "127.0.0.1",
+                                0);
+    server.setBytesReceivedCallback(
+                                 createCallback(&serverBytesReceivedCallback));
+
+    ByteArray byteArray("bytes");
+    ComInterface::Error disabledError = server.transmitBytes(byteArray);
+
+    server.enable();
+
+    ComInterface::Error noClientError = server.transmitBytes(byteArray);
+
+    ComInterfaceTcpLinux firstClient(ComInterfaceTcpLinux::MODE_CLIENT,
+                                     "127.0.0.1",
+                                     server.getPort());
+    firstClient.enable();
+
+    bool isFirstConnected = waitUntilConnected(server, true, 1000);
+
+    firstClient.disable();
+
+    bool isFirstDisconnected = waitUntilConnected(server, false, 1000);
+
+    ComInterfaceTcpLinux secondClient(ComInterfaceTcpLinux::MODE_CLIENT,
+                                      "127.0.0.1",
+                                      server.getPort());
+    secondClient.setNoDelay(false);
+    secondClient.enable();
+
+    bool isSecondConnected = waitUntilConnected(server, true, 1000);
+
+    nReceivedBytes.store(0);
+    nReceivedBlocks.store(0);
+
+    ComInterface::Error secondError = secondClient.transmitBytes(byteArray);
+
+    bool isReceived = waitUntilReceived(5, 1000);
+    bool isNoDelay = secondClient.getNoDelay();
+
+    const std::uint16_t closedPort = server.getPort();
+
+    secondClient.disable();
+    server.disable();
+
+    ComInterfaceTcpLinux refusedClient(ComInterfaceTcpLinux::MODE_CLIENT,
+                                       "127.0.0.1",
+                                       closedPort);
+    refusedClient.enable();
+
+    bool isRefused = waitUntilConnected(refusedClient, false, 1000);
+
+    refusedClient.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(disabledError.getCode(),
+                             ComInterface::ERROR_CODE_NOT_ENABLED) &
+        UNIT_TEST_CASE_EQUAL(noClientError.getCode(),
+                             ComInterface::ERROR_CODE_TRANSMIT_FAILED) &
+        UNIT_TEST_CASE_EQUAL(isFirstConnected, true) &
+        UNIT_TEST_CASE_EQUAL(isFirstDisconnected, true) &
+        UNIT_TEST_CASE_EQUAL(isSecondConnected, true) &
+        UNIT_TEST_CASE_EQUAL(isNoDelay, false) &
+        UNIT_TEST_CASE_EQUAL(secondError.getCode(),
+                             ComInterface::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(isReceived, true) &
+        UNIT_TEST_CASE_EQUAL(memcmp(receivedBytes, "bytes", 5), 0) &
+        UNIT_TEST_CASE_EQUAL(isRefused, true));
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinuxTest::acceptanceTest3()
+{
+    //
+    // Procedure: Run a ComLink with ComProtocolPlat4mBinary over each end of
+    // a connection, answer requests with an IncrementServer behind the server
+    // and make 100 blocking transactions from the client
+    //
+    // Test: Verify every transaction completes with the right response
+    //
+
+    // Setup / Operation
+
+    // ComLinks and their parsing threads live for the rest of the process, so
+    // everything they use does too
+    static ComInterfaceTcpLinux server(ComInterfaceTcpLinux::MODE_SERVER,
+                                       "127.0.0.1",
+                                       0);
+    server.enable();
+
+    static ComInterfaceTcpLinux client(ComInterfaceTcpLinux::MODE_CLIENT,
+                                       "127.0.0.1",
+                                       server.getPort());
+
+    static ByteArrayN<256> serverTransmitByteArray;
+    static ByteArrayN<1024> serverReceiveByteArray;
+    static ComInterfaceDeviceTemplate<256, 256> serverComInterfaceDevice(server);
+    static ComLink serverComLink(serverTransmitByteArray,
+                                 serverReceiveByteArray,
+                                 serverComInterfaceDevice,
+                                 server,
+                                 1024);
+    static ComProtocolPlat4mBinary serverProtocol(serverComLink);
+    static BinaryMessageFrameHandler serverFrameHandler(serverProtocol);
+
+    static ByteArrayN<256> clientTransmitByteArray;
+    static ByteArrayN<1024> clientReceiveByteArray;
+    static ComInterfaceDeviceTemplate<256, 256> clientComInterfaceDevice(client);
+    static ComLink clientComLink(clientTransmitByteArray,
+                                 clientReceiveByteArray,
+                                 clientComInterfaceDevice,
+                                 client,
+                                 1024);
+    static ComProtocolPlat4mBinary clientProtocol(clientComLink);
+    static BinaryMessageFrameHandler clientFrameHandler(clientProtocol);
+
+    IncrementServer incrementServer(serverProtocol, serverFrameHandler);
+
+    client.enable();
+    waitUntilConnected(server, true, 1000);
+
+    serverComLink.getDataParsingThread().setPriority(0);
+    serverComLink.enable();
+    clientComLink.getDataParsingThread().setPriority(0);
+    clientComLink.enable();
+
+    const std::uint32_t nRequests = 100;
+    std::uint32_t nErrors = 0;
+    std::uint32_t nWrongResponses = 0;
+    ValueMessage requestMessage;
+    ValueMessage responseMessage;
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        requestMessage.setValue(i * 3);
+        responseMessage.setValue(0);
+
+        BinaryMessageFrameHandler::Error error =
+                  clientFrameHandler.transmitReceiveMessage(requestMessage,
+                                                            responseMessage,
+                                                            1000);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+
+        if (responseMessage.getValue() != ((i * 3) + 1))
+        {
+            nWrongResponses++;
+        }
+    }
+
+    client.disable();
+    server.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL(nWrongResponses, 0U));
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinuxTest::serverBytesReceivedCallback(
+                                                     const ByteArray& byteArray)
+{
+    std::uint32_t index = nReceivedBytes.load(std::memory_order_relaxed);
+    std::uint32_t size = byteArray.getSize();
+
+    if ((index + size) > nStreamBytes)
+    {
+        size = nStreamBytes - index;
+    }
+
+    memcpy(receivedBytes + index, byteArray.getItems(), size);
+
+    nReceivedBlocks.fetch_add(1);
+    nReceivedBytes.store(index + size, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinuxTest::ValueMessage::ValueMessage() :
+    BinaryMessage(groupId, messageId),
+    myValue(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t ComInterfaceTcpLinuxTest::ValueMessage::getValue() const
+{
+    return myValue;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceTcpLinuxTest::ValueMessage::setValue(const std::uint32_t value)
+{
+    myValue = value;
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinuxTest::ValueMessage::parseMessageData(const ByteArray& data)
+{
+    ByteArrayParser byteArrayParser(data,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    return (byteArrayParser.parse(myValue));
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceTcpLinuxTest::ValueMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myValue, ENDIAN_BIG));
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceTcpLinuxTest::IncrementServer::IncrementServer(
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myResponseMessage()
+{
+    addMessageHandler(messageId, *this);
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComInterfaceTcpLinuxTest::IncrementServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    ByteArrayParser byteArrayParser(requestBinaryMessage.getData(),
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+    std::uint32_t value = 0;
+
+    if (!byteArrayParser.parse(value))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    myResponseMessage.setValue(value + 1);
+    responseBinaryMessage = &myResponseMessage;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
@@ -0,0 +1,441 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceUdpLinuxTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceUdpLinuxTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstring>
+
+#include <Test/Acceptance_Tests/ComInterfaceUdpLinuxTest.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/Linux/ComInterfaceUdpLinux.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nDatagrams = 50;
+
+static const std::uint16_t groupId = 0x0500;
+
+static const std::uint16_t messageId = 1;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static std::uint32_t receivedSizes[nDatagrams];
+
+static std::uint8_t receivedFirstBytes[nDatagrams];
+
+static std::atomic<std::uint32_t> nReceivedDatagrams(0);
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static std::uint32_t getDatagramSize(const std::uint32_t index)
+{
+    return ((((index * 997) + 1) % 4000) + 1);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                           ComInterfaceUdpLinuxTest::myTestCallbackFunctions[] =
+{
+    &ComInterfaceUdpLinuxTest::acceptanceTest1,
+    &ComInterfaceUdpLinuxTest::acceptanceTest2
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinuxTest::ComInterfaceUdpLinuxTest() :
+    UnitTest("ComInterfaceUdpLinuxTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinuxTest::~ComInterfaceUdpLinuxTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinuxTest::acceptanceTest1()
+{
+    //
+    // Procedure: Bind an unconnected endpoint to any free port and connect a
+    // second endpoint to it through a ComInterfaceDevice. Transmit from the
+    // unconnected one before it has heard from anyone, then send it 50
+    // datagrams of 2 to 4000 bytes, answer with 3 segments, and transmit one
+    // byte more than PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE
+    //
+    // Test: Verify the unconnected endpoint has no peer and fails to transmit
+    // until it receives, each datagram arrives as one block of its size and
+    // contents, the answer arrives as one datagram at the sender, and the
+    // oversize datagram is rejected
+    //
+
+    // Setup / Operation
+
+    ComInterfaceUdpLinux server("127.0.0.1", 0);
+    server.setBytesReceivedCallback(createCallback(&bytesReceivedCallback));
+    server.enable();
+
+    ComInterfaceUdpLinux client("127.0.0.1",
+                                0,
+                                "127.0.0.1",
+                                server.getLocalPort());
+    ComInterfaceDeviceTemplate<256, 256> comInterfaceDevice(client);
+    client.enable();
+
+    bool serverHasPeer = server.hasPeer();
+    bool clientHasPeer = client.hasPeer();
+
+    ByteArray byteArray("answer");
+    ComInterface::Error noPeerError = server.transmitBytes(byteArray);
+
+    nReceivedDatagrams.store(0);
+
+    static std::uint8_t datagramBytes[4001];
+    std::uint32_t nErrors = 0;
+
+    for (std::uint32_t i = 0; i < nDatagrams; i++)
+    {
+        const std::uint32_t size = getDatagramSize(i);
+        memset(datagramBytes, static_cast<int>(i), size);
+
+        ByteArray datagramByteArray(datagramBytes, size, size);
+
+        if (comInterfaceDevice.transmitBytes(datagramByteArray).getCode() !=
+                                         ComInterfaceDevice::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+    }
+
+    for (std::uint32_t i = 0;
+         (i < 1000) && (nReceivedDatagrams.load() < nDatagrams);
+         i++)
+    {
+        System::delayTimeMs(1);
+    }
+
+    std::uint32_t nWrongDatagrams = 0;
+
+    for (std::uint32_t i = 0; i < nDatagrams; i++)
+    {
+        if ((receivedSizes[i] != getDatagramSize(i)) ||
+            (receivedFirstBytes[i] != static_cast<std::uint8_t>(i)))
+        {
+            nWrongDatagrams++;
+        }
+    }
+
+    ByteArray segments[] = {ByteArray("an"), ByteArray("sw"), ByteArray("er")};
+    Array<ByteArray> segmentArray(segments);
+    ComInterface::Error answerError = server.transmitSegments(segmentArray);
+
+    for (std::uint32_t i = 0;
+         (i < 1000) && (comInterfaceDevice.getReceivedBytesCount() < 6);
+         i++)
+    {
+        System::delayTimeMs(1);
+    }
+
+    ByteArrayN<16> receivedAnswerByteArray;
+    comInterfaceDevice.getReceivedBytes(receivedAnswerByteArray);
+
+    static std::uint8_t oversizeBytes[
+                            PLAT4M_COM_INTERFACE_UDP_LINUX_MAX_DATAGRAM_SIZE + 1];
+    ByteArray oversizeByteArray(oversizeBytes,
+                                sizeof(oversizeBytes),
+                                sizeof(oversizeBytes));
+    ComInterface::Error oversizeError =
+                                       client.transmitBytes(oversizeByteArray);
+
+    client.disable();
+    server.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(serverHasPeer, false) &
+        UNIT_TEST_CASE_EQUAL(clientHasPeer, true) &
+        UNIT_TEST_CASE_EQUAL(noPeerError.getCode(),
+                             ComInterface::ERROR_CODE_TRANSMIT_FAILED) &
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL(nReceivedDatagrams.load(), nDatagrams) &
+        UNIT_TEST_CASE_EQUAL(nWrongDatagrams, 0U) &
+        UNIT_TEST_CASE_EQUAL(answerError.getCode(),
+                             ComInterface::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(receivedAnswerByteArray.getSize(), 6U) &
+        UNIT_TEST_CASE_EQUAL(memcmp(receivedAnswerByteArray.getItems(),
+                                    "answer",
+                                    6),
+                             0) &
+        UNIT_TEST_CASE_EQUAL(oversizeError.getCode(),
+                             ComInterface::ERROR_CODE_PARAMETER_INVALID));
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinuxTest::acceptanceTest2()
+{
+    //
+    // Procedure: Run a ComLink with ComProtocolPlat4mBinary over each
+    // endpoint, answer requests with an IncrementServer behind the
+    // unconnected one and make 100 blocking transactions from the other
+    //
+    // Test: Verify every transaction completes with the right response
+    //
+
+    // Setup / Operation
+
+    // ComLinks and their parsing threads live for the rest of the process, so
+    // everything they use does too
+    static ComInterfaceUdpLinux server("127.0.0.1", 0);
+    server.enable();
+
+    static ComInterfaceUdpLinux client("127.0.0.1",
+                                       0,
+                                       "127.0.0.1",
+                                       server.getLocalPort());
+
+    static ByteArrayN<256> serverTransmitByteArray;
+    static ByteArrayN<1024> serverReceiveByteArray;
+    static ComInterfaceDeviceTemplate<256, 256> serverComInterfaceDevice(server);
+    static ComLink serverComLink(serverTransmitByteArray,
+                                 serverReceiveByteArray,
+                                 serverComInterfaceDevice,
+                                 server,
+                                 1024);
+    static ComProtocolPlat4mBinary serverProtocol(serverComLink);
+    static BinaryMessageFrameHandler serverFrameHandler(serverProtocol);
+
+    static ByteArrayN<256> clientTransmitByteArray;
+    static ByteArrayN<1024> clientReceiveByteArray;
+    static ComInterfaceDeviceTemplate<256, 256> clientComInterfaceDevice(client);
+    static ComLink clientComLink(clientTransmitByteArray,
+                                 clientReceiveByteArray,
+                                 clientComInterfaceDevice,
+                                 client,
+                                 1024);
+    static ComProtocolPlat4mBinary clientProtocol(clientComLink);
+    static BinaryMessageFrameHandler clientFrameHandler(clientProtocol);
+
+    IncrementServer incrementServer(serverProtocol, serverFrameHandler);
+
+    client.enable();
+
+    serverComLink.getDataParsingThread().setPriority(0);
+    serverComLink.enable();
+    clientComLink.getDataParsingThread().setPriority(0);
+    clientComLink.enable();
+
+    const std::uint32_t nRequests = 100;
+    std::uint32_t nErrors = 0;
+    std::uint32_t nWrongResponses = 0;
+    ValueMessage requestMessage;
+    ValueMessage responseMessage;
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        requestMessage.setValue(i * 3);
+        responseMessage.setValue(0);
+
+        BinaryMessageFrameHandler::Error error =
+                  clientFrameHandler.transmitReceiveMessage(requestMessage,
+                                                            responseMessage,
+                                                            1000);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+
+        if (responseMessage.getValue() != ((i * 3) + 1))
+        {
+            nWrongResponses++;
+        }
+    }
+
+    client.disable();
+    server.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL(nWrongResponses, 0U));
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceUdpLinuxTest::bytesReceivedCallback(const ByteArray& byteArray)
+{
+    std::uint32_t index = nReceivedDatagrams.load(std::memory_order_relaxed);
+
+    if (index >= nDatagrams)
+    {
+        return;
+    }
+
+    receivedSizes[index] = byteArray.getSize();
+    receivedFirstBytes[index] = byteArray[0];
+
+    nReceivedDatagrams.store(index + 1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinuxTest::ValueMessage::ValueMessage() :
+    BinaryMessage(groupId, messageId),
+    myValue(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t ComInterfaceUdpLinuxTest::ValueMessage::getValue() const
+{
+    return myValue;
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceUdpLinuxTest::ValueMessage::setValue(const std::uint32_t value)
+{
+    myValue = value;
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinuxTest::ValueMessage::parseMessageData(const ByteArray& data)
+{
+    ByteArrayParser byteArrayParser(data,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    return (byteArrayParser.parse(myValue));
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceUdpLinuxTest::ValueMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myValue, ENDIAN_BIG));
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceUdpLinuxTest::IncrementServer::IncrementServer(
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myResponseMessage()
+{
+    addMessageHandler(messageId, *this);
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus ComInterfaceUdpLinuxTest::IncrementServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    ByteArrayParser byteArrayParser(requestBinaryMessage.getData(),
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+    std::uint32_t value = 0;
+
+    if (!byteArrayParser.parse(value))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    myResponseMessage.setValue(value + 1);
+    responseBinaryMessage = &myResponseMessage;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
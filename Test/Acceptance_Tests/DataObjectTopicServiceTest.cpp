@@ -54,6 +54,7 @@
 #include <Plat4m_Core/ServiceBase.h>
 #include <Plat4m_Core/Service.h>
 #include <Plat4m_Core/ServiceManager.h>
+#include <Plat4m_Core/SeqLock.h>
 
 using namespace Plat4m;
 
@@ -65,7 +66,8 @@ const UnitTest::TestCallbackFunction DataObjectTopicServiceTest::myTestCallbackF
 {
     &DataObjectTopicServiceTest::acceptanceTest1,
     &DataObjectTopicServiceTest::acceptanceTest2,
-    &DataObjectTopicServiceTest::acceptanceTest3
+    &DataObjectTopicServiceTest::acceptanceTest3,
+    &DataObjectTopicServiceTest::acceptanceTest4
 };
 
 std::uint8_t DataObjectTopicServiceTest::acceptanceTest1UpdatedData = 0;
@@ -306,3 +308,64 @@ ServiceBase::Error
 
     return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
 }
+
+//------------------------------------------------------------------------------
+bool DataObjectTopicServiceTest::acceptanceTest4()
+{
+    //
+    // Procedure: Create a DataObject driven by a Topic with a snapshot,
+    // publish samples and read the snapshot as another thread would
+    //
+    // Test: Verify the version counts updates and unchanged data is skipped
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id topicId = 1;
+
+    TopicManager topicManager;
+    DataObjectManager dataObjectManager;
+
+    Topic<std::uint8_t>& topic = Topic<std::uint8_t>::create(topicId);
+
+    const DataObjectBase::Id dataObjectId = 11;
+
+    DataObjectTopicService<std::uint8_t, DataObjectBase::ACCESS_READ_ONLY_PUSH>
+                                              dataObject(dataObjectId, topicId);
+
+    SeqLock<std::uint8_t> snapshot;
+    dataObject.setSnapshot(snapshot);
+
+    dataObject.enable();
+
+    topic.publish(42);
+    topic.publish(67);
+
+    std::uint8_t data = 0;
+    std::uint32_t version = 0;
+
+    const bool isChanged = snapshot.readIfChanged(data, version);
+    const std::uint8_t changedData = data;
+    const std::uint32_t changedVersion = version;
+
+    const bool isChangedAgain =
+                           snapshot.readIfChanged(data, version);
+
+    topic.publish(93);
+
+    const bool isChangedAfterPublish =
+                           snapshot.readIfChanged(data, version);
+
+    dataObject.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isChanged, true)                         &
+        UNIT_TEST_CASE_EQUAL(changedData, (std::uint8_t) 67)          &
+        UNIT_TEST_CASE_EQUAL(changedVersion, (std::uint32_t) 2)       &
+        UNIT_TEST_CASE_EQUAL(isChangedAgain, false)                   &
+        UNIT_TEST_CASE_EQUAL(isChangedAfterPublish, true)             &
+        UNIT_TEST_CASE_EQUAL(data, (std::uint8_t) 93)                 &
+        UNIT_TEST_CASE_EQUAL(snapshot.getVersion(), (std::uint32_t) 3));
+}
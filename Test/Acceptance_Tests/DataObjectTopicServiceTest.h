@@ -108,6 +108,8 @@ public:
                                        const ServiceRequest<void*>& request,
                                        ServiceResponse<std::uint8_t>& response);
 
+    static bool acceptanceTest4();
+
 private:
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file DescriptorTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief DescriptorTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Test/Acceptance_Tests/DescriptorTest.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/TopicDescriptor.h>
+#include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/ServiceManager.h>
+#include <Plat4m_Core/ServiceDescriptor.h>
+#include <Plat4m_Core/DescriptorSet.h>
+#include <Plat4m_Core/CallbackFunction.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+typedef TopicDescriptor<40, std::uint32_t> TestTopic1;
+
+typedef TopicDescriptor<41, std::uint32_t> TestTopic2;
+
+typedef ServiceDescriptor<40, std::uint32_t, std::uint32_t> TestService;
+
+//------------------------------------------------------------------------------
+// Descriptors
+//------------------------------------------------------------------------------
+
+PLAT4M_TOPIC_DESCRIPTOR_DEFINE(TestTopic1);
+
+PLAT4M_TOPIC_DESCRIPTOR_DEFINE(TestTopic2);
+
+PLAT4M_SERVICE_DESCRIPTOR_DEFINE(TestService);
+
+static_assert(DescriptorSet<TestTopic1, TestTopic2>::hasUniqueIds(),
+              "Duplicate Topic Id");
+
+static_assert(
+        !DescriptorSet<TestTopic1,
+                       TestTopic2,
+                       TopicDescriptor<40, std::uint8_t> >::hasUniqueIds(),
+        "Duplicate Topic Id not detected");
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction DescriptorTest::myTestCallbackFunctions[] =
+{
+    &DescriptorTest::acceptanceTest1,
+    &DescriptorTest::acceptanceTest2,
+    &DescriptorTest::acceptanceTest3
+};
+
+std::uint32_t DescriptorTest::topicNSamples = 0;
+
+std::uint32_t DescriptorTest::topicSampleSum = 0;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+DescriptorTest::DescriptorTest() :
+    UnitTest("DescriptorTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+DescriptorTest::~DescriptorTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool DescriptorTest::acceptanceTest1()
+{
+    //
+    // Procedure: Subscribe through a TopicDescriptor, then publish through
+    // the descriptor and through the Topic found by Id
+    //
+    // Test: Verify both reach the subscriber and the descriptor resolves to
+    // the Topic found by Id
+    //
+
+    // Setup / Operation
+
+    topicNSamples = 0;
+    topicSampleSum = 0;
+
+    TopicManager topicManager;
+
+    TestTopic1::subscribe(createCallback(&topicCallback));
+
+    TestTopic1::publish(3);
+    Topic<std::uint32_t>::create(TestTopic1::id).publish(4);
+
+    const bool isSameTopic = (&(TestTopic1::get()) ==
+                              &(Topic<std::uint32_t>::create(TestTopic1::id)));
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+                   UNIT_TEST_CASE_EQUAL(topicNSamples, (std::uint32_t) 2) &
+                   UNIT_TEST_CASE_EQUAL(topicSampleSum, (std::uint32_t) 7) &
+                   UNIT_TEST_CASE_EQUAL(isSameTopic, true));
+}
+
+//------------------------------------------------------------------------------
+bool DescriptorTest::acceptanceTest2()
+{
+    //
+    // Procedure: Create a Topic by Id before first using its descriptor, then
+    // replace the TopicManager and use the descriptor again
+    //
+    // Test: Verify the descriptor adopts the existing Topic, and resolves a
+    // fresh Topic without the old subscribers in the new TopicManager
+    //
+
+    // Setup / Operation
+
+    topicNSamples = 0;
+    topicSampleSum = 0;
+
+    bool isTopicAdopted = false;
+
+    {
+        TopicManager topicManager;
+
+        Topic<std::uint32_t>& topic =
+                                   Topic<std::uint32_t>::create(TestTopic2::id);
+        topic.subscribe(createCallback(&topicCallback));
+
+        isTopicAdopted = (&(TestTopic2::get()) == &topic);
+
+        TestTopic2::publish(5);
+    }
+
+    TopicManager topicManager;
+
+    TestTopic2::publish(6);
+
+    const std::uint32_t nSamplesAfterReplace = topicNSamples;
+
+    TestTopic2::subscribe(createCallback(&topicCallback));
+
+    TestTopic2::publish(7);
+
+    const bool isSameTopic = (&(TestTopic2::get()) ==
+                              &(Topic<std::uint32_t>::create(TestTopic2::id)));
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+            UNIT_TEST_CASE_EQUAL(isTopicAdopted, true) &
+            UNIT_TEST_CASE_EQUAL(nSamplesAfterReplace, (std::uint32_t) 1) &
+            UNIT_TEST_CASE_EQUAL(topicNSamples, (std::uint32_t) 2) &
+            UNIT_TEST_CASE_EQUAL(topicSampleSum, (std::uint32_t) 12) &
+            UNIT_TEST_CASE_EQUAL(isSameTopic, true));
+}
+
+//------------------------------------------------------------------------------
+bool DescriptorTest::acceptanceTest3()
+{
+    //
+    // Procedure: Create a Service through a ServiceDescriptor and request it
+    // through the descriptor and by Id, then replace the ServiceManager
+    //
+    // Test: Verify both requests are served by the descriptor's callback, and
+    // the replaced Service has no callback
+    //
+
+    // Setup / Operation
+
+    std::uint32_t response1 = 0;
+    std::uint32_t response2 = 0;
+    ServiceBase::Error error1;
+    ServiceBase::Error error2;
+
+    {
+        ServiceManager serviceManager;
+
+        TestService::create(createCallback(&serviceCallback));
+
+        error1 = TestService::request(20, response1);
+        error2 = Service<std::uint32_t, std::uint32_t>::request(TestService::id,
+                                                                 30,
+                                                                 response2);
+    }
+
+    ServiceManager serviceManager;
+
+    std::uint32_t response3 = 0;
+    ServiceBase::Error error3 = TestService::request(40, response3);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error1.getCode(), ServiceBase::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(error2.getCode(), ServiceBase::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(response1, (std::uint32_t) 40) &
+        UNIT_TEST_CASE_EQUAL(response2, (std::uint32_t) 60) &
+        UNIT_TEST_CASE_EQUAL(
+                          error3.getCode(),
+                          ServiceBase::ERROR_CODE_SERVICE_NOT_INITIALIZED) &
+        UNIT_TEST_CASE_EQUAL(response3, (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+void DescriptorTest::topicCallback(const TopicSample<std::uint32_t>& sample)
+{
+    topicNSamples++;
+    topicSampleSum += sample.data;
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error DescriptorTest::serviceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response)
+{
+    response.data = 2 * request.data;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
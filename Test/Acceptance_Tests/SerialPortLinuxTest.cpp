@@ -0,0 +1,650 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SerialPortLinuxTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SerialPortLinuxTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// termios2, to read back what the driver configured
+#include <asm/termbits.h>
+
+#include <Test/Acceptance_Tests/SerialPortLinuxTest.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/Linux/SerialPortLinux.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const std::uint32_t nBlockBytes = 3000;
+
+static const std::uint16_t groupId = 0x0500;
+
+static const std::uint16_t messageId = 1;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static std::uint8_t receivedBytes[nBlockBytes];
+
+static std::atomic<std::uint32_t> nReceivedBytes(0);
+
+static std::atomic<std::uint32_t> nReceivedBlocks(0);
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static int openPseudoTerminal(char* slaveName, const std::size_t nameSize)
+{
+    int masterFileDescriptor = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if ((masterFileDescriptor < 0)                    ||
+        (grantpt(masterFileDescriptor) != 0)          ||
+        (unlockpt(masterFileDescriptor) != 0)         ||
+        (ptsname_r(masterFileDescriptor, slaveName, nameSize) != 0))
+    {
+        if (masterFileDescriptor >= 0)
+        {
+            close(masterFileDescriptor);
+        }
+
+        return -1;
+    }
+
+    return masterFileDescriptor;
+}
+
+//------------------------------------------------------------------------------
+static std::uint32_t readAll(const int fileDescriptor,
+                             std::uint8_t* bytes,
+                             const std::uint32_t nBytes,
+                             const int timeoutMs)
+{
+    std::uint32_t nReadBytes = 0;
+
+    while (nReadBytes < nBytes)
+    {
+        struct pollfd pollFileDescriptor = {fileDescriptor, POLLIN, 0};
+
+        if (poll(&pollFileDescriptor, 1, timeoutMs) <= 0)
+        {
+            break;
+        }
+
+        ssize_t result = read(fileDescriptor,
+                              bytes + nReadBytes,
+                              nBytes - nReadBytes);
+
+        if (result <= 0)
+        {
+            break;
+        }
+
+        nReadBytes += static_cast<std::uint32_t>(result);
+    }
+
+    return nReadBytes;
+}
+
+//------------------------------------------------------------------------------
+static SerialPort::Config createConfig(const std::uint32_t baudRate)
+{
+    SerialPort::Config config;
+    config.baudRate            = baudRate;
+    config.wordBits            = SerialPort::WORD_BITS_8;
+    config.stopBits            = SerialPort::STOP_BITS_1;
+    config.parityBit           = SerialPort::PARITY_BIT_NONE;
+    config.hardwareFlowControl = SerialPort::HARDWARE_FLOW_CONTROL_NONE;
+
+    return config;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                SerialPortLinuxTest::myTestCallbackFunctions[] =
+{
+    &SerialPortLinuxTest::acceptanceTest1,
+    &SerialPortLinuxTest::acceptanceTest2,
+    &SerialPortLinuxTest::acceptanceTest3,
+    &SerialPortLinuxTest::acceptanceTest4
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxTest::SerialPortLinuxTest() :
+    UnitTest("SerialPortLinuxTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxTest::~SerialPortLinuxTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::acceptanceTest1()
+{
+    //
+    // Procedure: Enable a port on a pty, read its termios back, then set
+    // 250000 baud (no Bxxx constant) 8N1, then 1000000 baud 8E2, then 9 bit
+    // words
+    //
+    // Test: Verify the tty is raw once enabled, both baud rates are set
+    // exactly through BOTHER with the right framing, and 9 bit words are
+    // rejected without changing the configuration. Parity isn't checked, the
+    // pty driver always clears PARENB
+    //
+
+    // Setup / Operation
+
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+    serialPort.enable();
+
+    int slaveFileDescriptor = open(slaveName, O_RDWR | O_NOCTTY);
+    struct termios2 rawTermios;
+    struct termios2 customTermios;
+    struct termios2 fastTermios;
+
+    ioctl(slaveFileDescriptor, TCGETS2, &rawTermios);
+
+    SerialPort::Error customError = serialPort.setConfig(createConfig(250000));
+    ioctl(slaveFileDescriptor, TCGETS2, &customTermios);
+
+    SerialPort::Config config = createConfig(1000000);
+    config.stopBits  = SerialPort::STOP_BITS_2;
+    config.parityBit = SerialPort::PARITY_BIT_EVEN;
+
+    SerialPort::Error fastError = serialPort.setConfig(config);
+    ioctl(slaveFileDescriptor, TCGETS2, &fastTermios);
+
+    config.wordBits = SerialPort::WORD_BITS_9;
+
+    SerialPort::Error nineBitError = serialPort.setConfig(config);
+
+    serialPort.disable();
+    close(slaveFileDescriptor);
+    close(masterFileDescriptor);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(masterFileDescriptor >= 0, true) &
+        UNIT_TEST_CASE_EQUAL((rawTermios.c_lflag & (ICANON | ECHO)), 0U) &
+        UNIT_TEST_CASE_EQUAL((rawTermios.c_oflag & OPOST), 0U) &
+        UNIT_TEST_CASE_EQUAL(customError.getCode(), SerialPort::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL((customTermios.c_cflag & CBAUD), (unsigned int) BOTHER) &
+        UNIT_TEST_CASE_EQUAL(customTermios.c_ospeed, 250000U) &
+        UNIT_TEST_CASE_EQUAL((customTermios.c_cflag & CSIZE), (unsigned int) CS8) &
+        UNIT_TEST_CASE_EQUAL((customTermios.c_cflag & (PARENB | CSTOPB)), 0U) &
+        UNIT_TEST_CASE_EQUAL(fastError.getCode(), SerialPort::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(fastTermios.c_ospeed, 1000000U) &
+        UNIT_TEST_CASE_EQUAL((fastTermios.c_cflag & CSTOPB),
+                             (unsigned int) CSTOPB) &
+        UNIT_TEST_CASE_EQUAL(nineBitError.getCode(),
+                             SerialPort::ERROR_CODE_SET_CONFIG_FAILED) &
+        UNIT_TEST_CASE_EQUAL(serialPort.getConfig().baudRate, 1000000U));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::acceptanceTest2()
+{
+    //
+    // Procedure: Write 3000 bytes into the master end in one write() and
+    // collect them through the bytes received callback, then transmit 3000
+    // bytes from the port and read them from the master end
+    //
+    // Test: Verify both directions carry every byte in order and received
+    // bytes are handed up in blocks, not one callback per byte
+    //
+
+    // Setup / Operation
+
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+    serialPort.setBytesReceivedCallback(
+                                       createCallback(&bytesReceivedCallback));
+    serialPort.enable();
+    serialPort.setConfig(createConfig(1000000));
+
+    std::uint8_t bytes[nBlockBytes];
+
+    for (std::uint32_t i = 0; i < nBlockBytes; i++)
+    {
+        bytes[i] = static_cast<std::uint8_t>(i * 7);
+    }
+
+    nReceivedBytes.store(0);
+    nReceivedBlocks.store(0);
+
+    ssize_t nWrittenBytes = write(masterFileDescriptor, bytes, nBlockBytes);
+
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    while ((nReceivedBytes.load(std::memory_order_acquire) < nBlockBytes) &&
+           ((System::getTimeMs() - startTimeMs) < 1000))
+    {
+        System::delayTimeMs(1);
+    }
+
+    const bool isReceivedMatch =
+                            (memcmp(receivedBytes, bytes, nBlockBytes) == 0);
+
+    ByteArray byteArray(bytes, nBlockBytes, nBlockBytes);
+    ComInterface::Error transmitError = serialPort.transmitBytes(byteArray);
+
+    std::uint8_t transmittedBytes[nBlockBytes];
+    std::uint32_t nTransmittedBytes = readAll(masterFileDescriptor,
+                                              transmittedBytes,
+                                              nBlockBytes,
+                                              1000);
+
+    serialPort.disable();
+    close(masterFileDescriptor);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nWrittenBytes, (ssize_t) nBlockBytes) &
+        UNIT_TEST_CASE_EQUAL(nReceivedBytes.load(), nBlockBytes) &
+        UNIT_TEST_CASE_EQUAL(isReceivedMatch, true) &
+        UNIT_TEST_CASE_EQUAL((nReceivedBlocks.load() < 100), true) &
+        UNIT_TEST_CASE_EQUAL(transmitError.getCode(),
+                             ComInterface::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(nTransmittedBytes, nBlockBytes) &
+        UNIT_TEST_CASE_EQUAL(
+                     (memcmp(transmittedBytes, bytes, nBlockBytes) == 0), true));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::acceptanceTest3()
+{
+    //
+    // Procedure: Transmit 1 KB blocks without reading the master end until
+    // the port refuses one, then read everything from the master end
+    //
+    // Test: Verify transmitting never blocks, bytes the tty can't take wait
+    // in the ring, a block that doesn't fit is refused whole, and once read
+    // every accepted byte arrives in order and the ring drains
+    //
+
+    // Setup / Operation
+
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+    serialPort.enable();
+
+    const std::uint32_t nChunkBytes = 1024;
+    const std::uint32_t maxAcceptedBytes = 16 * 1024 * 1024;
+    std::uint8_t chunk[nChunkBytes];
+    ByteArray chunkByteArray(chunk, nChunkBytes, nChunkBytes);
+    std::uint32_t nAcceptedBytes = 0;
+    std::uint32_t maxTransmitBufferCount = 0;
+    ComInterface::Error error(ComInterface::ERROR_CODE_NONE);
+
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    while (nAcceptedBytes < maxAcceptedBytes)
+    {
+        for (std::uint32_t i = 0; i < nChunkBytes; i++)
+        {
+            chunk[i] = static_cast<std::uint8_t>((nAcceptedBytes + i) % 251);
+        }
+
+        error = serialPort.transmitBytes(chunkByteArray);
+
+        if (error.getCode() != ComInterface::ERROR_CODE_NONE)
+        {
+            break;
+        }
+
+        nAcceptedBytes += nChunkBytes;
+
+        std::uint32_t count = serialPort.getTransmitBufferCount();
+
+        if (count > maxTransmitBufferCount)
+        {
+            maxTransmitBufferCount = count;
+        }
+    }
+
+    const TimeMs transmitTimeMs = System::getTimeMs() - startTimeMs;
+
+    std::uint32_t nReadBytes = 0;
+    std::uint32_t nWrongBytes = 0;
+
+    while (nReadBytes < nAcceptedBytes)
+    {
+        std::uint8_t bytes[4096];
+        std::uint32_t nBytes = readAll(masterFileDescriptor,
+                                       bytes,
+                                       sizeof(bytes),
+                                       1000);
+
+        if (nBytes == 0)
+        {
+            break;
+        }
+
+        for (std::uint32_t i = 0; i < nBytes; i++)
+        {
+            if (bytes[i] != static_cast<std::uint8_t>((nReadBytes + i) % 251))
+            {
+                nWrongBytes++;
+            }
+        }
+
+        nReadBytes += nBytes;
+    }
+
+    const std::uint32_t endTransmitBufferCount =
+                                             serialPort.getTransmitBufferCount();
+
+    serialPort.disable();
+    close(masterFileDescriptor);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error.getCode(),
+                             ComInterface::ERROR_CODE_TRANSMIT_BUFFER_FULL) &
+        UNIT_TEST_CASE_EQUAL((transmitTimeMs < 1000), true) &
+        UNIT_TEST_CASE_EQUAL(
+                  (maxTransmitBufferCount >
+                   (PLAT4M_SERIAL_PORT_LINUX_TRANSMIT_BUFFER_SIZE - nChunkBytes)),
+                  true) &
+        UNIT_TEST_CASE_EQUAL(nReadBytes, nAcceptedBytes) &
+        UNIT_TEST_CASE_EQUAL(nWrongBytes, 0U) &
+        UNIT_TEST_CASE_EQUAL(endTransmitBufferCount, 0U));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::acceptanceTest4()
+{
+    //
+    // Procedure: Run a ComLink with a BinaryMessageFrameHandler and an
+    // increment server on the port, echo everything written to the master
+    // end back into it, and make 100 blocking requests
+    //
+    // Test: Verify every request is answered (by the server on the same
+    // link, through the echo) with its value plus one
+    //
+
+    // Setup / Operation
+
+    // ComLink and its parsing thread live for the rest of the process, so
+    // the port and name it uses do too
+    static char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+    std::atomic<bool> isEchoing(true);
+
+    std::thread echoThread([masterFileDescriptor, &isEchoing]()
+    {
+        std::uint8_t bytes[4096];
+
+        while (isEchoing.load())
+        {
+            struct pollfd pollFileDescriptor =
+                                           {masterFileDescriptor, POLLIN, 0};
+
+            if (poll(&pollFileDescriptor, 1, 10) <= 0)
+            {
+                continue;
+            }
+
+            ssize_t nBytes = read(masterFileDescriptor, bytes, sizeof(bytes));
+
+            if ((nBytes > 0) &&
+                (write(masterFileDescriptor, bytes, nBytes) != nBytes))
+            {
+                break;
+            }
+        }
+    });
+
+    static ByteArrayN<256> transmitByteArray;
+    static ByteArrayN<1024> receiveByteArray;
+    static SerialPortLinux serialPort(slaveName);
+    static ComInterfaceDeviceTemplate<256, 256> comInterfaceDevice(serialPort);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           serialPort,
+                           1024);
+    static ComProtocolPlat4mBinary protocol(comLink);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+
+    IncrementServer server(protocol, frameHandler);
+
+    serialPort.enable();
+    serialPort.setConfig(createConfig(1000000));
+    comLink.getDataParsingThread().setPriority(0);
+    comLink.enable();
+
+    const std::uint32_t nRequests = 100;
+    std::uint32_t nErrors = 0;
+    std::uint32_t nWrongResponses = 0;
+    ValueMessage requestMessage;
+    ValueMessage responseMessage;
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        requestMessage.setValue(i * 3);
+        responseMessage.setValue(0);
+
+        BinaryMessageFrameHandler::Error error =
+                      frameHandler.transmitReceiveMessage(requestMessage,
+                                                          responseMessage,
+                                                          1000);
+
+        if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+
+        if (responseMessage.getValue() != ((i * 3) + 1))
+        {
+            nWrongResponses++;
+        }
+    }
+
+    serialPort.disable();
+
+    isEchoing.store(false);
+    echoThread.join();
+    close(masterFileDescriptor);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL(nWrongResponses, 0U));
+}
+
+//------------------------------------------------------------------------------
+void SerialPortLinuxTest::bytesReceivedCallback(const ByteArray& byteArray)
+{
+    std::uint32_t index = nReceivedBytes.load(std::memory_order_relaxed);
+    std::uint32_t size = byteArray.getSize();
+
+    if ((index + size) > nBlockBytes)
+    {
+        size = nBlockBytes - index;
+    }
+
+    memcpy(receivedBytes + index, byteArray.getItems(), size);
+
+    nReceivedBlocks.fetch_add(1);
+    nReceivedBytes.store(index + size, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxTest::ValueMessage::ValueMessage() :
+    BinaryMessage(groupId, messageId),
+    myValue(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+std::uint32_t SerialPortLinuxTest::ValueMessage::getValue() const
+{
+    return myValue;
+}
+
+//------------------------------------------------------------------------------
+void SerialPortLinuxTest::ValueMessage::setValue(const std::uint32_t value)
+{
+    myValue = value;
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::ValueMessage::parseMessageData(const ByteArray& data)
+{
+    ByteArrayParser byteArrayParser(data,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    return (byteArrayParser.parse(myValue));
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxTest::ValueMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myValue, ENDIAN_BIG));
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxTest::IncrementServer::IncrementServer(
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myResponseMessage()
+{
+    addMessageHandler(messageId, *this);
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus SerialPortLinuxTest::IncrementServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    ByteArrayParser byteArrayParser(requestBinaryMessage.getData(),
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+    std::uint32_t value = 0;
+
+    if (!byteArrayParser.parse(value))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    myResponseMessage.setValue(value + 1);
+    responseBinaryMessage = &myResponseMessage;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
@@ -48,6 +48,8 @@
 #include <Plat4m_Core/ServiceManager.h>
 #include <Plat4m_Core/CallbackFunction.h>
 #include <Plat4m_Core/ServiceClient.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
 
 using namespace Plat4m;
 
@@ -57,11 +59,25 @@ using namespace Plat4m;
 
 const UnitTest::TestCallbackFunction ServiceClientTest::myTestCallbackFunctions[] =
 {
-    &ServiceClientTest::acceptanceTest1
+    &ServiceClientTest::acceptanceTest1,
+    &ServiceClientTest::acceptanceTest2,
+    &ServiceClientTest::acceptanceTest3,
+    &ServiceClientTest::acceptanceTest4,
+    &ServiceClientTest::acceptanceTest5
 };
 
 std::uint8_t ServiceClientTest::acceptanceTest1ServiceValue = 0;
 
+std::uint32_t ServiceClientTest::nCompletions = 0;
+
+std::uint32_t ServiceClientTest::lastCompletionSequenceId = 0;
+
+std::uint32_t ServiceClientTest::lastCompletionResponse = 0;
+
+std::atomic<bool> ServiceClientTest::isServiceHeld(false);
+
+std::atomic<bool> ServiceClientTest::isServiceRunning(false);
+
 //------------------------------------------------------------------------------
 // Public constructors
 //------------------------------------------------------------------------------
@@ -131,3 +147,313 @@ ServiceBase::Error ServiceClientTest::acceptanceTest1ServiceCallback(
 
     return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
 }
+
+//------------------------------------------------------------------------------
+bool ServiceClientTest::acceptanceTest2()
+{
+    //
+    // Procedure: Create a Service running on the caller's thread and make an
+    // asynchronous request with a completion callback
+    //
+    // Test: Verify the request has completed when requestAsync() returns, the
+    // completion callback was called, and the response sequence ID matches
+    // the request
+    //
+
+    // Setup / Operation
+
+    const ServiceBase::Id testServiceId = 2;
+
+    ServiceManager serviceManager;
+
+    createService(testServiceId, &doubleServiceCallback);
+
+    ServiceClient<std::uint32_t, std::uint32_t> serviceClient(testServiceId);
+
+    ServiceClient<std::uint32_t, std::uint32_t>::Future future1;
+    ServiceClient<std::uint32_t, std::uint32_t>::Future future2;
+
+    nCompletions = 0;
+
+    ServiceBase::Error error1 = serviceClient.requestAsync(
+                               21,
+                               future1,
+                               createCallback(&completionCallback));
+
+    ServiceBase::Error error2 = serviceClient.requestAsync(
+                               5,
+                               future2,
+                               createCallback(&completionCallback));
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error1.getCode(), ServiceBase::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(error2.getCode(), ServiceBase::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(future1.isPending(), false)                     &
+        UNIT_TEST_CASE_EQUAL(future1.getResponse(), 42U)                     &
+        UNIT_TEST_CASE_EQUAL(future2.getResponse(), 10U)                     &
+        UNIT_TEST_CASE_EQUAL(future2.getSequenceId(),
+                             future1.getSequenceId() + 1)                    &
+        UNIT_TEST_CASE_EQUAL(nCompletions, 2U)                               &
+        UNIT_TEST_CASE_EQUAL(lastCompletionSequenceId,
+                             future2.getSequenceId())                        &
+        UNIT_TEST_CASE_EQUAL(lastCompletionResponse, 10U));
+}
+
+//------------------------------------------------------------------------------
+bool ServiceClientTest::acceptanceTest3()
+{
+    //
+    // Procedure: Create a Service running on its own thread, hold it up in
+    // its callback and make requests until its queue is full
+    //
+    // Test: Verify requestAsync() does not block the caller, a short wait
+    // times out, the request past the queue size is rejected, and once the
+    // service is let go every queued request completes in order with the
+    // right response
+    //
+
+    // Setup / Operation
+
+    const ServiceBase::Id testServiceId = 3;
+    const std::uint32_t nRequests = PLAT4M_SERVICE_QUEUE_SIZE + 1;
+
+    ServiceManager serviceManager;
+
+    Service<std::uint32_t, std::uint32_t>& testService =
+                       createService(testServiceId, &heldDoubleServiceCallback);
+    testService.setThread();
+
+    ServiceClient<std::uint32_t, std::uint32_t> serviceClient(testServiceId);
+
+    ServiceClient<std::uint32_t, std::uint32_t>::Future futures[nRequests];
+    ServiceClient<std::uint32_t, std::uint32_t>::Future rejectedFuture;
+
+    isServiceHeld = true;
+    isServiceRunning = false;
+
+    // The first request is taken off the queue and holds up the service
+    serviceClient.requestAsync(0, futures[0]);
+
+    for (std::uint32_t i = 0; (i < 1000) && !isServiceRunning; i++)
+    {
+        System::delayTimeMs(1);
+    }
+
+    std::uint32_t nErrors = 0;
+
+    for (std::uint32_t i = 1; i < nRequests; i++)
+    {
+        if (serviceClient.requestAsync(i, futures[i]).getCode() !=
+                                                   ServiceBase::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+    }
+
+    ServiceBase::Error rejectedError =
+                                serviceClient.requestAsync(99, rejectedFuture);
+
+    ServiceBase::Error timeoutError = futures[0].wait(1);
+
+    isServiceHeld = false;
+
+    bool isInOrder = true;
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        if (futures[i].wait(5000).getCode() != ServiceBase::ERROR_CODE_NONE)
+        {
+            nErrors++;
+        }
+
+        isInOrder &= (futures[i].getResponse() == (i * 2));
+        isInOrder &= (futures[i].getResponseTimeStamp() >=
+                      futures[i].getRequestTimeStamp());
+
+        if (i > 0)
+        {
+            isInOrder &= (futures[i].getSequenceId() ==
+                          (futures[i - 1].getSequenceId() + 1));
+            isInOrder &= (futures[i].getResponseTimeStamp() >=
+                          futures[i - 1].getResponseTimeStamp());
+        }
+    }
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U)                                   &
+        UNIT_TEST_CASE_EQUAL(rejectedError.getCode(),
+                             ServiceBase::ERROR_CODE_QUEUE_FULL)            &
+        UNIT_TEST_CASE_EQUAL(testService.getNRejectedRequests(), 1U)        &
+        UNIT_TEST_CASE_EQUAL(timeoutError.getCode(),
+                             ServiceBase::ERROR_CODE_TIMEOUT)               &
+        UNIT_TEST_CASE_EQUAL(isInOrder, true));
+}
+
+//------------------------------------------------------------------------------
+bool ServiceClientTest::acceptanceTest4()
+{
+    //
+    // Procedure: Create a slow Service running on an Executor, make two
+    // asynchronous requests and a synchronous one
+    //
+    // Test: Verify all three complete with the right responses and the
+    // completion callback runs for the asynchronous ones
+    //
+
+    // Setup / Operation
+
+    const ServiceBase::Id testServiceId = 4;
+
+    ServiceManager serviceManager;
+
+    Service<std::uint32_t, std::uint32_t>& testService =
+                       createService(testServiceId, &slowDoubleServiceCallback);
+    testService.setExecutor(System::createExecutor(1));
+
+    ServiceClient<std::uint32_t, std::uint32_t> serviceClient(testServiceId);
+
+    ServiceClient<std::uint32_t, std::uint32_t>::Future future1;
+    ServiceClient<std::uint32_t, std::uint32_t>::Future future2;
+
+    nCompletions = 0;
+
+    serviceClient.requestAsync(1, future1, createCallback(&completionCallback));
+    serviceClient.requestAsync(2, future2, createCallback(&completionCallback));
+
+    // Queued behind the two asynchronous requests
+    std::uint32_t response = 0;
+    ServiceBase::Error error = serviceClient.request(3, response);
+
+    future1.wait(5000);
+    future2.wait(5000);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(error.getCode(), ServiceBase::ERROR_CODE_NONE) &
+        UNIT_TEST_CASE_EQUAL(response, 6U)                                  &
+        UNIT_TEST_CASE_EQUAL(future1.isPending(), false)                    &
+        UNIT_TEST_CASE_EQUAL(future2.isPending(), false)                    &
+        UNIT_TEST_CASE_EQUAL(future1.getResponse(), 2U)                     &
+        UNIT_TEST_CASE_EQUAL(future2.getResponse(), 4U)                     &
+        UNIT_TEST_CASE_EQUAL(nCompletions, 2U)                              &
+        UNIT_TEST_CASE_EQUAL(lastCompletionResponse, 4U));
+}
+
+//------------------------------------------------------------------------------
+bool ServiceClientTest::acceptanceTest5()
+{
+    //
+    // Procedure: Create a Service running on its own thread and one running
+    // on an Executor and make 100 synchronous requests to each
+    //
+    // Test: Verify every request gets the right response and the requests
+    // take well under a millisecond each, i.e. the caller is woken up when
+    // its request completes instead of polling
+    //
+
+    // Setup / Operation
+
+    const ServiceBase::Id threadServiceId   = 5;
+    const ServiceBase::Id executorServiceId = 6;
+    const std::uint32_t nRequests = 100;
+
+    ServiceManager serviceManager;
+
+    Service<std::uint32_t, std::uint32_t>& threadService =
+                       createService(threadServiceId, &doubleServiceCallback);
+    threadService.setThread();
+
+    Service<std::uint32_t, std::uint32_t>& executorService =
+                     createService(executorServiceId, &doubleServiceCallback);
+    executorService.setExecutor(System::createExecutor(1));
+
+    std::uint32_t nErrors = 0;
+
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    for (std::uint32_t i = 0; i < nRequests; i++)
+    {
+        std::uint32_t threadResponse = 0;
+        std::uint32_t executorResponse = 0;
+
+        if ((threadService.request(i, threadResponse).getCode() !=
+                                              ServiceBase::ERROR_CODE_NONE) ||
+            (threadResponse != (i * 2)))
+        {
+            nErrors++;
+        }
+
+        if ((executorService.request(i, executorResponse).getCode() !=
+                                              ServiceBase::ERROR_CODE_NONE) ||
+            (executorResponse != (i * 2)))
+        {
+            nErrors++;
+        }
+    }
+
+    const TimeMs elapsedTimeMs = System::getTimeMs() - startTimeMs;
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nErrors, 0U) &
+        UNIT_TEST_CASE_EQUAL((elapsedTimeMs < nRequests), true));
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error ServiceClientTest::doubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response)
+{
+    response.data = request.data * 2;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error ServiceClientTest::slowDoubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response)
+{
+    // Stands in for a slow bus transaction
+    System::delayTimeMs(20);
+
+    response.data = request.data * 2;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error ServiceClientTest::heldDoubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response)
+{
+    isServiceRunning = true;
+
+    while (isServiceHeld)
+    {
+        System::delayTimeMs(1);
+    }
+
+    response.data = request.data * 2;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+void ServiceClientTest::completionCallback(
+                                ServiceBase::Error error,
+                                const ServiceResponse<std::uint32_t>& response)
+{
+    if (error.getCode() == ServiceBase::ERROR_CODE_NONE)
+    {
+        nCompletions++;
+        lastCompletionSequenceId = response.sequenceId;
+        lastCompletionResponse = response.data;
+    }
+}
@@ -46,6 +46,7 @@
 // Include files
 //------------------------------------------------------------------------------
 
+#include <atomic>
 #include <cstdint>
 
 #include <Plat4m_Core/UnitTest/UnitTest.h>
@@ -91,6 +92,30 @@ public:
                                     const ServiceRequest<std::uint8_t>& request,
                                     ServiceResponse<bool>& response);
 
+    static bool acceptanceTest2();
+
+    static bool acceptanceTest3();
+
+    static bool acceptanceTest4();
+
+    static bool acceptanceTest5();
+
+    static ServiceBase::Error doubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response);
+
+    static ServiceBase::Error slowDoubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response);
+
+    static ServiceBase::Error heldDoubleServiceCallback(
+                                   const ServiceRequest<std::uint32_t>& request,
+                                   ServiceResponse<std::uint32_t>& response);
+
+    static void completionCallback(
+                                ServiceBase::Error error,
+                                const ServiceResponse<std::uint32_t>& response);
+
 private:
 
     //--------------------------------------------------------------------------
@@ -100,6 +125,16 @@ private:
     static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
 
     static std::uint8_t acceptanceTest1ServiceValue;
+
+    static std::uint32_t nCompletions;
+
+    static std::uint32_t lastCompletionSequenceId;
+
+    static std::uint32_t lastCompletionResponse;
+
+    static std::atomic<bool> isServiceHeld;
+
+    static std::atomic<bool> isServiceRunning;
 };
 
 }; // namespace Plat4m
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicBridgeShmLinuxTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicBridgeShmLinuxTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Test/Acceptance_Tests/TopicBridgeShmLinuxTest.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/Linux/TopicBridgeShmLinux.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static const char ringName[] = "/plat4m_topic_bridge_shm_linux_test";
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+///
+/// @brief Waits up to 1 s for the importing bridge to find the ring.
+///
+template <typename DataType>
+static bool waitForConnection(const TopicBridgeShmLinux<DataType>& bridge)
+{
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        if (bridge.isConnected())
+        {
+            return true;
+        }
+
+        System::delayTimeMs(10);
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                            TopicBridgeShmLinuxTest::myTestCallbackFunctions[] =
+{
+    &TopicBridgeShmLinuxTest::acceptanceTest1,
+    &TopicBridgeShmLinuxTest::acceptanceTest2
+};
+
+std::uint32_t TopicBridgeShmLinuxTest::acceptanceTest1NSamples = 0;
+
+bool TopicBridgeShmLinuxTest::acceptanceTest1IsInOrder = true;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBridgeShmLinuxTest::TopicBridgeShmLinuxTest() :
+    UnitTest("TopicBridgeShmLinuxTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBridgeShmLinuxTest::~TopicBridgeShmLinuxTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicBridgeShmLinuxTest::acceptanceTest1()
+{
+    //
+    // Procedure: Export one Topic through a shared memory bridge and import
+    // it on a second Topic, then publish 50 samples on the first
+    //
+    // Test: Verify the second Topic receives every sample in order and both
+    // bridges counted them
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id exportTopicId = 20;
+    const TopicBase::Id importTopicId = 21;
+
+    TopicManager topicManager;
+
+    Topic<TestSample>& exportTopic = Topic<TestSample>::create(exportTopicId);
+
+    Topic<TestSample>::subscribe(
+        importTopicId,
+        createCallback(
+                   &TopicBridgeShmLinuxTest::acceptanceTest1SampleCallback));
+
+    typedef TopicBridgeShmLinux<TestSample> Bridge;
+
+    Bridge exportBridge(exportTopicId, ringName, Bridge::DIRECTION_EXPORT);
+    Bridge importBridge(importTopicId, ringName, Bridge::DIRECTION_IMPORT);
+
+    exportBridge.enable();
+    importBridge.enable();
+
+    const bool isConnected = waitForConnection(importBridge);
+
+    TestSample sample;
+
+    for (std::uint32_t i = 0; i < 50; i++)
+    {
+        sample.value = i;
+        sample.values[0] = i * 0.5f;
+        sample.values[1] = i * 1.5f;
+        sample.values[2] = i * 2.5f;
+
+        exportTopic.publish(sample);
+    }
+
+    System::delayTimeMs(100);
+
+    importBridge.disable();
+    exportBridge.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isConnected, true)                               &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest1NSamples, (std::uint32_t) 50)     &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest1IsInOrder, true)                  &
+        UNIT_TEST_CASE_EQUAL(exportBridge.getNSamples(), (std::uint32_t) 50)  &
+        UNIT_TEST_CASE_EQUAL(importBridge.getNSamples(), (std::uint32_t) 50)  &
+        UNIT_TEST_CASE_EQUAL(importBridge.getNOverruns(), (std::uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+void TopicBridgeShmLinuxTest::acceptanceTest1SampleCallback(
+                                          const TopicSample<TestSample>& sample)
+{
+    const std::uint32_t i = acceptanceTest1NSamples;
+
+    acceptanceTest1IsInOrder &= (sample.data.value == i);
+    acceptanceTest1IsInOrder &= (sample.data.values[0] == (i * 0.5f));
+    acceptanceTest1IsInOrder &= (sample.data.values[1] == (i * 1.5f));
+    acceptanceTest1IsInOrder &= (sample.data.values[2] == (i * 2.5f));
+    acceptanceTest1NSamples++;
+}
+
+//------------------------------------------------------------------------------
+bool TopicBridgeShmLinuxTest::acceptanceTest2()
+{
+    //
+    // Procedure: Export a Topic through a shared memory bridge of 8 slots
+    // and import it with the importing bridge disabled, publish 20 samples,
+    // then enable the importing bridge
+    //
+    // Test: Verify the importing bridge skips the 12 samples it lost and
+    // republishes the last 8
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id exportTopicId = 22;
+    const TopicBase::Id importTopicId = 23;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& exportTopic =
+                                    Topic<std::uint32_t>::create(exportTopicId);
+
+    typedef TopicBridgeShmLinux<std::uint32_t> Bridge;
+
+    Bridge exportBridge(exportTopicId, ringName, Bridge::DIRECTION_EXPORT, 8);
+    Bridge importBridge(importTopicId, ringName, Bridge::DIRECTION_IMPORT, 8);
+
+    exportBridge.enable();
+    importBridge.enable();
+
+    const bool isConnected = waitForConnection(importBridge);
+
+    importBridge.disable();
+
+    // Give the import thread time to see it has been disabled
+    System::delayTimeMs(200);
+
+    for (std::uint32_t i = 0; i < 20; i++)
+    {
+        exportTopic.publish(i);
+    }
+
+    importBridge.enable();
+
+    System::delayTimeMs(100);
+
+    importBridge.disable();
+    exportBridge.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isConnected, true)                               &
+        UNIT_TEST_CASE_EQUAL(exportBridge.getNSamples(), (std::uint32_t) 20)  &
+        UNIT_TEST_CASE_EQUAL(importBridge.getNSamples(), (std::uint32_t) 8)   &
+        UNIT_TEST_CASE_EQUAL(importBridge.getNOverruns(), (std::uint32_t) 12));
+}
@@ -0,0 +1,392 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicRecorderLinuxTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicRecorderLinuxTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <unistd.h>
+
+#include <Test/Acceptance_Tests/TopicRecorderLinuxTest.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/Linux/TopicRecorderLinux.h>
+#include <Plat4m_Core/Linux/TopicReplayerLinux.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const char logFileName[] = "/tmp/plat4m_topic_recorder_linux_test.log";
+
+static const std::uint32_t acceptanceTest2MaxNSamples = 200;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                             TopicRecorderLinuxTest::myTestCallbackFunctions[] =
+{
+    &TopicRecorderLinuxTest::acceptanceTest1,
+    &TopicRecorderLinuxTest::acceptanceTest2,
+    &TopicRecorderLinuxTest::acceptanceTest3
+};
+
+std::uint32_t TopicRecorderLinuxTest::acceptanceTest1NSamples1 = 0;
+
+std::uint32_t TopicRecorderLinuxTest::acceptanceTest1NSamples2 = 0;
+
+bool TopicRecorderLinuxTest::acceptanceTest1IsInOrder = true;
+
+bool TopicRecorderLinuxTest::acceptanceTest2IsRecording = true;
+
+std::uint32_t TopicRecorderLinuxTest::acceptanceTest2NSamples = 0;
+
+std::uint32_t TopicRecorderLinuxTest::acceptanceTest2Samples[
+                                                  acceptanceTest2MaxNSamples];
+
+TimeStamp TopicRecorderLinuxTest::acceptanceTest2TimeStamps[
+                                                  acceptanceTest2MaxNSamples];
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinuxTest::TopicRecorderLinuxTest() :
+    UnitTest("TopicRecorderLinuxTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinuxTest::~TopicRecorderLinuxTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxTest::acceptanceTest1()
+{
+    //
+    // Procedure: Record 10 samples on each of three Topics of different
+    // types, then replay the log as fast as possible with only two of the
+    // Topics added to the replayer
+    //
+    // Test: Verify the two Topics receive their samples again in order and
+    // the third Topic's records are skipped
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId1 = 30;
+    const TopicBase::Id testTopicId2 = 31;
+    const TopicBase::Id testTopicId3 = 32;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic1 =
+                                     Topic<std::uint32_t>::create(testTopicId1);
+    Topic<TestSample>& testTopic2 = Topic<TestSample>::create(testTopicId2);
+    Topic<std::uint16_t>& testTopic3 =
+                                     Topic<std::uint16_t>::create(testTopicId3);
+
+    TopicRecorderLinux recorder;
+    recorder.addTopic<std::uint32_t>(testTopicId1);
+    recorder.addTopic<TestSample>(testTopicId2);
+    recorder.addTopic<std::uint16_t>(testTopicId3);
+
+    TopicRecorderLinux::Error duplicateError =
+                                recorder.addTopic<std::uint32_t>(testTopicId1);
+
+    recorder.open(logFileName);
+
+    for (std::uint32_t i = 0; i < 10; i++)
+    {
+        TestSample sample;
+        sample.sample1 = i;
+        sample.sample2 = i * 0.25;
+
+        testTopic1.publish(i);
+        testTopic2.publish(sample);
+        testTopic3.publish(i);
+    }
+
+    recorder.close();
+
+    // Published again after closing, not recorded
+    testTopic1.publish(10);
+
+    Topic<std::uint32_t>::subscribe(
+        testTopicId1,
+        createCallback(
+                 &TopicRecorderLinuxTest::acceptanceTest1SampleCallback1));
+    Topic<TestSample>::subscribe(
+        testTopicId2,
+        createCallback(
+                 &TopicRecorderLinuxTest::acceptanceTest1SampleCallback2));
+
+    TopicReplayerLinux replayer;
+    replayer.addTopic<std::uint32_t>(testTopicId1);
+    replayer.addTopic<TestSample>(testTopicId2);
+
+    TopicReplayerLinux::Error openError = replayer.open(logFileName);
+
+    const std::uint32_t nReplayedSamples =
+          replayer.replay(TopicReplayerLinux::PACING_AS_FAST_AS_POSSIBLE);
+
+    unlink(logFileName);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(duplicateError.getCode(),
+                           TopicRecorderLinux::ERROR_CODE_TOPIC_ALREADY_ADDED) &
+        UNIT_TEST_CASE_EQUAL(openError.getCode(),
+                             TopicReplayerLinux::ERROR_CODE_NONE)            &
+        UNIT_TEST_CASE_EQUAL(recorder.getNRecords(), (std::uint64_t) 30)     &
+        UNIT_TEST_CASE_EQUAL(recorder.getNDroppedRecords(), (std::uint32_t) 0)&
+        UNIT_TEST_CASE_EQUAL(nReplayedSamples, (std::uint32_t) 20)           &
+        UNIT_TEST_CASE_EQUAL(replayer.getNSkippedRecords(), (std::uint32_t) 10)&
+        UNIT_TEST_CASE_EQUAL(replayer.getNBytes(), recorder.getNBytes())     &
+        UNIT_TEST_CASE_EQUAL(replayer.isAtEnd(), true)                       &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest1NSamples1, (std::uint32_t) 10)   &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest1NSamples2, (std::uint32_t) 10)   &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest1IsInOrder, true));
+}
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinuxTest::acceptanceTest1SampleCallback1(
+                                       const TopicSample<std::uint32_t>& sample)
+{
+    acceptanceTest1IsInOrder &= (sample.data == acceptanceTest1NSamples1);
+    acceptanceTest1NSamples1++;
+}
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinuxTest::acceptanceTest1SampleCallback2(
+                                          const TopicSample<TestSample>& sample)
+{
+    const std::uint32_t i = acceptanceTest1NSamples2;
+
+    acceptanceTest1IsInOrder &= (sample.data.sample1 == i);
+    acceptanceTest1IsInOrder &= (sample.data.sample2 == (i * 0.25));
+    acceptanceTest1NSamples2++;
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxTest::acceptanceTest2()
+{
+    //
+    // Procedure: Record 200 samples 1 ms apart into 4 KB chunks, which hold
+    // 95 samples each, with a 5 ms index period, then seek to the time
+    // stamps of samples 150 and 0 and past the last sample
+    //
+    // Test: Verify the log spans 3 chunks, replay from sample 150 up
+    // to the time stamp of sample 159 publishes exactly samples 150 to 159,
+    // replay from sample 0 publishes all samples and seeking past the end
+    // leaves nothing to replay
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 33;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+
+    TopicRecorderLinux recorder(4096, 5);
+    recorder.addTopic<std::uint32_t>(testTopicId);
+    recorder.open(logFileName);
+
+    Topic<std::uint32_t>::subscribe(
+        testTopicId,
+        createCallback(&TopicRecorderLinuxTest::acceptanceTest2SampleCallback));
+
+    for (std::uint32_t i = 0; i < acceptanceTest2MaxNSamples; i++)
+    {
+        testTopic.publish(i);
+        System::delayTimeMs(1);
+    }
+
+    recorder.close();
+
+    acceptanceTest2IsRecording = false;
+
+    TopicReplayerLinux replayer;
+    replayer.addTopic<std::uint32_t>(testTopicId);
+    replayer.open(logFileName);
+
+    acceptanceTest2NSamples = 0;
+
+    const bool isMiddleFound = replayer.seek(acceptanceTest2TimeStamps[150]);
+    const std::uint32_t nMiddleSamples =
+                replayer.replay(TopicReplayerLinux::PACING_AS_FAST_AS_POSSIBLE,
+                                acceptanceTest2TimeStamps[159]);
+
+    const bool isMiddleInOrder = (acceptanceTest2NSamples == 10) &&
+                                 (acceptanceTest2Samples[0] == 150) &&
+                                 (acceptanceTest2Samples[9] == 159);
+
+    acceptanceTest2NSamples = 0;
+
+    const bool isStartFound = replayer.seek(acceptanceTest2TimeStamps[0]);
+    const std::uint32_t nAllSamples =
+          replayer.replay(TopicReplayerLinux::PACING_AS_FAST_AS_POSSIBLE);
+
+    bool isAllInOrder = (acceptanceTest2NSamples == acceptanceTest2MaxNSamples);
+
+    for (std::uint32_t i = 0; i < acceptanceTest2NSamples; i++)
+    {
+        isAllInOrder &= (acceptanceTest2Samples[i] == i);
+    }
+
+    const bool isEndFound = replayer.seek(
+                     acceptanceTest2TimeStamps[acceptanceTest2MaxNSamples - 1] +
+                                                              TimeStamp(1, 0));
+
+    unlink(logFileName);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(recorder.getNChunks(), (std::uint32_t) 3)    &
+        UNIT_TEST_CASE_EQUAL(replayer.getNChunks(), recorder.getNChunks()) &
+        UNIT_TEST_CASE_EQUAL(isMiddleFound, true)                         &
+        UNIT_TEST_CASE_EQUAL(nMiddleSamples, (std::uint32_t) 10)          &
+        UNIT_TEST_CASE_EQUAL(isMiddleInOrder, true)                       &
+        UNIT_TEST_CASE_EQUAL(isStartFound, true)                          &
+        UNIT_TEST_CASE_EQUAL(nAllSamples, acceptanceTest2MaxNSamples)     &
+        UNIT_TEST_CASE_EQUAL(isAllInOrder, true)                          &
+        UNIT_TEST_CASE_EQUAL(isEndFound, false)                           &
+        UNIT_TEST_CASE_EQUAL(replayer.isAtEnd(), true));
+}
+
+//------------------------------------------------------------------------------
+void TopicRecorderLinuxTest::acceptanceTest2SampleCallback(
+                                       const TopicSample<std::uint32_t>& sample)
+{
+    if (acceptanceTest2NSamples < acceptanceTest2MaxNSamples)
+    {
+        acceptanceTest2Samples[acceptanceTest2NSamples] = sample.data;
+
+        // Replay restamps samples, only keep the recorded time stamps
+        if (acceptanceTest2IsRecording)
+        {
+            acceptanceTest2TimeStamps[acceptanceTest2NSamples] =
+                                                              sample.timeStamp;
+        }
+    }
+
+    acceptanceTest2NSamples++;
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxTest::acceptanceTest3()
+{
+    //
+    // Procedure: Record 5 samples 20 ms apart, then replay them paced
+    //
+    // Test: Verify replay takes at least as long as the recording spanned
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 34;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+
+    TopicRecorderLinux recorder;
+    recorder.addTopic<std::uint32_t>(testTopicId);
+    recorder.open(logFileName);
+
+    for (std::uint32_t i = 0; i < 5; i++)
+    {
+        testTopic.publish(i);
+
+        if (i < 4)
+        {
+            System::delayTimeMs(20);
+        }
+    }
+
+    recorder.close();
+
+    TopicReplayerLinux replayer;
+    replayer.addTopic<std::uint32_t>(testTopicId);
+    replayer.open(logFileName);
+
+    const TimeStamp replayStartTimeStamp = System::getTimeStamp();
+
+    const std::uint32_t nSamples =
+                         replayer.replay(TopicReplayerLinux::PACING_RECORDED);
+
+    const TimeStamp replayTimeStamp =
+                                 System::getTimeStamp() - replayStartTimeStamp;
+
+    unlink(logFileName);
+
+    // Test
+
+    // The recorded samples are at least 4 x 20 ms apart
+    const TimeStamp minReplayTimeStamp(0, 80000000);
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(nSamples, (std::uint32_t) 5)                   &
+        UNIT_TEST_CASE_EQUAL((replayTimeStamp >= minReplayTimeStamp), true));
+}
@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicRecorderLinuxTest.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicRecorderLinuxTest class header file.
+///
+
+#ifndef PLAT4M_TOPIC_RECORDER_LINUX_TEST_H
+#define PLAT4M_TOPIC_RECORDER_LINUX_TEST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/TimeStamp.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+class TopicRecorderLinuxTest : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    struct TestSample
+    {
+        std::uint8_t sample1;
+        double sample2;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    TopicRecorderLinuxTest();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~TopicRecorderLinuxTest();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool acceptanceTest1();
+
+    static void acceptanceTest1SampleCallback1(
+                                      const TopicSample<std::uint32_t>& sample);
+
+    static void acceptanceTest1SampleCallback2(
+                                         const TopicSample<TestSample>& sample);
+
+    static bool acceptanceTest2();
+
+    static void acceptanceTest2SampleCallback(
+                                      const TopicSample<std::uint32_t>& sample);
+
+    static bool acceptanceTest3();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    static std::uint32_t acceptanceTest1NSamples1;
+
+    static std::uint32_t acceptanceTest1NSamples2;
+
+    static bool acceptanceTest1IsInOrder;
+
+    static bool acceptanceTest2IsRecording;
+
+    static std::uint32_t acceptanceTest2NSamples;
+
+    static std::uint32_t acceptanceTest2Samples[];
+
+    static TimeStamp acceptanceTest2TimeStamps[];
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_RECORDER_LINUX_TEST_H
@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSubscriberExecutorTest.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSubscriberExecutorTest class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <Test/Acceptance_Tests/TopicSubscriberExecutorTest.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSubscriberExecutor.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/TopicManager.h>
+
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                        TopicSubscriberExecutorTest::myTestCallbackFunctions[] =
+{
+    &TopicSubscriberExecutorTest::acceptanceTest1,
+    &TopicSubscriberExecutorTest::acceptanceTest2,
+    &TopicSubscriberExecutorTest::acceptanceTest3
+};
+
+Executor* TopicSubscriberExecutorTest::myExecutor = 0;
+
+TopicSubscriberExecutorTest::TestSample
+                           TopicSubscriberExecutorTest::acceptanceTest1Sample1;
+
+TopicSubscriberExecutorTest::TestSample
+                           TopicSubscriberExecutorTest::acceptanceTest1Sample2;
+
+std::uint32_t TopicSubscriberExecutorTest::acceptanceTest2NSamples = 0;
+
+bool TopicSubscriberExecutorTest::acceptanceTest2IsInOrder = true;
+
+std::atomic<std::uint32_t> TopicSubscriberExecutorTest::acceptanceTest3NSamples(
+                                                                            0);
+
+std::atomic<bool> TopicSubscriberExecutorTest::acceptanceTest3IsDone(false);
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicSubscriberExecutorTest::TopicSubscriberExecutorTest() :
+    UnitTest("TopicSubscriberExecutorTest",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicSubscriberExecutorTest::~TopicSubscriberExecutorTest()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberExecutorTest::acceptanceTest1()
+{
+    //
+    // Procedure: Create a Topic with two subscribers sharing an Executor of
+    // two workers and publish three samples
+    //
+    // Test: Verify both subscribers receive the last sample
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 7;
+
+    TopicManager topicManager;
+
+    Topic<TestSample>& testTopic = Topic<TestSample>::create(testTopicId);
+
+    TopicSubscriberExecutor<TestSample, 4> subscriber1(
+        testTopicId,
+        createCallback(
+               &TopicSubscriberExecutorTest::acceptanceTest1SampleCallback1),
+        getExecutor());
+
+    TopicSubscriberExecutor<TestSample, 4> subscriber2(
+        testTopicId,
+        createCallback(
+               &TopicSubscriberExecutorTest::acceptanceTest1SampleCallback2),
+        getExecutor());
+
+    subscriber1.enable();
+    subscriber2.enable();
+
+    TestSample sample;
+
+    for (std::uint8_t i = 1; i <= 3; i++)
+    {
+        sample.sample1 = i;
+        sample.sample2 = i * 2;
+
+        testTopic.publish(sample);
+
+        System::delayTimeMs(10);
+    }
+
+    subscriber1.disable();
+    subscriber2.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+       UNIT_TEST_CASE_EQUAL(acceptanceTest1Sample1.sample1, (std::uint8_t) 3) &
+       UNIT_TEST_CASE_EQUAL(acceptanceTest1Sample1.sample2, (std::uint8_t) 6) &
+       UNIT_TEST_CASE_EQUAL(acceptanceTest1Sample2.sample1, (std::uint8_t) 3) &
+       UNIT_TEST_CASE_EQUAL(acceptanceTest1Sample2.sample2, (std::uint8_t) 6));
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberExecutorTest::acceptanceTest1SampleCallback1(
+                                          const TopicSample<TestSample>& sample)
+{
+    acceptanceTest1Sample1 = sample.data;
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberExecutorTest::acceptanceTest1SampleCallback2(
+                                          const TopicSample<TestSample>& sample)
+{
+    acceptanceTest1Sample2 = sample.data;
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberExecutorTest::acceptanceTest2()
+{
+    //
+    // Procedure: Create a Topic with one subscriber on an Executor of two
+    // workers and publish 100 samples back to back
+    //
+    // Test: Verify the subscriber receives every sample in order
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 8;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+
+    TopicSubscriberExecutor<std::uint32_t, 128> subscriber(
+        testTopicId,
+        createCallback(
+                &TopicSubscriberExecutorTest::acceptanceTest2SampleCallback),
+        getExecutor());
+
+    subscriber.enable();
+
+    for (std::uint32_t i = 0; i < 100; i++)
+    {
+        testTopic.publish(i);
+    }
+
+    System::delayTimeMs(50);
+
+    subscriber.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+          UNIT_TEST_CASE_EQUAL(acceptanceTest2NSamples, (std::uint32_t) 100) &
+          UNIT_TEST_CASE_EQUAL(acceptanceTest2IsInOrder, true));
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberExecutorTest::acceptanceTest2SampleCallback(
+                                      const TopicSample<std::uint32_t>& sample)
+{
+    acceptanceTest2IsInOrder &= (sample.data == acceptanceTest2NSamples);
+    acceptanceTest2IsInOrder &= (sample.sequenceId == acceptanceTest2NSamples);
+    acceptanceTest2NSamples++;
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberExecutorTest::acceptanceTest3()
+{
+    //
+    // Procedure: Create a Topic with one subscriber whose callback takes
+    // 20ms, publish a sample and destroy the subscriber while the callback is
+    // running, then publish again
+    //
+    // Test: Verify the destructor returns only once the callback is done and
+    // the Topic no longer calls the destroyed subscriber
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 9;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+
+    bool isDoneAfterDestroy = false;
+
+    {
+        TopicSubscriberExecutor<std::uint32_t, 4> subscriber(
+            testTopicId,
+            createCallback(
+                &TopicSubscriberExecutorTest::acceptanceTest3SampleCallback),
+            getExecutor());
+
+        subscriber.enable();
+
+        testTopic.publish(1);
+
+        System::delayTimeMs(5);
+    }
+
+    isDoneAfterDestroy = acceptanceTest3IsDone.load();
+
+    testTopic.publish(2);
+
+    System::delayTimeMs(30);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isDoneAfterDestroy, true) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3NSamples.load(), (std::uint32_t) 1));
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberExecutorTest::acceptanceTest3SampleCallback(
+                                      const TopicSample<std::uint32_t>& sample)
+{
+    acceptanceTest3NSamples++;
+
+    System::delayTimeMs(20);
+
+    acceptanceTest3IsDone.store(true);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+Executor& TopicSubscriberExecutorTest::getExecutor()
+{
+    // Shared by all tests, executors are never destroyed
+    if (isNullPointer(myExecutor))
+    {
+        myExecutor = &(System::createExecutor(2));
+    }
+
+    return (*myExecutor);
+}
@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSubscriberExecutorTest.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSubscriberExecutorTest class header file.
+///
+
+#ifndef PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_TEST_H
+#define PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_TEST_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/Executor.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+class TopicSubscriberExecutorTest : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public types
+    //--------------------------------------------------------------------------
+
+    struct TestSample
+    {
+        std::uint8_t sample1;
+        std::uint8_t sample2;
+    };
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    TopicSubscriberExecutorTest();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~TopicSubscriberExecutorTest();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool acceptanceTest1();
+
+    static void acceptanceTest1SampleCallback1(
+                                         const TopicSample<TestSample>& sample);
+
+    static void acceptanceTest1SampleCallback2(
+                                         const TopicSample<TestSample>& sample);
+
+    static bool acceptanceTest2();
+
+    static void acceptanceTest2SampleCallback(
+                                      const TopicSample<std::uint32_t>& sample);
+
+    static bool acceptanceTest3();
+
+    static void acceptanceTest3SampleCallback(
+                                      const TopicSample<std::uint32_t>& sample);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    static Executor* myExecutor;
+
+    static TestSample acceptanceTest1Sample1;
+
+    static TestSample acceptanceTest1Sample2;
+
+    static std::uint32_t acceptanceTest2NSamples;
+
+    static bool acceptanceTest2IsInOrder;
+
+    static std::atomic<std::uint32_t> acceptanceTest3NSamples;
+
+    static std::atomic<bool> acceptanceTest3IsDone;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static Executor& getExecutor();
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_TOPIC_SUBSCRIBER_EXECUTOR_TEST_H
@@ -63,12 +63,33 @@ using namespace Plat4m;
 const UnitTest::TestCallbackFunction
                           TopicSubscriberThreadTest::myTestCallbackFunctions[] =
 {
-    &TopicSubscriberThreadTest::acceptanceTest1
+    &TopicSubscriberThreadTest::acceptanceTest1,
+    &TopicSubscriberThreadTest::acceptanceTest2,
+    &TopicSubscriberThreadTest::acceptanceTest3,
+    &TopicSubscriberThreadTest::acceptanceTest4,
+    &TopicSubscriberThreadTest::acceptanceTest5,
+    &TopicSubscriberThreadTest::acceptanceTest6,
+    &TopicSubscriberThreadTest::acceptanceTest7
 };
 
 TopicSubscriberThreadTest::TestSample
                                TopicSubscriberThreadTest::acceptanceTest1Sample;
 
+TopicSubscriberThreadTest::TestSample
+                              TopicSubscriberThreadTest::acceptanceTest2Sample1;
+
+TopicSubscriberThreadTest::TestSample
+                              TopicSubscriberThreadTest::acceptanceTest2Sample2;
+
+const TopicSubscriberThreadTest::TestSample*
+                           TopicSubscriberThreadTest::acceptanceTest2Data1 = 0;
+
+const TopicSubscriberThreadTest::TestSample*
+                           TopicSubscriberThreadTest::acceptanceTest2Data2 = 0;
+
+TopicSubscriberThreadTest::OverflowResult
+                                     TopicSubscriberThreadTest::overflowResult;
+
 //------------------------------------------------------------------------------
 // Public constructors
 //------------------------------------------------------------------------------
@@ -142,3 +163,310 @@ void TopicSubscriberThreadTest::acceptanceTest1SampleCallback(
     // acceptanceTest1Sample = *(sample.data);
     acceptanceTest1Sample = sample.data;
 }
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest2()
+{
+    //
+    // Procedure: Create a Topic with two threaded subscribers and publish
+    // three samples
+    //
+    // Test: Verify both subscribers receive the last sample, that they share
+    // the same copy of it, and that each publish copied the sample only once
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 6;
+
+    TopicManager topicManager;
+
+    Topic<TestSample>& testTopic = Topic<TestSample>::create(testTopicId);
+
+    TopicSubscriberThread<TestSample, 4> subscriber1(
+        testTopicId,
+        createCallback(
+                  &TopicSubscriberThreadTest::acceptanceTest2SampleCallback1));
+
+    TopicSubscriberThread<TestSample, 4> subscriber2(
+        testTopicId,
+        createCallback(
+                  &TopicSubscriberThreadTest::acceptanceTest2SampleCallback2));
+
+    subscriber1.enable();
+    subscriber2.enable();
+
+    TestSample sample;
+
+    for (std::uint8_t i = 1; i <= 3; i++)
+    {
+        sample.sample1 = i;
+        sample.sample2 = i * 2;
+
+        testTopic.publish(sample);
+
+        System::delayTimeMs(10);
+    }
+
+    subscriber1.disable();
+    subscriber2.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(acceptanceTest2Sample1.sample1, (std::uint8_t) 3) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest2Sample1.sample2, (std::uint8_t) 6) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest2Sample2.sample1, (std::uint8_t) 3) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest2Sample2.sample2, (std::uint8_t) 6) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest2Data1, acceptanceTest2Data2)       &
+        UNIT_TEST_CASE_EQUAL(testTopic.getNSampleBytesCopied(),
+                             (std::uint64_t) (3 * sizeof(TestSample))));
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberThreadTest::acceptanceTest2SampleCallback1(
+                                          const TopicSample<TestSample>& sample)
+{
+    acceptanceTest2Sample1 = sample.data;
+    acceptanceTest2Data1 = &(sample.data);
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberThreadTest::acceptanceTest2SampleCallback2(
+                                          const TopicSample<TestSample>& sample)
+{
+    acceptanceTest2Sample2 = sample.data;
+    acceptanceTest2Data2 = &(sample.data);
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest3()
+{
+    //
+    // Procedure: Stall a subscriber with a queue of 2 samples using
+    // OVERFLOW_POLICY_DROP_NEWEST and publish 5 samples
+    //
+    // Test: Verify the subscriber receives samples 1, 2 and 3, the last two
+    // samples are counted as dropped, and the latency of the queued samples
+    // is measured
+    //
+
+    // Setup / Operation
+
+    runOverflowTest(TopicBase::OVERFLOW_POLICY_DROP_NEWEST);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(overflowResult.nReceivedSamples, 3U)         &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[0], 1U)       &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[1], 2U)       &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[2], 3U)       &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nDroppedSamples, 2U)          &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nConflatedSamples, 0U)        &
+        UNIT_TEST_CASE_EQUAL(overflowResult.queueHighWaterMark, 2U)       &
+        UNIT_TEST_CASE_EQUAL(overflowResult.maxLatencyNs >= 20000000, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest4()
+{
+    //
+    // Procedure: Stall a subscriber with a queue of 2 samples using
+    // OVERFLOW_POLICY_DROP_OLDEST and publish 5 samples
+    //
+    // Test: Verify the subscriber receives samples 1, 4 and 5 and samples 2
+    // and 3 are counted as dropped
+    //
+
+    // Setup / Operation
+
+    runOverflowTest(TopicBase::OVERFLOW_POLICY_DROP_OLDEST);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(overflowResult.nReceivedSamples, 3U)   &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[0], 1U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[1], 4U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[2], 5U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nDroppedSamples, 2U)    &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nConflatedSamples, 0U)  &
+        UNIT_TEST_CASE_EQUAL(overflowResult.queueHighWaterMark, 2U));
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest5()
+{
+    //
+    // Procedure: Stall a subscriber with a queue of 2 samples using
+    // OVERFLOW_POLICY_KEEP_LATEST and publish 5 samples
+    //
+    // Test: Verify the subscriber receives samples 1 and 5 only and samples
+    // 2, 3 and 4 are counted as conflated
+    //
+
+    // Setup / Operation
+
+    runOverflowTest(TopicBase::OVERFLOW_POLICY_KEEP_LATEST);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(overflowResult.nReceivedSamples, 2U)   &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[0], 1U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[1], 5U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nDroppedSamples, 0U)    &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nConflatedSamples, 3U)  &
+        UNIT_TEST_CASE_EQUAL(overflowResult.queueHighWaterMark, 1U));
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest6()
+{
+    //
+    // Procedure: Stall a subscriber with a queue of 2 samples using
+    // OVERFLOW_POLICY_BLOCK_PUBLISHER and publish 5 samples
+    //
+    // Test: Verify the subscriber receives all 5 samples in order, none are
+    // dropped, and publishing was held up until the subscriber caught up
+    //
+
+    // Setup / Operation
+
+    runOverflowTest(TopicBase::OVERFLOW_POLICY_BLOCK_PUBLISHER);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(overflowResult.nReceivedSamples, 5U)   &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[0], 1U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[1], 2U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[2], 3U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[3], 4U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[4], 5U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.nDroppedSamples, 0U)    &
+        UNIT_TEST_CASE_EQUAL(overflowResult.queueHighWaterMark, 2U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.publishTimeMs >= 20, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberThreadTest::acceptanceTest7()
+{
+    //
+    // Procedure: Create a Topic with a history of 3 samples and publish 3
+    // samples, then create a subscriber asking for 2 samples to be replayed,
+    // enable it and publish one more sample
+    //
+    // Test: Verify the subscriber receives the 2 latest samples through its
+    // thread, followed by the new one
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 7;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+    testTopic.enableHistory(3);
+
+    for (std::uint32_t i = 10; i <= 30; i += 10)
+    {
+        testTopic.publish(i);
+    }
+
+    TopicSubscriberThread<std::uint32_t, 4> subscriber(
+        testTopicId,
+        createCallback(&TopicSubscriberThreadTest::overflowSampleCallback),
+        0,
+        false,
+        0,
+        2);
+
+    overflowResult = OverflowResult();
+
+    subscriber.enable();
+
+    testTopic.publish(40);
+
+    System::delayTimeMs(10);
+
+    subscriber.disable();
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(overflowResult.nReceivedSamples, 3U)    &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[0], 20U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[1], 30U) &
+        UNIT_TEST_CASE_EQUAL(overflowResult.receivedSamples[2], 40U));
+}
+
+//------------------------------------------------------------------------------
+void TopicSubscriberThreadTest::overflowSampleCallback(
+                                      const TopicSample<std::uint32_t>& sample)
+{
+    if (overflowResult.nReceivedSamples <
+                                    arraySize(overflowResult.receivedSamples))
+    {
+        overflowResult.receivedSamples[overflowResult.nReceivedSamples] =
+                                                                    sample.data;
+    }
+
+    overflowResult.nReceivedSamples++;
+
+    // Stall on the first sample so the queue backs up behind it
+    if (sample.data == 1)
+    {
+        System::delayTimeMs(50);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicSubscriberThreadTest::runOverflowTest(
+                                const TopicBase::OverflowPolicy overflowPolicy)
+{
+    const TopicBase::Id testTopicId = 7;
+
+    TopicManager topicManager;
+
+    Topic<std::uint32_t>& testTopic = Topic<std::uint32_t>::create(testTopicId);
+
+    TopicSubscriberThread<std::uint32_t, 2> subscriber(
+        testTopicId,
+        createCallback(&TopicSubscriberThreadTest::overflowSampleCallback));
+
+    subscriber.setOverflowPolicy(overflowPolicy);
+
+    overflowResult = OverflowResult();
+
+    subscriber.enable();
+
+    // Sample 1 stalls the subscriber thread, samples 2 to 5 back up behind it
+    testTopic.publish(1);
+
+    System::delayTimeMs(10);
+
+    const TimeMs startTimeMs = System::getTimeMs();
+
+    for (std::uint32_t i = 2; i <= 5; i++)
+    {
+        testTopic.publish(i);
+    }
+
+    overflowResult.publishTimeMs = System::getTimeMs() - startTimeMs;
+
+    System::delayTimeMs(100);
+
+    subscriber.disable();
+
+    overflowResult.nDroppedSamples    = subscriber.getNDroppedSamples();
+    overflowResult.nConflatedSamples  = subscriber.getNConflatedSamples();
+    overflowResult.queueHighWaterMark = subscriber.getQueueHighWaterMark();
+    overflowResult.maxLatencyNs       = subscriber.getMaxLatencyNs();
+}
@@ -100,8 +100,44 @@ public:
     static void acceptanceTest1SampleCallback(
                                          const TopicSample<TestSample>& sample);
 
+    static bool acceptanceTest2();
+
+    static void acceptanceTest2SampleCallback1(
+                                         const TopicSample<TestSample>& sample);
+
+    static void acceptanceTest2SampleCallback2(
+                                         const TopicSample<TestSample>& sample);
+
+    static bool acceptanceTest3();
+
+    static bool acceptanceTest4();
+
+    static bool acceptanceTest5();
+
+    static bool acceptanceTest6();
+
+    static bool acceptanceTest7();
+
+    static void overflowSampleCallback(
+                                      const TopicSample<std::uint32_t>& sample);
+
 private:
 
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    struct OverflowResult
+    {
+        std::uint32_t nReceivedSamples;
+        std::uint32_t receivedSamples[5];
+        std::uint32_t nDroppedSamples;
+        std::uint32_t nConflatedSamples;
+        std::uint32_t queueHighWaterMark;
+        std::int64_t maxLatencyNs;
+        TimeMs publishTimeMs;
+    };
+
     //--------------------------------------------------------------------------
     // Private static data members
     //--------------------------------------------------------------------------
@@ -109,6 +145,22 @@ private:
     static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
 
     static TestSample acceptanceTest1Sample;
+
+    static TestSample acceptanceTest2Sample1;
+
+    static TestSample acceptanceTest2Sample2;
+
+    static const TestSample* acceptanceTest2Data1;
+
+    static const TestSample* acceptanceTest2Data2;
+
+    static OverflowResult overflowResult;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void runOverflowTest(const TopicBase::OverflowPolicy overflowPolicy);
 };
 
 }; // namespace Plat4m
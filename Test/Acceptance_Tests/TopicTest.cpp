@@ -58,7 +58,10 @@ using namespace Plat4m;
 const UnitTest::TestCallbackFunction TopicTest::myTestCallbackFunctions[] =
 {
     &TopicTest::acceptanceTest1,
-    &TopicTest::acceptanceTest2
+    &TopicTest::acceptanceTest2,
+    &TopicTest::acceptanceTest3,
+    &TopicTest::acceptanceTest4,
+    &TopicTest::acceptanceTest5
 };
 
 std::uint8_t TopicTest::acceptanceTest1Sample = 0;
@@ -71,6 +74,30 @@ TopicTest::TestSample TopicTest::acceptanceTest2Sample =
     0
 };
 
+std::uint32_t TopicTest::acceptanceTest3NSamples = 0;
+
+std::uint32_t TopicTest::acceptanceTest3SampleSum = 0;
+
+std::uint32_t TopicTest::acceptanceTest3LastSequenceId = 0;
+
+TimeStamp TopicTest::acceptanceTest3FirstTimeStamp;
+
+TimeStamp TopicTest::acceptanceTest3LastTimeStamp;
+
+std::uint32_t TopicTest::acceptanceTest3NBatches = 0;
+
+TopicSampleBatch<std::uint8_t> TopicTest::acceptanceTest3SampleBatch(0, 0);
+
+std::uint32_t TopicTest::acceptanceTest4NSamples = 0;
+
+std::uint32_t TopicTest::acceptanceTest4FirstSequenceId = 0;
+
+std::uint8_t TopicTest::acceptanceTest4Sample = 0;
+
+Topic<std::uint8_t>::SampleCallback* TopicTest::acceptanceTest5Callback1 = 0;
+
+std::uint32_t TopicTest::acceptanceTest5NSamples[3] = {0, 0, 0};
+
 //------------------------------------------------------------------------------
 // Public constructors
 //------------------------------------------------------------------------------
@@ -184,3 +211,216 @@ void TopicTest::acceptanceTest2TopicCallback(
 {
     acceptanceTest2Sample = sample.data;
 }
+
+//------------------------------------------------------------------------------
+bool TopicTest::acceptanceTest3()
+{
+    //
+    // Procedure: Create a Topic with one sample subscriber and one batch
+    // subscriber, publish a sample and then a batch of 4 samples 1 ms apart
+    //
+    // Test: Verify the batch subscriber receives the single sample as a batch
+    // of 1 and the batch in one call, and the sample subscriber receives every
+    // sample with consecutive sequence Ids and time stamps 1 ms apart
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 1;
+    const std::uint8_t testTopicSamples[] = {1, 2, 3, 4};
+    TimeStamp samplePeriod;
+    samplePeriod.timeNs = 1000000;
+
+    TopicManager topicManager;
+
+    Topic<std::uint8_t>& testTopic = Topic<std::uint8_t>::create(testTopicId);
+
+    Topic<std::uint8_t>::subscribe(
+                                 testTopicId,
+                                 createCallback(&acceptanceTest3TopicCallback));
+
+    Topic<std::uint8_t>::subscribe(
+                            testTopicId,
+                            createCallback(&acceptanceTest3TopicBatchCallback));
+
+    testTopic.publish(10);
+
+    testTopic.publishBatch(testTopicSamples,
+                           arraySize(testTopicSamples),
+                           samplePeriod);
+
+    const TimeStamp batchPeriod = acceptanceTest3LastTimeStamp -
+                                  acceptanceTest3FirstTimeStamp;
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3NSamples, (std::uint32_t) 5) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3SampleSum, (std::uint32_t) 20) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3LastSequenceId, (std::uint32_t) 4) &
+        UNIT_TEST_CASE_EQUAL(batchPeriod.timeS, (TimeSSigned) 0) &
+        UNIT_TEST_CASE_EQUAL(batchPeriod.timeNs, (TimeNsSigned) 3000000) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3NBatches, (std::uint32_t) 2) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3SampleBatch.nSamples,
+                             (std::uint32_t) 4) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest3SampleBatch.firstSequenceId,
+                             (std::uint32_t) 1) &
+        UNIT_TEST_CASE_EQUAL(
+                       acceptanceTest3SampleBatch.getTimeStamp(3) ==
+                                                   acceptanceTest3LastTimeStamp,
+                       true));
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest3TopicCallback(
+                                        const TopicSample<std::uint8_t>& sample)
+{
+    if (acceptanceTest3NSamples == 1)
+    {
+        acceptanceTest3FirstTimeStamp = sample.timeStamp;
+    }
+
+    acceptanceTest3NSamples++;
+    acceptanceTest3SampleSum += sample.data;
+    acceptanceTest3LastSequenceId = sample.sequenceId;
+    acceptanceTest3LastTimeStamp = sample.timeStamp;
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest3TopicBatchCallback(
+                              const TopicSampleBatch<std::uint8_t>& sampleBatch)
+{
+    acceptanceTest3NBatches++;
+    acceptanceTest3SampleBatch = sampleBatch;
+}
+
+//------------------------------------------------------------------------------
+bool TopicTest::acceptanceTest4()
+{
+    //
+    // Procedure: Create a Topic with a history of 3 samples, publish 5
+    // samples, then subscribe asking for 2 samples to be replayed and publish
+    // one more sample
+    //
+    // Test: Verify the latest and history samples can be read without
+    // subscribing, and the late subscriber receives the 2 latest samples
+    // followed by the new one
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 1;
+
+    TopicManager topicManager;
+
+    Topic<std::uint8_t>& testTopic = Topic<std::uint8_t>::create(testTopicId);
+    testTopic.enableHistory(3);
+
+    Topic<std::uint8_t>::HistorySample latestSample;
+    const bool isEmptyLatestRead = testTopic.getLatest(latestSample);
+
+    for (std::uint8_t i = 1; i <= 5; i++)
+    {
+        testTopic.publish(i * 10);
+    }
+
+    const bool isLatestRead = testTopic.getLatest(latestSample);
+
+    Topic<std::uint8_t>::HistorySample historySamples[4];
+    const std::uint32_t nHistorySamples =
+                                   testTopic.getHistory(historySamples, 4);
+
+    Topic<std::uint8_t>::subscribe(
+                                 testTopicId,
+                                 createCallback(&acceptanceTest4TopicCallback),
+                                 2);
+
+    testTopic.publish(60);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(isEmptyLatestRead, false) &
+        UNIT_TEST_CASE_EQUAL(isLatestRead, true) &
+        UNIT_TEST_CASE_EQUAL(latestSample.data, (std::uint8_t) 50) &
+        UNIT_TEST_CASE_EQUAL(latestSample.sequenceId, (std::uint32_t) 4) &
+        UNIT_TEST_CASE_EQUAL(nHistorySamples, (std::uint32_t) 3) &
+        UNIT_TEST_CASE_EQUAL(historySamples[0].data, (std::uint8_t) 30) &
+        UNIT_TEST_CASE_EQUAL(historySamples[2].data, (std::uint8_t) 50) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest4NSamples, (std::uint32_t) 3) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest4FirstSequenceId,
+                             (std::uint32_t) 3) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest4Sample, (std::uint8_t) 60));
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest4TopicCallback(
+                                        const TopicSample<std::uint8_t>& sample)
+{
+    if (acceptanceTest4NSamples == 0)
+    {
+        acceptanceTest4FirstSequenceId = sample.sequenceId;
+    }
+
+    acceptanceTest4NSamples++;
+    acceptanceTest4Sample = sample.data;
+}
+
+//------------------------------------------------------------------------------
+bool TopicTest::acceptanceTest5()
+{
+    //
+    // Procedure: Create a Topic with three subscribers where the first one
+    // unsubscribes itself from its callback, and publish two samples
+    //
+    // Test: Verify the first subscriber receives only the first sample and
+    // the other two receive both
+    //
+
+    // Setup / Operation
+
+    const TopicBase::Id testTopicId = 1;
+
+    TopicManager topicManager;
+
+    Topic<std::uint8_t>& testTopic = Topic<std::uint8_t>::create(testTopicId);
+
+    acceptanceTest5Callback1 = &(createCallback(&acceptanceTest5TopicCallback1));
+
+    testTopic.subscribe(*acceptanceTest5Callback1);
+    testTopic.subscribe(createCallback(&acceptanceTest5TopicCallback2));
+    testTopic.subscribe(createCallback(&acceptanceTest5TopicCallback3));
+
+    testTopic.publish(1);
+    testTopic.publish(2);
+
+    // Test
+
+    return UNIT_TEST_REPORT(
+        UNIT_TEST_CASE_EQUAL(acceptanceTest5NSamples[0], (std::uint32_t) 1) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest5NSamples[1], (std::uint32_t) 2) &
+        UNIT_TEST_CASE_EQUAL(acceptanceTest5NSamples[2], (std::uint32_t) 2));
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest5TopicCallback1(
+                                        const TopicSample<std::uint8_t>& sample)
+{
+    acceptanceTest5NSamples[0]++;
+
+    Topic<std::uint8_t>::unsubscribe(1, *acceptanceTest5Callback1);
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest5TopicCallback2(
+                                        const TopicSample<std::uint8_t>& sample)
+{
+    acceptanceTest5NSamples[1]++;
+}
+
+//------------------------------------------------------------------------------
+void TopicTest::acceptanceTest5TopicCallback3(
+                                        const TopicSample<std::uint8_t>& sample)
+{
+    acceptanceTest5NSamples[2]++;
+}
@@ -50,6 +50,8 @@
 
 #include <Plat4m_Core/UnitTest/UnitTest.h>
 #include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/TopicSampleBatch.h>
+#include <Plat4m_Core/Topic.h>
 
 //------------------------------------------------------------------------------
 // Namespaces
@@ -105,6 +107,30 @@ public:
     static void acceptanceTest2TopicCallback(
                                          const TopicSample<TestSample>& sample);
 
+    static bool acceptanceTest3();
+
+    static void acceptanceTest3TopicCallback(
+                                       const TopicSample<std::uint8_t>& sample);
+
+    static void acceptanceTest3TopicBatchCallback(
+                             const TopicSampleBatch<std::uint8_t>& sampleBatch);
+
+    static bool acceptanceTest4();
+
+    static void acceptanceTest4TopicCallback(
+                                       const TopicSample<std::uint8_t>& sample);
+
+    static bool acceptanceTest5();
+
+    static void acceptanceTest5TopicCallback1(
+                                       const TopicSample<std::uint8_t>& sample);
+
+    static void acceptanceTest5TopicCallback2(
+                                       const TopicSample<std::uint8_t>& sample);
+
+    static void acceptanceTest5TopicCallback3(
+                                       const TopicSample<std::uint8_t>& sample);
+
 private:
 
     //--------------------------------------------------------------------------
@@ -118,6 +144,30 @@ private:
     static std::uint8_t acceptanceTest1Sample2;
 
     static TestSample acceptanceTest2Sample;
+
+    static std::uint32_t acceptanceTest3NSamples;
+
+    static std::uint32_t acceptanceTest3SampleSum;
+
+    static std::uint32_t acceptanceTest3LastSequenceId;
+
+    static TimeStamp acceptanceTest3FirstTimeStamp;
+
+    static TimeStamp acceptanceTest3LastTimeStamp;
+
+    static std::uint32_t acceptanceTest3NBatches;
+
+    static TopicSampleBatch<std::uint8_t> acceptanceTest3SampleBatch;
+
+    static std::uint32_t acceptanceTest4NSamples;
+
+    static std::uint32_t acceptanceTest4FirstSequenceId;
+
+    static std::uint8_t acceptanceTest4Sample;
+
+    static Topic<std::uint8_t>::SampleCallback* acceptanceTest5Callback1;
+
+    static std::uint32_t acceptanceTest5NSamples[3];
 };
 
 }; // namespace Plat4m
@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file Benchmark.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief Benchmark helper functions header file.
+///
+
+#ifndef PLAT4M_BENCHMARK_H
+#define PLAT4M_BENCHMARK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Namespace functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+inline std::uint64_t getBenchmarkTimeNs()
+{
+    struct timespec timeSpec;
+    clock_gettime(CLOCK_MONOTONIC, &timeSpec);
+
+    return ((static_cast<std::uint64_t>(timeSpec.tv_sec) * 1000000000) +
+            static_cast<std::uint64_t>(timeSpec.tv_nsec));
+}
+
+//------------------------------------------------------------------------------
+inline std::uint64_t getBenchmarkCpuTimeNs()
+{
+    struct timespec timeSpec;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &timeSpec);
+
+    return ((static_cast<std::uint64_t>(timeSpec.tv_sec) * 1000000000) +
+            static_cast<std::uint64_t>(timeSpec.tv_nsec));
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkHeader(const char* name)
+{
+    printf("\n    %-40s %12s %12s %14s\n",
+           name,
+           "ops",
+           "time (ms)",
+           "ops/s");
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkResult(const char* name,
+                                 const std::uint64_t nOperations,
+                                 const std::uint64_t elapsedTimeNs)
+{
+    double elapsedTimeS = static_cast<double>(elapsedTimeNs) / 1e9;
+    double operationsPerS = 0.0;
+
+    if (elapsedTimeNs != 0)
+    {
+        operationsPerS = static_cast<double>(nOperations) / elapsedTimeS;
+    }
+
+    printf("    %-40s %12llu %12.2f %14.0f\n",
+           name,
+           static_cast<unsigned long long>(nOperations),
+           elapsedTimeS * 1e3,
+           operationsPerS);
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkThroughputHeader(const char* name)
+{
+    printf("\n    %-40s %12s %12s %14s\n",
+           name,
+           "bytes",
+           "time (ms)",
+           "MB/s");
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkThroughputResult(const char* name,
+                                           const std::uint64_t nBytes,
+                                           const std::uint64_t elapsedTimeNs)
+{
+    double elapsedTimeS = static_cast<double>(elapsedTimeNs) / 1e9;
+    double megabytesPerS = 0.0;
+
+    if (elapsedTimeNs != 0)
+    {
+        megabytesPerS = (static_cast<double>(nBytes) / 1e6) / elapsedTimeS;
+    }
+
+    printf("    %-40s %12llu %12.2f %14.1f\n",
+           name,
+           static_cast<unsigned long long>(nBytes),
+           elapsedTimeS * 1e3,
+           megabytesPerS);
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkLatencyHeader(const char* name)
+{
+    printf("\n    %-40s %12s %12s %12s %12s\n",
+           name,
+           "samples",
+           "p50 (us)",
+           "p99 (us)",
+           "max (us)");
+}
+
+//------------------------------------------------------------------------------
+inline void printBenchmarkLatencyResult(const char* name,
+                                        const std::uint64_t nSamples,
+                                        const std::uint64_t p50Ns,
+                                        const std::uint64_t p99Ns,
+                                        const std::uint64_t maxNs)
+{
+    printf("    %-40s %12llu %12.1f %12.1f %12.1f\n",
+           name,
+           static_cast<unsigned long long>(nSamples),
+           static_cast<double>(p50Ns) / 1e3,
+           static_cast<double>(p99Ns) / 1e3,
+           static_cast<double>(maxNs) / 1e3);
+}
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BENCHMARK_H
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ApplicationBenchmarkLinuxApp.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ApplicationBenchmarkLinuxApp class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <ApplicationBenchmarkLinuxApp.h>
+
+using Plat4m::ApplicationBenchmarkLinuxApp;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ApplicationBenchmarkLinuxApp::ApplicationBenchmarkLinuxApp() :
+    ApplicationUnitTestApp("BENCHMARK_LINUX_APP",
+                           "BENCHMARK_LINUX",
+                           "0.1.0"),
+    myAllocationMemory(),
+    mySystem(),
+    myProcessor(),
+    myQueueDriverBenchmark(),
+    myIdHashIndexBenchmark(),
+    myTopicPublishBenchmark(),
+    myThreadJitterBenchmark(),
+    myCrcBenchmark(),
+    myComLinkBenchmark(),
+    myTopicDispatchBenchmark(),
+    mySystemTimeBenchmark(),
+    myTopicBatchBenchmark(),
+    myTopicSubscriberExecutorBenchmark(),
+    myTopicBridgeShmLinuxBenchmark(),
+    myTopicRecorderLinuxBenchmark(),
+    myTopicDescriptorBenchmark(),
+    mySeqLockBenchmark(),
+    myBinaryMessageBridgeBenchmark(),
+    myBinaryMessageDispatchBenchmark(),
+    myBinaryMessageTransactionBenchmark(),
+    mySegmentTransmitBenchmark(),
+    mySerialPortLinuxBenchmark(),
+    myComInterfaceSocketLinuxBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ApplicationBenchmarkLinuxApp::~ApplicationBenchmarkLinuxApp()
+{
+}
+
+//------------------------------------------------------------------------------
+// Private methods implemented from Application
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+int ApplicationBenchmarkLinuxApp::driverRun()
+{
+    initializeProcessor();
+    initializeSystem();
+
+    return (runParentApplication());
+}
+
+//------------------------------------------------------------------------------
+// Private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void ApplicationBenchmarkLinuxApp::initializeProcessor()
+{
+    myProcessor.reset();
+}
+
+//------------------------------------------------------------------------------
+void ApplicationBenchmarkLinuxApp::initializeSystem()
+{
+    addUnitTest(myQueueDriverBenchmark);
+    addUnitTest(myIdHashIndexBenchmark);
+    addUnitTest(myTopicPublishBenchmark);
+    addUnitTest(myThreadJitterBenchmark);
+    addUnitTest(myCrcBenchmark);
+    addUnitTest(myComLinkBenchmark);
+    addUnitTest(myTopicDispatchBenchmark);
+    addUnitTest(mySystemTimeBenchmark);
+    addUnitTest(myTopicBatchBenchmark);
+    addUnitTest(myTopicSubscriberExecutorBenchmark);
+    addUnitTest(myTopicBridgeShmLinuxBenchmark);
+    addUnitTest(myTopicRecorderLinuxBenchmark);
+    addUnitTest(myTopicDescriptorBenchmark);
+    addUnitTest(mySeqLockBenchmark);
+    addUnitTest(myBinaryMessageBridgeBenchmark);
+    addUnitTest(myBinaryMessageDispatchBenchmark);
+    addUnitTest(myBinaryMessageTransactionBenchmark);
+    addUnitTest(mySegmentTransmitBenchmark);
+    addUnitTest(mySerialPortLinuxBenchmark);
+    addUnitTest(myComInterfaceSocketLinuxBenchmark);
+}
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ApplicationBenchmarkLinuxApp.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ApplicationBenchmarkLinuxApp class header file.
+///
+
+#ifndef PLAT4M_APPLICATION_BENCHMARK_LINUX_APP_H
+#define PLAT4M_APPLICATION_BENCHMARK_LINUX_APP_H
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include <Plat4m_Core/UnitTest/ApplicationUnitTestApp.h>
+#include <Plat4m_Core/Linux/SystemLinux.h>
+#include <Plat4m_Core/Linux/ProcessorLinux.h>
+#include <Plat4m_Core/AllocationMemoryLite/AllocationMemoryLite.h>
+
+#include <Test/Benchmark_Tests/QueueDriverBenchmark.h>
+#include <Test/Benchmark_Tests/IdHashIndexBenchmark.h>
+#include <Test/Benchmark_Tests/TopicPublishBenchmark.h>
+#include <Test/Benchmark_Tests/ThreadJitterBenchmark.h>
+#include <Test/Benchmark_Tests/CrcBenchmark.h>
+#include <Test/Benchmark_Tests/ComLinkBenchmark.h>
+#include <Test/Benchmark_Tests/TopicDispatchBenchmark.h>
+#include <Test/Benchmark_Tests/SystemTimeBenchmark.h>
+#include <Test/Benchmark_Tests/TopicBatchBenchmark.h>
+#include <Test/Benchmark_Tests/TopicSubscriberExecutorBenchmark.h>
+#include <Test/Benchmark_Tests/TopicBridgeShmLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/TopicRecorderLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/TopicDescriptorBenchmark.h>
+#include <Test/Benchmark_Tests/SeqLockBenchmark.h>
+#include <Test/Benchmark_Tests/BinaryMessageBridgeBenchmark.h>
+#include <Test/Benchmark_Tests/BinaryMessageDispatchBenchmark.h>
+#include <Test/Benchmark_Tests/BinaryMessageTransactionBenchmark.h>
+#include <Test/Benchmark_Tests/SegmentTransmitBenchmark.h>
+#include <Test/Benchmark_Tests/SerialPortLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/ComInterfaceSocketLinuxBenchmark.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+class ApplicationBenchmarkLinuxApp : public ApplicationUnitTestApp
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ApplicationBenchmarkLinuxApp();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~ApplicationBenchmarkLinuxApp();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private data members
+    //--------------------------------------------------------------------------
+
+    AllocationMemoryLite<4194304> myAllocationMemory;
+
+    SystemLinux mySystem;
+
+    ProcessorLinux myProcessor;
+
+    QueueDriverBenchmark myQueueDriverBenchmark;
+    IdHashIndexBenchmark myIdHashIndexBenchmark;
+    TopicPublishBenchmark myTopicPublishBenchmark;
+    ThreadJitterBenchmark myThreadJitterBenchmark;
+    CrcBenchmark myCrcBenchmark;
+
+    ComLinkBenchmark myComLinkBenchmark;
+    TopicDispatchBenchmark myTopicDispatchBenchmark;
+    SystemTimeBenchmark mySystemTimeBenchmark;
+    TopicBatchBenchmark myTopicBatchBenchmark;
+    TopicSubscriberExecutorBenchmark myTopicSubscriberExecutorBenchmark;
+    TopicBridgeShmLinuxBenchmark myTopicBridgeShmLinuxBenchmark;
+    TopicRecorderLinuxBenchmark myTopicRecorderLinuxBenchmark;
+    TopicDescriptorBenchmark myTopicDescriptorBenchmark;
+    SeqLockBenchmark mySeqLockBenchmark;
+    BinaryMessageBridgeBenchmark myBinaryMessageBridgeBenchmark;
+    BinaryMessageDispatchBenchmark myBinaryMessageDispatchBenchmark;
+    BinaryMessageTransactionBenchmark myBinaryMessageTransactionBenchmark;
+    SegmentTransmitBenchmark mySegmentTransmitBenchmark;
+    SerialPortLinuxBenchmark mySerialPortLinuxBenchmark;
+    ComInterfaceSocketLinuxBenchmark myComInterfaceSocketLinuxBenchmark;
+
+    //--------------------------------------------------------------------------
+    // Private methods implemented from Application
+    //--------------------------------------------------------------------------
+
+    int driverRun();
+
+    //--------------------------------------------------------------------------
+    // Private methods
+    //--------------------------------------------------------------------------
+
+    void initializeProcessor();
+
+    void initializeSystem();
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_APPLICATION_BENCHMARK_LINUX_APP_H
@@ -0,0 +1,14 @@
+#! /bin/bash
+
+set -e
+
+pushd .
+
+# Switch current/working directory to here
+cd "${0%/*}"
+
+cd Build
+
+./Benchmark_Linux_App
+
+popd
@@ -0,0 +1,500 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridgeBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridgeBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+
+#include <Test/Benchmark_Tests/BinaryMessageBridgeBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/ServiceManager.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/PacketFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/Packet.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageBridge.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t receiveBufferSize = 4096;
+
+static const uint16_t groupId = 0x0200;
+
+static const uint16_t messageId = 1;
+
+static const TopicBase::Id exportTopicId = 90;
+
+static const TopicBase::Id importTopicId = 91;
+
+static const uint32_t nSamples = 4000;
+
+// Samples published per millisecond, a steady stream the bridge can carry
+// without dropping any when it flushes every millisecond
+static const uint32_t nSamplesPerBurst = 8;
+
+static const TimeMs bridgeFlushIntervalMs = 1;
+
+static const TimeMs sampleTimeoutMs = 5000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ByteArrayN<256> transmitByteArray;
+
+static ByteArrayN<receiveBufferSize> receiveByteArray;
+
+static ComProtocolPlat4mBinary* comProtocol = 0;
+
+static BinaryMessageFrameHandler* binaryMessageFrameHandler = 0;
+
+static atomic<uint32_t> nTransmittedBytes(0);
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                       BinaryMessageBridgeBenchmark::myTestCallbackFunctions[] =
+{
+    &BinaryMessageBridgeBenchmark::benchmarkFramePerSample,
+    &BinaryMessageBridgeBenchmark::benchmarkBridge
+};
+
+atomic<uint32_t> BinaryMessageBridgeBenchmark::myNReceivedSamples(0);
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::BinaryMessageBridgeBenchmark() :
+    UnitTest("BinaryMessageBridgeBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::~BinaryMessageBridgeBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeBenchmark::benchmarkFramePerSample()
+{
+    setUpComLink();
+
+    TopicManager topicManager;
+
+    FramePerSampleServer server(groupId,
+                                messageId,
+                                *comProtocol,
+                                *binaryMessageFrameHandler,
+                                exportTopicId,
+                                importTopicId);
+
+    Topic<Sample>::subscribe(importTopicId,
+                             createCallback(&receivedSampleCallback));
+
+    myNReceivedSamples.store(0);
+    const uint32_t nBytesBefore = nTransmittedBytes.load();
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+    uint64_t startCpuTimeNs = getBenchmarkCpuTimeNs();
+
+    publishSamples(exportTopicId);
+    const bool isReceived = waitForSamples(nSamples);
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+    uint64_t elapsedCpuTimeNs = getBenchmarkCpuTimeNs() - startCpuTimeNs;
+
+    printResults("One frame per sample",
+                 myNReceivedSamples.load(),
+                 server.getNFramesSent(),
+                 nTransmittedBytes.load() - nBytesBefore,
+                 elapsedTimeNs,
+                 elapsedCpuTimeNs);
+
+    return UNIT_TEST_REPORT(isReceived);
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeBenchmark::benchmarkBridge()
+{
+    setUpComLink();
+
+    TopicManager topicManager;
+    ServiceManager serviceManager;
+
+    BinaryMessageBridge bridge(groupId,
+                               *comProtocol,
+                               *binaryMessageFrameHandler,
+                               bridgeFlushIntervalMs);
+    bridge.exportTopic<Sample>(exportTopicId, messageId);
+    bridge.importTopic<Sample>(importTopicId, messageId);
+
+    Topic<Sample>::subscribe(importTopicId,
+                             createCallback(&receivedSampleCallback));
+
+    myNReceivedSamples.store(0);
+    const uint32_t nBytesBefore = nTransmittedBytes.load();
+
+    bridge.enable();
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+    uint64_t startCpuTimeNs = getBenchmarkCpuTimeNs();
+
+    publishSamples(exportTopicId);
+
+    // Dropped samples are final once publishing is done
+    const bool isReceived =
+                       waitForSamples(nSamples - bridge.getNDroppedSamples());
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+    uint64_t elapsedCpuTimeNs = getBenchmarkCpuTimeNs() - startCpuTimeNs;
+
+    bridge.disable();
+
+    printResults("BinaryMessageBridge, 1 ms flush interval",
+                 myNReceivedSamples.load(),
+                 bridge.getNFramesSent(),
+                 nTransmittedBytes.load() - nBytesBefore,
+                 elapsedTimeNs,
+                 elapsedCpuTimeNs);
+    printf("    %-40s %12u\n",
+           "Samples dropped",
+           static_cast<unsigned int>(bridge.getNDroppedSamples()));
+
+    return UNIT_TEST_REPORT(isReceived);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeBenchmark::setUpComLink()
+{
+    // Shared by both runs, ComLink and its parsing thread live for the rest of
+    // the process
+    static LoopbackComInterface comInterface;
+    static ComInterfaceDeviceTemplate<256, 256>
+                                              comInterfaceDevice(comInterface);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           comInterface,
+                           receiveBufferSize);
+    static ComProtocolPlat4mBinary protocol(comLink);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+    static PacketFrameHandler packetFrameHandler(protocol, frameHandler);
+
+    if (isNullPointer(comProtocol))
+    {
+        // The default real-time priority would preempt the sender on every
+        // byte
+        comLink.getDataParsingThread().setPriority(0);
+        comLink.enable();
+
+        comProtocol = &protocol;
+        binaryMessageFrameHandler = &frameHandler;
+    }
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeBenchmark::receivedSampleCallback(
+                                              const TopicSample<Sample>& sample)
+{
+    myNReceivedSamples.fetch_add(1);
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeBenchmark::publishSamples(const TopicBase::Id topicId)
+{
+    Topic<Sample>& topic = Topic<Sample>::create(topicId);
+
+    for (uint32_t i = 1; i <= nSamples; i++)
+    {
+        Sample sample;
+        sample.index = i;
+        sample.value = i * 0.5f;
+
+        topic.publish(sample);
+
+        if ((i % nSamplesPerBurst) == 0)
+        {
+            System::delayTimeMs(1);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeBenchmark::waitForSamples(const uint32_t nSamples)
+{
+    const TimeMs timeoutTimeMs = System::getTimeMs() + sampleTimeoutMs;
+
+    while (myNReceivedSamples.load() < nSamples)
+    {
+        if (System::getTimeMs() >= timeoutTimeMs)
+        {
+            return false;
+        }
+
+        System::delayTimeMs(1);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeBenchmark::printResults(
+                                          const char* name,
+                                          const uint32_t nReceivedSamples,
+                                          const uint32_t nFrames,
+                                          const uint32_t nBytes,
+                                          const uint64_t elapsedTimeNs,
+                                          const uint64_t elapsedCpuTimeNs)
+{
+    printBenchmarkHeader(name);
+    printBenchmarkResult("Samples received (wall time)",
+                         nReceivedSamples,
+                         elapsedTimeNs);
+
+    if (nReceivedSamples != 0)
+    {
+        printf("    %-40s %12.2f\n",
+               "Frames per sample",
+               static_cast<double>(nFrames) / nReceivedSamples);
+        printf("    %-40s %12.2f\n",
+               "Link bytes per sample",
+               static_cast<double>(nBytes) / nReceivedSamples);
+        printf("    %-40s %12.2f us\n",
+               "CPU time per sample",
+               (static_cast<double>(elapsedCpuTimeNs) / nReceivedSamples) /
+                                                                           1e3);
+    }
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::LoopbackComInterface::LoopbackComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+        BinaryMessageBridgeBenchmark::LoopbackComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    const uint32_t size = byteArray.getSize();
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        byteReceived(byteArray[i]);
+    }
+
+    nTransmittedBytes.fetch_add(size);
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+     BinaryMessageBridgeBenchmark::LoopbackComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+        BinaryMessageBridgeBenchmark::LoopbackComInterface::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// SampleMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::SampleMessage::SampleMessage(
+                                                      const uint16_t groupId,
+                                                      const uint16_t messageId,
+                                                      const Sample& sample) :
+    BinaryMessage(groupId, messageId),
+    mySample(sample)
+{
+}
+
+//------------------------------------------------------------------------------
+// SampleMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageBridgeBenchmark::SampleMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(reinterpret_cast<const uint8_t*>(&mySample),
+                             sizeof(Sample)));
+}
+
+//------------------------------------------------------------------------------
+// FramePerSampleServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::FramePerSampleServer::FramePerSampleServer(
+                          const uint16_t groupId,
+                          const uint16_t messageId,
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler,
+                          const TopicBase::Id exportTopicId,
+                          const TopicBase::Id importTopicId) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myGroupId(groupId),
+    myMessageId(messageId),
+    myExportTopic(Topic<Sample>::create(exportTopicId)),
+    myImportTopic(Topic<Sample>::create(importTopicId)),
+    mySampleCallback(createCallback(this,
+                                    &FramePerSampleServer::sampleCallback)),
+    myNFramesSent(0)
+{
+    addMessageHandler(*this);
+    myExportTopic.subscribe(mySampleCallback);
+}
+
+//------------------------------------------------------------------------------
+// FramePerSampleServer public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageBridgeBenchmark::FramePerSampleServer::~FramePerSampleServer()
+{
+    myExportTopic.unsubscribe(mySampleCallback);
+}
+
+//------------------------------------------------------------------------------
+// FramePerSampleServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageBridgeBenchmark::FramePerSampleServer::getNFramesSent()
+                                                                          const
+{
+    return (myNFramesSent.load());
+}
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+             BinaryMessageBridgeBenchmark::FramePerSampleServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    const ByteArray& data = requestBinaryMessage.getData();
+
+    if ((requestBinaryMessage.getMessageId() != myMessageId) ||
+        (data.getSize() != sizeof(Sample)))
+    {
+        return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+    }
+
+    Sample sample;
+    memcpy(&sample, data.getItems(), sizeof(Sample));
+
+    myImportTopic.publish(sample);
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
+
+//------------------------------------------------------------------------------
+// FramePerSampleServer private methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageBridgeBenchmark::FramePerSampleServer::sampleCallback(
+                                              const TopicSample<Sample>& sample)
+{
+    SampleMessage message(myGroupId, myMessageId, sample.data);
+    Packet packet;
+    packet.setFrame(message);
+
+    transmitFrame(packet);
+
+    myNFramesSent.fetch_add(1);
+}
@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageBridgeBenchmark.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageBridgeBenchmark class header file.
+///
+
+#ifndef PLAT4M_BINARY_MESSAGE_BRIDGE_BENCHMARK_H
+#define PLAT4M_BINARY_MESSAGE_BRIDGE_BENCHMARK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/TopicBase.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicSample.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageServer.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Streams small samples between two Topics over a loopback ComLink,
+/// once through a BinaryMessageBridge and once with one frame per sample, and
+/// compares the frames, link bytes and CPU time each sample costs.
+///
+class BinaryMessageBridgeBenchmark : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageBridgeBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~BinaryMessageBridgeBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool benchmarkFramePerSample();
+
+    static bool benchmarkBridge();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    struct Sample
+    {
+        std::uint32_t index;
+        float value;
+    };
+
+    ///
+    /// @brief Hands every transmitted byte straight back to the byte received
+    /// callback, counting them.
+    ///
+    class LoopbackComInterface : public ComInterface
+    {
+    public:
+
+        LoopbackComInterface();
+
+        Error transmitBytes(const ByteArray& byteArray,
+                            const bool waitUntilDone = true);
+
+        std::uint32_t getReceivedBytesCount();
+
+        Error getReceivedBytes(ByteArray& byteArray,
+                               const std::uint32_t nBytes = 0);
+    };
+
+    class SampleMessage : public BinaryMessage
+    {
+    public:
+
+        SampleMessage(const std::uint16_t groupId,
+                      const std::uint16_t messageId,
+                      const Sample& sample);
+
+    private:
+
+        const Sample& mySample;
+
+        bool binaryMessageToByteArray(ByteArray& byteArray) const;
+    };
+
+    ///
+    /// @brief Sends every sample of one Topic in its own frame, the way
+    /// TopicSubscriberExternal does, and publishes the ones it receives on a
+    /// second Topic.
+    ///
+    class FramePerSampleServer : public BinaryMessageServer,
+                                 public BinaryMessageHandler
+    {
+    public:
+
+        FramePerSampleServer(
+                          const std::uint16_t groupId,
+                          const std::uint16_t messageId,
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler,
+                          const TopicBase::Id exportTopicId,
+                          const TopicBase::Id importTopicId);
+
+        virtual ~FramePerSampleServer();
+
+        std::uint32_t getNFramesSent() const;
+
+        ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage);
+
+    private:
+
+        const std::uint16_t myGroupId;
+
+        const std::uint16_t myMessageId;
+
+        Topic<Sample>& myExportTopic;
+
+        Topic<Sample>& myImportTopic;
+
+        Topic<Sample>::SampleCallback& mySampleCallback;
+
+        std::atomic<std::uint32_t> myNFramesSent;
+
+        void sampleCallback(const TopicSample<Sample>& sample);
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    static std::atomic<std::uint32_t> myNReceivedSamples;
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void setUpComLink();
+
+    static void receivedSampleCallback(const TopicSample<Sample>& sample);
+
+    static void publishSamples(const TopicBase::Id topicId);
+
+    static bool waitForSamples(const std::uint32_t nSamples);
+
+    static void printResults(const char* name,
+                             const std::uint32_t nReceivedSamples,
+                             const std::uint32_t nFrames,
+                             const std::uint32_t nBytes,
+                             const std::uint64_t elapsedTimeNs,
+                             const std::uint64_t elapsedCpuTimeNs);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BINARY_MESSAGE_BRIDGE_BENCHMARK_H
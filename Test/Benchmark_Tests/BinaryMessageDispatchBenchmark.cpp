@@ -0,0 +1,418 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageDispatchBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageDispatchBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/BinaryMessageDispatchBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandlerGroup.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nFrames = 100000;
+
+static const uint32_t nRuns = 3;
+
+static const uint32_t maxMessageTypes = 500;
+
+static const uint32_t nMessageTypesPerGroup = 20;
+
+static const uint32_t maxGroups = maxMessageTypes / nMessageTypesPerGroup;
+
+static const uint16_t firstGroupId = 0x0300;
+
+static const uint8_t frameIdentifier = 0xA1;
+
+// Frame identifier, group Id, message Id and a 4 byte payload
+static const uint32_t frameSize = 9;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ComProtocolPlat4mBinary* comProtocol = 0;
+
+static BinaryMessageFrameHandler* binaryMessageFrameHandler = 0;
+
+static uint8_t frameBytes[maxMessageTypes][frameSize];
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static uint16_t getGroupId(const uint32_t messageType)
+{
+    return (firstGroupId + (messageType / nMessageTypesPerGroup));
+}
+
+//------------------------------------------------------------------------------
+static uint16_t getMessageId(const uint32_t messageType)
+{
+    return (messageType % nMessageTypesPerGroup);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                     BinaryMessageDispatchBenchmark::myTestCallbackFunctions[] =
+{
+    &BinaryMessageDispatchBenchmark::benchmark5MessageTypes,
+    &BinaryMessageDispatchBenchmark::benchmark50MessageTypes,
+    &BinaryMessageDispatchBenchmark::benchmark500MessageTypes
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageDispatchBenchmark::BinaryMessageDispatchBenchmark() :
+    UnitTest("BinaryMessageDispatchBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageDispatchBenchmark::~BinaryMessageDispatchBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageDispatchBenchmark::benchmark5MessageTypes()
+{
+    return UNIT_TEST_REPORT(benchmark(5));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageDispatchBenchmark::benchmark50MessageTypes()
+{
+    return UNIT_TEST_REPORT(benchmark(50));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageDispatchBenchmark::benchmark500MessageTypes()
+{
+    return UNIT_TEST_REPORT(benchmark(500));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageDispatchBenchmark::setUpComProtocol()
+{
+    // The ComLink is never enabled, it only has to outlive the protocol
+    static ByteArrayN<64> transmitByteArray;
+    static ByteArrayN<64> receiveByteArray;
+    static NullComInterface comInterface;
+    static ComInterfaceDeviceTemplate<64, 64> comInterfaceDevice(comInterface);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           comInterface);
+    static ComProtocolPlat4mBinary protocol(comLink);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+
+    if (isNullPointer(comProtocol))
+    {
+        comProtocol = &protocol;
+        binaryMessageFrameHandler = &frameHandler;
+
+        for (uint32_t i = 0; i < maxMessageTypes; i++)
+        {
+            const uint16_t groupId = getGroupId(i);
+            const uint16_t messageId = getMessageId(i);
+
+            frameBytes[i][0] = frameIdentifier;
+            frameBytes[i][1] = (uint8_t) (groupId >> 8);
+            frameBytes[i][2] = (uint8_t) groupId;
+            frameBytes[i][3] = (uint8_t) (messageId >> 8);
+            frameBytes[i][4] = (uint8_t) messageId;
+            frameBytes[i][5] = (uint8_t) i;
+            frameBytes[i][6] = 0;
+            frameBytes[i][7] = 0;
+            frameBytes[i][8] = 0;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageDispatchBenchmark::benchmark(const uint32_t nMessageTypes)
+{
+    char label[64];
+    snprintf(label, sizeof(label), "Binary message dispatch x%u (ns/frame)",
+             nMessageTypes);
+    printf("\n    %-40s %12s\n", label, "ns");
+
+    setUpComProtocol();
+
+    // Groups are found through the frame handler's index either way, only the
+    // handlers within a group are searched in order without a message Id
+    return (benchmarkDispatch("Handlers added by message Id",
+                              nMessageTypes,
+                              true) &
+            benchmarkDispatch("Handlers added without an Id",
+                              nMessageTypes,
+                              false));
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageDispatchBenchmark::benchmarkDispatch(
+                                               const char* name,
+                                               const uint32_t nMessageTypes,
+                                               const bool isIndexed)
+{
+    static MessageHandler messageHandlers[maxMessageTypes];
+    BinaryMessageHandlerGroup* groups[maxGroups];
+
+    const uint32_t nGroups =
+          (nMessageTypes + nMessageTypesPerGroup - 1) / nMessageTypesPerGroup;
+
+    for (uint32_t i = 0; i < nGroups; i++)
+    {
+        const uint16_t groupId = getGroupId(i * nMessageTypesPerGroup);
+
+        groups[i] =
+                MemoryAllocator::allocate<BinaryMessageHandlerGroup>(groupId);
+    }
+
+    for (uint32_t i = 0; i < nMessageTypes; i++)
+    {
+        MessageHandler& messageHandler = messageHandlers[i];
+        BinaryMessageHandlerGroup& group = *(groups[i / nMessageTypesPerGroup]);
+
+        messageHandler.setMessageId(getMessageId(i));
+        messageHandler.resetNMessages();
+
+        if (isIndexed)
+        {
+            group.addMessageHandler(getMessageId(i), messageHandler);
+        }
+        else
+        {
+            group.addMessageHandler(messageHandler);
+        }
+    }
+
+    for (uint32_t i = 0; i < nGroups; i++)
+    {
+        binaryMessageFrameHandler->addMessageHandlerGroup(*(groups[i]));
+    }
+
+    ByteArrayN<64> transmitByteArray;
+    Callback<>* followUpCallback = 0;
+    uint32_t parsedFrameSize = 0;
+    bool isFound = true;
+
+    uint64_t elapsedTimeNs = UINT64_MAX;
+
+    for (uint32_t run = 0; run < nRuns; run++)
+    {
+        uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        for (uint32_t i = 0; i < nFrames; i++)
+        {
+            ByteArray frameByteArray(frameBytes[i % nMessageTypes], frameSize);
+
+            isFound &= (comProtocol->parseData(frameByteArray,
+                                               transmitByteArray,
+                                               followUpCallback,
+                                               parsedFrameSize) ==
+                        ComProtocol::PARSE_STATUS_FOUND_FRAME);
+        }
+
+        uint64_t runElapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+        if (runElapsedTimeNs < elapsedTimeNs)
+        {
+            elapsedTimeNs = runElapsedTimeNs;
+        }
+    }
+
+    printf("    %-40s %12.1f\n",
+           name,
+           static_cast<double>(elapsedTimeNs) / nFrames);
+
+    // Every message reached its own handler and no other, nFrames is a
+    // multiple of every nMessageTypes benchmarked
+    const uint32_t nFramesPerType = (nRuns * nFrames) / nMessageTypes;
+    bool isDeliveredOnce = true;
+
+    for (uint32_t i = 0; i < nMessageTypes; i++)
+    {
+        isDeliveredOnce &=
+                         (messageHandlers[i].getNMessages() == nFramesPerType);
+    }
+
+    for (uint32_t i = 0; i < nGroups; i++)
+    {
+        binaryMessageFrameHandler->removeMessageHandlerGroup(*(groups[i]));
+
+        groups[i]->~BinaryMessageHandlerGroup();
+        MemoryAllocator::deallocate(groups[i]);
+    }
+
+    return (UNIT_TEST_CASE_EQUAL(isFound, true) &
+            UNIT_TEST_CASE_EQUAL(isDeliveredOnce, true));
+}
+
+//------------------------------------------------------------------------------
+// NullComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageDispatchBenchmark::NullComInterface::NullComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// NullComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+        BinaryMessageDispatchBenchmark::NullComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+uint32_t
+      BinaryMessageDispatchBenchmark::NullComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+        BinaryMessageDispatchBenchmark::NullComInterface::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// MessageHandler public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageDispatchBenchmark::MessageHandler::MessageHandler() :
+    BinaryMessageHandler(),
+    myMessageId(0),
+    myNMessages(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// MessageHandler public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageDispatchBenchmark::MessageHandler::setMessageId(
+                                                       const uint16_t messageId)
+{
+    myMessageId = messageId;
+}
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageDispatchBenchmark::MessageHandler::getNMessages() const
+{
+    return myNMessages;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageDispatchBenchmark::MessageHandler::resetNMessages()
+{
+    myNMessages = 0;
+}
+
+//------------------------------------------------------------------------------
+// MessageHandler public methods implemented from BinaryMessageHandler
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+              BinaryMessageDispatchBenchmark::MessageHandler::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    if (requestBinaryMessage.getMessageId() != myMessageId)
+    {
+        return ComProtocol::PARSE_STATUS_UNSUPPORTED_FRAME;
+    }
+
+    myNMessages++;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
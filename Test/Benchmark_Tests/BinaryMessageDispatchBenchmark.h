@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageDispatchBenchmark.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageDispatchBenchmark class header file.
+///
+
+#ifndef PLAT4M_BINARY_MESSAGE_DISPATCH_BENCHMARK_H
+#define PLAT4M_BINARY_MESSAGE_DISPATCH_BENCHMARK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageHandler.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Parses binary message frames for N message types spread over groups
+/// of handlers and reports the time per frame, with the handlers registered by
+/// message Id (found through the index) and without one (searched in order).
+///
+class BinaryMessageDispatchBenchmark : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    BinaryMessageDispatchBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~BinaryMessageDispatchBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool benchmark5MessageTypes();
+
+    static bool benchmark50MessageTypes();
+
+    static bool benchmark500MessageTypes();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Transmits nothing and never receives, frames are handed to the
+    /// protocol directly.
+    ///
+    class NullComInterface : public ComInterface
+    {
+    public:
+
+        NullComInterface();
+
+        Error transmitBytes(const ByteArray& byteArray,
+                            const bool waitUntilDone = true);
+
+        std::uint32_t getReceivedBytesCount();
+
+        Error getReceivedBytes(ByteArray& byteArray,
+                               const std::uint32_t nBytes = 0);
+    };
+
+    class MessageHandler : public BinaryMessageHandler
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        // Public constructors
+        //----------------------------------------------------------------------
+
+        MessageHandler();
+
+        //----------------------------------------------------------------------
+        // Public methods
+        //----------------------------------------------------------------------
+
+        void setMessageId(const std::uint16_t messageId);
+
+        std::uint32_t getNMessages() const;
+
+        void resetNMessages();
+
+        //----------------------------------------------------------------------
+        // Public methods implemented from BinaryMessageHandler
+        //----------------------------------------------------------------------
+
+        ComProtocol::ParseStatus handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage);
+
+    private:
+
+        //----------------------------------------------------------------------
+        // Private data members
+        //----------------------------------------------------------------------
+
+        std::uint16_t myMessageId;
+
+        std::uint32_t myNMessages;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static void setUpComProtocol();
+
+    static bool benchmark(const std::uint32_t nMessageTypes);
+
+    static bool benchmarkDispatch(const char* name,
+                                  const std::uint32_t nMessageTypes,
+                                  const bool isIndexed);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_BINARY_MESSAGE_DISPATCH_BENCHMARK_H
@@ -0,0 +1,401 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file BinaryMessageTransactionBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief BinaryMessageTransactionBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/BinaryMessageTransactionBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ByteArrayParser.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessageFrameHandler.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t receiveBufferSize = 4096;
+
+static const uint16_t groupId = 0x0300;
+
+static const uint16_t messageId = 1;
+
+static const uint32_t nRoundTrips = 20000;
+
+static const uint32_t maxPipelineDepth = 64;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ByteArrayN<256> transmitByteArray;
+
+static ByteArrayN<receiveBufferSize> receiveByteArray;
+
+static ComProtocolPlat4mBinary* comProtocol = 0;
+
+static BinaryMessageFrameHandler* binaryMessageFrameHandler = 0;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                  BinaryMessageTransactionBenchmark::myTestCallbackFunctions[] =
+{
+    &BinaryMessageTransactionBenchmark::benchmarkPipelineDepth1,
+    &BinaryMessageTransactionBenchmark::benchmarkPipelineDepth8,
+    &BinaryMessageTransactionBenchmark::benchmarkPipelineDepth64
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionBenchmark::BinaryMessageTransactionBenchmark() :
+    UnitTest("BinaryMessageTransactionBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionBenchmark::~BinaryMessageTransactionBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::benchmarkPipelineDepth1()
+{
+    return runPipelined("Round trips, 1 in flight", 1);
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::benchmarkPipelineDepth8()
+{
+    return runPipelined("Round trips, 8 in flight", 8);
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::benchmarkPipelineDepth64()
+{
+    return runPipelined("Round trips, 64 in flight", 64);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void BinaryMessageTransactionBenchmark::setUpComLink()
+{
+    // Shared by all runs, ComLink and its parsing thread live for the rest of
+    // the process
+    static LoopbackComInterface comInterface;
+    static ComInterfaceDeviceTemplate<256, 256>
+                                              comInterfaceDevice(comInterface);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           comInterface,
+                           receiveBufferSize);
+    static ComProtocolPlat4mBinary protocol(comLink);
+    static BinaryMessageFrameHandler frameHandler(protocol);
+
+    if (isNullPointer(comProtocol))
+    {
+        // The default real-time priority would preempt the sender on every
+        // byte
+        comLink.getDataParsingThread().setPriority(0);
+        comLink.enable();
+
+        comProtocol = &protocol;
+        binaryMessageFrameHandler = &frameHandler;
+    }
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::runPipelined(const char* name,
+                                                     const uint32_t depth)
+{
+    setUpComLink();
+
+    IncrementServer server(*comProtocol,
+                           *binaryMessageFrameHandler);
+
+    // Static, a transaction must outlive the run even if it fails midway
+    static BinaryMessageFrameHandler::Transaction transactions[maxPipelineDepth];
+    static ValueMessage responseMessages[maxPipelineDepth];
+    ValueMessage requestMessage;
+
+    uint32_t nSent = 0;
+    uint32_t nCompleted = 0;
+    uint32_t nErrors = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while (nCompleted < nRoundTrips)
+    {
+        // Keep the pipeline full, then retire transactions in the order they
+        // were sent
+        while ((nSent < nRoundTrips) && ((nSent - nCompleted) < depth))
+        {
+            const uint32_t slot = nSent % depth;
+            BinaryMessageFrameHandler::Error error;
+
+            requestMessage.setValue(nSent);
+            responseMessages[slot].setValue(0);
+
+            if (depth == 1)
+            {
+                error = binaryMessageFrameHandler->transmitReceiveMessage(
+                                                     requestMessage,
+                                                     responseMessages[slot]);
+            }
+            else
+            {
+                error = binaryMessageFrameHandler->transmitReceiveMessageAsync(
+                                                     requestMessage,
+                                                     responseMessages[slot],
+                                                     transactions[slot]);
+            }
+
+            if (error.getCode() != BinaryMessageFrameHandler::ERROR_CODE_NONE)
+            {
+                nErrors++;
+            }
+
+            nSent++;
+        }
+
+        const uint32_t slot = nCompleted % depth;
+
+        if (depth != 1)
+        {
+            transactions[slot].wait();
+
+            if (transactions[slot].getError().getCode() !=
+                                     BinaryMessageFrameHandler::ERROR_CODE_NONE)
+            {
+                nErrors++;
+            }
+        }
+
+        if (responseMessages[slot].getValue() != (nCompleted + 1))
+        {
+            nErrors++;
+        }
+
+        nCompleted++;
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    printBenchmarkHeader(name);
+    printBenchmarkResult("Round trips", nCompleted, elapsedTimeNs);
+    printf("    %-40s %12.2f us\n",
+           "Time per round trip",
+           (static_cast<double>(elapsedTimeNs) / nCompleted) / 1e3);
+    printf("    %-40s %12u\n",
+           "Failed round trips",
+           static_cast<unsigned int>(nErrors));
+
+    return UNIT_TEST_REPORT(
+                (nErrors == 0) &&
+                (binaryMessageFrameHandler->getNPendingTransactions() == 0));
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionBenchmark::LoopbackComInterface::LoopbackComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+    BinaryMessageTransactionBenchmark::LoopbackComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    const uint32_t size = byteArray.getSize();
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        byteReceived(byteArray[i]);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageTransactionBenchmark::LoopbackComInterface::
+                                                         getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+    BinaryMessageTransactionBenchmark::LoopbackComInterface::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionBenchmark::ValueMessage::ValueMessage() :
+    BinaryMessage(groupId, messageId),
+    myValue(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t BinaryMessageTransactionBenchmark::ValueMessage::getValue() const
+{
+    return myValue;
+}
+
+//------------------------------------------------------------------------------
+void BinaryMessageTransactionBenchmark::ValueMessage::setValue(
+                                                          const uint32_t value)
+{
+    myValue = value;
+}
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::ValueMessage::parseMessageData(
+                                                          const ByteArray& data)
+{
+    ByteArrayParser byteArrayParser(data,
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+
+    return (byteArrayParser.parse(myValue));
+}
+
+//------------------------------------------------------------------------------
+// ValueMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool BinaryMessageTransactionBenchmark::ValueMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myValue, ENDIAN_BIG));
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+BinaryMessageTransactionBenchmark::IncrementServer::IncrementServer(
+                          ComProtocolPlat4mBinary& comProtocolPlat4mBinary,
+                          BinaryMessageFrameHandler& binaryMessageFrameHandler) :
+    BinaryMessageServer(groupId,
+                        comProtocolPlat4mBinary,
+                        binaryMessageFrameHandler),
+    BinaryMessageHandler(),
+    myResponseMessage()
+{
+    addMessageHandler(messageId, *this);
+}
+
+//------------------------------------------------------------------------------
+// IncrementServer public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+          BinaryMessageTransactionBenchmark::IncrementServer::handleMessage(
+                                      const BinaryMessage& requestBinaryMessage,
+                                      BinaryMessage*& responseBinaryMessage)
+{
+    ByteArrayParser byteArrayParser(requestBinaryMessage.getData(),
+                                    ENDIAN_BIG,
+                                    ByteArrayParser::PARSE_DIRECTION_FORWARD);
+    uint32_t value = 0;
+
+    if (!byteArrayParser.parse(value))
+    {
+        return ComProtocol::PARSE_STATUS_INVALID_FRAME;
+    }
+
+    myResponseMessage.setValue(value + 1);
+    responseBinaryMessage = &myResponseMessage;
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
@@ -0,0 +1,400 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceSocketLinuxBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceSocketLinuxBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <Test/Benchmark_Tests/ComInterfaceSocketLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Linux/ComInterfaceTcpLinux.h>
+#include <Plat4m_Core/Linux/ComInterfaceUdpLinux.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t smallFrameSize = 64;
+
+static const uint32_t largeFrameSize = 4096;
+
+static const uint32_t nSmallFrames = 200000;
+
+static const uint32_t nLargeFrames = 50000;
+
+// Frames transmitted before waiting for the first echo, kept under the UDP
+// transmit queue so neither end ever has to drop one
+static const uint32_t nWindowFrames = 16;
+
+static const uint32_t nLatencySamples = 10000;
+
+// A window without a single echo for this long lost its frames (UDP)
+static const uint64_t stallTimeNs = 50000000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ComInterface* echoComInterface = 0;
+
+static atomic<uint64_t> nReceivedBytes(0);
+
+static uint8_t frameBytes[largeFrameSize];
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                   ComInterfaceSocketLinuxBenchmark::myTestCallbackFunctions[] =
+{
+    &ComInterfaceSocketLinuxBenchmark::benchmarkTcpFrames,
+    &ComInterfaceSocketLinuxBenchmark::benchmarkTcpLatency,
+    &ComInterfaceSocketLinuxBenchmark::benchmarkUdpFrames,
+    &ComInterfaceSocketLinuxBenchmark::benchmarkUdpLatency
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceSocketLinuxBenchmark::ComInterfaceSocketLinuxBenchmark() :
+    UnitTest("ComInterfaceSocketLinuxBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterfaceSocketLinuxBenchmark::~ComInterfaceSocketLinuxBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::benchmarkTcpFrames()
+{
+    ComInterfaceTcpLinux server(ComInterfaceTcpLinux::MODE_SERVER,
+                                "127.0.0.1",
+                                0);
+    server.setBytesReceivedCallback(createCallback(&echoBytesReceivedCallback));
+    server.enable();
+    echoComInterface = &server;
+
+    ComInterfaceTcpLinux client(ComInterfaceTcpLinux::MODE_CLIENT,
+                                "127.0.0.1",
+                                server.getPort());
+    client.setBytesReceivedCallback(createCallback(&bytesReceivedCallback));
+    client.enable();
+
+    while (!(server.isConnected()))
+    {
+        System::delayTimeMs(1);
+    }
+
+    printBenchmarkHeader("TCP echo, 16 frames in flight (frames)");
+
+    bool passed = runFrames("64 B frames", client, smallFrameSize, nSmallFrames);
+
+    // Nagle holds small frames back until the previous ones are acknowledged
+    client.setNoDelay(false);
+    server.setNoDelay(false);
+
+    passed &= runFrames("64 B frames, TCP_NODELAY off",
+                        client,
+                        smallFrameSize,
+                        nSmallFrames);
+
+    client.setNoDelay(true);
+    server.setNoDelay(true);
+
+    passed &= runFrames("4 KB frames", client, largeFrameSize, nLargeFrames);
+
+    client.disable();
+    server.disable();
+
+    return UNIT_TEST_REPORT(passed);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::benchmarkTcpLatency()
+{
+    ComInterfaceTcpLinux server(ComInterfaceTcpLinux::MODE_SERVER,
+                                "127.0.0.1",
+                                0);
+    server.setBytesReceivedCallback(createCallback(&echoBytesReceivedCallback));
+    server.enable();
+    echoComInterface = &server;
+
+    ComInterfaceTcpLinux client(ComInterfaceTcpLinux::MODE_CLIENT,
+                                "127.0.0.1",
+                                server.getPort());
+    client.setBytesReceivedCallback(createCallback(&bytesReceivedCallback));
+    client.enable();
+
+    while (!(server.isConnected()))
+    {
+        System::delayTimeMs(1);
+    }
+
+    printBenchmarkLatencyHeader("TCP echo round trip");
+
+    bool passed = runLatency("64 B frames", client, smallFrameSize);
+    passed &= runLatency("4 KB frames", client, largeFrameSize);
+
+    client.disable();
+    server.disable();
+
+    return UNIT_TEST_REPORT(passed);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::benchmarkUdpFrames()
+{
+    ComInterfaceUdpLinux server("127.0.0.1", 0);
+    server.setBytesReceivedCallback(createCallback(&echoBytesReceivedCallback));
+    server.enable();
+    echoComInterface = &server;
+
+    ComInterfaceUdpLinux client("127.0.0.1",
+                                0,
+                                "127.0.0.1",
+                                server.getLocalPort());
+    client.setBytesReceivedCallback(createCallback(&bytesReceivedCallback));
+    client.enable();
+
+    printBenchmarkHeader("UDP echo, 16 frames in flight (frames)");
+
+    bool passed = runFrames("64 B frames", client, smallFrameSize, nSmallFrames);
+    passed &= runFrames("4 KB frames", client, largeFrameSize, nLargeFrames);
+
+    client.disable();
+    server.disable();
+
+    return UNIT_TEST_REPORT(passed);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::benchmarkUdpLatency()
+{
+    ComInterfaceUdpLinux server("127.0.0.1", 0);
+    server.setBytesReceivedCallback(createCallback(&echoBytesReceivedCallback));
+    server.enable();
+    echoComInterface = &server;
+
+    ComInterfaceUdpLinux client("127.0.0.1",
+                                0,
+                                "127.0.0.1",
+                                server.getLocalPort());
+    client.setBytesReceivedCallback(createCallback(&bytesReceivedCallback));
+    client.enable();
+
+    printBenchmarkLatencyHeader("UDP echo round trip");
+
+    bool passed = runLatency("64 B frames", client, smallFrameSize);
+    passed &= runLatency("4 KB frames", client, largeFrameSize);
+
+    client.disable();
+    server.disable();
+
+    return UNIT_TEST_REPORT(passed);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceSocketLinuxBenchmark::echoBytesReceivedCallback(
+                                                     const ByteArray& byteArray)
+{
+    // On the receive thread, a full transmit ring or queue can't happen with
+    // the window the client keeps
+    echoComInterface->transmitBytes(byteArray, false);
+}
+
+//------------------------------------------------------------------------------
+void ComInterfaceSocketLinuxBenchmark::bytesReceivedCallback(
+                                                     const ByteArray& byteArray)
+{
+    nReceivedBytes.fetch_add(byteArray.getSize(), memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::runFrames(const char* name,
+                                                 ComInterface& comInterface,
+                                                 const uint32_t frameSize,
+                                                 const uint32_t nFrames)
+{
+    ByteArray frameByteArray(frameBytes, frameSize, frameSize);
+    uint32_t nTransmittedFrames = 0;
+    uint32_t nLostFrames = 0;
+    uint64_t lastReceivedBytes = 0;
+
+    nReceivedBytes.store(0);
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+    uint64_t lastProgressTimeNs = startTimeNs;
+
+    while (true)
+    {
+        const uint64_t receivedBytes = nReceivedBytes.load(memory_order_acquire);
+        const uint32_t nReceivedFrames =
+                                static_cast<uint32_t>(receivedBytes / frameSize);
+        const uint64_t timeNs = getBenchmarkTimeNs();
+
+        if ((nReceivedFrames + nLostFrames) >= nFrames)
+        {
+            break;
+        }
+
+        if (receivedBytes != lastReceivedBytes)
+        {
+            lastReceivedBytes = receivedBytes;
+            lastProgressTimeNs = timeNs;
+        }
+        else if ((timeNs - lastProgressTimeNs) > stallTimeNs)
+        {
+            // Whatever's still in flight isn't coming back
+            nLostFrames = nTransmittedFrames - nReceivedFrames;
+            lastProgressTimeNs = timeNs;
+        }
+
+        const uint32_t nFramesInFlight =
+                           nTransmittedFrames - nReceivedFrames - nLostFrames;
+
+        if ((nTransmittedFrames < nFrames) && (nFramesInFlight < nWindowFrames))
+        {
+            if (comInterface.transmitBytes(frameByteArray, false).getCode() ==
+                                                  ComInterface::ERROR_CODE_NONE)
+            {
+                nTransmittedFrames++;
+            }
+        }
+        else
+        {
+            this_thread::yield();
+        }
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    printBenchmarkResult(name, nFrames - nLostFrames, elapsedTimeNs);
+
+    if (nLostFrames != 0)
+    {
+        printf("    %-40s %12u\n", "Lost frames", nLostFrames);
+    }
+
+    return (nLostFrames == 0);
+}
+
+//------------------------------------------------------------------------------
+bool ComInterfaceSocketLinuxBenchmark::runLatency(const char* name,
+                                                  ComInterface& comInterface,
+                                                  const uint32_t frameSize)
+{
+    ByteArray frameByteArray(frameBytes, frameSize, frameSize);
+    vector<uint64_t> latenciesNs;
+    latenciesNs.reserve(nLatencySamples);
+
+    for (uint32_t i = 0; i < nLatencySamples; i++)
+    {
+        nReceivedBytes.store(0);
+
+        const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        if (comInterface.transmitBytes(frameByteArray, false).getCode() !=
+                                                  ComInterface::ERROR_CODE_NONE)
+        {
+            break;
+        }
+
+        while ((nReceivedBytes.load(memory_order_acquire) < frameSize) &&
+               ((getBenchmarkTimeNs() - startTimeNs) < stallTimeNs))
+        {
+        }
+
+        const uint64_t endTimeNs = getBenchmarkTimeNs();
+
+        if (nReceivedBytes.load(memory_order_acquire) < frameSize)
+        {
+            break;
+        }
+
+        latenciesNs.push_back(endTimeNs - startTimeNs);
+    }
+
+    const uint32_t nSamples = static_cast<uint32_t>(latenciesNs.size());
+
+    if (nSamples == 0)
+    {
+        return false;
+    }
+
+    sort(latenciesNs.begin(), latenciesNs.end());
+
+    printBenchmarkLatencyResult(name,
+                                nSamples,
+                                latenciesNs[(nSamples - 1) / 2],
+                                latenciesNs[((nSamples - 1) * 99) / 100],
+                                latenciesNs[nSamples - 1]);
+
+    return (nSamples == nLatencySamples);
+}
@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComInterfaceSocketLinuxBenchmark.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComInterfaceSocketLinuxBenchmark class header file.
+///
+
+#ifndef PLAT4M_COM_INTERFACE_SOCKET_LINUX_BENCHMARK_H
+#define PLAT4M_COM_INTERFACE_SOCKET_LINUX_BENCHMARK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ByteArray.h>
+#include <Plat4m_Core/ComInterface.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Measures ComInterfaceTcpLinux and ComInterfaceUdpLinux over
+/// 127.0.0.1 with 64 B and 4 KB frames echoed back by the other end: frames/s
+/// with a window of frames in flight, and round trip latency one frame at a
+/// time.
+///
+class ComInterfaceSocketLinuxBenchmark : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    ComInterfaceSocketLinuxBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~ComInterfaceSocketLinuxBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool benchmarkTcpFrames();
+
+    static bool benchmarkTcpLatency();
+
+    static bool benchmarkUdpFrames();
+
+    static bool benchmarkUdpLatency();
+
+    static void echoBytesReceivedCallback(const ByteArray& byteArray);
+
+    static void bytesReceivedCallback(const ByteArray& byteArray);
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static bool runFrames(const char* name,
+                          ComInterface& comInterface,
+                          const std::uint32_t frameSize,
+                          const std::uint32_t nFrames);
+
+    static bool runLatency(const char* name,
+                           ComInterface& comInterface,
+                           const std::uint32_t frameSize);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_COM_INTERFACE_SOCKET_LINUX_BENCHMARK_H
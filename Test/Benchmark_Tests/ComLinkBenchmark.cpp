@@ -0,0 +1,347 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ComLinkBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ComLinkBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <thread>
+
+#include <Test/Benchmark_Tests/ComLinkBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/Crc.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/ComProtocolPlat4m/ComProtocolPlat4mBinary.h>
+#include <Plat4m_Core/ComProtocolPlat4m/PacketFrameHandler.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint8_t packetFrameIdentifier = 0xA2;
+
+static const uint8_t embeddedFrameIdentifier = 0x10;
+
+// Identifier, packet number, data byte count and CRC
+static const uint32_t packetHeaderSize = 6;
+
+static const uint32_t maxDataSize = 65535;
+
+static const uint32_t maxFrameSize = packetHeaderSize + maxDataSize;
+
+// Frames the sender may run ahead of the parser, so that several frames
+// regularly arrive in the same receive batch
+static const uint32_t nMaxOutstandingFrames = 2;
+
+static const uint32_t receiveBufferSize = 4 * maxFrameSize;
+
+static const TimeMs frameTimeoutMs = 10000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static uint8_t frameBytes[maxFrameSize];
+
+static ByteArrayN<256> transmitByteArray;
+
+static ByteArrayN<receiveBufferSize> receiveByteArray;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static uint32_t buildFrame(const uint32_t dataSize)
+{
+    uint8_t* data = &(frameBytes[packetHeaderSize]);
+
+    data[0] = embeddedFrameIdentifier;
+
+    for (uint32_t i = 1; i < dataSize; i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    ByteArray dataByteArray(data, dataSize);
+    uint16_t crc = Crc::calculateCrc16Ccitt(dataByteArray);
+
+    frameBytes[0] = packetFrameIdentifier;
+    frameBytes[1] = 0;
+    frameBytes[2] = static_cast<uint8_t>(dataSize >> 8);
+    frameBytes[3] = static_cast<uint8_t>(dataSize);
+    frameBytes[4] = static_cast<uint8_t>(crc >> 8);
+    frameBytes[5] = static_cast<uint8_t>(crc);
+
+    return (packetHeaderSize + dataSize);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                   ComLinkBenchmark::myTestCallbackFunctions[] =
+{
+    &ComLinkBenchmark::benchmarkSmallFrames,
+    &ComLinkBenchmark::benchmarkLargeFrames
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComLinkBenchmark::ComLinkBenchmark() :
+    UnitTest("ComLinkBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComLinkBenchmark::~ComLinkBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComLinkBenchmark::benchmarkSmallFrames()
+{
+    return UNIT_TEST_REPORT(benchmark("1 KB packet frames", 1024, 5000));
+}
+
+//------------------------------------------------------------------------------
+bool ComLinkBenchmark::benchmarkLargeFrames()
+{
+    return UNIT_TEST_REPORT(benchmark("64 KB packet frames", maxDataSize, 100));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ComLinkBenchmark::benchmark(const char* name,
+                                 const uint32_t dataSize,
+                                 const uint32_t nFrames)
+{
+    // Shared by both runs, ComLink and its parsing thread live for the rest of
+    // the process
+    static LoopbackComInterface comInterface;
+    static ComInterfaceDeviceTemplate<256, 256>
+                                              comInterfaceDevice(comInterface);
+    static ComLink comLink(transmitByteArray,
+                           receiveByteArray,
+                           comInterfaceDevice,
+                           comInterface,
+                           receiveBufferSize);
+    static ComProtocolPlat4mBinary comProtocol(comLink);
+    static CountingFrameHandler countingFrameHandler(embeddedFrameIdentifier);
+    static PacketFrameHandler packetFrameHandler(comProtocol,
+                                                 countingFrameHandler);
+
+    // The default real-time priority would preempt the sender on every byte
+    comLink.getDataParsingThread().setPriority(0);
+    comLink.enable();
+
+    const uint32_t frameSize = buildFrame(dataSize);
+    ByteArray frameByteArray(frameBytes, frameSize);
+
+    const uint32_t nFramesBefore = countingFrameHandler.getNFrames();
+
+    bool isValid = true;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+    uint64_t startCpuTimeNs = getBenchmarkCpuTimeNs();
+
+    for (uint32_t i = 0; (i < nFrames) && isValid; i++)
+    {
+        TimeMs timeoutTimeMs = System::getTimeMs() + frameTimeoutMs;
+
+        while ((i - (countingFrameHandler.getNFrames() - nFramesBefore)) >=
+                                                          nMaxOutstandingFrames)
+        {
+            if (System::getTimeMs() >= timeoutTimeMs)
+            {
+                isValid = false;
+
+                break;
+            }
+
+            this_thread::yield();
+        }
+
+        comInterface.transmitBytes(frameByteArray);
+    }
+
+    TimeMs timeoutTimeMs = System::getTimeMs() + frameTimeoutMs;
+
+    while (isValid &&
+           ((countingFrameHandler.getNFrames() - nFramesBefore) < nFrames))
+    {
+        if (System::getTimeMs() >= timeoutTimeMs)
+        {
+            isValid = false;
+        }
+
+        this_thread::yield();
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+    uint64_t elapsedCpuTimeNs = getBenchmarkCpuTimeNs() - startCpuTimeNs;
+
+    comLink.disable();
+
+    const uint32_t nParsedFrames =
+                             countingFrameHandler.getNFrames() - nFramesBefore;
+
+    printBenchmarkHeader(name);
+    printBenchmarkResult("Frames parsed (wall time)",
+                         nParsedFrames,
+                         elapsedTimeNs);
+    printBenchmarkResult("Frames parsed (CPU time, all threads)",
+                         nParsedFrames,
+                         elapsedCpuTimeNs);
+
+    if (nParsedFrames != 0)
+    {
+        printf("    %-40s %12.2f us\n",
+               "CPU time per frame",
+               (static_cast<double>(elapsedCpuTimeNs) / nParsedFrames) / 1e3);
+    }
+
+    return (isValid && (nParsedFrames == nFrames));
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComLinkBenchmark::LoopbackComInterface::LoopbackComInterface() :
+    ComInterface()
+{
+}
+
+//------------------------------------------------------------------------------
+// LoopbackComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComLinkBenchmark::LoopbackComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    const uint32_t size = byteArray.getSize();
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        byteReceived(byteArray[i]);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+uint32_t ComLinkBenchmark::LoopbackComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error ComLinkBenchmark::LoopbackComInterface::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// CountingFrameHandler public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComLinkBenchmark::CountingFrameHandler::CountingFrameHandler(
+                                               const uint8_t frameIdentifier) :
+    FrameHandler(frameIdentifier),
+    myNFrames(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// CountingFrameHandler public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+uint32_t ComLinkBenchmark::CountingFrameHandler::getNFrames() const
+{
+    return (myNFrames.load(memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+// CountingFrameHandler private methods implemented from FrameHandler
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ComProtocol::ParseStatus
+              ComLinkBenchmark::CountingFrameHandler::driverHandleFrame(
+                                                      const Frame& requestFrame,
+                                                      Frame*& responseFrame)
+{
+    myNFrames.fetch_add(1, memory_order_release);
+
+    return ComProtocol::PARSE_STATUS_FOUND_FRAME;
+}
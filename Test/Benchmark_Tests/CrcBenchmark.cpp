@@ -0,0 +1,265 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file CrcBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief CrcBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/CrcBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Crc.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t bufferSize = 65536;
+
+static const uint32_t nPasses = 512;
+
+// The bit by bit reference is roughly two orders of magnitude slower
+static const uint32_t nBitwisePasses = 16;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static uint8_t buffer[bufferSize];
+
+// Keeps the compiler from discarding the CRC loops
+static volatile uint32_t crcSink;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void fillBuffer()
+{
+    uint32_t state = 0x12345678;
+
+    for (uint32_t i = 0; i < bufferSize; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        buffer[i] = static_cast<uint8_t>(state);
+    }
+}
+
+//------------------------------------------------------------------------------
+static uint16_t calculateCrc16CcittBitwise(const uint8_t data[],
+                                           const uint32_t size)
+{
+    // Implementation Crc::calculateCrc16Ccitt() used before the table engine
+    uint16_t crc = 0;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        uint8_t reversedByte = Crc::reverseBitOrder(data[i]);
+
+        crc ^= (((uint16_t) reversedByte) << 8);
+
+        for (uint32_t j = 8; j > 0; j--)
+        {
+            if (areBitsSet(crc, 0x8000))
+            {
+                crc = (crc << 1) ^ Crc::crc16CcittPlynomial;
+            }
+            else
+            {
+                crc = (crc << 1);
+            }
+        }
+    }
+
+    crc = Crc::reverseBitOrder(crc);
+
+    return crc;
+}
+
+//------------------------------------------------------------------------------
+template <typename TCalculator>
+static void runSoftware(const char* name)
+{
+    uint32_t crc = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nPasses; i++)
+    {
+        // Changes every pass so the calculation can't be hoisted
+        buffer[0] = static_cast<uint8_t>(i);
+
+        crc ^= TCalculator::updateValueSoftware(0, buffer, bufferSize);
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    crcSink = crc;
+
+    printBenchmarkThroughputResult(name,
+                                   static_cast<uint64_t>(nPasses) * bufferSize,
+                                   elapsedTimeNs);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction CrcBenchmark::myTestCallbackFunctions[] =
+{
+    &CrcBenchmark::benchmarkCrc16Ccitt,
+    &CrcBenchmark::benchmarkCrc32,
+    &CrcBenchmark::benchmarkCrc32c
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+CrcBenchmark::CrcBenchmark() :
+    UnitTest("CrcBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+    fillBuffer();
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+CrcBenchmark::~CrcBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool CrcBenchmark::benchmarkCrc16Ccitt()
+{
+    printBenchmarkThroughputHeader("CRC-16 (64 KB buffer)");
+
+    uint32_t crc = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nBitwisePasses; i++)
+    {
+        buffer[0] = static_cast<uint8_t>(i);
+
+        crc ^= calculateCrc16CcittBitwise(buffer, bufferSize);
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    crcSink = crc;
+
+    printBenchmarkThroughputResult(
+                          "bit by bit (previous)",
+                          static_cast<uint64_t>(nBitwisePasses) * bufferSize,
+                          elapsedTimeNs);
+
+    runSoftware<Crc::Crc16CcittCalculator>("slice-by-8");
+
+    const bool isEqual =
+               (calculateCrc16CcittBitwise(buffer, bufferSize) ==
+                Crc::Crc16CcittCalculator::calculate(buffer, bufferSize));
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isEqual, true));
+}
+
+//------------------------------------------------------------------------------
+bool CrcBenchmark::benchmarkCrc32()
+{
+    printBenchmarkThroughputHeader("CRC-32 (64 KB buffer)");
+
+    runSoftware<Crc::Crc32Calculator>("slice-by-8");
+
+    return UNIT_TEST_REPORT(true);
+}
+
+//------------------------------------------------------------------------------
+bool CrcBenchmark::benchmarkCrc32c()
+{
+    printBenchmarkThroughputHeader("CRC-32C (64 KB buffer)");
+
+    runSoftware<Crc::Crc32cCalculator>("slice-by-8");
+
+    if (!Crc::Crc32cCalculator::isHardwareSupported())
+    {
+        printf("    (SSE4.2 not supported)\n");
+
+        return UNIT_TEST_REPORT(true);
+    }
+
+    uint32_t crc = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nPasses; i++)
+    {
+        buffer[0] = static_cast<uint8_t>(i);
+
+        crc ^= Crc::Crc32cCalculator::updateValue(0, buffer, bufferSize);
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    crcSink = crc;
+
+    printBenchmarkThroughputResult("SSE4.2",
+                                   static_cast<uint64_t>(nPasses) * bufferSize,
+                                   elapsedTimeNs);
+
+    return UNIT_TEST_REPORT(true);
+}
@@ -0,0 +1,244 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file IdHashIndexBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief IdHashIndexBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/IdHashIndexBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/IdHashIndex.h>
+#include <Plat4m_Core/List.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nIndexLookups = 2000000;
+
+// The list search is O(n), scale its lookup count down so every run takes a
+// similar amount of time
+static const uint32_t nListLookupNodeVisits = 20000000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static uint32_t getRegistrantId(const uint32_t index)
+{
+    // Sparse, non-sequential Ids like real Topic/Service Ids
+    return ((index * 7919) + 1);
+}
+
+//------------------------------------------------------------------------------
+static uint32_t getNextLookupIndex(uint32_t& seed, const uint32_t nIds)
+{
+    seed = (seed * 1664525) + 1013904223;
+
+    return ((seed >> 8) % nIds);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                               IdHashIndexBenchmark::myTestCallbackFunctions[] =
+{
+    &IdHashIndexBenchmark::benchmark10Ids,
+    &IdHashIndexBenchmark::benchmark100Ids,
+    &IdHashIndexBenchmark::benchmark1000Ids,
+    &IdHashIndexBenchmark::benchmark10000Ids
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IdHashIndexBenchmark::IdHashIndexBenchmark() :
+    UnitTest("IdHashIndexBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+IdHashIndexBenchmark::~IdHashIndexBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool IdHashIndexBenchmark::benchmark10Ids()
+{
+    return UNIT_TEST_REPORT(benchmark(10));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexBenchmark::benchmark100Ids()
+{
+    return UNIT_TEST_REPORT(benchmark(100));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexBenchmark::benchmark1000Ids()
+{
+    return UNIT_TEST_REPORT(benchmark(1000));
+}
+
+//------------------------------------------------------------------------------
+bool IdHashIndexBenchmark::benchmark10000Ids()
+{
+    return UNIT_TEST_REPORT(benchmark(10000));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool IdHashIndexBenchmark::benchmark(const uint32_t nIds)
+{
+    printBenchmarkHeader("Registry lookup by Id");
+
+    // Smallest power of 2 that keeps the index at most 3/4 full
+    uint32_t nEntries = 2;
+
+    while ((nEntries - (nEntries / 4)) < nIds)
+    {
+        nEntries *= 2;
+    }
+
+    typedef IdHashIndex<Registrant*> Index;
+
+    Registrant* registrants = new Registrant[nIds];
+    Index::Entry* entries = new Index::Entry[nEntries];
+
+    Index index(entries, nEntries);
+    List<Registrant*> list;
+
+    for (uint32_t i = 0; i < nIds; i++)
+    {
+        registrants[i].id = getRegistrantId(i);
+
+        Registrant* pointer = &(registrants[i]);
+        list.append(pointer);
+        index.insert(registrants[i].id, pointer);
+    }
+
+    // List search, what the registries did before
+
+    const uint32_t nListLookups = nListLookupNodeVisits / nIds;
+    uint32_t seed = 1;
+    uint32_t nListFound = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nListLookups; i++)
+    {
+        const uint32_t id = getRegistrantId(getNextLookupIndex(seed, nIds));
+
+        List<Registrant*>::Iterator iterator = list.iterator();
+
+        while (iterator.hasCurrent())
+        {
+            if (iterator.current()->id == id)
+            {
+                nListFound++;
+
+                break;
+            }
+
+            iterator.next();
+        }
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    char label[64];
+    snprintf(label, sizeof(label), "List x%u", nIds);
+    printBenchmarkResult(label, nListLookups, elapsedTimeNs);
+
+    // Hash index
+
+    seed = 1;
+    uint32_t nIndexFound = 0;
+
+    startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nIndexLookups; i++)
+    {
+        const uint32_t id = getRegistrantId(getNextLookupIndex(seed, nIds));
+
+        Registrant* registrant = 0;
+
+        if ((index.find(id, registrant).getCode() == Index::ERROR_CODE_NONE) &&
+            (registrant->id == id))
+        {
+            nIndexFound++;
+        }
+    }
+
+    elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    snprintf(label, sizeof(label), "IdHashIndex x%u", nIds);
+    printBenchmarkResult(label, nIndexLookups, elapsedTimeNs);
+
+    delete[] entries;
+    delete[] registrants;
+
+    return (UNIT_TEST_CASE_EQUAL(nListFound, nListLookups) &
+            UNIT_TEST_CASE_EQUAL(nIndexFound, nIndexLookups));
+}
@@ -0,0 +1,221 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file QueueDriverBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief QueueDriverBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <Test/Benchmark_Tests/QueueDriverBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Linux/QueueDriverLinux.h>
+#include <Plat4m_Core/Linux/QueueDriverLinuxLockFree.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nTotalValues = 200000;
+
+static const uint32_t queueCapacity = 1024;
+
+static const uint32_t maxProducers = 16;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                               QueueDriverBenchmark::myTestCallbackFunctions[] =
+{
+    &QueueDriverBenchmark::benchmark1Producer,
+    &QueueDriverBenchmark::benchmark4Producers,
+    &QueueDriverBenchmark::benchmark16Producers
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverBenchmark::QueueDriverBenchmark() :
+    UnitTest("QueueDriverBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+QueueDriverBenchmark::~QueueDriverBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool QueueDriverBenchmark::benchmark1Producer()
+{
+    return UNIT_TEST_REPORT(benchmark(1));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverBenchmark::benchmark4Producers()
+{
+    return UNIT_TEST_REPORT(benchmark(4));
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverBenchmark::benchmark16Producers()
+{
+    return UNIT_TEST_REPORT(benchmark(16));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool QueueDriverBenchmark::benchmark(const uint32_t nProducers)
+{
+    printBenchmarkHeader("Queue driver (producers -> 1 consumer)");
+
+    QueueDriverLinux messageQueueDriver(sizeof(uint64_t));
+    QueueDriverLinuxLockFree lockFreeDriver(queueCapacity, sizeof(uint64_t));
+
+    bool passed = runDriver(messageQueueDriver, "QueueDriverLinux", nProducers);
+
+    passed &= runDriver(lockFreeDriver, "QueueDriverLinuxLockFree", nProducers);
+
+    return passed;
+}
+
+//------------------------------------------------------------------------------
+bool QueueDriverBenchmark::runDriver(QueueDriver& queueDriver,
+                                     const char* name,
+                                     const uint32_t nProducers)
+{
+    Producer producers[maxProducers];
+    pthread_t threads[maxProducers];
+    uint32_t nextSequenceIds[maxProducers];
+
+    const uint32_t nValuesPerProducer = nTotalValues / nProducers;
+    const uint32_t nValues = nValuesPerProducer * nProducers;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nProducers; i++)
+    {
+        producers[i].queueDriver = &queueDriver;
+        producers[i].producerIndex = i;
+        producers[i].nValues = nValuesPerProducer;
+        nextSequenceIds[i] = 0;
+
+        pthread_create(&(threads[i]), NULL, &producerThreadCallback,
+                       &(producers[i]));
+    }
+
+    bool isInOrder = true;
+
+    for (uint32_t i = 0; i < nValues; i++)
+    {
+        uint64_t value = 0;
+        queueDriver.driverDequeue(&value);
+
+        uint32_t producerIndex = static_cast<uint32_t>(value >> 32);
+        uint32_t sequenceId = static_cast<uint32_t>(value);
+
+        if ((producerIndex >= nProducers) ||
+            (sequenceId != nextSequenceIds[producerIndex]))
+        {
+            isInOrder = false;
+        }
+        else
+        {
+            nextSequenceIds[producerIndex]++;
+        }
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    for (uint32_t i = 0; i < nProducers; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    char label[64];
+    snprintf(label, sizeof(label), "%s x%u", name, nProducers);
+    printBenchmarkResult(label, nValues, elapsedTimeNs);
+
+    return UNIT_TEST_CASE_EQUAL(isInOrder, true);
+}
+
+//------------------------------------------------------------------------------
+void* QueueDriverBenchmark::producerThreadCallback(void* arg)
+{
+    Producer* producer = static_cast<Producer*>(arg);
+
+    for (uint32_t i = 0; i < producer->nValues; i++)
+    {
+        uint64_t value =
+                  (static_cast<uint64_t>(producer->producerIndex) << 32) | i;
+
+        while (!(producer->queueDriver->driverEnqueue(&value)))
+        {
+            // Queue full, let the consumer catch up
+            sched_yield();
+        }
+    }
+
+    return 0;
+}
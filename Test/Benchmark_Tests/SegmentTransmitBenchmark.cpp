@@ -0,0 +1,391 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SegmentTransmitBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SegmentTransmitBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <Test/Benchmark_Tests/SegmentTransmitBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/ComLink.h>
+#include <Plat4m_Core/ComInterfaceDeviceTemplate.h>
+#include <Plat4m_Core/ArrayN.h>
+#include <Plat4m_Core/ComProtocolPlat4m/Packet.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint16_t groupId = 0x0400;
+
+static const uint16_t messageId = 1;
+
+static const uint32_t maxPayloadSize = 1024;
+
+static const uint32_t maxFrameSize = maxPayloadSize + 64;
+
+static const uint32_t maxSegments = 8;
+
+static const uint32_t nFrames = 200000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static ByteArrayN<maxFrameSize> transmitByteArray;
+
+static ByteArrayN<128> receiveByteArray;
+
+static ComLink* comLink = 0;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                           SegmentTransmitBenchmark::myTestCallbackFunctions[] =
+{
+    &SegmentTransmitBenchmark::benchmarkCopyTransmit64,
+    &SegmentTransmitBenchmark::benchmarkSegmentTransmit64,
+    &SegmentTransmitBenchmark::benchmarkCopyTransmit1024,
+    &SegmentTransmitBenchmark::benchmarkSegmentTransmit1024
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::SegmentTransmitBenchmark() :
+    UnitTest("SegmentTransmitBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::~SegmentTransmitBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::benchmarkCopyTransmit64()
+{
+    return runTransmit("Copy + write(), 64 B payload", 64, false);
+}
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::benchmarkSegmentTransmit64()
+{
+    return runTransmit("Segments + writev(), 64 B payload", 64, true);
+}
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::benchmarkCopyTransmit1024()
+{
+    return runTransmit("Copy + write(), 1 KB payload", 1024, false);
+}
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::benchmarkSegmentTransmit1024()
+{
+    return runTransmit("Segments + writev(), 1 KB payload", 1024, true);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::SinkComInterface&
+                                        SegmentTransmitBenchmark::setUpComLink()
+{
+    // Only the transmit path is measured, the ComLink is never enabled
+    static SinkComInterface comInterface;
+    static ComInterfaceDeviceTemplate<128, 128> comInterfaceDevice(comInterface);
+    static ComLink link(transmitByteArray,
+                        receiveByteArray,
+                        comInterfaceDevice,
+                        comInterface);
+
+    comLink = &link;
+
+    return comInterface;
+}
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::runTransmit(const char* name,
+                                           const uint32_t payloadSize,
+                                           const bool useSegments)
+{
+    SinkComInterface& sinkComInterface = setUpComLink();
+    ByteArrayN<maxPayloadSize> payload;
+
+    for (uint32_t i = 0; i < payloadSize; i++)
+    {
+        payload.append(static_cast<uint8_t>(i));
+    }
+
+    PayloadMessage message(payload);
+    Packet packet(0, 0, 0, message);
+
+    // Both paths have to put the same bytes on the wire
+    ByteArrayN<maxFrameSize> expectedByteArray;
+    ByteArrayN<maxFrameSize> capturedByteArray;
+    ByteArrayN<maxFrameSize> frameByteArray;
+    ByteArrayN<maxFrameSize> headerByteArray;
+    ArrayN<ByteArray, maxSegments> segments;
+
+    packet.toByteArray(expectedByteArray);
+    sinkComInterface.setCaptureByteArray(&capturedByteArray);
+    packet.toSegments(headerByteArray, segments);
+    comLink->transmitSegments(segments);
+    sinkComInterface.setCaptureByteArray(0);
+
+    const uint32_t frameSize = expectedByteArray.getSize();
+    const bool isMatch =
+             (capturedByteArray.getSize() == frameSize) &&
+             (memcmp(capturedByteArray.getItems(),
+                     expectedByteArray.getItems(),
+                     frameSize) == 0);
+
+    uint64_t nBytesCopied = 0;
+    uint32_t nErrors = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nFrames; i++)
+    {
+        if (useSegments)
+        {
+            headerByteArray.clear();
+            segments.clear();
+
+            if (!(packet.toSegments(headerByteArray, segments)))
+            {
+                nErrors++;
+            }
+
+            // Only what the frames built themselves was copied
+            nBytesCopied += headerByteArray.getSize();
+            comLink->transmitSegments(segments);
+        }
+        else
+        {
+            frameByteArray.clear();
+
+            if (!(packet.toByteArray(frameByteArray)))
+            {
+                nErrors++;
+            }
+
+            nBytesCopied += frameByteArray.getSize();
+            comLink->transmitBytes(frameByteArray);
+        }
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    printBenchmarkHeader(name);
+    printBenchmarkResult("Frames", nFrames, elapsedTimeNs);
+    printf("    %-40s %12u B\n",
+           "Frame size",
+           static_cast<unsigned int>(frameSize));
+    printf("    %-40s %12.1f B\n",
+           "Bytes copied per frame",
+           static_cast<double>(nBytesCopied) / nFrames);
+    printf("    %-40s %12.1f MB/s\n",
+           "Throughput",
+           ((static_cast<double>(frameSize) * nFrames) /
+            (static_cast<double>(elapsedTimeNs) / 1e9)) / 1e6);
+
+    return UNIT_TEST_REPORT(isMatch && (nErrors == 0));
+}
+
+//------------------------------------------------------------------------------
+// SinkComInterface public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::SinkComInterface::SinkComInterface() :
+    ComInterface(),
+    myFileDescriptor(open("/dev/null", O_WRONLY)),
+    myCaptureByteArray(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// SinkComInterface public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::SinkComInterface::~SinkComInterface()
+{
+    if (myFileDescriptor >= 0)
+    {
+        close(myFileDescriptor);
+    }
+}
+
+//------------------------------------------------------------------------------
+// SinkComInterface public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void SegmentTransmitBenchmark::SinkComInterface::setCaptureByteArray(
+                                                   ByteArray* captureByteArray)
+{
+    myCaptureByteArray = captureByteArray;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error SegmentTransmitBenchmark::SinkComInterface::transmitBytes(
+                                                    const ByteArray& byteArray,
+                                                    const bool waitUntilDone)
+{
+    if (isValidPointer(myCaptureByteArray))
+    {
+        myCaptureByteArray->append(byteArray);
+
+        return Error(ERROR_CODE_NONE);
+    }
+
+    if (write(myFileDescriptor,
+              byteArray.getItems(),
+              byteArray.getSize()) < 0)
+    {
+        return Error(ERROR_CODE_TRANSMIT_FAILED);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+           SegmentTransmitBenchmark::SinkComInterface::transmitSegments(
+                                               const Array<ByteArray>& segments,
+                                               const bool waitUntilDone)
+{
+    if (isValidPointer(myCaptureByteArray))
+    {
+        return ComInterface::transmitSegments(segments, waitUntilDone);
+    }
+
+    struct iovec ioVectors[maxSegments];
+    const uint32_t nSegments = segments.getSize();
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        ioVectors[i].iov_base = segments[i].getItems();
+        ioVectors[i].iov_len = segments[i].getSize();
+    }
+
+    if (writev(myFileDescriptor, ioVectors, nSegments) < 0)
+    {
+        return Error(ERROR_CODE_TRANSMIT_FAILED);
+    }
+
+    return Error(ERROR_CODE_NONE);
+}
+
+//------------------------------------------------------------------------------
+uint32_t SegmentTransmitBenchmark::SinkComInterface::getReceivedBytesCount()
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+ComInterface::Error
+             SegmentTransmitBenchmark::SinkComInterface::getReceivedBytes(
+                                                          ByteArray& byteArray,
+                                                          const uint32_t nBytes)
+{
+    return Error(ERROR_CODE_RECEIVE_FAILED);
+}
+
+//------------------------------------------------------------------------------
+// PayloadMessage public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SegmentTransmitBenchmark::PayloadMessage::PayloadMessage(
+                                                    const ByteArray& payload) :
+    BinaryMessage(groupId, messageId),
+    myPayload(payload)
+{
+}
+
+//------------------------------------------------------------------------------
+// PayloadMessage private methods implemented from BinaryMessage
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::PayloadMessage::binaryMessageToByteArray(
+                                                    ByteArray& byteArray) const
+{
+    return (byteArray.append(myPayload));
+}
+
+//------------------------------------------------------------------------------
+bool SegmentTransmitBenchmark::PayloadMessage::binaryMessageToSegments(
+                                              ByteArray& headerByteArray,
+                                              Array<ByteArray>& segments) const
+{
+    return (appendSegment(segments, myPayload));
+}
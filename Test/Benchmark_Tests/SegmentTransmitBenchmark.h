@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SegmentTransmitBenchmark.h
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SegmentTransmitBenchmark class header file.
+///
+
+#ifndef PLAT4M_SEGMENT_TRANSMIT_BENCHMARK_H
+#define PLAT4M_SEGMENT_TRANSMIT_BENCHMARK_H
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <Plat4m_Core/UnitTest/UnitTest.h>
+#include <Plat4m_Core/ComInterface.h>
+#include <Plat4m_Core/ComProtocolPlat4m/BinaryMessage.h>
+
+//------------------------------------------------------------------------------
+// Namespaces
+//------------------------------------------------------------------------------
+
+namespace Plat4m
+{
+
+//------------------------------------------------------------------------------
+// Classes
+//------------------------------------------------------------------------------
+
+///
+/// @brief Compares transmitting a Packet wrapped BinaryMessage by copying it
+/// into one buffer and calling write(), against gathering it with
+/// Frame::toSegments() and calling writev(), for 64 B and 1 KB payloads.
+///
+class SegmentTransmitBenchmark : public UnitTest
+{
+public:
+
+    //--------------------------------------------------------------------------
+    // Public constructors
+    //--------------------------------------------------------------------------
+
+    SegmentTransmitBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public virtual destructors
+    //--------------------------------------------------------------------------
+
+    virtual ~SegmentTransmitBenchmark();
+
+    //--------------------------------------------------------------------------
+    // Public static methods
+    //--------------------------------------------------------------------------
+
+    static bool benchmarkCopyTransmit64();
+
+    static bool benchmarkSegmentTransmit64();
+
+    static bool benchmarkCopyTransmit1024();
+
+    static bool benchmarkSegmentTransmit1024();
+
+private:
+
+    //--------------------------------------------------------------------------
+    // Private types
+    //--------------------------------------------------------------------------
+
+    ///
+    /// @brief Writes everything transmitted to /dev/null, single buffers with
+    /// write() and segment lists with one writev(). If a capture array is
+    /// set the bytes are appended to it instead.
+    ///
+    class SinkComInterface : public ComInterface
+    {
+    public:
+
+        SinkComInterface();
+
+        virtual ~SinkComInterface();
+
+        void setCaptureByteArray(ByteArray* captureByteArray);
+
+        Error transmitBytes(const ByteArray& byteArray,
+                            const bool waitUntilDone = true);
+
+        Error transmitSegments(const Array<ByteArray>& segments,
+                               const bool waitUntilDone = true);
+
+        std::uint32_t getReceivedBytesCount();
+
+        Error getReceivedBytes(ByteArray& byteArray,
+                               const std::uint32_t nBytes = 0);
+
+    private:
+
+        int myFileDescriptor;
+
+        ByteArray* myCaptureByteArray;
+    };
+
+    ///
+    /// @brief Carries a payload held in a buffer of the caller's.
+    ///
+    class PayloadMessage : public BinaryMessage
+    {
+    public:
+
+        PayloadMessage(const ByteArray& payload);
+
+    private:
+
+        const ByteArray& myPayload;
+
+        bool binaryMessageToByteArray(ByteArray& byteArray) const;
+
+        bool binaryMessageToSegments(ByteArray& headerByteArray,
+                                     Array<ByteArray>& segments) const;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private static data members
+    //--------------------------------------------------------------------------
+
+    static const UnitTest::TestCallbackFunction myTestCallbackFunctions[];
+
+    //--------------------------------------------------------------------------
+    // Private static methods
+    //--------------------------------------------------------------------------
+
+    static SinkComInterface& setUpComLink();
+
+    static bool runTransmit(const char* name,
+                            const std::uint32_t payloadSize,
+                            const bool useSegments);
+};
+
+}; // namespace Plat4m
+
+#endif // PLAT4M_SEGMENT_TRANSMIT_BENCHMARK_H
@@ -0,0 +1,334 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SeqLockBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SeqLockBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+
+#include <pthread.h>
+#include <time.h>
+
+#include <Test/Benchmark_Tests/SeqLockBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/SeqLock.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+// Every field holds the same value so a torn read shows up as a mismatch
+struct BenchmarkData
+{
+    uint32_t values[16];
+};
+
+//------------------------------------------------------------------------------
+class MutexStorage
+{
+public:
+
+    //--------------------------------------------------------------------------
+    MutexStorage() :
+        myMutex(),
+        myData()
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    void write(const BenchmarkData& data)
+    {
+        lock_guard<mutex> lock(myMutex);
+        myData = data;
+    }
+
+    //--------------------------------------------------------------------------
+    uint32_t read(BenchmarkData& data) const
+    {
+        lock_guard<mutex> lock(myMutex);
+        data = myData;
+
+        return data.values[0];
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    mutable mutex myMutex;
+
+    BenchmarkData myData;
+};
+
+//------------------------------------------------------------------------------
+template <typename TStorage>
+struct ThreadState
+{
+    TStorage* storage;
+    atomic<bool>* isRunning;
+    uint64_t nOperations;
+    uint64_t nTornReads;
+};
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t maxReaders = 16;
+
+static const uint64_t runTimeNs = 100000000;
+
+static const long writePeriodNs = 20000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+template <typename TStorage>
+static void* readerThreadCallback(void* arg)
+{
+    ThreadState<TStorage>& state = *(static_cast<ThreadState<TStorage>*>(arg));
+
+    while (state.isRunning->load(memory_order_relaxed))
+    {
+        BenchmarkData data;
+        state.storage->read(data);
+
+        for (uint32_t i = 1; i < arraySize(data.values); i++)
+        {
+            if (data.values[i] != data.values[0])
+            {
+                state.nTornReads++;
+
+                break;
+            }
+        }
+
+        state.nOperations++;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename TStorage>
+static void* writerThreadCallback(void* arg)
+{
+    ThreadState<TStorage>& state = *(static_cast<ThreadState<TStorage>*>(arg));
+
+    struct timespec period;
+    period.tv_sec = 0;
+    period.tv_nsec = writePeriodNs;
+
+    uint32_t value = 0;
+
+    while (state.isRunning->load(memory_order_relaxed))
+    {
+        value++;
+
+        BenchmarkData data;
+
+        for (uint32_t i = 0; i < arraySize(data.values); i++)
+        {
+            data.values[i] = value;
+        }
+
+        state.storage->write(data);
+        state.nOperations++;
+
+        nanosleep(&period, NULL);
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                   SeqLockBenchmark::myTestCallbackFunctions[] =
+{
+    &SeqLockBenchmark::benchmark1Reader,
+    &SeqLockBenchmark::benchmark2Readers,
+    &SeqLockBenchmark::benchmark4Readers,
+    &SeqLockBenchmark::benchmark8Readers,
+    &SeqLockBenchmark::benchmark16Readers
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SeqLockBenchmark::SeqLockBenchmark() :
+    UnitTest("SeqLockBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SeqLockBenchmark::~SeqLockBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark1Reader()
+{
+    return UNIT_TEST_REPORT(benchmark(1));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark2Readers()
+{
+    return UNIT_TEST_REPORT(benchmark(2));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark4Readers()
+{
+    return UNIT_TEST_REPORT(benchmark(4));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark8Readers()
+{
+    return UNIT_TEST_REPORT(benchmark(8));
+}
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark16Readers()
+{
+    return UNIT_TEST_REPORT(benchmark(16));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SeqLockBenchmark::benchmark(const uint32_t nReaders)
+{
+    printBenchmarkHeader("64 B reads (readers + 1 writer)");
+
+    bool passed = runStorage<SeqLock<BenchmarkData>>("SeqLock", nReaders);
+
+    passed &= runStorage<MutexStorage>("std::mutex", nReaders);
+
+    return passed;
+}
+
+//------------------------------------------------------------------------------
+template <typename TStorage>
+bool SeqLockBenchmark::runStorage(const char* name, const uint32_t nReaders)
+{
+    TStorage storage;
+    atomic<bool> isRunning(true);
+
+    ThreadState<TStorage> readerStates[maxReaders];
+    pthread_t readerThreads[maxReaders];
+
+    ThreadState<TStorage> writerState = { &storage, &isRunning, 0, 0 };
+    pthread_t writerThread;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    pthread_create(&writerThread, NULL, &writerThreadCallback<TStorage>,
+                   &writerState);
+
+    for (uint32_t i = 0; i < nReaders; i++)
+    {
+        readerStates[i].storage = &storage;
+        readerStates[i].isRunning = &isRunning;
+        readerStates[i].nOperations = 0;
+        readerStates[i].nTornReads = 0;
+
+        pthread_create(&(readerThreads[i]), NULL,
+                       &readerThreadCallback<TStorage>, &(readerStates[i]));
+    }
+
+    struct timespec runTime;
+    runTime.tv_sec = 0;
+    runTime.tv_nsec = runTimeNs;
+    nanosleep(&runTime, NULL);
+
+    isRunning.store(false, memory_order_relaxed);
+
+    uint64_t nReads = 0;
+    uint64_t nTornReads = 0;
+
+    for (uint32_t i = 0; i < nReaders; i++)
+    {
+        pthread_join(readerThreads[i], NULL);
+
+        nReads += readerStates[i].nOperations;
+        nTornReads += readerStates[i].nTornReads;
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    pthread_join(writerThread, NULL);
+
+    char label[64];
+    snprintf(label, sizeof(label), "%s x%u (%llu writes)",
+             name,
+             nReaders,
+             static_cast<unsigned long long>(writerState.nOperations));
+    printBenchmarkResult(label, nReads, elapsedTimeNs);
+
+    return UNIT_TEST_CASE_EQUAL(nTornReads, (uint64_t) 0);
+}
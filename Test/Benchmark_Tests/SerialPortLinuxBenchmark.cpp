@@ -0,0 +1,443 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SerialPortLinuxBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SerialPortLinuxBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <Test/Benchmark_Tests/SerialPortLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/Linux/SerialPortLinux.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t baudRate = 1000000;
+
+// 8N1, 10 bits on the line per byte
+static const uint32_t bytesPerS = baudRate / 10;
+
+static const uint32_t nChunkBytes = 4096;
+
+static const uint64_t nBulkBytes = 32 * 1024 * 1024;
+
+// 1 ms worth of bytes at 1 Mbaud
+static const uint32_t nPacedChunkBytes = bytesPerS / 1000;
+
+static const uint32_t nPacedChunks = 2000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static atomic<uint64_t> nReceivedBytes(0);
+
+static atomic<uint64_t> nReceivedBlocks(0);
+
+static uint64_t chunkWriteTimesNs[nPacedChunks];
+
+static uint64_t chunkLatenciesNs[nPacedChunks];
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static int openPseudoTerminal(char* slaveName, const size_t nameSize)
+{
+    int masterFileDescriptor = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if ((masterFileDescriptor < 0)                    ||
+        (grantpt(masterFileDescriptor) != 0)          ||
+        (unlockpt(masterFileDescriptor) != 0)         ||
+        (ptsname_r(masterFileDescriptor, slaveName, nameSize) != 0))
+    {
+        if (masterFileDescriptor >= 0)
+        {
+            close(masterFileDescriptor);
+        }
+
+        return -1;
+    }
+
+    return masterFileDescriptor;
+}
+
+//------------------------------------------------------------------------------
+static SerialPort::Config createConfig()
+{
+    SerialPort::Config config;
+    config.baudRate            = baudRate;
+    config.wordBits            = SerialPort::WORD_BITS_8;
+    config.stopBits            = SerialPort::STOP_BITS_1;
+    config.parityBit           = SerialPort::PARITY_BIT_NONE;
+    config.hardwareFlowControl = SerialPort::HARDWARE_FLOW_CONTROL_NONE;
+
+    return config;
+}
+
+//------------------------------------------------------------------------------
+static void printLineRate(const uint64_t nBytes, const uint64_t elapsedTimeNs)
+{
+    const double lineBytesPerS =
+           static_cast<double>(nBytes) / (static_cast<double>(elapsedTimeNs) / 1e9);
+
+    printf("    %-40s %12.1f x\n",
+           "Rate relative to 1 Mbaud 8N1",
+           lineBytesPerS / bytesPerS);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                           SerialPortLinuxBenchmark::myTestCallbackFunctions[] =
+{
+    &SerialPortLinuxBenchmark::benchmarkTransmit,
+    &SerialPortLinuxBenchmark::benchmarkReceiveBlocks,
+    &SerialPortLinuxBenchmark::benchmarkReceiveBytes,
+    &SerialPortLinuxBenchmark::benchmarkPacedReceiveLatency
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxBenchmark::SerialPortLinuxBenchmark() :
+    UnitTest("SerialPortLinuxBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SerialPortLinuxBenchmark::~SerialPortLinuxBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxBenchmark::benchmarkTransmit()
+{
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+    serialPort.enable();
+    serialPort.setConfig(createConfig());
+
+    uint64_t nReadBytes = 0;
+
+    thread readerThread([masterFileDescriptor, &nReadBytes]()
+    {
+        uint8_t bytes[nChunkBytes];
+
+        while (nReadBytes < nBulkBytes)
+        {
+            struct pollfd pollFileDescriptor = {masterFileDescriptor, POLLIN, 0};
+
+            if (poll(&pollFileDescriptor, 1, 1000) <= 0)
+            {
+                break;
+            }
+
+            ssize_t nBytes = read(masterFileDescriptor, bytes, sizeof(bytes));
+
+            if (nBytes <= 0)
+            {
+                break;
+            }
+
+            nReadBytes += nBytes;
+        }
+    });
+
+    static uint8_t chunk[nChunkBytes];
+    ByteArray chunkByteArray(chunk, nChunkBytes, nChunkBytes);
+    uint64_t nTransmittedBytes = 0;
+    uint64_t nBufferFullRetries = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while (nTransmittedBytes < nBulkBytes)
+    {
+        ComInterface::Error error = serialPort.transmitBytes(chunkByteArray);
+
+        if (error.getCode() == ComInterface::ERROR_CODE_TRANSMIT_BUFFER_FULL)
+        {
+            // Transmitting never blocks, back off until the reader catches up
+            nBufferFullRetries++;
+            this_thread::yield();
+
+            continue;
+        }
+
+        if (error.getCode() != ComInterface::ERROR_CODE_NONE)
+        {
+            break;
+        }
+
+        nTransmittedBytes += nChunkBytes;
+    }
+
+    readerThread.join();
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    serialPort.disable();
+    close(masterFileDescriptor);
+
+    printBenchmarkThroughputHeader("Transmit, 4 KB writes");
+    printBenchmarkThroughputResult("Bytes", nReadBytes, elapsedTimeNs);
+    printLineRate(nReadBytes, elapsedTimeNs);
+    printf("    %-40s %12llu\n",
+           "Transmit buffer full retries",
+           static_cast<unsigned long long>(nBufferFullRetries));
+
+    return UNIT_TEST_REPORT((masterFileDescriptor >= 0) &&
+                            (nReadBytes == nBulkBytes));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxBenchmark::benchmarkReceiveBlocks()
+{
+    return UNIT_TEST_REPORT(runReceive("Receive, block per callback", true));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxBenchmark::benchmarkReceiveBytes()
+{
+    return UNIT_TEST_REPORT(runReceive("Receive, byte per callback", false));
+}
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxBenchmark::benchmarkPacedReceiveLatency()
+{
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+    serialPort.setBytesReceivedCallback(
+                                       createCallback(&bytesReceivedCallback));
+    serialPort.enable();
+    serialPort.setConfig(createConfig());
+
+    nReceivedBytes.store(0);
+    nReceivedBlocks.store(0);
+
+    for (uint32_t i = 0; i < nPacedChunks; i++)
+    {
+        chunkLatenciesNs[i] = 0;
+    }
+
+    uint8_t chunk[nPacedChunkBytes] = {};
+    uint64_t nextWriteTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nPacedChunks; i++)
+    {
+        // Paced by wall time, so the bytes arrive at the line rate
+        while (getBenchmarkTimeNs() < nextWriteTimeNs)
+        {
+        }
+
+        chunkWriteTimesNs[i] = getBenchmarkTimeNs();
+
+        if (write(masterFileDescriptor, chunk, sizeof(chunk)) !=
+                                                 static_cast<ssize_t>(sizeof(chunk)))
+        {
+            break;
+        }
+
+        nextWriteTimeNs += 1000000;
+    }
+
+    const uint64_t nBytes = static_cast<uint64_t>(nPacedChunks) * nPacedChunkBytes;
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while ((nReceivedBytes.load() < nBytes) &&
+           ((getBenchmarkTimeNs() - startTimeNs) < 1000000000))
+    {
+        this_thread::yield();
+    }
+
+    serialPort.disable();
+    close(masterFileDescriptor);
+
+    vector<uint64_t> latenciesNs(chunkLatenciesNs,
+                                 chunkLatenciesNs + nPacedChunks);
+    sort(latenciesNs.begin(), latenciesNs.end());
+
+    printBenchmarkLatencyHeader("Receive latency, paced at 1 Mbaud 8N1");
+    printBenchmarkLatencyResult("100 B chunk written to callback",
+                                nPacedChunks,
+                                latenciesNs[(nPacedChunks - 1) / 2],
+                                latenciesNs[((nPacedChunks - 1) * 99) / 100],
+                                latenciesNs[nPacedChunks - 1]);
+    printf("    %-40s %12.1f B\n",
+           "Average block size",
+           static_cast<double>(nReceivedBytes.load()) / nReceivedBlocks.load());
+
+    return UNIT_TEST_REPORT(nReceivedBytes.load() == nBytes);
+}
+
+//------------------------------------------------------------------------------
+void SerialPortLinuxBenchmark::bytesReceivedCallback(const ByteArray& byteArray)
+{
+    const uint64_t firstByte = nReceivedBytes.load(memory_order_relaxed);
+    const uint64_t endByte = firstByte + byteArray.getSize();
+
+    // Chunks whose last byte arrived in this block
+    const uint64_t timeNs = getBenchmarkTimeNs();
+
+    for (uint64_t chunk = (firstByte / nPacedChunkBytes);
+         ((chunk + 1) * nPacedChunkBytes <= endByte) && (chunk < nPacedChunks);
+         chunk++)
+    {
+        if (((chunk + 1) * nPacedChunkBytes) > firstByte)
+        {
+            chunkLatenciesNs[chunk] = timeNs - chunkWriteTimesNs[chunk];
+        }
+    }
+
+    nReceivedBlocks.fetch_add(1, memory_order_relaxed);
+    nReceivedBytes.store(endByte, memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+void SerialPortLinuxBenchmark::byteReceivedCallback(const uint8_t byte)
+{
+    nReceivedBlocks.fetch_add(1, memory_order_relaxed);
+    nReceivedBytes.fetch_add(1, memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SerialPortLinuxBenchmark::runReceive(const char* name,
+                                          const bool isBlockCallback)
+{
+    char slaveName[64];
+    int masterFileDescriptor = openPseudoTerminal(slaveName, sizeof(slaveName));
+
+    SerialPortLinux serialPort(slaveName);
+
+    if (isBlockCallback)
+    {
+        serialPort.setBytesReceivedCallback(
+                                       createCallback(&bytesReceivedCallback));
+    }
+    else
+    {
+        serialPort.setByteReceivedCallback(
+                                        createCallback(&byteReceivedCallback));
+    }
+
+    serialPort.enable();
+    serialPort.setConfig(createConfig());
+
+    nReceivedBytes.store(0);
+    nReceivedBlocks.store(0);
+
+    static uint8_t chunk[nChunkBytes];
+    uint64_t nWrittenBytes = 0;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while (nWrittenBytes < nBulkBytes)
+    {
+        // The master blocks while the port's input queue is full
+        ssize_t nBytes = write(masterFileDescriptor, chunk, sizeof(chunk));
+
+        if (nBytes <= 0)
+        {
+            break;
+        }
+
+        nWrittenBytes += nBytes;
+    }
+
+    while ((nReceivedBytes.load(memory_order_acquire) < nWrittenBytes) &&
+           ((getBenchmarkTimeNs() - startTimeNs) < 10000000000ULL))
+    {
+        this_thread::yield();
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    serialPort.disable();
+    close(masterFileDescriptor);
+
+    printBenchmarkThroughputHeader(name);
+    printBenchmarkThroughputResult("Bytes", nReceivedBytes.load(), elapsedTimeNs);
+    printLineRate(nReceivedBytes.load(), elapsedTimeNs);
+    printf("    %-40s %12llu\n",
+           "Callbacks",
+           static_cast<unsigned long long>(nReceivedBlocks.load()));
+
+    return ((masterFileDescriptor >= 0) &&
+            (nReceivedBytes.load() == nBulkBytes));
+}
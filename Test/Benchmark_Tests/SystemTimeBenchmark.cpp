@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file SystemTimeBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief SystemTimeBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+#include <Test/Benchmark_Tests/SystemTimeBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/TimeStamp.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nCalls = 2000000;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void printTimePerCall(const char* name, const uint64_t elapsedTimeNs)
+{
+    printf("    %-40s %12.1f\n",
+           name,
+           static_cast<double>(elapsedTimeNs) / nCalls);
+}
+
+//------------------------------------------------------------------------------
+static uint64_t measureClock(const clockid_t clockId)
+{
+    struct timespec timeSpec;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nCalls; i++)
+    {
+        clock_gettime(clockId, &timeSpec);
+    }
+
+    return (getBenchmarkTimeNs() - startTimeNs);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                SystemTimeBenchmark::myTestCallbackFunctions[] =
+{
+    &SystemTimeBenchmark::benchmarkSystemTime,
+    &SystemTimeBenchmark::benchmarkClocks
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SystemTimeBenchmark::SystemTimeBenchmark() :
+    UnitTest("SystemTimeBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+SystemTimeBenchmark::~SystemTimeBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool SystemTimeBenchmark::benchmarkSystemTime()
+{
+    printf("\n    %-40s %12s\n", "System time (ns/call)", "ns");
+
+    TimeStamp previousTimeStamp = System::getTimeStamp();
+
+    bool isMonotonic = true;
+    bool isInRange = true;
+
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nCalls; i++)
+    {
+        TimeStamp timeStamp = System::getTimeStamp();
+
+        isMonotonic &= (timeStamp >= previousTimeStamp);
+        isInRange &= (timeStamp.timeNs >= 0);
+
+        previousTimeStamp = timeStamp;
+    }
+
+    printTimePerCall("System::getTimeStamp() (+ checks)",
+                     getBenchmarkTimeNs() - startTimeNs);
+
+    startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nCalls; i++)
+    {
+        System::getTimeUs();
+    }
+
+    printTimePerCall("System::getTimeUs()",
+                     getBenchmarkTimeNs() - startTimeNs);
+
+    startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nCalls; i++)
+    {
+        System::getWallTimeStamp();
+    }
+
+    printTimePerCall("System::getWallTimeStamp()",
+                     getBenchmarkTimeNs() - startTimeNs);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isMonotonic, true) &
+                            UNIT_TEST_CASE_EQUAL(isInRange, true));
+}
+
+//------------------------------------------------------------------------------
+bool SystemTimeBenchmark::benchmarkClocks()
+{
+    printf("\n    %-40s %12s\n", "clock_gettime() (ns/call)", "ns");
+
+    printTimePerCall("CLOCK_REALTIME", measureClock(CLOCK_REALTIME));
+    printTimePerCall("CLOCK_MONOTONIC", measureClock(CLOCK_MONOTONIC));
+    printTimePerCall("CLOCK_MONOTONIC_RAW",
+                     measureClock(CLOCK_MONOTONIC_RAW));
+
+    return UNIT_TEST_REPORT(true);
+}
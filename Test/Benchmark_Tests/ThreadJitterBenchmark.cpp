@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file ThreadJitterBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief ThreadJitterBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+
+#include <sched.h>
+
+#include <Test/Benchmark_Tests/ThreadJitterBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/CallbackMethod.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Linux/ThreadLinux.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nSamplesPerThread = 2000;
+
+static const uint32_t nThreads = 3;
+
+static const TimeUs threadPeriodsUs[nThreads] = {1000, 500, 250};
+
+static const uint32_t realTimePriority = 50;
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                              ThreadJitterBenchmark::myTestCallbackFunctions[] =
+{
+    &ThreadJitterBenchmark::benchmarkNormalPriority,
+    &ThreadJitterBenchmark::benchmarkRealTimePriority
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ThreadJitterBenchmark::ThreadJitterBenchmark() :
+    UnitTest("ThreadJitterBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ThreadJitterBenchmark::~ThreadJitterBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ThreadJitterBenchmark::benchmarkNormalPriority()
+{
+    return UNIT_TEST_REPORT(benchmark(0));
+}
+
+//------------------------------------------------------------------------------
+bool ThreadJitterBenchmark::benchmarkRealTimePriority()
+{
+    return UNIT_TEST_REPORT(benchmark(realTimePriority));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool ThreadJitterBenchmark::benchmark(const uint32_t priority)
+{
+    Sampler samplers[nThreads];
+    ThreadLinux* threads[nThreads];
+
+    uint32_t appliedPriority = priority;
+
+    for (uint32_t i = 0; i < nThreads; i++)
+    {
+        threads[i] = new ThreadLinux(
+                         createCallback(&(samplers[i]), &Sampler::runCallback));
+        samplers[i].setThread(*(threads[i]));
+        threads[i]->setPeriodUs(threadPeriodsUs[i]);
+        threads[i]->setPriority(priority);
+
+        appliedPriority = min(appliedPriority, threads[i]->getPriority());
+    }
+
+    if (appliedPriority == 0)
+    {
+        printBenchmarkLatencyHeader("Thread wake-up error (SCHED_OTHER)");
+    }
+    else
+    {
+        printBenchmarkLatencyHeader("Thread wake-up error (SCHED_FIFO)");
+    }
+
+    if ((priority != 0) && (appliedPriority == 0))
+    {
+        printf("    (not permitted to use SCHED_FIFO, running on "
+               "SCHED_OTHER)\n");
+    }
+
+    for (uint32_t i = 0; i < nThreads; i++)
+    {
+        threads[i]->enable();
+    }
+
+    bool isDone = false;
+
+    TimeMs timeoutTimeMs = System::getTimeMs() + 10000;
+
+    while (!isDone && (System::getTimeMs() < timeoutTimeMs))
+    {
+        System::delayTimeMs(10);
+
+        isDone = true;
+
+        for (uint32_t i = 0; i < nThreads; i++)
+        {
+            isDone &= samplers[i].isDone();
+        }
+    }
+
+    bool isValid = true;
+
+    for (uint32_t i = 0; i < nThreads; i++)
+    {
+        threads[i]->disable();
+
+        const uint32_t nSamples = samplers[i].getNSamples();
+
+        isValid &= (nSamples == nSamplesPerThread);
+
+        uint64_t* samplesNs = samplers[i].getSamples();
+        sort(samplesNs, samplesNs + nSamples);
+
+        char label[64];
+        snprintf(label,
+                 sizeof(label),
+                 "%u us period (%u overruns)",
+                 threadPeriodsUs[i],
+                 threads[i]->getNOverruns());
+
+        if (nSamples != 0)
+        {
+            printBenchmarkLatencyResult(label,
+                                        nSamples,
+                                        samplesNs[nSamples / 2],
+                                        samplesNs[(nSamples * 99) / 100],
+                                        samplesNs[nSamples - 1]);
+        }
+
+        delete threads[i];
+    }
+
+    return isValid;
+}
+
+//------------------------------------------------------------------------------
+// Sampler public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ThreadJitterBenchmark::Sampler::Sampler() :
+    myThread(0),
+    mySamplesNs(new uint64_t[nSamplesPerThread]),
+    myNSamples(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Sampler public destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+ThreadJitterBenchmark::Sampler::~Sampler()
+{
+    delete[] mySamplesNs;
+}
+
+//------------------------------------------------------------------------------
+// Sampler public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void ThreadJitterBenchmark::Sampler::setThread(ThreadLinux& thread)
+{
+    myThread = &thread;
+}
+
+//------------------------------------------------------------------------------
+void ThreadJitterBenchmark::Sampler::runCallback()
+{
+    const uint64_t timeNs = getBenchmarkTimeNs();
+
+    const uint32_t nSamples = myNSamples.load(memory_order_relaxed);
+
+    if (nSamples < nSamplesPerThread)
+    {
+        // Scheduled time is on the same CLOCK_MONOTONIC timeline
+        mySamplesNs[nSamples] = timeNs - myThread->getScheduledTimeNs();
+        myNSamples.store(nSamples + 1, memory_order_release);
+    }
+}
+
+//------------------------------------------------------------------------------
+bool ThreadJitterBenchmark::Sampler::isDone() const
+{
+    return (myNSamples.load(memory_order_acquire) >= nSamplesPerThread);
+}
+
+//------------------------------------------------------------------------------
+uint32_t ThreadJitterBenchmark::Sampler::getNSamples() const
+{
+    return (myNSamples.load(memory_order_acquire));
+}
+
+//------------------------------------------------------------------------------
+uint64_t* ThreadJitterBenchmark::Sampler::getSamples()
+{
+    return mySamplesNs;
+}
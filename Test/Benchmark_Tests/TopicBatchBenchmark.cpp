@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicBatchBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicBatchBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/TopicBatchBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t batchSize = 256;
+
+static const uint32_t nBatches = 2000;
+
+static const uint32_t nRuns = 5;
+
+static const TopicBase::Id topicId = 1;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void printSamplesPerSecond(const char* name,
+                                  const uint64_t elapsedTimeNs)
+{
+    const double nSamples = static_cast<double>(batchSize) * nBatches;
+
+    printf("    %-40s %12.0f %8.1f\n",
+           name,
+           nSamples * 1e9 / static_cast<double>(elapsedTimeNs),
+           static_cast<double>(elapsedTimeNs) / nSamples);
+}
+
+//------------------------------------------------------------------------------
+static uint64_t publishSamples(Topic<uint32_t>& topic,
+                               const uint32_t* samples,
+                               const bool isBatch)
+{
+    uint64_t minElapsedTimeNs = UINT64_MAX;
+
+    for (uint32_t run = 0; run < nRuns; run++)
+    {
+        uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        for (uint32_t i = 0; i < nBatches; i++)
+        {
+            if (isBatch)
+            {
+                topic.publishBatch(samples, batchSize);
+            }
+            else
+            {
+                for (uint32_t j = 0; j < batchSize; j++)
+                {
+                    topic.publish(samples[j]);
+                }
+            }
+        }
+
+        uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+        if (elapsedTimeNs < minElapsedTimeNs)
+        {
+            minElapsedTimeNs = elapsedTimeNs;
+        }
+    }
+
+    return minElapsedTimeNs;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                                TopicBatchBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicBatchBenchmark::benchmarkBatchSubscriber,
+    &TopicBatchBenchmark::benchmarkSampleSubscriber
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBatchBenchmark::TopicBatchBenchmark() :
+    UnitTest("TopicBatchBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBatchBenchmark::~TopicBatchBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicBatchBenchmark::benchmarkBatchSubscriber()
+{
+    return UNIT_TEST_REPORT(benchmark(true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicBatchBenchmark::benchmarkSampleSubscriber()
+{
+    return UNIT_TEST_REPORT(benchmark(false));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicBatchBenchmark::benchmark(const bool isBatchSubscriber)
+{
+    printf("\n    %-40s %12s %8s\n",
+           isBatchSubscriber ? "Topic batch subscriber (samples/s)" :
+                               "Topic sample subscriber (samples/s)",
+           "samples/s",
+           "ns");
+
+    TopicManager topicManager;
+
+    Topic<uint32_t>& topic = Topic<uint32_t>::create(topicId);
+
+    Receiver receiver;
+
+    if (isBatchSubscriber)
+    {
+        topic.subscribe(createCallback(&receiver,
+                                       &Receiver::sampleBatchCallback));
+    }
+    else
+    {
+        topic.subscribe(createCallback(&receiver, &Receiver::sampleCallback));
+    }
+
+    uint32_t samples[batchSize];
+
+    for (uint32_t i = 0; i < batchSize; i++)
+    {
+        samples[i] = i;
+    }
+
+    printSamplesPerSecond("publish() x1",
+                          publishSamples(topic, samples, false));
+
+    char label[64];
+    snprintf(label, sizeof(label), "publishBatch() x%u", batchSize);
+    printSamplesPerSecond(label, publishSamples(topic, samples, true));
+
+    // The receiver saw every sample of every batch, both ways
+    const uint64_t nSamples = 2ULL * nRuns * nBatches * batchSize;
+    const uint64_t expectedSum = 2ULL * nRuns * nBatches *
+                                 ((batchSize * (batchSize - 1)) / 2);
+
+    return (UNIT_TEST_CASE_EQUAL(receiver.getNSamples(), nSamples) &
+            UNIT_TEST_CASE_EQUAL(receiver.getSum(), expectedSum));
+}
+
+//------------------------------------------------------------------------------
+// Receiver public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBatchBenchmark::Receiver::Receiver() :
+    mySum(0),
+    myNSamples(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Receiver public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicBatchBenchmark::Receiver::sampleCallback(
+                                       const TopicSample<uint32_t>& sample)
+{
+    mySum += sample.data;
+    myNSamples++;
+}
+
+//------------------------------------------------------------------------------
+void TopicBatchBenchmark::Receiver::sampleBatchCallback(
+                                const TopicSampleBatch<uint32_t>& sampleBatch)
+{
+    for (uint32_t i = 0; i < sampleBatch.nSamples; i++)
+    {
+        mySum += sampleBatch.data[i];
+    }
+
+    myNSamples += sampleBatch.nSamples;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicBatchBenchmark::Receiver::getSum() const
+{
+    return mySum;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicBatchBenchmark::Receiver::getNSamples() const
+{
+    return myNSamples;
+}
@@ -0,0 +1,525 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicBridgeShmLinuxBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicBridgeShmLinuxBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include <poll.h>
+#include <signal.h>
+#include <pty.h>
+#include <sched.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <Test/Benchmark_Tests/TopicBridgeShmLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/ByteArrayN.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Linux/TopicBridgeShmLinux.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+struct BenchmarkSample
+{
+    uint64_t sendTimeNs;
+    uint32_t index;
+    uint8_t payload[52];
+};
+
+static_assert(sizeof(BenchmarkSample) == 64, "Benchmark sample is 64 bytes");
+
+///
+/// @brief Anonymous shared mapping inherited by the forked receiver, which
+/// reports its progress and results through it.
+///
+struct SharedState
+{
+    atomic<uint32_t> isReady;
+    atomic<uint32_t> nReceived;
+    atomic<uint32_t> nOutOfOrder;
+    atomic<uint64_t> lastReceiveTimeNs;
+    uint64_t p50LatencyNs;
+    uint64_t p99LatencyNs;
+    uint64_t maxLatencyNs;
+    atomic<uint32_t> isDone;
+};
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const TopicBase::Id exportTopicId = 1;
+
+static const TopicBase::Id importTopicId = 2;
+
+static const char ringName[] = "/plat4m_topic_bridge_shm_linux_benchmark";
+
+static const uint32_t nPacedSamples = 1000;
+
+static const uint32_t pacedPeriodUs = 200;
+
+static const uint32_t nStreamingSamples = 20000;
+
+// Below the ring size, so the importing bridge is never overrun
+static const uint32_t nMaxInFlightSamples = 128;
+
+static const uint64_t timeoutNs = 10000000000ULL;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static SharedState* sharedState = 0;
+
+// Only written by the receiving process
+static uint64_t latenciesNs[nStreamingSamples];
+
+static int ptyMasterFd = -1;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void resetSharedState()
+{
+    // Never unmapped, shared by every run
+    if (isNullPointer(sharedState))
+    {
+        void* memory = mmap(0,
+                            sizeof(SharedState),
+                            PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_ANONYMOUS,
+                            -1,
+                            0);
+
+        sharedState = static_cast<SharedState*>(memory);
+    }
+
+    new(sharedState) SharedState();
+}
+
+//------------------------------------------------------------------------------
+static bool isTimedOut(const uint64_t startTimeNs)
+{
+    return ((getBenchmarkTimeNs() - startTimeNs) > timeoutNs);
+}
+
+//------------------------------------------------------------------------------
+static void receiverSampleCallback(const TopicSample<BenchmarkSample>& sample)
+{
+    const uint64_t timeNs = getBenchmarkTimeNs();
+    const uint32_t nReceived = sharedState->nReceived.load();
+
+    if (sample.data.index != nReceived)
+    {
+        sharedState->nOutOfOrder.fetch_add(1);
+    }
+
+    if (nReceived < nStreamingSamples)
+    {
+        latenciesNs[nReceived] = timeNs - sample.data.sendTimeNs;
+    }
+
+    sharedState->lastReceiveTimeNs.store(timeNs);
+    sharedState->nReceived.store(nReceived + 1);
+}
+
+///
+/// @brief Waits for all samples in the receiving process, then reports the
+/// latencies and exits it.
+///
+static void finishReceiver(const uint32_t nSamples)
+{
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while ((sharedState->nReceived.load() < nSamples) &&
+           !isTimedOut(startTimeNs))
+    {
+        System::delayTimeMs(1);
+    }
+
+    const uint32_t nLatencies = min(sharedState->nReceived.load(), nSamples);
+
+    if (nLatencies > 0)
+    {
+        sort(latenciesNs, latenciesNs + nLatencies);
+
+        sharedState->p50LatencyNs = latenciesNs[(nLatencies - 1) / 2];
+        sharedState->p99LatencyNs = latenciesNs[((nLatencies - 1) * 99) / 100];
+        sharedState->maxLatencyNs = latenciesNs[nLatencies - 1];
+    }
+
+    sharedState->isDone.store(1);
+
+    // Skip destructors, the parent still owns everything inherited
+    _exit(0);
+}
+
+//------------------------------------------------------------------------------
+static void runSharedMemoryReceiver(const uint32_t nSamples)
+{
+    typedef TopicBridgeShmLinux<BenchmarkSample> Bridge;
+
+    Topic<BenchmarkSample>::subscribe(importTopicId,
+                                      createCallback(&receiverSampleCallback));
+
+    Bridge bridge(importTopicId, ringName, Bridge::DIRECTION_IMPORT);
+    bridge.enable();
+
+    while (!(bridge.isConnected()))
+    {
+        System::delayTimeMs(1);
+    }
+
+    sharedState->isReady.store(1);
+
+    finishReceiver(nSamples);
+}
+
+//------------------------------------------------------------------------------
+static void runPtyReceiver(const int fd, const uint32_t nSamples)
+{
+    Topic<BenchmarkSample>& topic =
+                                 Topic<BenchmarkSample>::create(importTopicId);
+
+    topic.subscribe(createCallback(&receiverSampleCallback));
+
+    sharedState->isReady.store(1);
+
+    uint8_t bytes[4096];
+    uint32_t nBytes = 0;
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while ((sharedState->nReceived.load() < nSamples) &&
+           !isTimedOut(startTimeNs))
+    {
+        struct pollfd pollFd = {fd, POLLIN, 0};
+
+        if (poll(&pollFd, 1, 100) <= 0)
+        {
+            continue;
+        }
+
+        const ssize_t nReadBytes = read(fd,
+                                        &(bytes[nBytes]),
+                                        sizeof(bytes) - nBytes);
+
+        if (nReadBytes <= 0)
+        {
+            break;
+        }
+
+        nBytes += nReadBytes;
+
+        // Deserialize every complete sample and republish it locally
+        uint32_t offset = 0;
+
+        while ((nBytes - offset) >= sizeof(BenchmarkSample))
+        {
+            BenchmarkSample sample;
+            memcpy(&sample, &(bytes[offset]), sizeof(sample));
+            topic.publish(sample);
+
+            offset += sizeof(BenchmarkSample);
+        }
+
+        memmove(bytes, &(bytes[offset]), nBytes - offset);
+        nBytes -= offset;
+    }
+
+    finishReceiver(nSamples);
+}
+
+//------------------------------------------------------------------------------
+static void serializingSampleCallback(
+                                     const TopicSample<BenchmarkSample>& sample)
+{
+    // The same steps as TopicSubscriberExternal::sampleCallbackInternal()
+    BenchmarkSample copy = sample.data;
+
+    ByteArrayN<256> bytes;
+    bytes.append((uint8_t*) &copy, sizeof(copy));
+
+    const uint8_t* data = bytes.getItems();
+    uint32_t nBytes = bytes.getSize();
+
+    while (nBytes > 0)
+    {
+        const ssize_t nWrittenBytes = write(ptyMasterFd, data, nBytes);
+
+        if (nWrittenBytes <= 0)
+        {
+            return;
+        }
+
+        data += nWrittenBytes;
+        nBytes -= nWrittenBytes;
+    }
+}
+
+///
+/// @brief Publishes samples to the forked receiver and prints its results.
+///
+static bool publishSamples(const char* name,
+                           Topic<BenchmarkSample>& topic,
+                           const pid_t pid,
+                           const uint32_t nSamples,
+                           const bool isPaced)
+{
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    while (sharedState->isReady.load() == 0)
+    {
+        if (isTimedOut(startTimeNs))
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, 0, 0);
+
+            return false;
+        }
+
+        System::delayTimeMs(1);
+    }
+
+    BenchmarkSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        if (isPaced)
+        {
+            usleep(pacedPeriodUs);
+        }
+        else
+        {
+            while ((i - sharedState->nReceived.load()) >= nMaxInFlightSamples)
+            {
+                sched_yield();
+            }
+        }
+
+        sample.index = i;
+        sample.sendTimeNs = getBenchmarkTimeNs();
+
+        topic.publish(sample);
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+
+    const uint32_t nReceived = sharedState->nReceived.load();
+    const uint64_t elapsedTimeNs =
+                            sharedState->lastReceiveTimeNs.load() - startTimeNs;
+
+    printf("    %-40s %12.0f %10.1f %10.1f %10.1f\n",
+           name,
+           static_cast<double>(nReceived) * 1e9 /
+                                        static_cast<double>(elapsedTimeNs),
+           static_cast<double>(sharedState->p50LatencyNs) / 1000.0,
+           static_cast<double>(sharedState->p99LatencyNs) / 1000.0,
+           static_cast<double>(sharedState->maxLatencyNs) / 1000.0);
+
+    return (WIFEXITED(status)                        &&
+            (sharedState->isDone.load() == 1)        &&
+            (nReceived == nSamples)                  &&
+            (sharedState->nOutOfOrder.load() == 0));
+}
+
+//------------------------------------------------------------------------------
+static void printHeader(const char* name)
+{
+    printf("\n    %-40s %12s %10s %10s %10s\n",
+           name,
+           "samples/s",
+           "p50 (us)",
+           "p99 (us)",
+           "max (us)");
+}
+
+//------------------------------------------------------------------------------
+static bool runSharedMemory(const char* name,
+                            const uint32_t nSamples,
+                            const bool isPaced)
+{
+    typedef TopicBridgeShmLinux<BenchmarkSample> Bridge;
+
+    TopicManager topicManager;
+
+    Topic<BenchmarkSample>& topic =
+                                 Topic<BenchmarkSample>::create(exportTopicId);
+
+    Bridge bridge(exportTopicId, ringName, Bridge::DIRECTION_EXPORT);
+    bridge.enable();
+
+    resetSharedState();
+
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        runSharedMemoryReceiver(nSamples);
+    }
+
+    return publishSamples(name, topic, pid, nSamples, isPaced);
+}
+
+//------------------------------------------------------------------------------
+static bool runSerializedPty(const char* name,
+                             const uint32_t nSamples,
+                             const bool isPaced)
+{
+    struct termios rawTermios;
+    memset(&rawTermios, 0, sizeof(rawTermios));
+    cfmakeraw(&rawTermios);
+
+    int slaveFd = -1;
+
+    if (openpty(&ptyMasterFd, &slaveFd, 0, &rawTermios, 0) != 0)
+    {
+        return false;
+    }
+
+    TopicManager topicManager;
+
+    Topic<BenchmarkSample>& topic =
+                                 Topic<BenchmarkSample>::create(exportTopicId);
+
+    topic.subscribe(createCallback(&serializingSampleCallback));
+
+    resetSharedState();
+
+    const pid_t pid = fork();
+
+    if (pid == 0)
+    {
+        close(ptyMasterFd);
+        runPtyReceiver(slaveFd, nSamples);
+    }
+
+    close(slaveFd);
+
+    const bool isDelivered =
+                            publishSamples(name, topic, pid, nSamples, isPaced);
+
+    close(ptyMasterFd);
+    ptyMasterFd = -1;
+
+    return isDelivered;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                       TopicBridgeShmLinuxBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicBridgeShmLinuxBenchmark::benchmarkSharedMemory,
+    &TopicBridgeShmLinuxBenchmark::benchmarkSerializedPty
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBridgeShmLinuxBenchmark::TopicBridgeShmLinuxBenchmark() :
+    UnitTest("TopicBridgeShmLinuxBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicBridgeShmLinuxBenchmark::~TopicBridgeShmLinuxBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicBridgeShmLinuxBenchmark::benchmarkSharedMemory()
+{
+    printHeader("TopicBridgeShmLinux, 64 B samples");
+
+    bool isDelivered = runSharedMemory("paced", nPacedSamples, true);
+    isDelivered &= runSharedMemory("streaming", nStreamingSamples, false);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isDelivered, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicBridgeShmLinuxBenchmark::benchmarkSerializedPty()
+{
+    printHeader("Serialized over pty, 64 B samples");
+
+    bool isDelivered = runSerializedPty("paced", nPacedSamples, true);
+    isDelivered &= runSerializedPty("streaming", nStreamingSamples, false);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isDelivered, true));
+}
@@ -0,0 +1,314 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicDescriptorBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicDescriptorBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/TopicDescriptorBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/TopicDescriptor.h>
+#include <Plat4m_Core/Service.h>
+#include <Plat4m_Core/ServiceManager.h>
+#include <Plat4m_Core/ServiceDescriptor.h>
+#include <Plat4m_Core/CallbackFunction.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+typedef TopicDescriptor<1, uint32_t> BenchmarkTopic;
+
+typedef ServiceDescriptor<1, uint32_t, uint32_t> BenchmarkService;
+
+//------------------------------------------------------------------------------
+// Descriptors
+//------------------------------------------------------------------------------
+
+PLAT4M_TOPIC_DESCRIPTOR_DEFINE(BenchmarkTopic);
+
+PLAT4M_SERVICE_DESCRIPTOR_DEFINE(BenchmarkService);
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nOperations = 1000000;
+
+static const uint32_t nRuns = 5;
+
+// Registered alongside the benchmarked one so lookups by Id have company
+static const uint32_t nOtherIds = 32;
+
+static const uint32_t firstOtherId = 100;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static Topic<uint32_t>* heldTopic = 0;
+
+static Service<uint32_t, uint32_t>* heldService = 0;
+
+static uint32_t nErrors = 0;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+template <void (*operation)(const uint32_t)>
+static uint64_t run()
+{
+    uint64_t minElapsedTimeNs = UINT64_MAX;
+
+    for (uint32_t run = 0; run < nRuns; run++)
+    {
+        uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        for (uint32_t i = 0; i < nOperations; i++)
+        {
+            operation(i);
+        }
+
+        uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+        if (elapsedTimeNs < minElapsedTimeNs)
+        {
+            minElapsedTimeNs = elapsedTimeNs;
+        }
+    }
+
+    return minElapsedTimeNs;
+}
+
+//------------------------------------------------------------------------------
+static void publishById(const uint32_t i)
+{
+    Topic<uint32_t>::create(BenchmarkTopic::id).publish(i);
+}
+
+//------------------------------------------------------------------------------
+static void publishByDescriptor(const uint32_t i)
+{
+    BenchmarkTopic::publish(i);
+}
+
+//------------------------------------------------------------------------------
+static void publishByHeldTopic(const uint32_t i)
+{
+    heldTopic->publish(i);
+}
+
+//------------------------------------------------------------------------------
+static void checkResponse(ServiceBase::Error error,
+                          const uint32_t request,
+                          const uint32_t response)
+{
+    if ((error.getCode() != ServiceBase::ERROR_CODE_NONE) ||
+        (response != (request + 1)))
+    {
+        nErrors++;
+    }
+}
+
+//------------------------------------------------------------------------------
+static void requestById(const uint32_t i)
+{
+    uint32_t response = 0;
+
+    ServiceBase::Error error = Service<uint32_t, uint32_t>::request(
+                                                           BenchmarkService::id,
+                                                           i,
+                                                           response);
+    checkResponse(error, i, response);
+}
+
+//------------------------------------------------------------------------------
+static void requestByDescriptor(const uint32_t i)
+{
+    uint32_t response = 0;
+
+    ServiceBase::Error error = BenchmarkService::request(i, response);
+    checkResponse(error, i, response);
+}
+
+//------------------------------------------------------------------------------
+static void requestByHeldService(const uint32_t i)
+{
+    uint32_t response = 0;
+
+    ServiceBase::Error error = heldService->request(i, response);
+    checkResponse(error, i, response);
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                           TopicDescriptorBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicDescriptorBenchmark::benchmarkTopicPublish,
+    &TopicDescriptorBenchmark::benchmarkServiceRequest
+};
+
+uint64_t TopicDescriptorBenchmark::mySampleSum = 0;
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicDescriptorBenchmark::TopicDescriptorBenchmark() :
+    UnitTest("TopicDescriptorBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicDescriptorBenchmark::~TopicDescriptorBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicDescriptorBenchmark::benchmarkTopicPublish()
+{
+    printBenchmarkHeader("Topic<uint32_t>::publish");
+
+    TopicManager topicManager;
+
+    for (uint32_t i = 0; i < nOtherIds; i++)
+    {
+        Topic<uint32_t>::create(firstOtherId + i);
+    }
+
+    BenchmarkTopic::subscribe(createCallback(&sampleCallback));
+
+    heldTopic = &(BenchmarkTopic::get());
+
+    mySampleSum = 0;
+
+    printBenchmarkResult("Lookup by Id",
+                         nOperations,
+                         run<&publishById>());
+    printBenchmarkResult("TopicDescriptor",
+                         nOperations,
+                         run<&publishByDescriptor>());
+    printBenchmarkResult("Held reference",
+                         nOperations,
+                         run<&publishByHeldTopic>());
+
+    // Every sample reached the subscriber (3 x nRuns passes of 0..n-1)
+    const uint64_t n = nOperations;
+    const uint64_t expectedSum = 3 * nRuns * ((n * (n - 1)) / 2);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(mySampleSum, expectedSum));
+}
+
+//------------------------------------------------------------------------------
+bool TopicDescriptorBenchmark::benchmarkServiceRequest()
+{
+    printBenchmarkHeader("Service<uint32_t, uint32_t>::request");
+
+    ServiceManager serviceManager;
+
+    for (uint32_t i = 0; i < nOtherIds; i++)
+    {
+        createService(firstOtherId + i, &serviceCallback);
+    }
+
+    heldService = &(BenchmarkService::create(
+                                           createCallback(&serviceCallback)));
+
+    nErrors = 0;
+
+    printBenchmarkResult("Lookup by Id",
+                         nOperations,
+                         run<&requestById>());
+    printBenchmarkResult("ServiceDescriptor",
+                         nOperations,
+                         run<&requestByDescriptor>());
+    printBenchmarkResult("Held reference",
+                         nOperations,
+                         run<&requestByHeldService>());
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(nErrors, (uint32_t) 0));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicDescriptorBenchmark::sampleCallback(
+                                            const TopicSample<uint32_t>& sample)
+{
+    mySampleSum += sample.data;
+}
+
+//------------------------------------------------------------------------------
+ServiceBase::Error TopicDescriptorBenchmark::serviceCallback(
+                                        const ServiceRequest<uint32_t>& request,
+                                        ServiceResponse<uint32_t>& response)
+{
+    response.data = request.data + 1;
+
+    return ServiceBase::Error(ServiceBase::ERROR_CODE_NONE);
+}
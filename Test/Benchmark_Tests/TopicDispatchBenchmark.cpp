@@ -0,0 +1,294 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicDispatchBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicDispatchBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+
+#include <Test/Benchmark_Tests/TopicDispatchBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/List.h>
+#include <Plat4m_Core/ArrayList.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+typedef Topic<uint32_t>::SampleCallback SampleCallback;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nPublishes = 100000;
+
+static const uint32_t nRuns = 5;
+
+static const uint32_t maxSubscribers = 64;
+
+static const TopicBase::Id topicId = 1;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static void printTimePerPublish(const char* name,
+                                const uint64_t elapsedTimeNs)
+{
+    printf("    %-40s %12.1f\n",
+           name,
+           static_cast<double>(elapsedTimeNs) / nPublishes);
+}
+
+//------------------------------------------------------------------------------
+template <typename TList>
+static uint64_t dispatch(TList& list)
+{
+    uint32_t value = 0;
+    TopicSample<uint32_t> sample(value);
+
+    uint64_t minElapsedTimeNs = UINT64_MAX;
+
+    for (uint32_t run = 0; run < nRuns; run++)
+    {
+        uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        for (uint32_t i = 0; i < nPublishes; i++)
+        {
+            value = i;
+
+            typename TList::Iterator iterator = list.iterator();
+
+            while (iterator.hasCurrent())
+            {
+                iterator.current()->call(sample);
+
+                iterator.next();
+            }
+        }
+
+        uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+        if (elapsedTimeNs < minElapsedTimeNs)
+        {
+            minElapsedTimeNs = elapsedTimeNs;
+        }
+    }
+
+    return minElapsedTimeNs;
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                             TopicDispatchBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicDispatchBenchmark::benchmark1Subscriber,
+    &TopicDispatchBenchmark::benchmark8Subscribers,
+    &TopicDispatchBenchmark::benchmark64Subscribers
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicDispatchBenchmark::TopicDispatchBenchmark() :
+    UnitTest("TopicDispatchBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicDispatchBenchmark::~TopicDispatchBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicDispatchBenchmark::benchmark1Subscriber()
+{
+    return UNIT_TEST_REPORT(benchmark(1));
+}
+
+//------------------------------------------------------------------------------
+bool TopicDispatchBenchmark::benchmark8Subscribers()
+{
+    return UNIT_TEST_REPORT(benchmark(8));
+}
+
+//------------------------------------------------------------------------------
+bool TopicDispatchBenchmark::benchmark64Subscribers()
+{
+    return UNIT_TEST_REPORT(benchmark(64));
+}
+
+//------------------------------------------------------------------------------
+// Private static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicDispatchBenchmark::benchmark(const uint32_t nSubscribers)
+{
+    char label[64];
+    snprintf(label, sizeof(label), "Topic dispatch x%u (ns/publish)",
+             nSubscribers);
+    printf("\n    %-40s %12s\n", label, "ns");
+
+    TopicManager topicManager;
+
+    Topic<uint32_t>& topic = Topic<uint32_t>::create(topicId);
+
+    Receiver receivers[maxSubscribers];
+
+    List<SampleCallback*> list;
+    ArrayList<SampleCallback*, 8> arrayList;
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        SampleCallback* sampleCallback =
+                  &createCallback(&(receivers[i]), &Receiver::sampleCallback);
+
+        topic.subscribe(*sampleCallback);
+        list.append(sampleCallback);
+        arrayList.append(sampleCallback);
+
+        // Other allocations land between the List nodes in a process that
+        // has been running a while
+        MemoryAllocator::allocate(256);
+    }
+
+    // Publishing must not touch the allocator, however many subscribers
+    const size_t freeMemorySize = MemoryAllocator::getFreeMemorySize();
+
+    uint64_t elapsedTimeNs = UINT64_MAX;
+
+    for (uint32_t run = 0; run < nRuns; run++)
+    {
+        uint64_t startTimeNs = getBenchmarkTimeNs();
+
+        for (uint32_t i = 0; i < nPublishes; i++)
+        {
+            topic.publish(i);
+        }
+
+        uint64_t runElapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+        if (runElapsedTimeNs < elapsedTimeNs)
+        {
+            elapsedTimeNs = runElapsedTimeNs;
+        }
+    }
+
+    const bool isAllocationFree =
+                   (MemoryAllocator::getFreeMemorySize() == freeMemorySize);
+
+    printTimePerPublish("Topic::publish", elapsedTimeNs);
+
+    // The subscriber walk alone (no time stamping), through the old and new
+    // list types
+    printTimePerPublish("List<SampleCallback*> walk", dispatch(list));
+    printTimePerPublish("ArrayList<SampleCallback*, 8> walk",
+                        dispatch(arrayList));
+
+    // Every receiver saw every sample (3 x nRuns passes of 0..nPublishes-1)
+    const uint64_t nPublishesPerRun = nPublishes;
+    const uint64_t expectedSum =
+                  3 * nRuns * ((nPublishesPerRun * (nPublishesPerRun - 1)) / 2);
+
+    bool isSumCorrect = true;
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        isSumCorrect &= (receivers[i].getSum() == expectedSum);
+    }
+
+    return (UNIT_TEST_CASE_EQUAL(isAllocationFree, true) &
+            UNIT_TEST_CASE_EQUAL(isSumCorrect, true));
+}
+
+//------------------------------------------------------------------------------
+// Receiver public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicDispatchBenchmark::Receiver::Receiver() :
+    mySum(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Receiver public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicDispatchBenchmark::Receiver::sampleCallback(
+                                       const TopicSample<uint32_t>& sample)
+{
+    mySum += sample.data;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicDispatchBenchmark::Receiver::getSum() const
+{
+    return mySum;
+}
@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicRecorderLinuxBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicRecorderLinuxBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <unistd.h>
+
+#include <Test/Benchmark_Tests/TopicRecorderLinuxBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/CallbackFunctionParameter.h>
+#include <Plat4m_Core/System.h>
+#include <Plat4m_Core/Linux/TopicRecorderLinux.h>
+#include <Plat4m_Core/Linux/TopicReplayerLinux.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local types
+//------------------------------------------------------------------------------
+
+template <uint32_t N>
+struct Payload
+{
+    uint8_t bytes[N];
+};
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const char logFileName[] = "/tmp/plat4m_topic_recorder_benchmark.log";
+
+static const TopicBase::Id topicId = 1;
+
+static const uint32_t nSmallSamples = 200000;
+
+static const uint32_t nLargeSamples = 50000;
+
+static const uint32_t nSeeks = 10000;
+
+//------------------------------------------------------------------------------
+// Local variables
+//------------------------------------------------------------------------------
+
+static uint64_t nReplayedSamples = 0;
+
+static TimeStamp firstTimeStamp;
+
+static TimeStamp lastTimeStamp;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+template <uint32_t N>
+static void replaySampleCallback(const TopicSample<Payload<N>>& sample)
+{
+    nReplayedSamples += sample.data.bytes[0] + 1;
+}
+
+///
+/// @brief Records the given number of samples and prints the MB/s.
+///
+template <uint32_t N>
+static bool recordLog(const char* name, const uint32_t nSamples)
+{
+    TopicManager topicManager;
+
+    Topic<Payload<N>>& topic = Topic<Payload<N>>::create(topicId);
+
+    TopicRecorderLinux recorder;
+    recorder.addTopic<Payload<N>>(topicId);
+
+    Payload<N> sample;
+    memset(&sample, 0, sizeof(sample));
+
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    if (recorder.open(logFileName).getCode() !=
+                                           TopicRecorderLinux::ERROR_CODE_NONE)
+    {
+        return false;
+    }
+
+    firstTimeStamp = System::getTimeStamp();
+
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        topic.publish(sample);
+    }
+
+    lastTimeStamp = System::getTimeStamp();
+
+    recorder.close();
+
+    const uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    if (isValidPointer(name))
+    {
+        printBenchmarkThroughputResult(name,
+                                       recorder.getNBytes(),
+                                       elapsedTimeNs);
+    }
+
+    return ((recorder.getNRecords() == nSamples) &&
+            (recorder.getNDroppedRecords() == 0));
+}
+
+///
+/// @brief Replays the log as fast as possible and prints the MB/s.
+///
+template <uint32_t N>
+static bool replayLog(const char* name, const uint32_t nSamples)
+{
+    TopicManager topicManager;
+
+    Topic<Payload<N>>::subscribe(topicId,
+                                 createCallback(&replaySampleCallback<N>));
+
+    TopicReplayerLinux replayer;
+    replayer.addTopic<Payload<N>>(topicId);
+
+    nReplayedSamples = 0;
+
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    if (replayer.open(logFileName).getCode() !=
+                                           TopicReplayerLinux::ERROR_CODE_NONE)
+    {
+        return false;
+    }
+
+    const uint32_t nPublishedSamples =
+          replayer.replay(TopicReplayerLinux::PACING_AS_FAST_AS_POSSIBLE);
+
+    replayer.close();
+
+    const uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    printBenchmarkThroughputResult(name, replayer.getNBytes(), elapsedTimeNs);
+
+    return ((nPublishedSamples == nSamples) && (nReplayedSamples == nSamples));
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                        TopicRecorderLinuxBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicRecorderLinuxBenchmark::benchmarkRecord,
+    &TopicRecorderLinuxBenchmark::benchmarkReplay,
+    &TopicRecorderLinuxBenchmark::benchmarkSeek
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinuxBenchmark::TopicRecorderLinuxBenchmark() :
+    UnitTest("TopicRecorderLinuxBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicRecorderLinuxBenchmark::~TopicRecorderLinuxBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxBenchmark::benchmarkRecord()
+{
+    printBenchmarkThroughputHeader("Record, open to close");
+
+    bool isRecorded = recordLog<64>("64 B samples", nSmallSamples);
+    isRecorded &= recordLog<1024>("1 KB samples", nLargeSamples);
+
+    unlink(logFileName);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isRecorded, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxBenchmark::benchmarkReplay()
+{
+    printBenchmarkThroughputHeader("Replay as fast as possible");
+
+    bool isReplayed = recordLog<64>(0, nSmallSamples);
+    isReplayed &= replayLog<64>("64 B samples", nSmallSamples);
+
+    isReplayed &= recordLog<1024>(0, nLargeSamples);
+    isReplayed &= replayLog<1024>("1 KB samples", nLargeSamples);
+
+    unlink(logFileName);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isReplayed, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicRecorderLinuxBenchmark::benchmarkSeek()
+{
+    bool isSought = recordLog<64>(0, nSmallSamples);
+
+    TopicReplayerLinux replayer;
+    replayer.open(logFileName);
+
+    const TimeStamp spanTimeStamp = lastTimeStamp - firstTimeStamp;
+    const double spanTimeS = spanTimeStamp.timeS + (spanTimeStamp.timeNs / 1e9);
+
+    printBenchmarkHeader("Seek");
+
+    uint32_t nFound = 0;
+    const uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t i = 0; i < nSeeks; i++)
+    {
+        // Spread over the log in a scattered order
+        const double fraction = ((i * 7919) % nSeeks) /
+                                                   static_cast<double>(nSeeks);
+        const double offsetTimeS = spanTimeS * fraction;
+
+        TimeStamp timeStamp(static_cast<TimeSecondsSigned>(offsetTimeS),
+                            static_cast<TimeNanosecondsSigned>(
+                               (offsetTimeS - static_cast<TimeSecondsSigned>(
+                                                       offsetTimeS)) * 1e9));
+
+        if (replayer.seek(firstTimeStamp + timeStamp))
+        {
+            nFound++;
+        }
+    }
+
+    const uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    char name[64];
+    snprintf(name,
+             sizeof(name),
+             "%u chunks, %u samples",
+             replayer.getNChunks(),
+             nSmallSamples);
+
+    printBenchmarkResult(name, nSeeks, elapsedTimeNs);
+
+    replayer.close();
+    unlink(logFileName);
+
+    isSought &= (nFound == nSeeks);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isSought, true));
+}
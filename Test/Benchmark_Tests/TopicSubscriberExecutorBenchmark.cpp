@@ -0,0 +1,328 @@
+//------------------------------------------------------------------------------
+//       _______    __                           ___
+//      ||  ___ \  || |             __          //  |
+//      || |  || | || |   _______  || |__      //   |    _____  ___
+//      || |__|| | || |  // ___  | ||  __|    // _  |   ||  _ \/ _ \
+//      ||  ____/  || | || |  || | || |      // /|| |   || |\\  /\\ \
+//      || |       || | || |__|| | || |     // /_|| |_  || | || | || |
+//      || |       || |  \\____  | || |__  //_____   _| || | || | || |
+//      ||_|       ||_|       ||_|  \\___|       ||_|   ||_| ||_| ||_|
+//
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Benjamin Minerd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//------------------------------------------------------------------------------
+
+///
+/// @file TopicSubscriberExecutorBenchmark.cpp
+/// @author Ben Minerd
+/// @date 10/17/2026
+/// @brief TopicSubscriberExecutorBenchmark class source file.
+///
+
+//------------------------------------------------------------------------------
+// Include files
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <sched.h>
+
+#include <Test/Benchmark_Tests/TopicSubscriberExecutorBenchmark.h>
+#include <Test/Benchmark_Tests/Benchmark.h>
+#include <Plat4m_Core/Topic.h>
+#include <Plat4m_Core/TopicManager.h>
+#include <Plat4m_Core/TopicSubscriberThread.h>
+#include <Plat4m_Core/TopicSubscriberExecutor.h>
+#include <Plat4m_Core/CallbackMethodParameter.h>
+#include <Plat4m_Core/MemoryAllocator.h>
+#include <Plat4m_Core/System.h>
+
+using namespace std;
+using namespace Plat4m;
+
+//------------------------------------------------------------------------------
+// Local constants
+//------------------------------------------------------------------------------
+
+static const uint32_t nSubscribers = 64;
+
+static const uint32_t nQueueValues = 32;
+
+static const uint32_t nBursts = 100;
+
+static const TopicBase::Id topicId = 1;
+
+static const uint64_t drainTimeoutNs = 10000000000ULL;
+
+//------------------------------------------------------------------------------
+// Local typedefs
+//------------------------------------------------------------------------------
+
+typedef TopicSubscriberExecutorBenchmark::Receiver Receiver;
+
+typedef TopicSubscriberThread<uint64_t, nQueueValues> ThreadSubscriber;
+
+typedef TopicSubscriberExecutor<uint64_t, nQueueValues> ExecutorSubscriber;
+
+//------------------------------------------------------------------------------
+// Local functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+static uint32_t getNDeliveredSamples(const Receiver* receivers)
+{
+    uint32_t nSamples = 0;
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        nSamples += receivers[i].getNSamples();
+    }
+
+    return nSamples;
+}
+
+//------------------------------------------------------------------------------
+static bool publishBursts(const char* name,
+                          Topic<uint64_t>& topic,
+                          const Receiver* receivers)
+{
+    // Each burst fills every subscriber queue exactly, then waits for all of
+    // them to drain so no sample is dropped in either model
+    uint32_t nExpectedSamples = 0;
+    uint64_t startTimeNs = getBenchmarkTimeNs();
+
+    for (uint32_t burst = 0; burst < nBursts; burst++)
+    {
+        for (uint32_t i = 0; i < nQueueValues; i++)
+        {
+            topic.publish(getBenchmarkTimeNs());
+        }
+
+        nExpectedSamples += nQueueValues * nSubscribers;
+
+        while (getNDeliveredSamples(receivers) < nExpectedSamples)
+        {
+            if ((getBenchmarkTimeNs() - startTimeNs) > drainTimeoutNs)
+            {
+                return false;
+            }
+
+            sched_yield();
+        }
+    }
+
+    uint64_t elapsedTimeNs = getBenchmarkTimeNs() - startTimeNs;
+
+    uint64_t latencySumNs = 0;
+    uint64_t maxLatencyNs = 0;
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        latencySumNs += receivers[i].getLatencySumNs();
+
+        if (receivers[i].getMaxLatencyNs() > maxLatencyNs)
+        {
+            maxLatencyNs = receivers[i].getMaxLatencyNs();
+        }
+    }
+
+    printf("\n    %-40s %12s %10s %10s\n",
+           name,
+           "samples/s",
+           "mean (us)",
+           "max (us)");
+
+    char label[64];
+    snprintf(label, sizeof(label), "%u subscribers", nSubscribers);
+
+    printf("    %-40s %12.0f %10.1f %10.1f\n",
+           label,
+           static_cast<double>(nExpectedSamples) * 1e9 /
+                                        static_cast<double>(elapsedTimeNs),
+           static_cast<double>(latencySumNs) / nExpectedSamples / 1000.0,
+           static_cast<double>(maxLatencyNs) / 1000.0);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+template <typename SubscriberType>
+static void destroySubscribers(SubscriberType** subscribers)
+{
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        subscribers[i]->disable();
+        subscribers[i]->~SubscriberType();
+        MemoryAllocator::deallocate(subscribers[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Private static data members
+//------------------------------------------------------------------------------
+
+const UnitTest::TestCallbackFunction
+                   TopicSubscriberExecutorBenchmark::myTestCallbackFunctions[] =
+{
+    &TopicSubscriberExecutorBenchmark::benchmarkThreadSubscribers,
+    &TopicSubscriberExecutorBenchmark::benchmarkExecutorSubscribers
+};
+
+//------------------------------------------------------------------------------
+// Public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicSubscriberExecutorBenchmark::TopicSubscriberExecutorBenchmark() :
+    UnitTest("TopicSubscriberExecutorBenchmark",
+             myTestCallbackFunctions,
+             arraySize(myTestCallbackFunctions))
+{
+}
+
+//------------------------------------------------------------------------------
+// Public virtual destructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicSubscriberExecutorBenchmark::~TopicSubscriberExecutorBenchmark()
+{
+}
+
+//------------------------------------------------------------------------------
+// Public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberExecutorBenchmark::benchmarkThreadSubscribers()
+{
+    TopicManager topicManager;
+
+    Topic<uint64_t>& topic = Topic<uint64_t>::create(topicId);
+
+    Receiver receivers[nSubscribers];
+    ThreadSubscriber* subscribers[nSubscribers];
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        subscribers[i] = MemoryAllocator::allocate<ThreadSubscriber>(
+                    topicId,
+                    createCallback(&(receivers[i]), &Receiver::sampleCallback));
+        subscribers[i]->enable();
+    }
+
+    bool isDrained = publishBursts("TopicSubscriberThread (1 thread each)",
+                                   topic,
+                                   receivers);
+
+    destroySubscribers(subscribers);
+
+    return UNIT_TEST_REPORT(UNIT_TEST_CASE_EQUAL(isDrained, true));
+}
+
+//------------------------------------------------------------------------------
+bool TopicSubscriberExecutorBenchmark::benchmarkExecutorSubscribers()
+{
+    TopicManager topicManager;
+
+    Topic<uint64_t>& topic = Topic<uint64_t>::create(topicId);
+
+    Executor& executor = System::createExecutor();
+
+    Receiver receivers[nSubscribers];
+    ExecutorSubscriber* subscribers[nSubscribers];
+
+    for (uint32_t i = 0; i < nSubscribers; i++)
+    {
+        subscribers[i] = MemoryAllocator::allocate<ExecutorSubscriber>(
+                    topicId,
+                    createCallback(&(receivers[i]), &Receiver::sampleCallback),
+                    executor);
+        subscribers[i]->enable();
+    }
+
+    char name[64];
+    snprintf(name,
+             sizeof(name),
+             "TopicSubscriberExecutor (%u workers)",
+             executor.getNWorkers());
+
+    bool isDrained = publishBursts(name, topic, receivers);
+
+    destroySubscribers(subscribers);
+
+    return UNIT_TEST_REPORT(
+                   UNIT_TEST_CASE_EQUAL(isDrained, true) &
+                   UNIT_TEST_CASE_EQUAL(executor.getNRejectedTasks(), 0U));
+}
+
+//------------------------------------------------------------------------------
+// Receiver public constructors
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+TopicSubscriberExecutorBenchmark::Receiver::Receiver() :
+    myLatencySumNs(0),
+    myMaxLatencyNs(0),
+    myNSamples(0)
+{
+}
+
+//------------------------------------------------------------------------------
+// Receiver public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+void TopicSubscriberExecutorBenchmark::Receiver::sampleCallback(
+                                         const TopicSample<uint64_t>& sample)
+{
+    uint64_t latencyNs = getBenchmarkTimeNs() - sample.data;
+
+    myLatencySumNs += latencyNs;
+
+    if (latencyNs > myMaxLatencyNs)
+    {
+        myMaxLatencyNs = latencyNs;
+    }
+
+    // Publishes the latency totals to the benchmark thread
+    myNSamples.fetch_add(1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+uint32_t TopicSubscriberExecutorBenchmark::Receiver::getNSamples() const
+{
+    return myNSamples.load(std::memory_order_acquire);
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicSubscriberExecutorBenchmark::Receiver::getLatencySumNs() const
+{
+    return myLatencySumNs;
+}
+
+//------------------------------------------------------------------------------
+uint64_t TopicSubscriberExecutorBenchmark::Receiver::getMaxLatencyNs() const
+{
+    return myMaxLatencyNs;
+}
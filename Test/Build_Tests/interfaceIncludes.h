@@ -150,6 +150,7 @@
 #include <Plat4m_Core/ComProtocolPlat4m/Message.h>
 #include <Plat4m_Core/ComProtocolPlat4m/Packet.h>
 #include <Plat4m_Core/ComProtocolPlat4m/PacketFrameHandler.h>
+#include <Plat4m_Core/ComProtocolPlat4m/TransactionFrame.h>
 #include <Plat4m_Core/ImuLSM6DS0/ImuLSM6DS0.h>
 #include <Plat4m_Core/ImuLSM6DS3/ImuLSM6DS3.h>
 #include <Plat4m_Core/ImuServer/ImuClient.h>